@@ -0,0 +1,197 @@
+/*
+
+-Header_File SpiceTim.h ( CSPICE time formatting definitions )
+
+-Abstract
+
+   Perform CSPICE definitions for the SpiceTimePlan data type.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   TIME
+
+-Particulars
+
+   This header defines structures, typedefs and constants that may be
+   referenced in application code that calls the CSPICE compiled time
+   picture functions timpln_c and timoutv_c.
+
+
+      Structures
+      ==========
+
+         Name                  Description
+         ----                  ----------
+
+         SpiceTimePlan         Structure representing a time format
+                               picture that has been compiled by
+                               timpln_c for use by timoutv_c.
+
+                               Users should treat the members of
+                               this structure as private.  The
+                               members are:
+
+                                  direct:     Logical flag indicating
+                                              whether the picture can
+                                              be formatted without
+                                              calling timout_c.
+
+                                  system:     Time system code set by
+                                              a ::UTC, ::TDB or ::TDT
+                                              marker; zero if the
+                                              picture has none.
+
+                                  calendar:   Calendar code set by a
+                                              ::GCAL or ::MCAL marker;
+                                              zero if the picture has
+                                              none.
+
+                                  pad:        Time added to each epoch
+                                              when the picture calls
+                                              for rounding.
+
+                                  ntoks:      Number of compiled
+                                              tokens.
+
+                                  kind:       Token types.
+
+                                  begin:      Index in `pictur' of the
+                                              first character of each
+                                              literal token.
+
+                                  size:       Length of each literal
+                                              token, the number of
+                                              decimal places of a
+                                              seconds token, or the
+                                              style of a month name
+                                              token.
+
+                                  pictur:     Copy of the picture.
+
+         ConstSpiceTimePlan    A const SpiceTimePlan.
+
+
+      Constants
+      ==========
+
+         Name                  Description
+         ----                  ----------
+
+         SPICE_TIMPLN_MAXTOK   Maximum number of tokens in a compiled
+                               picture.
+
+         SPICE_TIMPLN_PICLEN   Maximum length of a picture, including
+                               the null terminator.  This matches the
+                               internal picture buffer of timout_c.
+
+         SPICE_TIMPLN_LITERAL  Token type codes stored in the `kind'
+         SPICE_TIMPLN_YEAR     member of SpiceTimePlan.
+         SPICE_TIMPLN_MONTH
+         SPICE_TIMPLN_DAY
+         SPICE_TIMPLN_DOY
+         SPICE_TIMPLN_HOUR
+         SPICE_TIMPLN_MINUTE
+         SPICE_TIMPLN_SECOND
+         SPICE_TIMPLN_MONNAM
+
+         SPICE_TIMPLN_UTC      Time system codes stored in the `system'
+         SPICE_TIMPLN_TDB      member of SpiceTimePlan.
+         SPICE_TIMPLN_TDT
+
+         SPICE_TIMPLN_GCAL     Calendar codes stored in the `calendar'
+         SPICE_TIMPLN_MCAL     member of SpiceTimePlan.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Restrictions
+
+   None.
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+*/
+
+#ifndef HAVE_SPICE_TIME_PLAN
+
+   #define HAVE_SPICE_TIME_PLAN
+
+
+   /*
+   Constants
+   */
+   #define SPICE_TIMPLN_MAXTOK      100
+   #define SPICE_TIMPLN_PICLEN      256
+
+   #define SPICE_TIMPLN_LITERAL     1
+   #define SPICE_TIMPLN_YEAR        2
+   #define SPICE_TIMPLN_MONTH       3
+   #define SPICE_TIMPLN_DAY         4
+   #define SPICE_TIMPLN_DOY         5
+   #define SPICE_TIMPLN_HOUR        6
+   #define SPICE_TIMPLN_MINUTE      7
+   #define SPICE_TIMPLN_SECOND      8
+   #define SPICE_TIMPLN_MONNAM      9
+
+   #define SPICE_TIMPLN_UTC         1
+   #define SPICE_TIMPLN_TDB         2
+   #define SPICE_TIMPLN_TDT         3
+
+   #define SPICE_TIMPLN_GCAL        1
+   #define SPICE_TIMPLN_MCAL        2
+
+
+   /*
+   Compiled time picture structure:
+   */
+
+   struct _SpiceTimePlan
+
+      { SpiceBoolean     direct;
+        SpiceInt         system;
+        SpiceInt         calendar;
+        SpiceDouble      pad;
+        SpiceInt         ntoks;
+        SpiceInt         kind   [SPICE_TIMPLN_MAXTOK];
+        SpiceInt         begin  [SPICE_TIMPLN_MAXTOK];
+        SpiceInt         size   [SPICE_TIMPLN_MAXTOK];
+        SpiceChar        pictur [SPICE_TIMPLN_PICLEN];  };
+
+   typedef struct _SpiceTimePlan  SpiceTimePlan;
+
+   typedef const SpiceTimePlan    ConstSpiceTimePlan;
+
+#endif
+
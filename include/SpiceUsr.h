@@ -113,6 +113,7 @@
    N.J. Bachman       (JPL)
    S.C. Krening       (JPL)
    E.D. Wright        (JPL)
+   Nabla Zero Labs
    
 -Restrictions
 
@@ -123,6 +124,10 @@
    
 -Version
 
+   -CSPICE Version 6.1.0, 18-OCT-2026 (NZL)
+
+      Now includes SpiceTim.h.
+
    -CSPICE Version 6.0.0, 07-FEB-2010 (NJB) 
 
       Now includes SpiceOsc.h.
@@ -256,6 +261,11 @@
    Include oscltx_c definitions.
    */
    #include "SpiceOsc.h"
+
+   /*
+   Include compiled time picture definitions.
+   */
+   #include "SpiceTim.h"
   
    /*
    Include CSPICE prototypes.
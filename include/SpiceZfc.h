@@ -1398,6 +1398,7 @@ extern int dafsih_(integer *handle, char *access, ftnlen access_len);
 /*:ref: failed_ 12 0 */
 /*:ref: isrchi_ 4 3 4 4 4 */
 /*:ref: zzdafgfr_ 14 11 4 13 4 4 13 4 4 4 12 124 124 */
+/*:ref: zzdafwbf_ 14 1 4 */
 /*:ref: zzddhcls_ 14 4 4 13 12 124 */
 /*:ref: setmsg_ 14 2 13 124 */
 /*:ref: errch_ 14 4 13 13 124 124 */
@@ -1442,7 +1443,8 @@ extern int dafcad_(integer *handle);
 /*:ref: moved_ 14 3 7 4 7 */
 /*:ref: dafhfn_ 14 3 4 13 124 */
 /*:ref: errch_ 14 4 13 13 124 124 */
-/*:ref: dafwda_ 14 4 4 4 4 7 */
+/*:ref: zzdafwba_ 14 4 4 4 4 7 */
+/*:ref: zzdafwbf_ 14 1 4 */
 /*:ref: dafus_ 14 5 7 4 4 7 4 */
 /*:ref: dafps_ 14 5 4 4 7 4 7 */
 /*:ref: dafrdr_ 14 6 4 4 4 4 7 12 */
@@ -1694,6 +1696,7 @@ extern int dafnrr_(integer *reads, integer *reqs);
 /*:ref: chkin_ 14 2 13 124 */
 /*:ref: sigerr_ 14 2 13 124 */
 /*:ref: chkout_ 14 2 13 124 */
+/*:ref: zzdafwbr_ 14 2 4 4 */
 /*:ref: minai_ 14 4 4 4 4 4 */
 /*:ref: zzdafgdr_ 14 4 4 4 7 12 */
 /*:ref: failed_ 12 0 */
@@ -1795,6 +1798,7 @@ extern int dasa2l_(integer *handle, integer *type__, integer *addrss, integer *c
 /*:ref: failed_ 12 0 */
 /*:ref: dashfs_ 14 9 4 4 4 4 4 4 4 4 4 */
 /*:ref: dasrri_ 14 5 4 4 4 4 4 */
+/*:ref: zzdascm_ 14 7 4 4 4 4 4 4 4 */
  
 extern int dasac_(integer *handle, integer *n, char *buffer, ftnlen buffer_len);
 /*:ref: return_ 12 0 */
@@ -1831,6 +1835,7 @@ extern int dasacr_(integer *handle, integer *n);
 /*:ref: dasioc_ 14 6 13 4 4 13 124 124 */
 /*:ref: dasiod_ 14 5 13 4 4 7 124 */
 /*:ref: dasufs_ 14 9 4 4 4 4 4 4 4 4 4 */
+/*:ref: zzdascmi_ 14 1 4 */
  
 extern int dasacu_(integer *comlun, char *begmrk, char *endmrk, logical *insbln, integer *handle, ftnlen begmrk_len, ftnlen endmrk_len);
 /*:ref: return_ 12 0 */
@@ -2097,6 +2102,7 @@ extern int dasrcr_(integer *handle, integer *n);
 /*:ref: dasioc_ 14 6 13 4 4 13 124 124 */
 /*:ref: dasiod_ 14 5 13 4 4 7 124 */
 /*:ref: dasufs_ 14 9 4 4 4 4 4 4 4 4 4 */
+/*:ref: zzdascmi_ 14 1 4 */
  
 extern int dasrdc_(integer *handle, integer *first, integer *last, integer *bpos, integer *epos, char *data, ftnlen data_len);
 /*:ref: chkin_ 14 2 13 124 */
@@ -2111,11 +2117,13 @@ extern int dasrdc_(integer *handle, integer *first, integer *last, integer *bpos
 extern int dasrdd_(integer *handle, integer *first, integer *last, doublereal *data);
 /*:ref: dasa2l_ 14 7 4 4 4 4 4 4 4 */
 /*:ref: dasrrd_ 14 5 4 4 4 4 7 */
+/*:ref: zzdasbxd_ 14 4 4 4 4 7 */
 /*:ref: failed_ 12 0 */
  
 extern int dasrdi_(integer *handle, integer *first, integer *last, integer *data);
 /*:ref: dasa2l_ 14 7 4 4 4 4 4 4 4 */
 /*:ref: dasrri_ 14 5 4 4 4 4 4 */
+/*:ref: zzdasbxi_ 14 4 4 4 4 4 */
 /*:ref: failed_ 12 0 */
  
 extern int dasrfr_(integer *handle, char *idword, char *ifname, integer *nresvr, integer *nresvc, integer *ncomr, integer *ncomc, ftnlen idword_len, ftnlen ifname_len);
@@ -2136,29 +2144,25 @@ extern int dasurd_(integer *handle, integer *recno, integer *first, integer *las
 extern int dasuri_(integer *handle, integer *recno, integer *first, integer *last, integer *datai);
 extern int dasurc_(integer *handle, integer *recno, integer *first, integer *last, char *datac, ftnlen datac_len);
 extern int daswbr_(integer *handle);
-/*:ref: return_ 12 0 */
 /*:ref: chkin_ 14 2 13 124 */
-/*:ref: sigerr_ 14 2 13 124 */
-/*:ref: chkout_ 14 2 13 124 */
-/*:ref: lnkini_ 14 2 4 4 */
 /*:ref: setmsg_ 14 2 13 124 */
 /*:ref: errint_ 14 3 13 4 124 */
 /*:ref: errhan_ 14 3 13 4 124 */
-/*:ref: lnkxsl_ 14 3 4 4 4 */
-/*:ref: lnkilb_ 14 3 4 4 4 */
-/*:ref: moved_ 14 3 7 4 7 */
-/*:ref: lnktl_ 4 2 4 4 */
-/*:ref: zzddhhlu_ 14 5 4 13 12 4 124 */
-/*:ref: failed_ 12 0 */
-/*:ref: dasiod_ 14 5 13 4 4 7 124 */
-/*:ref: lnkan_ 14 2 4 4 */
-/*:ref: zzdasgrd_ 14 3 4 4 7 */
-/*:ref: movei_ 14 3 4 4 4 */
-/*:ref: dasioi_ 14 5 13 4 4 4 124 */
-/*:ref: zzdasgri_ 14 3 4 4 4 */
-/*:ref: dasioc_ 14 6 13 4 4 13 124 124 */
+/*:ref: sigerr_ 14 2 13 124 */
+/*:ref: chkout_ 14 2 13 124 */
+/*:ref: zzdasbrd_ 14 5 4 4 4 4 7 */
+/*:ref: zzdasbri_ 14 5 4 4 4 4 4 */
+/*:ref: zzdasbrc_ 14 6 4 4 4 4 13 124 */
+/*:ref: return_ 12 0 */
 /*:ref: dassih_ 14 3 4 13 124 */
-/*:ref: lnkfsl_ 14 3 4 4 4 */
+/*:ref: failed_ 12 0 */
+/*:ref: zzdasbwd_ 14 3 4 4 7 */
+/*:ref: zzdasbwi_ 14 3 4 4 4 */
+/*:ref: zzdasbwc_ 14 4 4 4 13 124 */
+/*:ref: zzdasbud_ 14 5 4 4 4 4 7 */
+/*:ref: zzdasbui_ 14 5 4 4 4 4 4 */
+/*:ref: zzdasbuc_ 14 6 4 4 4 4 13 124 */
+/*:ref: zzdasbwb_ 14 1 4 */
  
 extern int dassdr_(integer *handle);
 /*:ref: return_ 12 0 */
@@ -2181,6 +2185,8 @@ extern int dassdr_(integer *handle);
 /*:ref: dasiod_ 14 5 13 4 4 7 124 */
 /*:ref: dasioi_ 14 5 13 4 4 4 124 */
 /*:ref: dasufs_ 14 9 4 4 4 4 4 4 4 4 4 */
+/*:ref: zzdasbiv_ 14 1 4 */
+/*:ref: zzdascmi_ 14 1 4 */
 /*:ref: dasllc_ 14 1 4 */
  
 extern int dastb_(integer *xfrlun, char *binfil, ftnlen binfil_len);
@@ -3209,6 +3215,9 @@ extern int eknelt_(integer *selidx, integer *row, integer *nelt);
 extern int ekgc_(integer *selidx, integer *row, integer *elment, char *cdata, logical *null, logical *found, ftnlen cdata_len);
 extern int ekgd_(integer *selidx, integer *row, integer *elment, doublereal *ddata, logical *null, logical *found);
 extern int ekgi_(integer *selidx, integer *row, integer *elment, integer *idata, logical *null, logical *found);
+extern int ekgcn_(integer *selidx, integer *row, integer *n, integer *elment, char *cdata, logical *null, logical *found, ftnlen cdata_len);
+extern int ekgdn_(integer *selidx, integer *row, integer *n, integer *elment, doublereal *ddata, logical *null, logical *found);
+extern int ekgin_(integer *selidx, integer *row, integer *n, integer *elment, integer *idata, logical *null, logical *found);
 /*:ref: return_ 12 0 */
 /*:ref: chkin_ 14 2 13 124 */
 /*:ref: sigerr_ 14 2 13 124 */
@@ -3219,6 +3228,7 @@ extern int ekgi_(integer *selidx, integer *row, integer *elment, integer *idata,
 /*:ref: dascls_ 14 1 4 */
 /*:ref: lnknxt_ 4 2 4 4 */
 /*:ref: zzekpgch_ 14 3 4 13 124 */
+/*:ref: zzekpqu_ 14 0 */
 /*:ref: lnknfn_ 4 1 4 */
 /*:ref: setmsg_ 14 2 13 124 */
 /*:ref: errhan_ 14 3 13 4 124 */
@@ -3245,6 +3255,7 @@ extern int ekgi_(integer *selidx, integer *row, integer *elment, integer *idata,
 /*:ref: appndi_ 14 2 4 4 */
 /*:ref: zzekstop_ 14 1 4 */
 /*:ref: zzeksdec_ 14 1 4 */
+/*:ref: zzekjmrs_ 14 0 */
 /*:ref: cleari_ 14 2 4 4 */
 /*:ref: zzekqcnj_ 14 3 4 4 4 */
 /*:ref: zzekqcon_ 14 24 4 13 7 4 4 13 4 13 4 4 13 4 13 4 4 4 4 7 4 124 124 124 124 124 */
@@ -4754,6 +4765,8 @@ extern int limbpt_(char *method, char *target, doublereal *et, char *fixref, cha
 /*:ref: mtxv_ 14 3 7 7 7 */
 /*:ref: vnorm_ 7 1 7 */
 /*:ref: clight_ 7 0 */
+/*:ref: zzcutget_ 14 1 4 */
+/*:ref: zztrkcut_ 14 1 4 */
  
 extern int ljucrs_(integer *n, char *input, char *output, ftnlen input_len, ftnlen output_len);
  
@@ -5212,13 +5225,13 @@ extern integer ordd_(doublereal *item, doublereal *set);
 /*:ref: chkout_ 14 2 13 124 */
  
 extern int orderc_(char *array, integer *ndim, integer *iorder, ftnlen array_len);
-/*:ref: swapi_ 14 2 4 4 */
+/*:ref: zzordc_ 14 4 13 4 4 124 */
  
 extern int orderd_(doublereal *array, integer *ndim, integer *iorder);
-/*:ref: swapi_ 14 2 4 4 */
+/*:ref: zzordd_ 14 3 7 4 4 */
  
 extern int orderi_(integer *array, integer *ndim, integer *iorder);
-/*:ref: swapi_ 14 2 4 4 */
+/*:ref: zzordi_ 14 3 4 4 4 */
  
 extern integer ordi_(integer *item, integer *set);
 /*:ref: return_ 12 0 */
@@ -6716,13 +6729,14 @@ extern int sharpr_(doublereal *rot);
 /*:ref: ucrss_ 14 3 7 7 7 */
  
 extern int shellc_(integer *ndim, char *array, ftnlen array_len);
+/*:ref: zzsortc_ 14 4 4 13 12 124 */
 /*:ref: swapc_ 14 4 13 13 124 124 */
  
 extern int shelld_(integer *ndim, doublereal *array);
-/*:ref: swapd_ 14 2 7 7 */
+/*:ref: zzsortd_ 14 2 4 7 */
  
 extern int shelli_(integer *ndim, integer *array);
-/*:ref: swapi_ 14 2 4 4 */
+/*:ref: zzsorti_ 14 2 4 4 */
  
 extern int shiftc_(char *in, char *dir, integer *nshift, char *fillc, char *out, ftnlen in_len, ftnlen dir_len, ftnlen fillc_len, ftnlen out_len);
 /*:ref: return_ 12 0 */
@@ -6774,6 +6788,8 @@ extern int sincpt_(char *method, char *target, doublereal *et, char *fixref, cha
 /*:ref: zzsuelin_ 14 1 4 */
 /*:ref: zzsudski_ 14 4 4 4 4 4 */
 /*:ref: zzsfxcor_ 14 22 200 200 200 4 7 13 12 12 12 12 13 4 4 4 4 7 7 7 7 12 124 124 */
+/*:ref: zzsfxbnr_ 14 1 4 */
+/*:ref: zzsfxbrn_ 14 17 200 200 200 4 7 13 12 12 12 12 13 4 4 4 4 124 124 */
  
 extern integer sizec_(char *cell, ftnlen cell_len);
 /*:ref: return_ 12 0 */
@@ -7150,7 +7166,7 @@ extern int spkcvt_(doublereal *trgsta, doublereal *trgepc, char *trgctr, char *t
  
 extern int spke01_(doublereal *et, doublereal *record, doublereal *state);
 /*:ref: return_ 12 0 */
-/*:ref: moved_ 14 3 7 4 7 */
+/*:ref: zzmdaev_ 14 4 7 4 7 7 */
  
 extern int spke02_(doublereal *et, doublereal *record, doublereal *xyzdot);
 /*:ref: return_ 12 0 */
@@ -7303,7 +7319,7 @@ extern int spke21_(doublereal *et, doublereal *record, doublereal *state);
 /*:ref: errint_ 14 3 13 4 124 */
 /*:ref: sigerr_ 14 2 13 124 */
 /*:ref: chkout_ 14 2 13 124 */
-/*:ref: moved_ 14 3 7 4 7 */
+/*:ref: zzmdaev_ 14 4 7 4 7 7 */
  
 extern int spkez_(integer *targ, doublereal *et, char *ref, char *abcorr, integer *obs, doublereal *starg, doublereal *lt, ftnlen ref_len, ftnlen abcorr_len);
 /*:ref: return_ 12 0 */
@@ -7439,6 +7455,8 @@ extern int spkltc_(integer *targ, doublereal *et, char *ref, char *abcorr, doubl
 /*:ref: vdot_ 7 2 7 7 */
 /*:ref: touchd_ 7 1 7 */
 /*:ref: vlcom_ 14 5 7 7 7 7 7 */
+/*:ref: zzltsget_ 14 6 4 4 12 7 12 7 */
+/*:ref: zzltssav_ 14 6 4 4 12 7 7 7 */
  
 extern int spkobj_(char *spk, integer *ids, ftnlen spk_len);
 /*:ref: return_ 12 0 */
@@ -7562,7 +7580,7 @@ extern int spkr01_(integer *handle, doublereal *descr, doublereal *et, doublerea
 /*:ref: chkin_ 14 2 13 124 */
 /*:ref: dafus_ 14 5 7 4 4 7 4 */
 /*:ref: dafgda_ 14 4 4 4 4 7 */
-/*:ref: lstltd_ 4 3 7 4 7 */
+/*:ref: zzmdaloc_ 14 6 4 4 4 4 7 4 */
 /*:ref: chkout_ 14 2 13 124 */
  
 extern int spkr02_(integer *handle, doublereal *descr, doublereal *et, doublereal *record);
@@ -7719,7 +7737,7 @@ extern int spkr21_(integer *handle, doublereal *descr, doublereal *et, doublerea
 /*:ref: errint_ 14 3 13 4 124 */
 /*:ref: sigerr_ 14 2 13 124 */
 /*:ref: chkout_ 14 2 13 124 */
-/*:ref: lstltd_ 4 3 7 4 7 */
+/*:ref: zzmdaloc_ 14 6 4 4 4 4 7 4 */
  
 extern int spks01_(integer *handle, integer *baddr, integer *eaddr, doublereal *begin, doublereal *end);
 /*:ref: return_ 12 0 */
@@ -9275,6 +9293,8 @@ extern int termpt_(char *method, char *ilusrc, char *target, doublereal *et, cha
 /*:ref: clight_ 7 0 */
 /*:ref: mtxv_ 14 3 7 7 7 */
 /*:ref: stelab_ 14 3 7 7 7 */
+/*:ref: zzcutget_ 14 1 4 */
+/*:ref: zztrkcut_ 14 1 4 */
  
 extern int texpyr_(integer *year);
 extern int tsetyr_(integer *year);
@@ -9958,7 +9978,7 @@ extern int wnvald_(integer *size, integer *n, doublereal *a);
 /*:ref: chkout_ 14 2 13 124 */
 /*:ref: ssized_ 14 2 4 7 */
 /*:ref: scardd_ 14 2 4 7 */
-/*:ref: wninsd_ 14 3 7 7 7 */
+/*:ref: zzsortp_ 14 2 4 7 */
  
 extern int wrencc_(integer *unit, integer *n, char *data, ftnlen data_len);
 /*:ref: return_ 12 0 */
@@ -10400,6 +10420,9 @@ extern int zzcorsxf_(logical *xmit, doublereal *dlt, doublereal *xform, doublere
 /*:ref: moved_ 14 3 7 4 7 */
 /*:ref: vsclip_ 14 2 7 7 */
  
+extern int zzcutset_(integer *first);
+extern int zzcutget_(integer *first);
+ 
 extern int zzcputim_(doublereal *tvec);
 /*:ref: chkout_ 14 2 13 124 */
  
@@ -10520,6 +10543,52 @@ extern int zzdafnfr_(integer *lun, char *idword, integer *nd, integer *ni, char
 /*:ref: sigerr_ 14 2 13 124 */
 /*:ref: chkout_ 14 2 13 124 */
  
+extern int zzdafwba_(integer *handle, integer *begin, integer *n, doublereal *data);
+extern int zzdafwbf_(integer *handle);
+extern int zzdafwbr_(integer *handle, integer *recno);
+/*:ref: dafwda_ 14 4 4 4 4 7 */
+ 
+extern int zzdasbrd_(integer *handle, integer *recno, integer *first, integer *last, doublereal *datad);
+extern int zzdasbri_(integer *handle, integer *recno, integer *first, integer *last, integer *datai);
+extern int zzdasbrc_(integer *handle, integer *recno, integer *first, integer *last, char *datac, ftnlen datac_len);
+extern int zzdasbwd_(integer *handle, integer *recno, doublereal *recd);
+extern int zzdasbwi_(integer *handle, integer *recno, integer *reci);
+extern int zzdasbwc_(integer *handle, integer *recno, char *recc, ftnlen recc_len);
+extern int zzdasbud_(integer *handle, integer *recno, integer *first, integer *last, doublereal *datad);
+extern int zzdasbui_(integer *handle, integer *recno, integer *first, integer *last, integer *datai);
+extern int zzdasbuc_(integer *handle, integer *recno, integer *first, integer *last, char *datac, ftnlen datac_len);
+extern int zzdasbwb_(integer *handle);
+extern int zzdasbiv_(integer *handle);
+extern int zzdasbxd_(integer *handle, integer *recno, integer *n, doublereal *datad);
+extern int zzdasbxi_(integer *handle, integer *recno, integer *n, integer *datai);
+extern int zzdasbsz_(integer *nrec);
+extern int zzdasnrr_(integer *reads, integer *reqs);
+/*:ref: chkin_ 14 2 13 124 */
+/*:ref: chkout_ 14 2 13 124 */
+/*:ref: setmsg_ 14 2 13 124 */
+/*:ref: errint_ 14 3 13 4 124 */
+/*:ref: sigerr_ 14 2 13 124 */
+/*:ref: failed_ 12 0 */
+/*:ref: return_ 12 0 */
+/*:ref: zzddhhlu_ 14 5 4 13 12 4 124 */
+/*:ref: zzdasgrd_ 14 3 4 4 7 */
+/*:ref: zzdasgri_ 14 3 4 4 4 */
+/*:ref: dasiod_ 14 5 13 4 4 7 124 */
+/*:ref: dasioi_ 14 5 13 4 4 4 124 */
+/*:ref: dasioc_ 14 6 13 4 4 13 124 124 */
+/*:ref: zzddhnfc_ 14 1 4 */
+/*:ref: zzddhnfo_ 14 7 4 13 4 4 4 12 124 */
+ 
+extern int zzdascm_(integer *handle, integer *fwrd, integer *type__, integer *addrss, integer *clbase, integer *clsize, integer *hiaddr);
+extern int zzdascmi_(integer *handle);
+/*:ref: dasrri_ 14 5 4 4 4 4 4 */
+/*:ref: chkin_ 14 2 13 124 */
+/*:ref: chkout_ 14 2 13 124 */
+/*:ref: setmsg_ 14 2 13 124 */
+/*:ref: errint_ 14 3 13 4 124 */
+/*:ref: sigerr_ 14 2 13 124 */
+/*:ref: failed_ 12 0 */
+ 
 extern int zzdasgrd_(integer *handle, integer *recno, doublereal *record);
 /*:ref: return_ 12 0 */
 /*:ref: chkin_ 14 2 13 124 */
@@ -12104,6 +12173,16 @@ extern int zzekixlk_(integer *handle, integer *coldsc, integer *key, integer *re
 /*:ref: sigerr_ 14 2 13 124 */
 /*:ref: chkout_ 14 2 13 124 */
  
+extern int zzekjmlg_(integer *method);
+extern int zzekjmnx_(logical *found, integer *lrvidx, integer *rrvidx);
+extern logical zzekjmpr_(integer *op, integer *lhan, integer *lsgdsc, integer *lcldsc, integer *lrvbas, integer *lnt, integer *ltab, integer *lnr, integer *rhan, integer *rsgdsc, integer *rcldsc, integer *rrvbas, integer *rnt, integer *rtab, integer *rnr);
+extern int zzekjmrs_(void);
+extern int zzekjmsp_(integer *nt1, integer *nt2, integer *nr1, integer *nr2, integer *nrows);
+/*:ref: zzeksrd_ 14 3 4 4 4 */
+/*:ref: zzekrsd_ 14 8 4 4 4 4 4 7 12 12 */
+/*:ref: zzekrsi_ 14 8 4 4 4 4 4 4 12 12 */
+/*:ref: failed_ 12 0 */
+ 
 extern int zzekjoin_(integer *jbase1, integer *jbase2, integer *njcnst, logical *active, integer *cpidx1, integer *clidx1, integer *elts1, integer *ops, integer *cpidx2, integer *clidx2, integer *elts2, integer *sthan, integer *stsdsc, integer *stdtpt, integer *dtpool, integer *dtdscs, integer *jbase3, integer *nrows);
 /*:ref: chkin_ 14 2 13 124 */
 /*:ref: setmsg_ 14 2 13 124 */
@@ -12116,6 +12195,7 @@ extern int zzekjoin_(integer *jbase1, integer *jbase2, integer *njcnst, logical
 /*:ref: zzeksupd_ 14 3 4 4 4 */
 /*:ref: zzekjprp_ 14 23 4 4 4 4 4 4 4 4 4 4 12 4 4 4 4 4 4 4 4 4 4 4 4 */
 /*:ref: zzekjnxt_ 14 2 12 4 */
+/*:ref: zzekjmsp_ 14 5 4 4 4 4 4 */
  
 extern int zzekjsqz_(integer *jrsbas);
 /*:ref: zzeksrd_ 14 3 4 4 4 */
@@ -12159,6 +12239,9 @@ extern int zzekjnxt_(logical *found, integer *rowvec);
 /*:ref: zzekjsrt_ 14 13 4 4 4 4 4 4 4 4 4 4 4 4 4 */
 /*:ref: zzekrcmp_ 12 12 4 4 4 4 4 4 4 4 4 4 4 4 */
 /*:ref: zzekvmch_ 12 13 4 12 4 4 4 4 4 4 4 4 4 4 4 */
+/*:ref: zzekjmpr_ 12 15 4 4 4 4 4 4 4 4 4 4 4 4 4 4 4 */
+/*:ref: zzekjmnx_ 14 3 12 4 4 */
+/*:ref: zzekjmlg_ 14 1 4 */
  
 extern int zzekkey_(integer *handle, integer *segdsc, integer *nrows, integer *ncnstr, integer *clidxs, integer *dsclst, integer *ops, integer *dtypes, char *chrbuf, integer *cbegs, integer *cends, doublereal *dvals, integer *ivals, logical *active, integer *key, integer *keydsc, integer *begidx, integer *endidx, logical *found, ftnlen chrbuf_len);
 /*:ref: return_ 12 0 */
@@ -12411,6 +12494,30 @@ extern int zzekpcol_(char *qcol, integer *eqryi, char *eqryc, char *table, char
 /*:ref: ekccnt_ 14 3 13 4 124 */
 /*:ref: ekcii_ 14 6 13 4 13 4 124 124 */
  
+extern int zzekpqp_(char *query, integer *qryid, logical *error, char *errmsg, ftnlen query_len, ftnlen errmsg_len);
+extern int zzekpqc_(integer *qryid, integer *prmidx, char *cval, ftnlen cval_len);
+extern int zzekpqd_(integer *qryid, integer *prmidx, doublereal *dval);
+extern int zzekpqi_(integer *qryid, integer *prmidx, integer *ival);
+extern int zzekpqx_(integer *qryid, integer *nmrows, logical *error, char *errmsg, ftnlen errmsg_len);
+extern int zzekpqr_(integer *qryid);
+extern int zzekpqu_(void);
+/*:ref: chkin_ 14 2 13 124 */
+/*:ref: chkout_ 14 2 13 124 */
+/*:ref: setmsg_ 14 2 13 124 */
+/*:ref: errint_ 14 3 13 4 124 */
+/*:ref: errch_ 14 4 13 13 124 124 */
+/*:ref: sigerr_ 14 2 13 124 */
+/*:ref: failed_ 12 0 */
+/*:ref: zzekreqi_ 14 4 4 13 4 124 */
+/*:ref: zzekqini_ 14 6 4 4 4 13 7 124 */
+/*:ref: zzekscan_ 14 17 13 4 4 4 4 4 4 4 7 13 4 4 12 13 124 124 124 */
+/*:ref: zzekpars_ 14 19 13 4 4 4 4 4 7 13 4 4 4 13 7 12 13 124 124 124 124 */
+/*:ref: zzeknres_ 14 9 13 4 13 12 13 4 124 124 124 */
+/*:ref: zzektres_ 14 10 13 4 13 7 12 13 4 124 124 124 */
+/*:ref: zzeksemc_ 14 9 13 4 13 12 13 4 124 124 124 */
+/*:ref: zzektcnv_ 14 6 13 7 12 13 124 124 */
+/*:ref: eksrch_ 14 8 4 13 7 4 12 13 124 124 */
+ 
 extern int zzekpdec_(char *decl, integer *pardsc, ftnlen decl_len);
 /*:ref: return_ 12 0 */
 /*:ref: chkin_ 14 2 13 124 */
@@ -13621,6 +13728,11 @@ extern int zzgfdigq_(doublereal *et, doublereal *dist);
 /*:ref: spkez_ 14 9 4 7 13 13 4 7 7 124 124 */
 /*:ref: vdot_ 7 2 7 7 */
 /*:ref: zzgfdiq_ 14 6 4 7 13 4 7 124 */
+/*:ref: zzgfdrsv_ 14 2 7 7 */
+ 
+extern int zzgfdrsv_(doublereal *et, doublereal *value);
+extern int zzgfdrgt_(doublereal *et, logical *found, doublereal *value);
+extern int zzgfdrcl_(void);
  
 extern int zzgfdsps_(integer *nlead, char *string, char *fmt, integer *ntrail, ftnlen string_len, ftnlen fmt_len);
 /*:ref: rtrim_ 4 2 13 124 */
@@ -13713,6 +13825,7 @@ extern int zzgfilgq_(doublereal *et, doublereal *angle);
 /*:ref: esrchc_ 4 5 13 4 13 124 124 */
 /*:ref: zzilusta_ 14 18 13 13 13 7 13 13 13 7 7 7 7 7 124 124 124 124 124 124 */
 /*:ref: illumg_ 14 19 13 13 13 7 13 13 13 7 7 7 7 7 7 124 124 124 124 124 124 */
+/*:ref: zzgfdrsv_ 14 2 7 7 */
  
 extern int zzgflong_(char *vecdef, char *method, char *target, char *ref, char *abcorr, char *obsrvr, char *dref, doublereal *dvec, char *crdsys, char *crdnam, char *relate, doublereal *refval, doublereal *tol, doublereal *adjust, U_fp udstep, U_fp udrefn, logical *rpt, U_fp udrepi, U_fp udrepu, U_fp udrepf, logical *bail, L_fp udbail, integer *mw, integer *nw, doublereal *work, doublereal *cnfine, doublereal *result, ftnlen vecdef_len, ftnlen method_len, ftnlen target_len, ftnlen ref_len, ftnlen abcorr_len, ftnlen obsrvr_len, ftnlen dref_len, ftnlen crdsys_len, ftnlen crdnam_len, ftnlen relate_len);
 /*:ref: return_ 12 0 */
@@ -13835,6 +13948,7 @@ extern int zzgfpax_(integer *xtarg, integer *xillmn, char *xabcor, integer *xobs
 /*:ref: vsclip_ 14 2 7 7 */
 /*:ref: dvsep_ 7 2 7 7 */
 /*:ref: zzgfpaq_ 14 7 7 4 4 4 13 7 124 */
+/*:ref: zzgfdrsv_ 14 2 7 7 */
  
 extern int zzgfref_(doublereal *refval);
 /*:ref: zzholdd_ 14 4 4 4 12 7 */
@@ -13945,6 +14059,7 @@ extern int zzgfrrx_(integer *xtarg, char *xabcor, integer *xobs, doublereal *xdt
 /*:ref: dvhat_ 14 2 7 7 */
 /*:ref: vdot_ 7 2 7 7 */
 /*:ref: zzgfrrq_ 14 6 7 4 4 13 7 124 */
+/*:ref: zzgfdrsv_ 14 2 7 7 */
  
 extern int zzgfsolv_(S_fp udcond, S_fp udstep, S_fp udrefn, logical *bail, L_fp udbail, logical *cstep, doublereal *step, doublereal *start, doublereal *finish, doublereal *tol, logical *rpt, S_fp udrepu, doublereal *result);
 /*:ref: return_ 12 0 */
@@ -13973,6 +14088,10 @@ extern int zzgfsolvx_(U_fp udfuns, S_fp udfunb, S_fp udstep, S_fp udrefn, logica
 /*:ref: errint_ 14 3 13 4 124 */
 /*:ref: brcktd_ 7 3 7 7 7 */
 /*:ref: zzwninsd_ 14 5 7 7 13 7 124 */
+/*:ref: gfrefn_ 14 5 7 7 12 12 7 */
+/*:ref: zzholdd_ 14 4 4 4 12 7 */
+/*:ref: zzgfdrcl_ 14 0 */
+/*:ref: zzgfdrgt_ 14 3 7 12 7 */
  
 extern int zzgfspq_(doublereal *et, integer *targ1, integer *targ2, doublereal *r1, doublereal *r2, integer *obs, char *abcorr, char *ref, doublereal *value, ftnlen abcorr_len, ftnlen ref_len);
 /*:ref: return_ 12 0 */
@@ -14015,6 +14134,7 @@ extern int zzgfspx_(char *xabcr, integer *xbod, char *yref, char *xref, integer
 /*:ref: dvsep_ 7 2 7 7 */
 /*:ref: dhfa_ 7 2 7 7 */
 /*:ref: zzgfspq_ 14 11 7 4 4 7 7 4 13 13 7 124 124 */
+/*:ref: zzgfdrsv_ 14 2 7 7 */
  
 extern int zzgfssin_(char *method, integer *trgid, doublereal *et, char *fixref, char *abcorr, integer *obsid, char *dref, integer *dctr, doublereal *dvec, doublereal *radii, doublereal *state, logical *found, ftnlen method_len, ftnlen fixref_len, ftnlen abcorr_len, ftnlen dref_len);
 /*:ref: return_ 12 0 */
@@ -14379,6 +14499,17 @@ extern int zzlexmet_(char *method, integer *maxn, integer *n, integer *begs, int
 /*:ref: lxqstr_ 14 7 13 13 4 4 4 124 124 */
 /*:ref: errch_ 14 4 13 13 124 124 */
  
+extern int zzltsset_(logical *enable);
+extern int zzltsget_(integer *targ, integer *refid, logical *xmit, doublereal *et, logical *found, doublereal *lt);
+extern int zzltssav_(integer *targ, integer *refid, logical *xmit, doublereal *et, doublereal *lt, doublereal *dlt);
+ 
+extern int zzmdaev_(doublereal *et, integer *maxdim, doublereal *dline, doublereal *state);
+ 
+extern int zzmdaloc_(integer *handle, integer *begin, integer *nrec, integer *offe, doublereal *et, integer *recno);
+/*:ref: dafgda_ 14 4 4 4 4 7 */
+/*:ref: failed_ 12 0 */
+/*:ref: lstltd_ 4 3 7 4 7 */
+ 
 extern int zzmkpc_(char *pictur, integer *b, integer *e, char *mark, char *pattrn, ftnlen pictur_len, ftnlen mark_len, ftnlen pattrn_len);
 /*:ref: lastnb_ 4 2 13 124 */
 /*:ref: zzrepsub_ 14 8 13 4 4 13 13 124 124 124 */
@@ -14392,17 +14523,11 @@ extern int zzmkspin_(integer *np, integer *plates, doublereal *vrtces, doublerea
 /*:ref: chkout_ 14 2 13 124 */
 /*:ref: dpmax_ 7 0 */
 /*:ref: dpmin_ 7 0 */
-/*:ref: zzinilnk_ 14 5 4 4 4 4 4 */
 /*:ref: cleari_ 14 2 4 4 */
 /*:ref: brcktd_ 7 3 7 7 7 */
 /*:ref: vpack_ 14 4 7 7 7 7 */
 /*:ref: zzgetvox_ 14 6 7 7 4 7 12 4 */
 /*:ref: errdp_ 14 3 13 7 124 */
-/*:ref: zzvoxcvo_ 14 6 4 4 4 4 4 4 */
-/*:ref: failed_ 12 0 */
-/*:ref: zzvox2id_ 4 2 4 4 */
-/*:ref: zzaddlnk_ 14 7 4 4 4 4 4 4 4 */
-/*:ref: zzuntngl_ 14 7 4 4 4 4 4 4 4 */
  
 extern int zzmobliq_(doublereal *et, doublereal *mob, doublereal *dmob);
 /*:ref: jyear_ 7 0 */
@@ -14905,6 +15030,10 @@ extern int zzsegbox_(doublereal *dskdsc, doublereal *boxctr, doublereal *maxr);
 /*:ref: sigerr_ 14 2 13 124 */
 /*:ref: chkout_ 14 2 13 124 */
  
+extern int zzsfxbst_(integer *n, doublereal *dvecs, doublereal *spoint, doublereal *trgepc, doublereal *srfvec, logical *found);
+extern int zzsfxbnr_(integer *n);
+extern int zzsfxbrn_(S_fp udnear, S_fp udmaxr, S_fp udrayx, integer *trgcde, doublereal *et, char *abcorr, logical *uselt, logical *usecn, logical *usestl, logical *xmit, char *fixref, integer *obscde, integer *dfrcde, integer *dclass, integer *dcentr, ftnlen abcorr_len, ftnlen fixref_len);
+ 
 extern int zzsfxcor_(S_fp udnear, S_fp udmaxr, S_fp udrayx, integer *trgcde, doublereal *et, char *abcorr, logical *uselt, logical *usecn, logical *usestl, logical *xmit, char *fixref, integer *obscde, integer *dfrcde, integer *dclass, integer *dcentr, doublereal *dvec, doublereal *spoint, doublereal *trgepc, doublereal *srfvec, logical *found, ftnlen abcorr_len, ftnlen fixref_len);
 /*:ref: return_ 12 0 */
 /*:ref: chkin_ 14 2 13 124 */
@@ -14995,6 +15124,14 @@ extern int zzraynp_(doublereal *vertex, doublereal *raydir, doublereal *et, doub
 extern int zzsizeok_(integer *size, integer *psize, integer *dsize, integer *offset, logical *ok, integer *n);
 /*:ref: rmaini_ 14 4 4 4 4 4 */
  
+extern int zzsortd_(integer *ndim, doublereal *array);
+extern int zzsorti_(integer *ndim, integer *array);
+extern int zzsortp_(integer *npair, doublereal *pairs);
+extern int zzsortc_(integer *ndim, char *array, logical *done, ftnlen array_len);
+extern int zzordd_(doublereal *array, integer *ndim, integer *iorder);
+extern int zzordi_(integer *array, integer *ndim, integer *iorder);
+extern int zzordc_(char *array, integer *ndim, integer *iorder, ftnlen array_len);
+ 
 extern int zzspkac0_(integer *targ, doublereal *et, char *ref, char *abcorr, integer *obs, doublereal *starg, doublereal *lt, doublereal *dlt, ftnlen ref_len, ftnlen abcorr_len);
 /*:ref: return_ 12 0 */
 /*:ref: chkin_ 14 2 13 124 */
@@ -15596,6 +15733,9 @@ extern int zztangnt_(integer *curve, doublereal *srcrad, integer *shape, integer
 /*:ref: errint_ 14 3 13 4 124 */
 /*:ref: zztanslv_ 14 11 200 200 200 12 7 7 7 7 7 7 12 */
 /*:ref: cardd_ 4 1 7 */
+/*:ref: zztrkwin_ 14 7 4 4 7 7 12 7 7 */
+/*:ref: zztansta_ 14 3 7 12 7 */
+/*:ref: zztrksav_ 14 3 4 4 7 */
  
 extern int zztanslv_(S_fp udcond, S_fp udstep, S_fp udrefn, logical *cstep, doublereal *step, doublereal *start, doublereal *finish, doublereal *tol, doublereal *result, doublereal *points, logical *endflg);
 /*:ref: return_ 12 0 */
@@ -15695,6 +15835,12 @@ extern logical zztpats_(integer *room, integer *nknown, char *known, char *meann
 /*:ref: orderc_ 14 4 13 4 4 124 */
 /*:ref: reordc_ 14 4 4 4 13 124 */
  
+extern int zztrkset_(logical *enable, doublereal *margin);
+extern int zztrkcut_(integer *cut);
+extern int zztrkwin_(integer *curve, integer *trgcde, doublereal *start, doublereal *finish, logical *track, doublereal *lo, doublereal *hi);
+extern int zztrksav_(integer *curve, integer *trgcde, doublereal *result);
+/*:ref: cardd_ 4 1 7 */
+ 
 extern int zztrvlnk_(integer *aval, integer *maxa, integer *pntrs, integer *cellsz, integer *cells, integer *maxb, integer *nb, integer *blist);
 /*:ref: return_ 12 0 */
 /*:ref: chkin_ 14 2 13 124 */
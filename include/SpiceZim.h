@@ -71,6 +71,43 @@
 
 -Version
 
+   -CSPICE Version 13.6.0, 19-OCT-2026 (NZL)
+
+       Added macro for
+
+          evsgpc_c
+
+   -CSPICE Version 13.5.0, 18-OCT-2026 (NZL)
+
+       Added macro for
+
+          gftfvv_c
+
+   -CSPICE Version 13.4.0, 18-OCT-2026 (NZL)
+
+       Added macro for
+
+          gfdstv_c
+
+   -CSPICE Version 13.3.0, 18-OCT-2026 (NZL)
+
+       Added macro for
+
+          spkezrv_c
+
+   -CSPICE Version 13.2.0, 18-OCT-2026 (NZL)
+
+       Added macro for
+
+          sincpv_c
+
+   -CSPICE Version 13.1.0, 18-OCT-2026 (NZL)
+
+       Added macros for
+
+          limbpr_c
+          termpr_c
+
    -CSPICE Version 13.0.0, 25-JAN-2017 (NJB) (EDW) 
 
        Defined new abbreviation macro CONST_IVEC3.
@@ -710,6 +747,14 @@ Macros that substitute for function calls:
         (   eul2xf_c ( CONST_VEC(eulang), (axisa), (axisb), (axisc),   \
                        (xform)                                     )  )
 
+
+   #define  evsgpc_c( geophs, nelts,  elems,  ref,    n,      ets,    \
+                      states                                  )       \
+                                                                       \
+        (   evsgpc_c ( CONST_VEC(geophs), (nelts), CONST_VEC(elems),   \
+                       (ref),    (n),     CONST_VEC(ets),   (states) ) )
+
+
    #define  fovray_c( inst,   raydir, rframe, abcorr, observer,        \
                       et,     visible       )                          \
                                                                        \
@@ -722,6 +767,16 @@ Macros that substitute for function calls:
                        (epoch),  (elems)                      )   )
 
 
+   #define  gfdstv_c( ntarg,  targs,  abcorr, obsrvr, relate,         \
+                      refval, step,   cnfine, maxn,   n,              \
+                      tindex, intvls                          )       \
+                                                                       \
+        (   gfdstv_c ( (ntarg),  CONST_IVEC(targs), (abcorr),          \
+                       (obsrvr), (relate),          (refval),          \
+                       (step),   (cnfine),          (maxn),            \
+                       (n),      (tindex),          (intvls)  )   )
+
+
    #define  gfevnt_c( udstep, udrefn, gquant, qnpars, lenvals,         \
                       qpnams, qcpars, qdpars, qipars, qlpars,          \
                       op,     refval, tol,    adjust, rpt,             \
@@ -771,6 +826,16 @@ Macros that substitute for function calls:
                       (step),          (nintvls), (cnfine), (result) )  )
 
 
+   #define  gftfvv_c( inst,   ntarg,  targs,  tshape, abcorr,          \
+                      obsrvr, step,   cnfine, maxn,   n,               \
+                      tindex, intvls                          )        \
+                                                                       \
+        (   gftfvv_c ( (inst),   (ntarg),  CONST_IVEC(targs),          \
+                       (tshape), (abcorr), (obsrvr),                   \
+                       (step),   (cnfine), (maxn),                     \
+                       (n),      (tindex), (intvls)          )   )
+
+
    #define  illum_c( target, et,    abcorr, obsrvr,                    \
                      spoint, phase, solar,  emissn )                   \
                                                                        \
@@ -842,6 +907,21 @@ Macros that substitute for function calls:
                       (srfpts)                                     )  )
 
 
+   #define  limbpr_c( method, target, et,     fixref,                  \
+                      abcorr, corloc, obsrvr, refvec,                  \
+                      rolstp, first,  ncuts,  schstp,                  \
+                      soltol, maxn,   npts,   points,                  \
+                      epochs, tangts                  )                \
+                                                                       \
+       (   limbpr_c( CONST_STR(method), CONST_STR(target),  (et),      \
+                     CONST_STR(fixref), CONST_STR(abcorr),             \
+                     CONST_STR(corloc), CONST_STR(obsrvr),             \
+                     CONST_VEC(refvec), (rolstp),           (first),   \
+                     (ncuts),           (schstp),           (soltol),  \
+                     (maxn),            (npts),             (points),  \
+                     (epochs),          (tangts)                   )  )
+
+
    #define  limbpt_c( method, target, et,     fixref,                  \
                       abcorr, corloc, obsrvr, refvec,                  \
                       rolstp, ncuts,  schstp, soltol,                  \
@@ -1174,6 +1254,17 @@ Macros that substitute for function calls:
                        (smajor),         (sminor)         )   )
 
 
+   #define  sincpv_c( method, target, et,     fixref,                  \
+                      abcorr, obsrvr, dref,   nrays,                   \
+                      dvecs,  spoint, trgepc, srfvec, found )          \
+                                                                       \
+       (   sincpv_c( CONST_STR(method), CONST_STR(target),  (et),      \
+                     CONST_STR(fixref), CONST_STR(abcorr),             \
+                     CONST_STR(obsrvr), CONST_STR(dref),    (nrays),   \
+                     CONST_VEC3(dvecs), (spoint),           (trgepc),  \
+                     (srfvec),          (found)                    )  )
+
+
    #define  spk14a_c( handle, ncsets, coeffs, epochs )                 \
                                                                        \
         (   spk14a_c ( (handle),           (ncsets),                   \
@@ -1236,6 +1327,12 @@ Macros that substitute for function calls:
                       (abcorr), (obsrvr), (state),  (lt)     )  )
 
 
+   #define  spkezrv_c( targ, n, et, ref, abcorr, obs, starg, lt )      \
+                                                                       \
+        (   spkezrv_c ( (targ),       (n),   CONST_VEC(et), (ref),     \
+                        (abcorr),     (obs), (starg),       (lt)  )  )
+
+
    #define  spkltc_c( targ, et, ref, abcorr, sobs, starg, lt, dlt )    \
                                                                        \
         (   spkltc_c ( (targ),   (et),  (ref),    (abcorr),            \
@@ -1420,6 +1517,22 @@ Macros that substitute for function calls:
                       (lenvals),        CONST_VOID(names)         )    )
 
 
+   #define  termpr_c( method, ilusrc, target, et,     fixref,          \
+                      abcorr, corloc, obsrvr, refvec,                  \
+                      rolstp, first,  ncuts,  schstp,                  \
+                      soltol, maxn,   npts,   points,                  \
+                      epochs, trmvcs                  )                \
+                                                                       \
+       (   termpr_c( CONST_STR(method), CONST_STR(ilusrc),             \
+                     CONST_STR(target), (et),                          \
+                     CONST_STR(fixref), CONST_STR(abcorr),             \
+                     CONST_STR(corloc), CONST_STR(obsrvr),             \
+                     CONST_VEC(refvec), (rolstp),           (first),   \
+                     (ncuts),           (schstp),           (soltol),  \
+                     (maxn),            (npts),             (points),  \
+                     (epochs),          (trmvcs)                   )  )
+
+
    #define  termpt_c( method, ilusrc, target, et,     fixref,          \
                       abcorr, corloc, obsrvr, refvec,                  \
                       rolstp, ncuts,  schstp, soltol,                  \
@@ -53,9 +53,130 @@
    W.L. Taber         (JPL)
    F.S. Turner        (JPL)
    E.D. Wright        (JPL)
+   Nabla Zero Labs
 
 -Version
 
+   -CSPICE Version 12.29.0, 19-OCT-2026 (NZL)
+
+      Added prototypes for
+
+         ekbndc_c
+         ekbndd_c
+         ekbndi_c
+         ekexec_c
+         ekpclr_c
+         ekprep_c
+
+   -CSPICE Version 12.28.0, 19-OCT-2026 (NZL)
+
+      Added prototypes for
+
+         ekgcn_c
+         ekgdn_c
+         ekgin_c
+
+   -CSPICE Version 12.27.0, 19-OCT-2026 (NZL)
+
+      Added prototype for
+
+         evsgpc_c
+
+   -CSPICE Version 12.26.0, 18-OCT-2026 (NZL)
+
+      Added prototype for
+
+         gftfvv_c
+
+   -CSPICE Version 12.25.0, 18-OCT-2026 (NZL)
+
+      Added prototype for
+
+         gfdstv_c
+
+   -CSPICE Version 12.24.0, 18-OCT-2026 (NZL)
+
+      Added prototypes for
+
+         gfoclp_c
+         wnpart_c
+
+   -CSPICE Version 12.23.0, 18-OCT-2026 (NZL)
+
+      Added prototype for
+
+         spkezrv_c
+
+   -CSPICE Version 12.22.0, 18-OCT-2026 (NZL)
+
+      Added prototype for
+
+         sincpv_c
+
+   -CSPICE Version 12.21.0, 18-OCT-2026 (NZL)
+
+      Added prototype for
+
+         tngtrk_c
+
+   -CSPICE Version 12.20.0, 18-OCT-2026 (NZL)
+
+      Added prototypes for
+
+         limbpr_c
+         termpr_c
+
+   -CSPICE Version 12.19.0, 18-OCT-2026 (NZL)
+
+      Added prototypes for
+
+         ekxpln_c
+         zzekjmst_c
+
+   -CSPICE Version 12.18.0, 18-OCT-2026 (NZL)
+
+      Added prototypes for
+
+         sce2cv_c
+         sce2sv_c
+         scs2ev_c
+         sct2ev_c
+         zzsc01ec_c
+         zzsc01en_c
+         zzsc01et_c
+         zzsc01ld_c
+         zzsc01ok_c
+         zzsc01te_c
+
+   -CSPICE Version 12.17.0, 18-OCT-2026 (NZL)
+
+      Added prototypes for
+
+         unitimv_c
+         zztdttdb_c
+
+   -CSPICE Version 12.16.0, 18-OCT-2026 (NZL)
+
+      Added prototypes for
+
+         timoutv_c
+         timpln_c
+         zztaitdt_c
+         zztaiutc_c
+         zztdbtdt_c
+         zztdttai_c
+
+   -CSPICE Version 12.15.0, 18-OCT-2026 (NZL)
+
+      Added prototypes for
+
+         str2etv_c
+         zzlskok_c
+         zztaitdb_c
+         zzutcfst_c
+         zzutcrdy_c
+         zzutctai_c
+
    -CSPICE Version 12.14.0, 05-JAN-2017 (EDW) (NJB)
 
       Added prototypes for
@@ -1671,6 +1792,21 @@ Include Files:
                                 SpiceInt            * recno  );
 
 
+   void              ekbndc_c ( SpiceInt              qryid,
+                                SpiceInt              prmidx,
+                                ConstSpiceChar      * cval   );
+
+
+   void              ekbndd_c ( SpiceInt              qryid,
+                                SpiceInt              prmidx,
+                                SpiceDouble           dval   );
+
+
+   void              ekbndi_c ( SpiceInt              qryid,
+                                SpiceInt              prmidx,
+                                SpiceInt              ival   );
+
+
    void              ekbseg_c ( SpiceInt              handle,
                                 ConstSpiceChar      * tabnam,
                                 SpiceInt              ncols,
@@ -1700,6 +1836,13 @@ Include Files:
                                 SpiceInt              recno );
 
 
+   void              ekexec_c ( SpiceInt            qryid,
+                                SpiceInt            lenout,
+                                SpiceInt          * nmrows,
+                                SpiceBoolean      * error,
+                                SpiceChar         * errmsg );
+
+
    void              ekffld_c ( SpiceInt            handle,
                                 SpiceInt            segno,
                                 SpiceInt          * rcptrs );
@@ -1737,6 +1880,34 @@ Include Files:
                                 SpiceBoolean      * found  );
 
 
+   void              ekgcn_c  ( SpiceInt            selidx,
+                                SpiceInt            row,
+                                SpiceInt            nrows,
+                                SpiceInt            elment,
+                                SpiceInt            lenout,
+                                void              * cvals,
+                                SpiceBoolean        nulls  [],
+                                SpiceBoolean        found  [] );
+
+
+   void              ekgdn_c  ( SpiceInt            selidx,
+                                SpiceInt            row,
+                                SpiceInt            nrows,
+                                SpiceInt            elment,
+                                SpiceDouble         dvals  [],
+                                SpiceBoolean        nulls  [],
+                                SpiceBoolean        found  [] );
+
+
+   void              ekgin_c  ( SpiceInt            selidx,
+                                SpiceInt            row,
+                                SpiceInt            nrows,
+                                SpiceInt            elment,
+                                SpiceInt            ivals  [],
+                                SpiceBoolean        nulls  [],
+                                SpiceBoolean        found  [] );
+
+
    void              ekifld_c ( SpiceInt            handle,
                                 ConstSpiceChar    * tabnam,
                                 SpiceInt            ncols,
@@ -1785,6 +1956,16 @@ Include Files:
                                 SpiceInt          * handle );
 
 
+   void              ekpclr_c ( SpiceInt            qryid );
+
+
+   void              ekprep_c ( ConstSpiceChar    * query,
+                                SpiceInt            lenout,
+                                SpiceInt          * qryid,
+                                SpiceBoolean      * error,
+                                SpiceChar         * errmsg );
+
+
    void              ekpsel_c ( ConstSpiceChar    * query,
                                 SpiceInt            msglen,
                                 SpiceInt            tablen,
@@ -1869,6 +2050,12 @@ Include Files:
    void              ekuef_c  ( SpiceInt            handle );
 
 
+   void              ekxpln_c ( SpiceInt              room,
+                                SpiceInt              lenout,
+                                SpiceInt            * n,
+                                void                * plan    );
+
+
    SpiceBoolean      elemc_c  ( ConstSpiceChar     * item,
                                 SpiceCell          * set   );
 
@@ -1973,6 +2160,15 @@ Include Files:
                                 SpiceDouble         xform [6][6] );
 
 
+   void              evsgpc_c ( ConstSpiceDouble    geophs [8],
+                                SpiceInt            nelts,
+                                ConstSpiceDouble    elems  [],
+                                ConstSpiceChar    * ref,
+                                SpiceInt            n,
+                                ConstSpiceDouble    ets    [],
+                                SpiceDouble         states [][6] );
+
+
    SpiceBoolean      exists_c ( ConstSpiceChar    * name );
 
 
@@ -2101,6 +2297,21 @@ Include Files:
 
 
 
+   void              gfdstv_c ( SpiceInt            ntarg,
+                                ConstSpiceInt       targs  [],
+                                ConstSpiceChar    * abcorr,
+                                ConstSpiceChar    * obsrvr,
+                                ConstSpiceChar    * relate,
+                                SpiceDouble         refval,
+                                SpiceDouble         step,
+                                SpiceCell         * cnfine,
+                                SpiceInt            maxn,
+                                SpiceInt          * n,
+                                SpiceInt            tindex [],
+                                SpiceDouble         intvls [][2] );
+
+
+
    void  gfevnt_c ( void             ( * udstep ) ( SpiceDouble       et,
                                                     SpiceDouble     * step ),
 
@@ -2236,6 +2447,23 @@ Include Files:
 
 
 
+   void              gfoclp_c ( ConstSpiceChar    * occtyp,
+                                ConstSpiceChar    * front,
+                                ConstSpiceChar    * fshape,
+                                ConstSpiceChar    * fframe,
+                                ConstSpiceChar    * back,
+                                ConstSpiceChar    * bshape,
+                                ConstSpiceChar    * bframe,
+                                ConstSpiceChar    * abcorr,
+                                ConstSpiceChar    * obsrvr,
+                                SpiceDouble         step,
+                                SpiceInt            npart,
+                                SpiceInt            ipart,
+                                SpiceCell         * cnfine,
+                                SpiceCell         * result );
+
+
+
    void              gfpa_c ( ConstSpiceChar     * target,
                               ConstSpiceChar     * illum,
                               ConstSpiceChar     * abcorr,
@@ -2379,6 +2607,20 @@ Include Files:
                                 SpiceCell        * result  );
 
 
+   void              gftfvv_c ( ConstSpiceChar    * inst,
+                                SpiceInt            ntarg,
+                                ConstSpiceInt       targs  [],
+                                ConstSpiceChar    * tshape,
+                                ConstSpiceChar    * abcorr,
+                                ConstSpiceChar    * obsrvr,
+                                SpiceDouble         step,
+                                SpiceCell         * cnfine,
+                                SpiceInt            maxn,
+                                SpiceInt          * n,
+                                SpiceInt            tindex [],
+                                SpiceDouble         intvls [][2] );
+
+
 
    void              gfudb_c (  void ( * udfuns ) ( SpiceDouble       et,
                                                     SpiceDouble     * value ),
@@ -2750,6 +2992,26 @@ Include Files:
                                  SpiceInt              plateIDs []     );
 
 
+   void              limbpr_c ( ConstSpiceChar    * method,
+                                ConstSpiceChar    * target,
+                                SpiceDouble         et,
+                                ConstSpiceChar    * fixref,
+                                ConstSpiceChar    * abcorr,
+                                ConstSpiceChar    * corloc,
+                                ConstSpiceChar    * obsrvr,
+                                ConstSpiceDouble    refvec[3],
+                                SpiceDouble         rolstp,
+                                SpiceInt            first,
+                                SpiceInt            ncuts,
+                                SpiceDouble         schstp,
+                                SpiceDouble         soltol,
+                                SpiceInt            maxn,
+                                SpiceInt            npts  [],
+                                SpiceDouble         points[][3],
+                                SpiceDouble         epochs[],
+                                SpiceDouble         tangts[][3]  );
+
+
    void              limbpt_c ( ConstSpiceChar    * method,
                                 ConstSpiceChar    * target,
                                 SpiceDouble         et,
@@ -3511,11 +3773,24 @@ Include Files:
                                 SpiceChar         * sclkch   );
 
 
+   void              sce2sv_c ( SpiceInt            sc,
+                                SpiceInt            n,
+                                ConstSpiceDouble  * et,
+                                SpiceInt            lenout,
+                                void              * sclkch   );
+
+
    void              sce2c_c  ( SpiceInt            sc,
                                 SpiceDouble         et,
                                 SpiceDouble       * sclkdp   );
 
 
+   void              sce2cv_c ( SpiceInt            sc,
+                                SpiceInt            n,
+                                ConstSpiceDouble  * et,
+                                SpiceDouble       * sclkdp   );
+
+
    void              sce2t_c  ( SpiceInt            sc,
                                 SpiceDouble         et,
                                 SpiceDouble       * sclkdp   );
@@ -3543,11 +3818,24 @@ Include Files:
                                 SpiceDouble       * et      );
 
 
+   void              scs2ev_c ( SpiceInt            sc,
+                                SpiceInt            n,
+                                SpiceInt            lenstr,
+                                const void        * sclkch,
+                                SpiceDouble       * et      );
+
+
    void              sct2e_c  ( SpiceInt            sc,
                                 SpiceDouble         sclkdp,
                                 SpiceDouble       * et      );
 
 
+   void              sct2ev_c ( SpiceInt            sc,
+                                SpiceInt            n,
+                                ConstSpiceDouble  * sclkdp,
+                                SpiceDouble       * et      );
+
+
    void              sctiks_c ( SpiceInt            sc,
                                 ConstSpiceChar    * clkstr,
                                 SpiceDouble       * ticks   );
@@ -3596,6 +3884,21 @@ Include Files:
                                 SpiceBoolean      * found         );
 
 
+   void              sincpv_c ( ConstSpiceChar    * method,
+                                ConstSpiceChar    * target,
+                                SpiceDouble         et,
+                                ConstSpiceChar    * fixref,
+                                ConstSpiceChar    * abcorr,
+                                ConstSpiceChar    * obsrvr,
+                                ConstSpiceChar    * dref,
+                                SpiceInt            nrays,
+                                ConstSpiceDouble    dvecs  [][3],
+                                SpiceDouble         spoint [][3],
+                                SpiceDouble         trgepc [],
+                                SpiceDouble         srfvec [][3],
+                                SpiceBoolean        found  []    );
+
+
    SpiceInt          size_c   ( SpiceCell         * size );
 
 
@@ -3767,6 +4070,16 @@ Include Files:
                                 SpiceDouble       * lt       );
 
 
+   void              spkezrv_c( ConstSpiceChar    * target,
+                                SpiceInt            n,
+                                ConstSpiceDouble    epochs [],
+                                ConstSpiceChar    * frame,
+                                ConstSpiceChar    * abcorr,
+                                ConstSpiceChar    * observer,
+                                SpiceDouble         states [][6],
+                                SpiceDouble         lts    []    );
+
+
    void              spkgeo_c ( SpiceInt            targ,
                                 SpiceDouble         et,
                                 ConstSpiceChar    * ref,
@@ -4123,6 +4436,12 @@ Include Files:
                                 SpiceDouble       * et   );
 
 
+   void              str2etv_c( SpiceInt            n,
+                                SpiceInt            lenstr,
+                                const void        * strs,
+                                SpiceDouble       * ets  );
+
+
    void              subpnt_c ( ConstSpiceChar    * method,
                                 ConstSpiceChar    * target,
                                 SpiceDouble         et,
@@ -4251,6 +4570,27 @@ Include Files:
                                  SpiceInt              plateIDs []     );
 
 
+   void              termpr_c ( ConstSpiceChar    * method,
+                                ConstSpiceChar    * ilusrc,
+                                ConstSpiceChar    * target,
+                                SpiceDouble         et,
+                                ConstSpiceChar    * fixref,
+                                ConstSpiceChar    * abcorr,
+                                ConstSpiceChar    * corloc,
+                                ConstSpiceChar    * obsrvr,
+                                ConstSpiceDouble    refvec[3],
+                                SpiceDouble         rolstp,
+                                SpiceInt            first,
+                                SpiceInt            ncuts,
+                                SpiceDouble         schstp,
+                                SpiceDouble         soltol,
+                                SpiceInt            maxn,
+                                SpiceInt            npts  [],
+                                SpiceDouble         points[][3],
+                                SpiceDouble         epochs[],
+                                SpiceDouble         trmvcs[][3]  );
+
+
    void              termpt_c ( ConstSpiceChar    * method,
                                 ConstSpiceChar    * ilusrc,
                                 ConstSpiceChar    * target,
@@ -4283,6 +4623,17 @@ Include Files:
                                 SpiceChar         * output );
 
 
+   void              timoutv_c ( ConstSpiceTimePlan * plan,
+                                 SpiceInt             n,
+                                 ConstSpiceDouble   * ets,
+                                 SpiceInt             lenout,
+                                 void               * output );
+
+
+   void              timpln_c ( ConstSpiceChar    * pictur,
+                                SpiceTimePlan     * plan    );
+
+
    void              tipbod_c ( ConstSpiceChar    * ref,
                                 SpiceInt            body,
                                 SpiceDouble         et,
@@ -4298,6 +4649,10 @@ Include Files:
    ConstSpiceChar  * tkvrsn_c ( ConstSpiceChar    * item );
 
 
+   void              tngtrk_c ( SpiceBoolean        enable,
+                                SpiceDouble         margin  );
+
+
    void              tparse_c ( ConstSpiceChar    * string,
                                 SpiceInt            lenout,
                                 SpiceDouble       * sp2000,
@@ -4381,6 +4736,13 @@ Include Files:
                                 ConstSpiceChar    * outsys );
 
 
+   void              unitimv_c ( SpiceInt              n,
+                                 ConstSpiceDouble    * epochs,
+                                 ConstSpiceChar      * insys,
+                                 ConstSpiceChar      * outsys,
+                                 SpiceDouble         * outs    );
+
+
    void              unload_c ( ConstSpiceChar   * file );
 
 
@@ -4651,6 +5013,12 @@ Include Files:
                                 SpiceCell          * c  );
 
 
+   void              wnpart_c ( SpiceCell          * window,
+                                SpiceInt             npart,
+                                SpiceInt             ipart,
+                                SpiceCell          * part   );
+
+
    SpiceBoolean      wnreld_c ( SpiceCell          * a,
                                 ConstSpiceChar     * op,
                                 SpiceCell          * b   );
@@ -4712,14 +5080,79 @@ Include Files:
                                  SpiceBoolean        init );
 
 
+   SpiceBoolean      zzekjmst_c( SpiceInt            step,
+                                 SpiceInt          * nstp,
+                                 SpiceInt            ntab   [2],
+                                 SpiceInt            nrows  [2],
+                                 SpiceInt            method [4],
+                                 SpiceInt          * nout      );
+
+
    SpiceBoolean      zzgfgeth_c ( void );
 
 
+   SpiceBoolean      zzlskok_c ( void );
+
+
    void              zzgfsavh_c( SpiceBoolean        status );
 
 
+   SpiceBoolean      zzsc01ec_c( SpiceDouble         et,
+                                 SpiceDouble       * sclkdp );
+
+
+   SpiceBoolean      zzsc01en_c( ConstSpiceChar    * sclkch,
+                                 SpiceDouble       * sclkdp );
+
+
+   SpiceBoolean      zzsc01et_c( SpiceDouble         et,
+                                 SpiceDouble       * sclkdp );
+
+
+   SpiceBoolean      zzsc01ld_c( SpiceInt            sc );
+
+
+   SpiceBoolean      zzsc01ok_c( SpiceInt            sc );
+
+
+   SpiceBoolean      zzsc01te_c( SpiceDouble         sclkdp,
+                                 SpiceDouble       * et     );
+
+
    void              zzsynccl_c( SpiceTransDir       xdir,
                                  SpiceCell         * cell );
 
 
+   SpiceDouble       zztaitdb_c( SpiceDouble         tai );
+
+
+   SpiceDouble       zztaitdt_c( SpiceDouble         tai );
+
+
+   void              zztaiutc_c( SpiceDouble         tai,
+                                 SpiceInt          * daynum,
+                                 SpiceDouble       * secs   );
+
+
+   SpiceDouble       zztdbtdt_c( SpiceDouble         tdb );
+
+
+   SpiceDouble       zztdttai_c( SpiceDouble         tdt );
+
+
+   SpiceDouble       zztdttdb_c( SpiceDouble         tdt );
+
+
+   void              zzutcfst_c( ConstSpiceChar    * str,
+                                 SpiceDouble       * et,
+                                 SpiceBoolean      * found );
+
+
+   SpiceBoolean      zzutcrdy_c( void );
+
+
+   SpiceDouble       zzutctai_c( SpiceInt            daynum,
+                                 SpiceDouble         secs   );
+
+
 #endif
@@ -0,0 +1,407 @@
+/*
+
+-Procedure bnchmda ( Benchmark type 1 and type 21 SPK evaluation )
+
+-Abstract
+
+   Time the reading and evaluation of SPK type 1 and type 21
+   (modified difference array) records by the current SPKR01, SPKE01,
+   SPKR21 and SPKE21, and by the N0066 versions of those routines,
+   and check that both produce the same states.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   SPK
+
+-Keywords
+
+   EPHEMERIS
+   UTILITY
+
+-Particulars
+
+   This program writes a scratch SPK file holding a type 1 segment
+   and a type 21 segment of NREC records each, with synthetic
+   difference lines.  For each segment it reads and evaluates the
+   record covering each of a number of epochs, first in increasing
+   order (a sweep) and then in random order, using
+
+      -  the reference routines OSPKR01, OSPKE01, OSPKR21 and
+         OSPKE21, which are the N0066 versions of SPKR01, SPKE01,
+         SPKR21 and SPKE21, and
+
+      -  the current routines, which locate the record through
+         ZZMDALOC and evaluate it through ZZMDAEV.
+
+   It prints the time taken by each.  It then compares the states
+   found by both at every 100th epoch, and prints the number of
+   those epochs at which they differ in any bit.  That number should
+   be zero.
+
+   To build the program, compile this file and the four reference
+   routines in this directory, and link them with the CSPICE library:
+
+      cc -Iinclude -o bnchmda src/bench_c/bnchmda.c
+         src/bench_c/ospk[er]*.c cspice.a -lm
+
+   The program takes two optional arguments: the number of epochs
+   per case (default 1000000) and the name of the scratch SPK file
+   (default bnchmda.bsp).  The scratch file is deleted at the end.
+
+-Examples
+
+   On a 5000-record segment of each type, with 10^6 epochs per
+   case, the program printed:
+
+      Type   Order        N0066 (s)   Current (s)   Differences
+      ----   ------       ---------   -----------   -----------
+         1   sweep             3.13          0.54             0
+         1   random           14.70         11.17             0
+        21   sweep             8.62          1.46             0
+        21   random           23.39         13.01             0
+
+   Random access is dominated by DAF record buffer misses on the
+   difference lines, which both versions read in the same way.
+
+-Restrictions
+
+   None.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 19-OCT-2026 (NZL)
+
+-&
+*/
+
+   #include <stdio.h>
+   #include <stdlib.h>
+   #include <string.h>
+   #include <time.h>
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+
+
+   /*
+   Local parameters
+   */
+   #define NREC            5000
+   #define STEP            3600.0
+   #define MAXD21          21
+   #define DLSZ01          71
+   #define DLSZ21          ( 4 * MAXD21 + 11 )
+   #define BODY01          2000001
+   #define BODY21          2000002
+   #define IDLEN           41
+
+
+   /*
+   Reference routines
+   */
+   int ospkr01_ ( integer *handle, doublereal *descr,
+                  doublereal *et,  doublereal *record );
+   int ospke01_ ( doublereal *et,  doublereal *record,
+                  doublereal *state );
+   int ospkr21_ ( integer *handle, doublereal *descr,
+                  doublereal *et,  doublereal *record );
+   int ospke21_ ( doublereal *et,  doublereal *record,
+                  doublereal *state );
+
+
+   /*
+   Static variables
+   */
+   static doublereal       dl01   [ NREC * DLSZ01 ];
+   static doublereal       dl21   [ NREC * DLSZ21 ];
+   static doublereal       epochs [ NREC ];
+
+
+   /*
+   Fill a difference line of maximum dimension `maxdim', with
+   reference epoch `tl'.  The KQMAX1 and KQ values use the full
+   dimension allowed.
+   */
+   static void filldl ( doublereal   * dl,
+                        SpiceInt       maxdim,
+                        doublereal     tl      )
+   {
+      SpiceInt                i;
+
+      dl[0] = tl;
+
+      for ( i = 0;  i < maxdim;  i++ )
+      {
+         dl[1+i] = STEP * (i+1)
+                   * ( 1.0 + 0.1 * ( rand()/(double)RAND_MAX - 0.5 ) );
+      }
+
+      for ( i = 0;  i < 6;  i++ )
+      {
+         dl[1+maxdim+i] = ( (i%2) ? 30.0 : 1.0e8 )
+                          * ( 1.0 + ( rand()/(double)RAND_MAX - 0.5 ) );
+      }
+
+      for ( i = 0;  i < 3*maxdim;  i++ )
+      {
+         dl[7+maxdim+i] = 1.0e-6 * ( rand()/(double)RAND_MAX - 0.5 )
+                          / ( 1 + i%maxdim );
+      }
+
+      dl[7 + 4*maxdim]  = (doublereal) ( maxdim     );
+      dl[8 + 4*maxdim]  = (doublereal) ( maxdim - 1 );
+      dl[9 + 4*maxdim]  = (doublereal) ( maxdim - 2 );
+      dl[10 + 4*maxdim] = (doublereal) ( maxdim - 3 );
+   }
+
+
+   /*
+   Return the epoch of case `i' of `n': in increasing order if
+   `order' is 0, and at random otherwise.
+   */
+   static doublereal epoch ( SpiceInt  order,
+                             SpiceInt  i,
+                             SpiceInt  n     )
+   {
+      doublereal              span;
+
+      span = NREC * STEP;
+
+      if ( order == 0 )
+      {
+         return (  1.0 + i * ( span - 2.0 ) / n  );
+      }
+
+      return (  span * ( rand() / (double)RAND_MAX )  );
+   }
+
+
+   int main ( int argc, char **argv )
+   {
+      /*
+      Local variables
+      */
+      SpiceChar               ident  [ IDLEN ];
+      ConstSpiceChar        * spk;
+
+      SpiceDouble             descr  [5];
+      SpiceDouble             first;
+      SpiceDouble             last;
+      SpiceDouble             et;
+      SpiceDouble             record [ DLSZ21 + 1 ];
+      SpiceDouble             snew   [6];
+      SpiceDouble             sold   [6];
+      SpiceDouble             told;
+      SpiceDouble             tnew;
+
+      SpiceInt                handle;
+      SpiceInt                i;
+      SpiceInt                n;
+      SpiceInt                ndiff;
+      SpiceInt                order;
+      SpiceInt                type;
+
+      SpiceBoolean            found;
+
+      clock_t                 c0;
+
+      integer                 body;
+      integer                 center;
+      integer                 dlsize;
+      integer                 fhan;
+      integer                 nrec;
+
+
+      n   = ( argc > 1 ) ? atoi( argv[1] ) : 1000000;
+      spk = ( argc > 2 ) ? argv[2]         : "bnchmda.bsp";
+
+      /*
+      Write the scratch SPK file.
+      */
+      srand ( 7 );
+
+      for ( i = 0;  i < NREC;  i++ )
+      {
+         epochs[i] = ( i + 1 ) * STEP;
+
+         filldl ( dl01 + DLSZ01*i, 15,     epochs[i] - 0.5*STEP );
+         filldl ( dl21 + DLSZ21*i, MAXD21, epochs[i] - 0.5*STEP );
+      }
+
+      if ( exists_c( spk ) )
+      {
+         remove ( spk );
+      }
+
+      spkopn_c ( spk, "bnchmda", 0, &handle );
+
+      fhan   = (integer) handle;
+      center = 10;
+      nrec   = NREC;
+      dlsize = DLSZ21;
+      first  = 0.0;
+      last   = epochs[NREC-1];
+
+      body   = BODY01;
+
+      spkw01_ ( &fhan,  &body, &center, "J2000", &first, &last, "TYPE 1",
+                &nrec,  dl01,  epochs,  5,       6                        );
+
+      body   = BODY21;
+
+      spkw21_ ( &fhan,  &body,  &center, "J2000", &first, &last, "TYPE 21",
+                &nrec,  &dlsize, dl21,   epochs,  5,      7                );
+
+      spkcls_c ( handle );
+
+      furnsh_c ( spk );
+
+      if ( failed_c() )
+      {
+         return 1;
+      }
+
+      printf ( "\n"
+         "   Type   Order        N0066 (s)   Current (s)   Differences\n"
+         "   ----   ------       ---------   -----------   -----------\n" );
+
+      for ( type = 1;  type <= 21;  type += 20 )
+      {
+         spksfs_c ( ( type == 1 ) ? BODY01 : BODY21,  0.5*last,  IDLEN,
+                    &handle,  descr,  ident,  &found                   );
+
+         fhan = (integer) handle;
+
+         for ( order = 0;  order < 2;  order++ )
+         {
+            /*
+            Time the reference routines.
+            */
+            srand ( 3 );
+
+            c0 = clock();
+
+            for ( i = 0;  i < n;  i++ )
+            {
+               et = epoch ( order, i, n );
+
+               if ( type == 1 )
+               {
+                  ospkr01_ ( &fhan, descr, &et, record );
+                  ospke01_ ( &et,   record, sold       );
+               }
+               else
+               {
+                  ospkr21_ ( &fhan, descr, &et, record );
+                  ospke21_ ( &et,   record, sold       );
+               }
+            }
+
+            told = (double)( clock() - c0 ) / CLOCKS_PER_SEC;
+
+            /*
+            Time the current routines.
+            */
+            srand ( 3 );
+
+            c0 = clock();
+
+            for ( i = 0;  i < n;  i++ )
+            {
+               et = epoch ( order, i, n );
+
+               if ( type == 1 )
+               {
+                  spkr01_ ( &fhan, descr, &et, record );
+                  spke01_ ( &et,   record, snew       );
+               }
+               else
+               {
+                  spkr21_ ( &fhan, descr, &et, record );
+                  spke21_ ( &et,   record, snew       );
+               }
+            }
+
+            tnew = (double)( clock() - c0 ) / CLOCKS_PER_SEC;
+
+            /*
+            Compare the states at every 100th epoch.
+            */
+            srand ( 3 );
+
+            ndiff = 0;
+
+            for ( i = 0;  i < n;  i++ )
+            {
+               et = epoch ( order, i, n );
+
+               if ( i % 100 == 0 )
+               {
+                  if ( type == 1 )
+                  {
+                     ospkr01_ ( &fhan, descr, &et, record );
+                     ospke01_ ( &et,   record, sold       );
+                     spkr01_  ( &fhan, descr, &et, record );
+                     spke01_  ( &et,   record, snew       );
+                  }
+                  else
+                  {
+                     ospkr21_ ( &fhan, descr, &et, record );
+                     ospke21_ ( &et,   record, sold       );
+                     spkr21_  ( &fhan, descr, &et, record );
+                     spke21_  ( &et,   record, snew       );
+                  }
+
+                  if ( memcmp( sold, snew, sizeof(sold) ) != 0 )
+                  {
+                     ++ndiff;
+                  }
+               }
+            }
+
+            printf ( "   %4d   %-6s     %11.2f   %11.2f   %11d\n",
+                     (int)type,  order ? "random" : "sweep",
+                     told,       tnew,
+                     (int)ndiff                              );
+         }
+      }
+
+      printf ( "\n" );
+
+      unload_c ( spk );
+      remove   ( spk );
+
+      return (  failed_c() ? 1 : 0  );
+   }
@@ -0,0 +1,477 @@
+/*
+
+-Procedure bnchsrt ( Benchmark SHELL* and ORDER* sorting routines )
+
+-Abstract
+
+   Time the sorting routines SHELLD, SHELLI, SHELLC, ORDERD, ORDERI
+   and ORDERC against their N0066 versions, on several kinds of
+   input, and check that both produce the same sorted output.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   None.
+
+-Keywords
+
+   SORT
+   UTILITY
+
+-Particulars
+
+   For each of four kinds of input of N elements,
+
+      random     values drawn at random,
+      7 values   values drawn at random from 7 distinct values,
+      sorted     values already in increasing order,
+      reversed   values in decreasing order,
+
+   this program sorts a copy of the same doubles, integers and
+   strings of length STRLEN with each of the six routines, first
+   with the reference routines OSHELLD, OSHELLI, OSHELLC, OORDERD,
+   OORDERI and OORDERC, which are the N0066 versions, and then with
+   the current routines.  It prints the time taken by each, and
+   whether the outputs agree:
+
+      -  The arrays sorted by SHELLD, SHELLI and SHELLC must equal
+         those sorted by the reference routines.
+
+      -  The arrays ordered by the order vectors of ORDERD, ORDERI
+         and ORDERC must equal those ordered by the reference order
+         vectors.  The order vectors themselves may differ where
+         elements are equal, since the reference routines are not
+         stable; the current order vectors must list the indices of
+         equal elements in increasing order.
+
+   To build the program, compile this file and the six reference
+   routines in this directory, and link them with the CSPICE
+   library:
+
+      cc -Iinclude -o bnchsrt src/bench_c/bnchsrt.c
+         src/bench_c/oshell?.c src/bench_c/oorder?.c cspice.a -lm
+
+   The program takes one optional argument: N (default 1000000).
+
+-Examples
+
+   With N = 1000000, the program printed:
+
+      Routine   Input       N0066 (s)   Current (s)   Check
+      -------   --------    ---------   -----------   -----
+      SHELLD    random           0.48          0.16   ok
+      SHELLI    random           0.45          0.04   ok
+      SHELLC    random           2.95          0.65   ok
+      ORDERD    random           1.16          0.28   ok
+      ORDERI    random           0.83          0.06   ok
+      ORDERC    random           3.89          0.52   ok
+      SHELLD    7 values         0.11          0.06   ok
+      SHELLI    7 values         0.09          0.02   ok
+      SHELLC    7 values         0.76          0.48   ok
+      ORDERD    7 values         0.26          0.20   ok
+      ORDERI    7 values         0.22          0.02   ok
+      ORDERC    7 values         1.47          0.34   ok
+      ...
+
+   Sorted and reversed inputs take at most 0.05 s for the numeric
+   routines either way.
+
+-Restrictions
+
+   None.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 19-OCT-2026 (NZL)
+
+-&
+*/
+
+   #include <stdio.h>
+   #include <stdlib.h>
+   #include <string.h>
+   #include <time.h>
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+
+
+   /*
+   Local parameters
+   */
+   #define STRLEN          16
+   #define NKIND           4
+
+
+   /*
+   Reference routines
+   */
+   int oshelld_ ( integer *ndim, doublereal *array );
+   int oshelli_ ( integer *ndim, integer *array );
+   int oshellc_ ( integer *ndim, char *array, ftnlen array_len );
+   int oorderd_ ( doublereal *array, integer *ndim, integer *iorder );
+   int oorderi_ ( integer *array, integer *ndim, integer *iorder );
+   int oorderc_ ( char *array, integer *ndim, integer *iorder,
+                  ftnlen array_len );
+
+
+   /*
+   Input kinds
+   */
+   static ConstSpiceChar * kinds [NKIND] =
+   {
+      "random", "7 values", "sorted", "reversed"
+   };
+
+
+   /*
+   Static variables
+   */
+   static doublereal     * dinp;
+   static doublereal     * dwrk;
+   static doublereal     * dref;
+
+   static integer        * iinp;
+   static integer        * iwrk;
+   static integer        * iref;
+
+   static char           * cinp;
+   static char           * cwrk;
+   static char           * cref;
+
+   static integer        * ordnew;
+   static integer        * ordref;
+
+   static integer          n;
+
+
+   /*
+   Return the number of seconds since `c0'.
+   */
+   static SpiceDouble secs ( clock_t  c0 )
+   {
+      return (  (SpiceDouble)( clock() - c0 ) / CLOCKS_PER_SEC  );
+   }
+
+
+   /*
+   Fill the inputs with values of the given kind.  The doubles,
+   integers and strings have the same order.
+   */
+   static void fill ( SpiceInt  kind )
+   {
+      SpiceInt                i;
+      long                    v;
+      char                    buf [ 32 ];
+
+      srand ( 11 );
+
+      for ( i = 0;  i < n;  i++ )
+      {
+         if ( kind == 0 )
+         {
+            v = ( (long)rand() << 16 ) ^ (long)rand();
+            v = ( v % 2000000000L ) - 1000000000L;
+         }
+         else if ( kind == 1 )
+         {
+            v = (long)( rand() % 7 ) * 100;
+         }
+         else if ( kind == 2 )
+         {
+            v = i;
+         }
+         else
+         {
+            v = n - i;
+         }
+
+         dinp[i] = (doublereal) v * 0.25;
+         iinp[i] = (integer)    v;
+
+         /*
+         Offset the string values so that they sort as the numbers.
+         */
+         sprintf ( buf, "%0*ld", STRLEN, v + 1000000000L );
+         memcpy  ( cinp + i*STRLEN, buf, STRLEN );
+      }
+   }
+
+
+   /*
+   Return SPICETRUE if the order vector `ord' lists the indices of
+   equal elements of `a' in increasing order.  `ord' holds Fortran
+   indices.
+   */
+   static SpiceBoolean stabld ( doublereal *a, integer *ord )
+   {
+      SpiceInt                i;
+
+      for ( i = 1;  i < n;  i++ )
+      {
+         if (  ( a[ord[i]-1] == a[ord[i-1]-1] )  &&  ( ord[i] < ord[i-1] )  )
+         {
+            return SPICEFALSE;
+         }
+      }
+
+      return SPICETRUE;
+   }
+
+
+   static SpiceBoolean stabli ( integer *a, integer *ord )
+   {
+      SpiceInt                i;
+
+      for ( i = 1;  i < n;  i++ )
+      {
+         if (  ( a[ord[i]-1] == a[ord[i-1]-1] )  &&  ( ord[i] < ord[i-1] )  )
+         {
+            return SPICEFALSE;
+         }
+      }
+
+      return SPICETRUE;
+   }
+
+
+   static SpiceBoolean stablc ( char *a, integer *ord )
+   {
+      SpiceInt                i;
+
+      for ( i = 1;  i < n;  i++ )
+      {
+         if (     ( memcmp( a + (ord[i]-1)*STRLEN,
+                            a + (ord[i-1]-1)*STRLEN, STRLEN ) == 0 )
+              &&  ( ord[i] < ord[i-1] )                              )
+         {
+            return SPICEFALSE;
+         }
+      }
+
+      return SPICETRUE;
+   }
+
+
+   /*
+   Print a line of the report.
+   */
+   static void report ( ConstSpiceChar  * name,
+                        SpiceInt          kind,
+                        SpiceDouble       told,
+                        SpiceDouble       tnew,
+                        SpiceBoolean      ok    )
+   {
+      printf ( "   %-7s   %-8s    %9.2f   %11.2f   %s\n",
+               name,  kinds[kind],  told,  tnew,  ok ? "ok" : "MISMATCH" );
+   }
+
+
+   int main ( int argc, char **argv )
+   {
+      /*
+      Local variables
+      */
+      SpiceBoolean            ok;
+      SpiceDouble             told;
+      SpiceDouble             tnew;
+      SpiceInt                i;
+      SpiceInt                kind;
+      SpiceInt                nbad;
+
+      clock_t                 c0;
+
+
+      n    = ( argc > 1 ) ? atoi( argv[1] ) : 1000000;
+      nbad = 0;
+
+      dinp   = (doublereal *) malloc ( n * sizeof(doublereal) );
+      dwrk   = (doublereal *) malloc ( n * sizeof(doublereal) );
+      dref   = (doublereal *) malloc ( n * sizeof(doublereal) );
+      iinp   = (integer    *) malloc ( n * sizeof(integer)    );
+      iwrk   = (integer    *) malloc ( n * sizeof(integer)    );
+      iref   = (integer    *) malloc ( n * sizeof(integer)    );
+      cinp   = (char       *) malloc ( n * STRLEN             );
+      cwrk   = (char       *) malloc ( n * STRLEN             );
+      cref   = (char       *) malloc ( n * STRLEN             );
+      ordnew = (integer    *) malloc ( n * sizeof(integer)    );
+      ordref = (integer    *) malloc ( n * sizeof(integer)    );
+
+      if (    !dinp || !dwrk || !dref || !iinp || !iwrk || !iref
+           || !cinp || !cwrk || !cref || !ordnew || !ordref      )
+      {
+         printf ( "Unable to allocate arrays of %d elements.\n", (int)n );
+         return 1;
+      }
+
+      printf ( "\n"
+               "   Routine   Input       N0066 (s)   Current (s)   Check\n"
+               "   -------   --------    ---------   -----------   -----\n" );
+
+      for ( kind = 0;  kind < NKIND;  kind++ )
+      {
+         fill ( kind );
+
+         /*
+         SHELLD
+         */
+         memcpy ( dref, dinp, n * sizeof(doublereal) );
+         c0   = clock();
+         oshelld_ ( &n, dref );
+         told = secs ( c0 );
+
+         memcpy ( dwrk, dinp, n * sizeof(doublereal) );
+         c0   = clock();
+         shelld_ ( &n, dwrk );
+         tnew = secs ( c0 );
+
+         ok = ( memcmp( dref, dwrk, n * sizeof(doublereal) ) == 0 );
+         report ( "SHELLD", kind, told, tnew, ok );
+         nbad += !ok;
+
+         /*
+         SHELLI
+         */
+         memcpy ( iref, iinp, n * sizeof(integer) );
+         c0   = clock();
+         oshelli_ ( &n, iref );
+         told = secs ( c0 );
+
+         memcpy ( iwrk, iinp, n * sizeof(integer) );
+         c0   = clock();
+         shelli_ ( &n, iwrk );
+         tnew = secs ( c0 );
+
+         ok = ( memcmp( iref, iwrk, n * sizeof(integer) ) == 0 );
+         report ( "SHELLI", kind, told, tnew, ok );
+         nbad += !ok;
+
+         /*
+         SHELLC
+         */
+         memcpy ( cref, cinp, n * STRLEN );
+         c0   = clock();
+         oshellc_ ( &n, cref, (ftnlen)STRLEN );
+         told = secs ( c0 );
+
+         memcpy ( cwrk, cinp, n * STRLEN );
+         c0   = clock();
+         shellc_ ( &n, cwrk, (ftnlen)STRLEN );
+         tnew = secs ( c0 );
+
+         ok = ( memcmp( cref, cwrk, n * STRLEN ) == 0 );
+         report ( "SHELLC", kind, told, tnew, ok );
+         nbad += !ok;
+
+         /*
+         ORDERD
+         */
+         c0   = clock();
+         oorderd_ ( dinp, &n, ordref );
+         told = secs ( c0 );
+
+         c0   = clock();
+         orderd_ ( dinp, &n, ordnew );
+         tnew = secs ( c0 );
+
+         ok = stabld ( dinp, ordnew );
+
+         for ( i = 0;  ok && ( i < n );  i++ )
+         {
+            ok = ( dinp[ordref[i]-1] == dinp[ordnew[i]-1] );
+         }
+
+         report ( "ORDERD", kind, told, tnew, ok );
+         nbad += !ok;
+
+         /*
+         ORDERI
+         */
+         c0   = clock();
+         oorderi_ ( iinp, &n, ordref );
+         told = secs ( c0 );
+
+         c0   = clock();
+         orderi_ ( iinp, &n, ordnew );
+         tnew = secs ( c0 );
+
+         ok = stabli ( iinp, ordnew );
+
+         for ( i = 0;  ok && ( i < n );  i++ )
+         {
+            ok = ( iinp[ordref[i]-1] == iinp[ordnew[i]-1] );
+         }
+
+         report ( "ORDERI", kind, told, tnew, ok );
+         nbad += !ok;
+
+         /*
+         ORDERC
+         */
+         c0   = clock();
+         oorderc_ ( cinp, &n, ordref, (ftnlen)STRLEN );
+         told = secs ( c0 );
+
+         c0   = clock();
+         orderc_ ( cinp, &n, ordnew, (ftnlen)STRLEN );
+         tnew = secs ( c0 );
+
+         ok = stablc ( cinp, ordnew );
+
+         for ( i = 0;  ok && ( i < n );  i++ )
+         {
+            ok = ( memcmp( cinp + (ordref[i]-1)*STRLEN,
+                           cinp + (ordnew[i]-1)*STRLEN, STRLEN ) == 0 );
+         }
+
+         report ( "ORDERC", kind, told, tnew, ok );
+         nbad += !ok;
+      }
+
+      printf ( "\n" );
+
+      free ( dinp   );
+      free ( dwrk   );
+      free ( dref   );
+      free ( iinp   );
+      free ( iwrk   );
+      free ( iref   );
+      free ( cinp   );
+      free ( cwrk   );
+      free ( cref   );
+      free ( ordnew );
+      free ( ordref );
+
+      return (  ( nbad > 0 ) ? 1 : 0  );
+   }
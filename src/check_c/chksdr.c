@@ -0,0 +1,286 @@
+/*
+
+-Procedure chksdr ( Check DAS reads after segregation )
+
+-Abstract
+
+   Check that the data of a DAS file open for writing read back
+   correctly through the same handle after DASSDR segregates the
+   file, and after DASACR and DASRCR add and remove comment records.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   DAS
+
+-Keywords
+
+   DAS
+   UTILITY
+
+-Particulars
+
+   DASSDR, DASACR and DASRCR move the records of a DAS file by direct
+   writes, bypassing the DAS record buffer, and rewrite its directory
+   records.  The buffer kept by ZZDASBUF and the cluster map kept by
+   ZZDASCM must then forget what they hold for the file, or later
+   reads through the same handle return the data of the records
+   that were formerly at the addresses read.
+
+   This program writes a scratch DAS file of NCLUS pairs of
+   clusters, alternating NDP double precision numbers and NINT
+   integers, so that the file is not segregated.  It reads all of
+   the data back, which loads the buffer and the cluster map, then
+
+      1)  segregates the file with DASSDR,
+
+      2)  adds NCOM comment records with DASACR,
+
+      3)  removes the comment records with DASRCR, and
+
+      4)  appends NCLUS more pairs of clusters,
+
+   reading all of the data back through the same handle after each
+   step.  Last, it closes the file, opens it for reading and reads
+   the data once more.  It prints the number of words that differ
+   from those written at each check, and returns a nonzero exit
+   status if any do.
+
+   To build the program, compile this file and link it with the
+   CSPICE library:
+
+      cc -Iinclude -o chksdr src/check_c/chksdr.c cspice.a -lm
+
+   The program takes one optional argument: the name of the scratch
+   DAS file (default chksdr.das).  The scratch file is deleted at
+   the end.
+
+-Examples
+
+   The program prints:
+
+      Check                         Bad words
+      --------------------------    ---------
+      written                               0
+      segregated                            0
+      comment records added                 0
+      comment records removed               0
+      data appended                         0
+      reopened                              0
+
+-Restrictions
+
+   None.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 19-OCT-2026 (NZL)
+
+-&
+*/
+
+   #include <stdio.h>
+   #include <string.h>
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+
+
+   /*
+   Local parameters
+   */
+   #define NCLUS           300
+   #define NDP             200
+   #define NINT            300
+   #define NCOM            3
+
+
+   /*
+   Static variables
+   */
+   static doublereal       dpdata [ 2 * NCLUS * NDP  ];
+   static doublereal       dpread [ 2 * NCLUS * NDP  ];
+   static integer          idata  [ 2 * NCLUS * NINT ];
+   static integer          iread  [ 2 * NCLUS * NINT ];
+
+
+   /*
+   Append clusters `c0' through `c0'+NCLUS-1 to the file.
+   */
+   static void append ( integer  handle,
+                        SpiceInt c0      )
+   {
+      SpiceInt                c;
+      SpiceInt                k;
+      integer                 n;
+
+      for ( c = c0;  c < c0 + NCLUS;  c++ )
+      {
+         for ( k = 0;  k < NDP;  k++ )
+         {
+            dpdata[c*NDP + k] = c * 1000.0 + k + 0.5;
+         }
+
+         for ( k = 0;  k < NINT;  k++ )
+         {
+            idata[c*NINT + k] = c * 100000 + k;
+         }
+
+         n = NDP;
+         dasadd_ ( &handle, &n, dpdata + c*NDP );
+
+         n = NINT;
+         dasadi_ ( &handle, &n, idata + c*NINT );
+      }
+   }
+
+
+   /*
+   Read the data of the first `nclus' clusters of each type, and
+   return the number of words that differ from those written.
+   */
+   static SpiceInt check ( integer         handle,
+                           SpiceInt        nclus,
+                           ConstSpiceChar * label  )
+   {
+      SpiceInt                k;
+      SpiceInt                nbad;
+      integer                 first;
+      integer                 last;
+
+      memset ( dpread, 0, sizeof(dpread) );
+      memset ( iread,  0, sizeof(iread)  );
+
+      first = 1;
+
+      last  = nclus * NDP;
+      dasrdd_ ( &handle, &first, &last, dpread );
+
+      last  = nclus * NINT;
+      dasrdi_ ( &handle, &first, &last, iread );
+
+      nbad = 0;
+
+      for ( k = 0;  k < nclus * NDP;  k++ )
+      {
+         nbad += ( dpread[k] != dpdata[k] );
+      }
+
+      for ( k = 0;  k < nclus * NINT;  k++ )
+      {
+         nbad += ( iread[k] != idata[k] );
+      }
+
+      if ( failed_c() )
+      {
+         nbad = nclus * ( NDP + NINT );
+         reset_c();
+      }
+
+      printf ( "   %-26s    %9d\n", label, (int)nbad );
+
+      return nbad;
+   }
+
+
+   int main ( int argc, char **argv )
+   {
+      /*
+      Local variables
+      */
+      ConstSpiceChar        * das;
+
+      SpiceInt                nbad;
+
+      integer                 handle;
+      integer                 n;
+      integer                 ncomr;
+
+
+      das = ( argc > 1 ) ? argv[1] : "chksdr.das";
+
+      erract_c ( "SET", 0, "RETURN" );
+
+      if ( exists_c( das ) )
+      {
+         remove ( das );
+      }
+
+      ncomr = 0;
+
+      dasonw_ ( (char *) das,  "CHK",  "chksdr",  &ncomr,  &handle,
+                (ftnlen) strlen(das),  3,  6                         );
+
+      if ( failed_c() )
+      {
+         return 1;
+      }
+
+      printf ( "\n"
+               "   Check                         Bad words\n"
+               "   --------------------------    ---------\n" );
+
+      append ( handle, 0 );
+
+      nbad  = check ( handle, NCLUS, "written" );
+
+      dassdr_ ( &handle );
+
+      nbad += check ( handle, NCLUS, "segregated" );
+
+      n = NCOM;
+      dasacr_ ( &handle, &n );
+
+      nbad += check ( handle, NCLUS, "comment records added" );
+
+      dasrcr_ ( &handle, &n );
+
+      nbad += check ( handle, NCLUS, "comment records removed" );
+
+      append ( handle, NCLUS );
+
+      nbad += check ( handle, 2*NCLUS, "data appended" );
+
+      dascls_ ( &handle );
+      dasopr_ ( (char *) das, &handle, (ftnlen) strlen(das) );
+
+      nbad += check ( handle, 2*NCLUS, "reopened" );
+
+      dascls_ ( &handle );
+      remove  ( das );
+
+      printf ( "\n" );
+
+      return (  ( nbad > 0 ) ? 1 : 0  );
+   }
@@ -49,9 +49,9 @@ static logical c_true = TRUE_;
 	    ftnlen, ftnlen), zzddhfnh_(char *, integer *, logical *, ftnlen), 
 	    zzdafnfr_(integer *, char *, integer *, integer *, char *, 
 	    integer *, integer *, integer *, char *, ftnlen, ftnlen, ftnlen), 
-	    zzddhcls_(integer *, char *, logical *, ftnlen), zzddhnfo_(
-	    integer *, char *, integer *, integer *, integer *, logical *, 
-	    ftnlen), zzddhhlu_(integer *, char *, logical *, integer *, 
+	    zzddhcls_(integer *, char *, logical *, ftnlen), zzdafwbf_(
+	    integer *), zzddhnfo_(integer *, char *, integer *, integer *, 
+	    integer *, logical *, ftnlen), zzddhhlu_(integer *, char *, logical *, integer *, 
 	    ftnlen), zzddhluh_(integer *, integer *, logical *), zzddhopn_(
 	    char *, char *, char *, integer *, ftnlen, ftnlen, ftnlen), 
 	    zzplatfm_(char *, char *, ftnlen, ftnlen);
@@ -3457,6 +3457,11 @@ L_dafcls:
 		ftnlen)3305)] - 1;
 	if (ftlnk[(i__1 = findex - 1) < 5000 && 0 <= i__1 ? i__1 : s_rnge(
 		"ftlnk", i__1, "dafah_", (ftnlen)3307)] == 0) {
+
+/*           Write any data of a new array held in the DAF write-behind */
+/*           buffer before the file is closed. */
+
+	    zzdafwbf_(handle);
 	    zzddhcls_(handle, "DAF", &c_false, (ftnlen)3);
 	    i__1 = nft - 1;
 	    for (i__ = findex; i__ <= i__1; ++i__) {
@@ -48,8 +48,7 @@ static integer c__128 = 128;
     static char dafnam[255];
     static integer ni;
     extern /* Subroutine */ int dafhof_(integer *), dafhfn_(integer *, char *,
-	     ftnlen), dafwda_(integer *, integer *, integer *, doublereal *), 
-	    dafhsf_(integer *, integer *, integer *), dafsih_(integer *, char 
+	     ftnlen), dafhsf_(integer *, integer *, integer *), dafsih_(integer *, char 
 	    *, ftnlen);
     static char ifname[60];
     extern /* Subroutine */ int cleard_(integer *, doublereal *), dafrcr_(
@@ -57,6 +56,8 @@ static integer c__128 = 128;
 	    *, integer *, integer *, doublereal *, logical *), dafrfr_(
 	    integer *, integer *, integer *, char *, integer *, integer *, 
 	    integer *, ftnlen);
+    extern /* Subroutine */ int zzdafwba_(integer *, integer *, integer *, 
+	    doublereal *), zzdafwbf_(integer *);
     static char namrec[1000];
     static logical staddg[20];
     extern /* Subroutine */ int dafwdr_(integer *, integer *, doublereal *), 
@@ -1707,6 +1708,12 @@ L_dafada:
 /*     Data can be added to a DAF in chunks of any size, so long */
 /*     as the chunks are added in the proper order. */
 
+/*     The data are held in a write-behind buffer and written to the */
+/*     file in whole records, at the latest when the array is ended by */
+/*     DAFENA, so adding small chunks costs little more than adding */
+/*     large ones. Errors writing the data may therefore be signaled */
+/*     by a later call to DAFADA or DAFENA. */
+
 /* $ Examples */
 
 /*     See example for DAFADA in the header of DAFANA. */
@@ -1814,15 +1821,15 @@ L_dafada:
 	return 0;
 
 /*     Start adding data at the first free address, then update that */
-/*     address to get ready for the next addition. */
+/*     address to get ready for the next addition. The data go to the */
+/*     write-behind buffer of ZZDAFWB, which writes them to the file */
+/*     in whole records when it is emptied. */
 
     } else if (*n >= 1) {
-	i__4 = stfree[(i__3 = p - 1) < 20 && 0 <= i__3 ? i__3 : s_rnge("stfr"
-		"ee", i__3, "dafana_", (ftnlen)1617)] + *n - 1;
-	dafwda_(&stfh[(i__1 = p - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge("stfh",
-		 i__1, "dafana_", (ftnlen)1617)], &stfree[(i__2 = p - 1) < 20 
-		&& 0 <= i__2 ? i__2 : s_rnge("stfree", i__2, "dafana_", (
-		ftnlen)1617)], &i__4, data);
+	zzdafwba_(&stfh[(i__1 = p - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge(
+		"stfh", i__1, "dafana_", (ftnlen)1617)], &stfree[(i__2 = p - 
+		1) < 20 && 0 <= i__2 ? i__2 : s_rnge("stfree", i__2, "dafana_"
+		, (ftnlen)1617)], n, data);
 	stfree[(i__1 = p - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge("stfree", 
 		i__1, "dafana_", (ftnlen)1618)] = stfree[(i__2 = p - 1) < 20 
 		&& 0 <= i__2 ? i__2 : s_rnge("stfree", i__2, "dafana_", (
@@ -2042,6 +2049,17 @@ L_dafena:
 	return 0;
     }
 
+/*     Write any data of the array still held in the write-behind */
+/*     buffer. The array must not be made visible if they cannot be */
+/*     written. */
+
+    zzdafwbf_(&stfh[(i__1 = p - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge("stfh", 
+	    i__1, "dafana_", (ftnlen)1853)]);
+    if (failed_()) {
+	chkout_("DAFENA", (ftnlen)6);
+	return 0;
+    }
+
 /*     No more data. The array ends just before the next free */
 /*     address. The summary should be complete except for the */
 /*     initial and final addresses of the data, of which we */
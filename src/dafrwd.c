@@ -630,7 +630,8 @@ static integer c__128 = 128;
 	    logical *), zzddhrcm_(integer *, integer *, integer *), zzdafgsr_(
 	    integer *, integer *, integer *, integer *, doublereal *, logical 
 	    *), zzddhhlu_(integer *, char *, logical *, integer *, ftnlen), 
-	    zzddhisn_(integer *, logical *, logical *);
+	    zzddhisn_(integer *, logical *, logical *), zzdafwbr_(integer *, 
+	    integer *);
     integer b, e;
     extern /* Subroutine */ int chkin_(char *, ftnlen), minai_(integer *, 
 	    integer *, integer *, integer *), moved_(doublereal *, integer *, 
@@ -1152,6 +1153,11 @@ L_dafgdr:
 	return 0;
     }
 
+/*     If the record holds data of a new array still in the DAF */
+/*     write-behind buffer, write them to the file first. */
+
+    zzdafwbr_(handle, recno);
+
 /*     Assume that the record will be found until proven otherwise. */
 
     *found = TRUE_;
@@ -1410,6 +1416,11 @@ L_dafgsr:
 	return 0;
     }
 
+/*     If the record holds data of a new array still in the DAF */
+/*     write-behind buffer, write them to the file first. */
+
+    zzdafwbr_(handle, recno);
+
 /*     Assume that the record will be found until proven otherwise. */
 
     *found = TRUE_;
@@ -1775,6 +1786,11 @@ L_dafrdr:
 	return 0;
     }
 
+/*     If the record holds data of a new array still in the DAF */
+/*     write-behind buffer, write them to the file first. */
+
+    zzdafwbr_(handle, recno);
+
 /*     Assume that the record will be found until proven otherwise. */
 
     *found = TRUE_;
@@ -2049,6 +2065,12 @@ L_dafwdr:
 	return 0;
     }
 
+/*     If the record holds data of a new array still in the DAF */
+/*     write-behind buffer, write them to the file first, so that */
+/*     they do not overwrite this record later. */
+
+    zzdafwbr_(handle, recno);
+
 /*     If the specified handle and record number match those of */
 /*     a buffered record, determine the location of that record */
 /*     within the buffer. */
@@ -9,7 +9,6 @@
 
 static integer c__1 = 1;
 static integer c__256 = 256;
-static integer c__2 = 2;
 
 /* $Procedure      DASA2L ( DAS, address to physical location ) */
 /* Subroutine */ int dasa2l_(integer *handle, integer *type__, integer *
@@ -43,7 +42,6 @@ static integer c__2 = 2;
 	    -1,-1,-1,-1,-1,-1,-1,-1 };
     static integer prev[3] = { 3,1,2 };
     static integer nw[3] = { 1024,128,256 };
-    static integer rngloc[3] = { 3,5,7 };
     static logical fast = FALSE_;
     static integer fidx = 0;
     static logical known = FALSE_;
@@ -58,11 +56,11 @@ static integer c__2 = 2;
 	    ftnlen, ftnlen);
 
     /* Local variables */
-    static integer free, nrec, i__, j, range[2];
+    static integer free, nrec, i__, j;
     extern /* Subroutine */ int chkin_(char *, ftnlen);
     static integer ncomc;
     static logical segok;
-    static integer ncomr, ndirs;
+    static integer ncomr;
     extern logical failed_(void);
     static integer ub, hiaddr;
     extern /* Subroutine */ int dasham_(integer *, char *, ftnlen);
@@ -82,6 +80,8 @@ static integer c__2 = 2;
 	    integer *, ftnlen), chkout_(char *, ftnlen), dasrri_(integer *, 
 	    integer *, integer *, integer *, integer *);
     static integer lstwrd[3], nresvr, ntypes, curtyp, prvtyp;
+    extern /* Subroutine */ int zzdascm_(integer *, integer *, integer *, 
+	    integer *, integer *, integer *, integer *);
 
 /* $ Abstract */
 
@@ -241,6 +241,12 @@ static integer c__2 = 2;
 /*     this routine once per cluster read, rather than once per */
 /*     physical record read. */
 
+/*     For files that are open for writing, or whose clusters are not */
+/*     segregated by data type, the cluster containing an address is */
+/*     found in a map of the file's clusters, kept in memory by */
+/*     ZZDASCM, rather than by reading the directory records of the */
+/*     file on every call. */
+
 /* $ Examples */
 
 /*     1)  Use this routine to read integers from a range of */
@@ -996,61 +1002,17 @@ static integer c__2 = 2;
 /*        If we're not looking at a "fast" file, find the cluster */
 /*        containing the input address, for the input data type. */
 
-/*        Find out which directory describes the cluster containing this */
-/*        word. To do this, we must traverse the directory list. The */
+/*        ZZDASCM keeps a map of the clusters of the file, which it */
+/*        builds from the directory records the first time it's */
+/*        needed. It reads the last directory records again when the */
+/*        input address lies beyond the clusters it has mapped, so that */
+/*        the map follows the growth of a file open for writing. The */
 /*        first directory record comes right after the last comment */
-/*        record. (Don't forget the file record when counting the */
-/*        predecessors of the directory record.) */
-
-/*        Note that we don't need to worry about not finding a directory */
-/*        record that contains the address we're looking for, since */
-/*        we've already checked that the address is in range. */
-
-	nrec = tbfwrd[(i__1 = fidx - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge(
-		"tbfwrd", i__1, "dasa2l_", (ftnlen)1043)];
-	ndirs = 1;
-	i__3 = rngloc[(i__2 = *type__ - 1) < 3 && 0 <= i__2 ? i__2 : s_rnge(
-		"rngloc", i__2, "dasa2l_", (ftnlen)1046)] + 1;
-	dasrri_(handle, &nrec, &rngloc[(i__1 = *type__ - 1) < 3 && 0 <= i__1 ?
-		 i__1 : s_rnge("rngloc", i__1, "dasa2l_", (ftnlen)1046)], &
-		i__3, range);
-	while(range[1] < *addrss) {
-
-/*           The record number of the next directory is the forward */
-/*           pointer in the current directory record. Update NREC with */
-/*           this pointer. Get the address range for the specified type */
-/*           covered by this next directory record. */
-
-	    dasrri_(handle, &nrec, &c__2, &c__2, &nxtrec);
-	    nrec = nxtrec;
-	    ++ndirs;
-	    i__3 = rngloc[(i__2 = *type__ - 1) < 3 && 0 <= i__2 ? i__2 : 
-		    s_rnge("rngloc", i__2, "dasa2l_", (ftnlen)1065)] + 1;
-	    dasrri_(handle, &nrec, &rngloc[(i__1 = *type__ - 1) < 3 && 0 <= 
-		    i__1 ? i__1 : s_rnge("rngloc", i__1, "dasa2l_", (ftnlen)
-		    1065)], &i__3, range);
-	    if (failed_()) {
-
-/*              Make sure the current table entry won't be found */
-/*              on a subsequent search. */
-
-		tbhan[(i__1 = fidx - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge(
-			"tbhan", i__1, "dasa2l_", (ftnlen)1076)] = 0;
-		return 0;
-	    }
-	}
+/*        record; ZZDASCM rebuilds the map if this changes. */
 
-/*        NREC is now the record number of the directory that contains */
-/*        the type descriptor for the address we're looking for. */
-
-/*        Our next task is to find the descriptor for the cluster */
-/*        containing the input address. To do this, we must examine the */
-/*        directory record in `left-to-right' order. As we do so, we'll */
-/*        keep track of the highest address of type TYPE occurring in */
-/*        the clusters whose descriptors we've seen. The variable HIADDR */
-/*        will contain this address. */
-
-	dasrri_(handle, &nrec, &c__1, &c__256, dirrec);
+	zzdascm_(handle, &tbfwrd[(i__1 = fidx - 1) < 20 && 0 <= i__1 ? i__1 :
+		 s_rnge("tbfwrd", i__1, "dasa2l_", (ftnlen)1043)], type__, 
+		addrss, clbase, clsize, &hiaddr);
 	if (failed_()) {
 
 /*           Make sure the current table entry won't be found on a */
@@ -1061,107 +1023,6 @@ static integer c__2 = 2;
 	    return 0;
 	}
 
-/*        In the process of finding the physical location corresponding */
-/*        to ADDRSS, we'll find the record number of the base of the */
-/*        cluster containing ADDRSS. We'll start out by initializing */
-/*        this value with the number of the first data record of the */
-/*        next cluster. */
-
-	*clbase = nrec + 1;
-
-/*        We'll initialize HIADDR with the value preceding the lowest */
-/*        address of type TYPE described by the current directory. */
-
-	hiaddr = dirrec[(i__2 = rngloc[(i__1 = *type__ - 1) < 3 && 0 <= i__1 ?
-		 i__1 : s_rnge("rngloc", i__1, "dasa2l_", (ftnlen)1121)] - 1) 
-		< 256 && 0 <= i__2 ? i__2 : s_rnge("dirrec", i__2, "dasa2l_", 
-		(ftnlen)1121)] - 1;
-
-/*        Initialize the number of records described by the last seen */
-/*        type descriptor. This number, when added to CLBASE, should */
-/*        yield the number of the first record of the current cluster; */
-/*        that's why it's initialized to 0. */
-
-	*clsize = 0;
-
-/*        Now find the descriptor for the cluster containing ADDRSS. */
-/*        Read descriptors until we get to the one that describes the */
-/*        record containing ADDRSS. Keep track of descriptor data */
-/*        types as we go. Also count the descriptors. */
-
-/*        At this point, HIADDR is less than ADDRSS, so the loop will */
-/*        always be executed at least once. */
-
-	prvtyp = prev[(i__1 = dirrec[8] - 1) < 3 && 0 <= i__1 ? i__1 : s_rnge(
-		"prev", i__1, "dasa2l_", (ftnlen)1140)];
-	dscloc = 10;
-	while(hiaddr < *addrss) {
-	    if (dscloc > 256) {
-
-/*              This situation shouldn't occur, but it might if the */
-/*              DAS file is corrupted. */
-
-/*              Make sure the current table entry won't be found */
-/*              on a subsequent search. */
-
-		tbhan[(i__1 = fidx - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge(
-			"tbhan", i__1, "dasa2l_", (ftnlen)1153)] = 0;
-		chkin_("DASA2L", (ftnlen)6);
-		setmsg_("Directory record # in DAS file with handle # is pro"
-			"bably corrupted. No high cluster address at or above"
-			" the input address # was found, though it should hav"
-			"e been. High address was #. Data type was #.", (
-			ftnlen)199);
-		errint_("#", &nrec, (ftnlen)1);
-		errint_("#", handle, (ftnlen)1);
-		errint_("#", addrss, (ftnlen)1);
-		errint_("#", &hiaddr, (ftnlen)1);
-		errint_("#", type__, (ftnlen)1);
-		sigerr_("SPICE(BADDASDIRECTORY)", (ftnlen)22);
-		chkout_("DASA2L", (ftnlen)6);
-		return 0;
-	    }
-
-/*           Update CLBASE so that it is the record number of the */
-/*           first record of the current cluster. */
-
-	    *clbase += *clsize;
-
-/*           Find the type of the current descriptor. */
-
-	    if (dirrec[(i__1 = dscloc - 1) < 256 && 0 <= i__1 ? i__1 : s_rnge(
-		    "dirrec", i__1, "dasa2l_", (ftnlen)1180)] > 0) {
-		curtyp = next[(i__1 = prvtyp - 1) < 3 && 0 <= i__1 ? i__1 : 
-			s_rnge("next", i__1, "dasa2l_", (ftnlen)1181)];
-	    } else {
-		curtyp = prev[(i__1 = prvtyp - 1) < 3 && 0 <= i__1 ? i__1 : 
-			s_rnge("prev", i__1, "dasa2l_", (ftnlen)1183)];
-	    }
-
-/*           Forgetting to update PRVTYP is a Very Bad Thing (VBT). */
-
-	    prvtyp = curtyp;
-
-/*           If the current descriptor is of the type we're interested */
-/*           in, update the highest address count. */
-
-	    if (curtyp == *type__) {
-		hiaddr += nw[(i__1 = *type__ - 1) < 3 && 0 <= i__1 ? i__1 : 
-			s_rnge("nw", i__1, "dasa2l_", (ftnlen)1196)] * (i__3 =
-			 dirrec[(i__2 = dscloc - 1) < 256 && 0 <= i__2 ? i__2 
-			: s_rnge("dirrec", i__2, "dasa2l_", (ftnlen)1196)], 
-			abs(i__3));
-	    }
-
-/*           Compute the number of records described by the current */
-/*           descriptor. Update the descriptor location. */
-
-	    *clsize = (i__2 = dirrec[(i__1 = dscloc - 1) < 256 && 0 <= i__1 ? 
-		    i__1 : s_rnge("dirrec", i__1, "dasa2l_", (ftnlen)1203)], 
-		    abs(i__2));
-	    ++dscloc;
-	}
-
 /*        At this point, the variables */
 
 /*           CLBASE */
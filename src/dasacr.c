@@ -48,7 +48,7 @@ static integer c__256 = 256;
 	     dassih_(integer *, char *, ftnlen), dasioi_(char *, integer *, 
 	    integer *, integer *, ftnlen);
     integer lastla[3];
-    extern /* Subroutine */ int daswbr_(integer *);
+    extern /* Subroutine */ int daswbr_(integer *), zzdascmi_(integer *);
     integer lindex;
     extern /* Subroutine */ int dasufs_(integer *, integer *, integer *, 
 	    integer *, integer *, integer *, integer *, integer *, integer *);
@@ -498,6 +498,11 @@ static integer c__256 = 256;
 	}
     }
 
+/*     The directory records of the file have moved.  Discard the map */
+/*     of the file's clusters kept for DASA2L. */
+
+    zzdascmi_(handle);
+
 /*     Update the file summary.  The number of comment records and the */
 /*     number of the first free record have been incremented by N. */
 /*     The numbers of the records containing the last descriptor of each */
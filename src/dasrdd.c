@@ -25,6 +25,9 @@ static integer c__1 = 1;
     integer clbase;
     extern /* Subroutine */ int dasrrd_(integer *, integer *, integer *, 
 	    integer *, doublereal *);
+    integer nrec;
+    extern /* Subroutine */ int zzdasbxd_(integer *, integer *, integer *, 
+	    doublereal *);
     integer clsize, wordno;
 
 /* $ Abstract */
@@ -121,6 +124,9 @@ static integer c__1 = 1;
 /*     data in a DAS file.  This data is logically structured as a */
 /*     one-dimensional array of double precision numbers. */
 
+/*     Whole records of a long read are read directly into DATA, and */
+/*     do not replace the records held by the DAS record buffer. */
+
 /* $ Examples */
 
 /*     1)  Create the new DAS file TEST.DAS and add 200 double */
@@ -305,14 +311,25 @@ static integer c__1 = 1;
 	if (recno < clbase + clsize) {
 
 /*           We can continue reading from the current */
-/*           cluster. */
+/*           cluster.  If at least 8 whole records of the cluster */
+/*           remain to be read, read them directly into DATA; */
+/*           otherwise read one record through the record buffer. */
 
 /* Computing MIN */
-	    i__1 = numdp - nread;
-	    n = min(i__1,128);
-	    dasrrd_(handle, &recno, &c__1, &n, &data[nread]);
-	    nread += n;
-	    ++recno;
+	    i__1 = (numdp - nread) / 128, i__2 = clbase + clsize - recno;
+	    nrec = min(i__1,i__2);
+	    if (nrec >= 8) {
+		zzdasbxd_(handle, &recno, &nrec, &data[nread]);
+		nread += nrec << 7;
+		recno += nrec;
+	    } else {
+/* Computing MIN */
+		i__1 = numdp - nread;
+		n = min(i__1,128);
+		dasrrd_(handle, &recno, &c__1, &n, &data[nread]);
+		nread += n;
+		++recno;
+	    }
 	} else {
 
 /*           We must find the next double precision cluster to */
@@ -25,6 +25,9 @@ static integer c__1 = 1;
     integer clbase;
     extern /* Subroutine */ int dasrri_(integer *, integer *, integer *, 
 	    integer *, integer *);
+    integer nrec;
+    extern /* Subroutine */ int zzdasbxi_(integer *, integer *, integer *, 
+	    integer *);
     integer clsize, wordno, numint;
 
 /* $ Abstract */
@@ -121,6 +124,9 @@ static integer c__1 = 1;
 /*     a DAS file.  This data is logically structured as a */
 /*     one-dimensional array of integers. */
 
+/*     Whole records of a long read are read directly into DATA, and */
+/*     do not replace the records held by the DAS record buffer. */
+
 /* $ Examples */
 
 
@@ -302,14 +308,25 @@ static integer c__1 = 1;
 	if (recno < clbase + clsize) {
 
 /*           We can continue reading from the current */
-/*           cluster. */
+/*           cluster.  If at least 8 whole records of the cluster */
+/*           remain to be read, read them directly into DATA; */
+/*           otherwise read one record through the record buffer. */
 
 /* Computing MIN */
-	    i__1 = numint - nread;
-	    n = min(i__1,256);
-	    dasrri_(handle, &recno, &c__1, &n, &data[nread]);
-	    nread += n;
-	    ++recno;
+	    i__1 = (numint - nread) / 256, i__2 = clbase + clsize - recno;
+	    nrec = min(i__1,i__2);
+	    if (nrec >= 8) {
+		zzdasbxi_(handle, &recno, &nrec, &data[nread]);
+		nread += nrec << 8;
+		recno += nrec;
+	    } else {
+/* Computing MIN */
+		i__1 = numint - nread;
+		n = min(i__1,256);
+		dasrri_(handle, &recno, &c__1, &n, &data[nread]);
+		nread += n;
+		++recno;
+	    }
 	} else {
 
 /*           We must find the next integer cluster to */
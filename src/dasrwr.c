@@ -7,10 +7,8 @@
 
 /* Table of constant values */
 
-static integer c__10 = 10;
 static integer c__1 = 1;
 static integer c__128 = 128;
-static logical c_false = FALSE_;
 static integer c__256 = 256;
 static integer c__1024 = 1024;
 
@@ -20,64 +18,21 @@ static integer c__1024 = 1024;
 	 doublereal *datad, integer *datai, char *datac, ftnlen recc_len, 
 	ftnlen datac_len)
 {
-    /* Initialized data */
-
-    static logical pass1 = TRUE_;
-    static integer hnbufi[10] = { 0,0,0,0,0,0,0,0,0,0 };
-    static logical upbufc[10] = { FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,
-	    FALSE_,FALSE_,FALSE_,FALSE_ };
-    static logical upbufd[10] = { FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,
-	    FALSE_,FALSE_,FALSE_,FALSE_ };
-    static logical upbufi[10] = { FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,
-	    FALSE_,FALSE_,FALSE_,FALSE_ };
-    static integer headc = 0;
-    static integer headd = 0;
-    static integer headi = 0;
-    static integer unit = -1;
-    static integer wrunit = -1;
-    static integer usedc = 0;
-    static integer usedd = 0;
-    static integer usedi = 0;
-    static integer rnbufc[10] = { 0,0,0,0,0,0,0,0,0,0 };
-    static integer rnbufd[10] = { 0,0,0,0,0,0,0,0,0,0 };
-    static integer rnbufi[10] = { 0,0,0,0,0,0,0,0,0,0 };
-    static integer hnbufc[10] = { 0,0,0,0,0,0,0,0,0,0 };
-    static integer hnbufd[10] = { 0,0,0,0,0,0,0,0,0,0 };
-
-    /* System generated locals */
-    integer i__1, i__2;
-
-    /* Builtin functions */
-    integer s_rnge(char *, integer, char *, integer);
-    /* Subroutine */ int s_copy(char *, char *, ftnlen, ftnlen);
-
-    /* Local variables */
-    static integer node, next;
-    extern /* Subroutine */ int zzdasgrd_(integer *, integer *, doublereal *),
-	     zzddhhlu_(integer *, char *, logical *, integer *, ftnlen), 
-	    zzdasgri_(integer *, integer *, integer *), chkin_(char *, ftnlen)
-	    , lnkan_(integer *, integer *), moved_(doublereal *, integer *, 
-	    doublereal *);
-    static integer poolc[32]	/* was [2][16] */, poold[32]	/* was [2][16]
-	     */;
-    extern /* Subroutine */ int movei_(integer *, integer *, integer *);
-    static integer pooli[32]	/* was [2][16] */;
-    extern integer lnktl_(integer *, integer *);
+    extern /* Subroutine */ int zzdasbrc_(integer *, integer *, integer *, 
+	    integer *, char *, ftnlen), zzdasbrd_(integer *, integer *, 
+	    integer *, integer *, doublereal *), zzdasbri_(integer *, integer 
+	    *, integer *, integer *, integer *), zzdasbuc_(integer *, integer 
+	    *, integer *, integer *, char *, ftnlen), zzdasbud_(integer *, 
+	    integer *, integer *, integer *, doublereal *), zzdasbui_(integer 
+	    *, integer *, integer *, integer *, integer *), zzdasbwb_(integer 
+	    *), zzdasbwc_(integer *, integer *, char *, ftnlen), zzdasbwd_(
+	    integer *, integer *, doublereal *), zzdasbwi_(integer *, integer 
+	    *, integer *), chkin_(char *, ftnlen);
     extern logical failed_(void);
-    extern /* Subroutine */ int dasioc_(char *, integer *, integer *, char *, 
-	    ftnlen, ftnlen), dasiod_(char *, integer *, integer *, doublereal 
-	    *, ftnlen);
-    static char rcbufc[1024*10];
-    static doublereal rcbufd[1280]	/* was [128][10] */;
-    extern /* Subroutine */ int dasioi_(char *, integer *, integer *, integer 
-	    *, ftnlen);
-    static integer rcbufi[2560]	/* was [256][10] */;
-    extern /* Subroutine */ int lnkilb_(integer *, integer *, integer *), 
-	    dassih_(integer *, char *, ftnlen), errhan_(char *, integer *, 
-	    ftnlen), lnkini_(integer *, integer *), sigerr_(char *, ftnlen), 
-	    chkout_(char *, ftnlen), setmsg_(char *, ftnlen), errint_(char *, 
-	    integer *, ftnlen), lnkfsl_(integer *, integer *, integer *), 
-	    lnkxsl_(integer *, integer *, integer *);
+    extern /* Subroutine */ int dassih_(integer *, char *, ftnlen), errhan_(
+	    char *, integer *, ftnlen), sigerr_(char *, ftnlen), chkout_(char 
+	    *, ftnlen), setmsg_(char *, ftnlen), errint_(char *, integer *, 
+	    ftnlen);
     extern logical return_(void);
 
 /* $ Abstract */
@@ -137,9 +92,6 @@ static integer c__1024 = 1024;
 /*     NWD        P   RRD, WRD, URD */
 /*     NWI        P   RRI, WRI, URI */
 /*     NWC        P   RRC, WRC, URC */
-/*     BUFSZD     P   RRD, WRD, URD */
-/*     BUFSZI     P   RRI, WRI, URI */
-/*     BUFSZC     P   RRC, WRC, URC */
 
 /* $ Detailed_Input */
 
@@ -160,12 +112,6 @@ static integer c__1024 = 1024;
 /*     NWC           is the number of characters in a single DAS record */
 /*                   containing characters. */
 
-/*     BUFSZD, */
-/*     BUFSZI, */
-/*     BUFSZC        are, respectively, the number of records in the */
-/*                   data buffers for double precision, integer, and */
-/*                   character records. */
-
 /* $ Exceptions */
 
 /*     1)  If this routine is called directly, the error */
@@ -229,24 +175,21 @@ static integer c__1024 = 1024;
 /*     file.  The entry point DASWBR (DAS, write buffered records) */
 /*     provides this capability. */
 
-/*     DASRWR contains three record buffers:  one of character type, */
-/*     one of double precision type, and one of integer type.  Each */
-/*     buffer has enough room for an integer number of records.  The */
-/*     sizes of the buffers are parameterized and can be increased if */
-/*     necessary.  When contemplating the revision of the buffer */
-/*     sizes selected by NAIF, SPICELIB users should take note of the */
-/*     following points: */
-
-/*        -- Changing values of parameters in NAIF subroutines may cause */
-/*           a maintenance burden for the users of the modified NAIF */
-/*           code, since any changes made to a SPICELIB routine will have */
-/*           to be made to any new version of that routine released by */
-/*           NAIF in a later version of SPICELIB. */
-
-/*        -- The effect of buffer size on the speed with which an */
-/*           application executes is highly dependent on the specific */
-/*           application.  In some cases, increasing the buffer sizes */
-/*           may slow the application down. */
+/*     The records of all three data types, from all DAS files, are */
+/*     held in a single record buffer, maintained by the private */
+/*     routine ZZDASBUF.  The buffer holds 1024 records by default; */
+/*     buffered records are found through a hash table keyed by file */
+/*     handle, record number and data type, and when the buffer is */
+/*     full the least recently accessed record is replaced.  Updated */
+/*     records are written to their file only when they are replaced, */
+/*     or when DASWBR is called for their file. */
+
+/*     The number of records the buffer holds may be changed by */
+/*     ZZDASBSZ, and the number of records read from DAS files, and of */
+/*     requests made of the DASRRx and DASURx entry points, may be */
+/*     obtained from ZZDASNRR.  The effect of buffer size on the speed */
+/*     with which an application executes is highly dependent on the */
+/*     specific application. */
 
 /* $ Examples */
 
@@ -330,42 +273,9 @@ static integer c__1024 = 1024;
 /*     Local variables */
 
 
-/*     The data structure maintained by this set of routines consists */
-/*     of three record buffers, one each for use with records of double */
-/*     precision, integer, and character data types. */
-
-/*     Each buffer consists of five parallel arrays; the arrays contain: */
-
-/*        -- data records */
-/*        -- Fortran record numbers */
-/*        -- file handles */
-/*        -- Update flags */
-
-/*     In addition, for each buffer there is a doubly linked list that */
-/*     points to the buffer and keeps track of the order in which the */
-/*     records in the buffer were accessed.  The three linked lists are */
-/*     maintained in a doubly linked list pool structure.  The logical */
-/*     structure of each buffer is illustrated below.  All of the array */
-/*     elements in the same row are associated with the data record in */
-/*     that row. */
-
-
-
-/*     Linked          Record       Record   Handles   Update */
-/*      List           buffer       Numbers            Flags */
-
-/*      +---+      +------------+    +---+    +---+    +---+ */
-/*      |   | ---> |            |    |   |    |   |    |   | */
-/*      +---+      +------------+    +---+    +---+    +---+ */
-/*      |   | ---> |            |    |   |    |   |    |   | */
-/*      +---+      +------------+    +---+    +---+    +---+ */
-/*        .              .             .        .        . */
-/*        .              .             .        .        . */
-/*        .              .             .        .        . */
-/*      +---+      +------------+    +---+    +---+    +---+ */
-/*      |   | ---> |            |    |   |    |   |    |   | */
-/*      +---+      +------------+    +---+    +---+    +---+ */
-
+/*     The record buffer is maintained by ZZDASBUF.  The entry points */
+/*     of this routine check their inputs and pass each request on to */
+/*     the corresponding ZZDASBUF entry point. */
 
 
 /*     Other local variables */
@@ -473,7 +383,6 @@ L_dasrrd:
 /*     FIRST, */
 /*     LAST       I   First and last indices of range within record. */
 /*     DATAD      O   Double precision data read from record. */
-/*     BUFSZD     P   Number of records in the DP record buffer. */
 /*     NWD        P   Number of DP in a single DAS DP record. */
 
 /* $ Detailed_Input */
@@ -503,8 +412,6 @@ L_dasrrd:
 /*     NWD            is the number of DPs in a single DAS record */
 /*                    containing DPs. */
 
-/*     BUFSZD         is the number of records in the double precision */
-/*                    record buffer. */
 
 /* $ Exceptions */
 
@@ -520,7 +427,7 @@ L_dasrrd:
 /*         error will be diagnosed by routines called by this routine. */
 /*         The output argument DATAD will not be modified.  This routine */
 /*         may write out updated, buffered records in order to make */
-/*         room in the double precision buffer for a newly read record. */
+/*         room in the record buffer for a newly read record. */
 /*         Note that the file written to may be different than the file */
 /*         designated by HANDLE if multiple DAS files are open for */
 /*         writing. */
@@ -628,15 +535,6 @@ L_dasrrd:
 
 /* -& */
 
-/*     If it hasn't been done yet, initialize the pointer list pools. */
-
-    if (pass1) {
-	lnkini_(&c__10, poold);
-	lnkini_(&c__10, pooli);
-	lnkini_(&c__10, poolc);
-	pass1 = FALSE_;
-    }
-
 /*     Check FIRST and LAST.  Use discovery check-in. */
 
     if (*first < 1 || *first > 128 || *last < 1 || *last > 128) {
@@ -662,129 +560,11 @@ L_dasrrd:
 	return 0;
     }
 
-/*     See whether record number RECNO in file HANDLE is buffered.  We'll */
-/*     search through the list of buffered records starting at the head */
-/*     of the list.  If we find the desired record, transfer the */
-/*     requested data to the array DATAD and return without further ado. */
-
-    node = headd;
-    while(node > 0) {
-	if (*handle == hnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		s_rnge("hnbufd", i__1, "dasrwr_", (ftnlen)715)] && *recno == 
-		rnbufd[(i__2 = node - 1) < 10 && 0 <= i__2 ? i__2 : s_rnge(
-		"rnbufd", i__2, "dasrwr_", (ftnlen)715)]) {
-
-/*           Found it.  Move this record to the head of the list. */
-/*           Update our head pointer as required. */
-
-	    if (node != headd) {
-		lnkxsl_(&node, &node, poold);
-		lnkilb_(&node, &headd, poold);
-		headd = node;
-	    }
-
-/*           Don't forget to return the requested data. */
-
-	    if (*first == *last) {
-		datad[0] = rcbufd[(i__1 = *first + (node << 7) - 129) < 1280 
-			&& 0 <= i__1 ? i__1 : s_rnge("rcbufd", i__1, "dasrwr_"
-			, (ftnlen)735)];
-	    } else {
-		i__2 = *last - *first + 1;
-		moved_(&rcbufd[(i__1 = *first + (node << 7) - 129) < 1280 && 
-			0 <= i__1 ? i__1 : s_rnge("rcbufd", i__1, "dasrwr_", (
-			ftnlen)739)], &i__2, datad);
-	    }
-
-/*           We haven't checked in, so don't check out. */
-
-	    return 0;
-	}
-	node = poold[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
-		s_rnge("poold", i__1, "dasrwr_", (ftnlen)750)];
-    }
-
-/*     The record wasn't buffered.  We need to allocate entries to */
-/*     hold the record contents.  If the buffer isn't full, just */
-/*     select a free set of entries.  If the buffer is full, use */
-/*     the set of entries at the tail of the list. */
-
-/*     Since we're now going to do a file read, it doesn't slow */
-/*     us down much to check in, comparatively speaking. */
-
-    chkin_("DASRRD", (ftnlen)6);
-    if (usedd == 10) {
-
-/*        Grab the buffer entry at the tail end of the list. */
-
-	node = lnktl_(&headd, poold);
-	lnkxsl_(&node, &node, poold);
-
-/*        If the allocated buffer entry was updated, write it out. */
-
-	if (upbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
-		"fd", i__1, "dasrwr_", (ftnlen)776)]) {
-
-/*           We'll need a logical unit in order to write to the file. */
-
-	    zzddhhlu_(&hnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		    s_rnge("hnbufd", i__1, "dasrwr_", (ftnlen)780)], "DAS", &
-		    c_false, &wrunit, (ftnlen)3);
-	    if (failed_()) {
-		chkout_("DASRRD", (ftnlen)6);
-		return 0;
-	    }
-	    dasiod_("WRITE", &wrunit, &rnbufd[(i__1 = node - 1) < 10 && 0 <= 
-		    i__1 ? i__1 : s_rnge("rnbufd", i__1, "dasrwr_", (ftnlen)
-		    787)], &rcbufd[(i__2 = (node << 7) - 128) < 1280 && 0 <= 
-		    i__2 ? i__2 : s_rnge("rcbufd", i__2, "dasrwr_", (ftnlen)
-		    787)], (ftnlen)5);
-	    if (failed_()) {
-		chkout_("DASRRD", (ftnlen)6);
-		return 0;
-	    }
-	}
-    } else {
-
-/*        Allocate a new set of buffer entries, but don't link */
-/*        them into the list yet. */
-
-	lnkan_(poold, &node);
-	++usedd;
-    }
-
-/*     Try to read the record. */
-
-    zzdasgrd_(handle, recno, &rcbufd[(i__1 = (node << 7) - 128) < 1280 && 0 <=
-	     i__1 ? i__1 : s_rnge("rcbufd", i__1, "dasrwr_", (ftnlen)813)]);
-    if (failed_()) {
-	chkout_("DASRRD", (ftnlen)6);
-	return 0;
-    }
+/*     Obtain the data from the DAS record buffer, which reads the */
+/*     record from the file if it is not buffered.  (We're not checked */
+/*     in, so we don't check out.) */
 
-/*     The read was successful.  Link the node pointing to the buffer */
-/*     entries for this record in before the current head of the */
-/*     list, thus putting them at the head. */
-
-/*     Set the file handle, record number, and update flag for */
-/*     this record. */
-
-    lnkilb_(&node, &headd, poold);
-    hnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("hnbufd", i__1,
-	     "dasrwr_", (ftnlen)830)] = *handle;
-    rnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("rnbufd", i__1,
-	     "dasrwr_", (ftnlen)831)] = *recno;
-    upbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbufd", i__1,
-	     "dasrwr_", (ftnlen)832)] = FALSE_;
-    headd = node;
-
-/*     Don't forget to return the requested data. */
-
-    i__2 = *last - *first + 1;
-    moved_(&rcbufd[(i__1 = *first + (node << 7) - 129) < 1280 && 0 <= i__1 ? 
-	    i__1 : s_rnge("rcbufd", i__1, "dasrwr_", (ftnlen)838)], &i__2, 
-	    datad);
-    chkout_("DASRRD", (ftnlen)6);
+    zzdasbrd_(handle, recno, first, last, datad);
     return 0;
 /* $Procedure DASRRI ( DAS, read record, integer ) */
 
@@ -845,7 +625,6 @@ L_dasrri:
 /*     FIRST, */
 /*     LAST       I   First and last indices of range within record. */
 /*     DATAI      O   Integer data read from record. */
-/*     BUFSZI     P   Number of records in the integer record buffer. */
 /*     NWI        P   Number of integers in a single DAS integer record. */
 
 /* $ Detailed_Input */
@@ -874,8 +653,6 @@ L_dasrri:
 /*     NWI           is the number of integers in a single DAS record */
 /*                   containing integers. */
 
-/*     BUFSZI        is the number of records in the integer record */
-/*                   buffer. */
 
 /* $ Exceptions */
 
@@ -891,7 +668,7 @@ L_dasrri:
 /*         error will be diagnosed by routines called by this routine. */
 /*         The output argument DATAI will not be modified.  This routine */
 /*         may write out updated, buffered records in order to make room */
-/*         in the integer buffer for a newly read record.  Note that the */
+/*         in the record buffer for a newly read record.  Note that the */
 /*         file written to may be different than the file designated by */
 /*         HANDLE if multiple DAS files are open for writing. */
 
@@ -1000,15 +777,6 @@ L_dasrri:
 
 /*     Non-standard SPICE error handling. */
 
-/*     If it hasn't been done yet, initialize the pointer list pools. */
-
-    if (pass1) {
-	lnkini_(&c__10, poold);
-	lnkini_(&c__10, pooli);
-	lnkini_(&c__10, poolc);
-	pass1 = FALSE_;
-    }
-
 /*     Check FIRST and LAST.  Use discovery check-in. */
 
     if (*first < 1 || *first > 256 || *last < 1 || *last > 256) {
@@ -1034,123 +802,11 @@ L_dasrri:
 	return 0;
     }
 
-/*     See whether record number RECNO in file HANDLE is buffered.  We'll */
-/*     search through the list of buffered records starting at the head */
-/*     of the list.  If we find the desired record, transfer the */
-/*     requested data to the array DATAI and return without further ado. */
-
-    node = headi;
-    while(node > 0) {
-	if (*handle == hnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		s_rnge("hnbufi", i__1, "dasrwr_", (ftnlen)1124)] && *recno == 
-		rnbufi[(i__2 = node - 1) < 10 && 0 <= i__2 ? i__2 : s_rnge(
-		"rnbufi", i__2, "dasrwr_", (ftnlen)1124)]) {
-
-
-/*           Found it.  Move this record to the head of the list. */
-/*           Update our head pointer as required. */
-
-	    if (node != headi) {
-		lnkxsl_(&node, &node, pooli);
-		lnkilb_(&node, &headi, pooli);
-		headi = node;
-	    }
-
-/*           Don't forget to return the requested data. */
-
-	    if (*first == *last) {
-		datai[0] = rcbufi[(i__1 = *first + (node << 8) - 257) < 2560 
-			&& 0 <= i__1 ? i__1 : s_rnge("rcbufi", i__1, "dasrwr_"
-			, (ftnlen)1145)];
-	    } else {
-		i__2 = *last - *first + 1;
-		movei_(&rcbufi[(i__1 = *first + (node << 8) - 257) < 2560 && 
-			0 <= i__1 ? i__1 : s_rnge("rcbufi", i__1, "dasrwr_", (
-			ftnlen)1149)], &i__2, datai);
-	    }
-
-/*           We haven't checked in, so don't check out. */
-
-	    return 0;
-	}
-	node = pooli[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
-		s_rnge("pooli", i__1, "dasrwr_", (ftnlen)1160)];
-    }
-
-/*     The record wasn't buffered.  We need to allocate entries to */
-/*     hold the record contents.  If the buffer isn't full, just */
-/*     select a free set of entries.  If the buffer is full, use */
-/*     the set of entries at the tail of the list. */
-
-/*     Since we're now going to do a file read, it doesn't slow */
-/*     us down much to check in, comparatively speaking. */
-
-    chkin_("DASRRI", (ftnlen)6);
-    if (usedi == 10) {
-
-/*        Grab the buffer entry at the tail end of the list. */
-
-	node = lnktl_(&headi, pooli);
-	lnkxsl_(&node, &node, pooli);
-
-/*        If the allocated buffer entry was updated, write it out. */
-
-	if (upbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
-		"fi", i__1, "dasrwr_", (ftnlen)1186)]) {
-	    zzddhhlu_(&hnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		    s_rnge("hnbufi", i__1, "dasrwr_", (ftnlen)1188)], "DAS", &
-		    c_false, &wrunit, (ftnlen)3);
-	    dasioi_("WRITE", &wrunit, &rnbufi[(i__1 = node - 1) < 10 && 0 <= 
-		    i__1 ? i__1 : s_rnge("rnbufi", i__1, "dasrwr_", (ftnlen)
-		    1190)], &rcbufi[(i__2 = (node << 8) - 256) < 2560 && 0 <= 
-		    i__2 ? i__2 : s_rnge("rcbufi", i__2, "dasrwr_", (ftnlen)
-		    1190)], (ftnlen)5);
-	    if (failed_()) {
-		chkout_("DASRRI", (ftnlen)6);
-		return 0;
-	    }
-	}
-    } else {
-
-/*        Allocate a new set of buffer entries, but don't link */
-/*        them into the list yet. */
-
-	lnkan_(pooli, &node);
-	++usedi;
-    }
-
-/*     Try to read the record. */
+/*     Obtain the data from the DAS record buffer, which reads the */
+/*     record from the file if it is not buffered.  (We're not checked */
+/*     in, so we don't check out.) */
 
-    zzdasgri_(handle, recno, &rcbufi[(i__1 = (node << 8) - 256) < 2560 && 0 <=
-	     i__1 ? i__1 : s_rnge("rcbufi", i__1, "dasrwr_", (ftnlen)1216)]);
-    if (failed_()) {
-	chkout_("DASRRI", (ftnlen)6);
-	return 0;
-    }
-
-/*     The read was successful.  Link the node pointing to the buffer */
-/*     entries for this record in before the current head of the */
-/*     list, thus putting them at the head. */
-
-/*     Set the file handle, record number, and update flag for */
-/*     this record. */
-
-    lnkilb_(&node, &headi, pooli);
-    hnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("hnbufi", i__1,
-	     "dasrwr_", (ftnlen)1233)] = *handle;
-    rnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("rnbufi", i__1,
-	     "dasrwr_", (ftnlen)1234)] = *recno;
-    upbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbufi", i__1,
-	     "dasrwr_", (ftnlen)1235)] = FALSE_;
-    headi = node;
-
-/*     Don't forget to return the requested data. */
-
-    i__2 = *last - *first + 1;
-    movei_(&rcbufi[(i__1 = *first + (node << 8) - 257) < 2560 && 0 <= i__1 ? 
-	    i__1 : s_rnge("rcbufi", i__1, "dasrwr_", (ftnlen)1241)], &i__2, 
-	    datai);
-    chkout_("DASRRI", (ftnlen)6);
+    zzdasbri_(handle, recno, first, last, datai);
     return 0;
 /* $Procedure DASRRC ( DAS, read record, character ) */
 
@@ -1211,7 +867,6 @@ L_dasrrc:
 /*     FIRST, */
 /*     LAST       I   First and last indices of range within record. */
 /*     DATAC      O   Character data read from record. */
-/*     BUFSZC     P   Number of records in the character record buffer. */
 /*     NWC        P   Number of characters in a single DAS char. record. */
 
 /* $ Detailed_Input */
@@ -1240,8 +895,6 @@ L_dasrrc:
 /*     NWC           is the number of characters in a single DAS record */
 /*                   containing characters. */
 
-/*     BUFSZC        is the number of records in the character record */
-/*                   buffer. */
 
 /* $ Exceptions */
 
@@ -1257,7 +910,7 @@ L_dasrrc:
 /*         error will be diagnosed by routines called by this routine. */
 /*         The output argument DATAC will not be modified.  This routine */
 /*         may write out updated, buffered records in order to make room */
-/*         in the character buffer for a newly read record.  Note that */
+/*         in the record buffer for a newly read record.  Note that */
 /*         the file written to may be different than the file */
 /*         designated by HANDLE if multiple DAS files are open for */
 /*         writing. */
@@ -1363,15 +1016,6 @@ L_dasrrc:
 
 /* -& */
 
-/*     If it hasn't been done yet, initialize the pointer list pools. */
-
-    if (pass1) {
-	lnkini_(&c__10, poold);
-	lnkini_(&c__10, pooli);
-	lnkini_(&c__10, poolc);
-	pass1 = FALSE_;
-    }
-
 /*     Check FIRST and LAST.  Use discovery check-in. */
 
     if (*first < 1 || *first > 1024 || *last < 1 || *last > 1024) {
@@ -1397,117 +1041,11 @@ L_dasrrc:
 	return 0;
     }
 
-/*     See whether record number RECNO in file HANDLE is buffered.  We'll */
-/*     search through the list of buffered records starting at the head */
-/*     of the list.  If we find the desired record, transfer the */
-/*     requested data to the array DATAC and return without further ado. */
-
-    node = headc;
-    while(node > 0) {
-	if (*handle == hnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		s_rnge("hnbufc", i__1, "dasrwr_", (ftnlen)1525)] && *recno == 
-		rnbufc[(i__2 = node - 1) < 10 && 0 <= i__2 ? i__2 : s_rnge(
-		"rnbufc", i__2, "dasrwr_", (ftnlen)1525)]) {
-
-
-/*           Found it.  Move this record to the head of the list. */
-/*           Update our head pointer as required. */
-
-	    if (node != headc) {
-		lnkxsl_(&node, &node, poolc);
-		lnkilb_(&node, &headc, poolc);
-		headc = node;
-	    }
-
-/*           Don't forget to return the requested data. */
-
-	    s_copy(datac, rcbufc + ((((i__1 = node - 1) < 10 && 0 <= i__1 ? 
-		    i__1 : s_rnge("rcbufc", i__1, "dasrwr_", (ftnlen)1544)) <<
-		     10) + (*first - 1)), datac_len, *last - (*first - 1));
-
-/*           We haven't checked in, so don't check out. */
-
-	    return 0;
-	}
-	node = poolc[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
-		s_rnge("poolc", i__1, "dasrwr_", (ftnlen)1553)];
-    }
-
-/*     The record wasn't buffered.  We need to allocate entries to */
-/*     hold the record contents.  If the buffer isn't full, just */
-/*     select a free set of entries.  If the buffer is full, use */
-/*     the set of entries at the tail of the list. */
-
-/*     Since we're now going to do a file read, it doesn't slow */
-/*     us down much to check in, comparatively speaking. */
-
-    chkin_("DASRRC", (ftnlen)6);
-    if (usedc == 10) {
-
-/*        Grab the buffer entry at the tail end of the list. */
-
-	node = lnktl_(&headc, poolc);
-	lnkxsl_(&node, &node, poolc);
-
-/*        If the allocated buffer entry was updated, write it out. */
-
-	if (upbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
-		"fc", i__1, "dasrwr_", (ftnlen)1579)]) {
-	    zzddhhlu_(&hnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		    s_rnge("hnbufc", i__1, "dasrwr_", (ftnlen)1581)], "DAS", &
-		    c_false, &wrunit, (ftnlen)3);
-	    dasioc_("WRITE", &wrunit, &rnbufc[(i__1 = node - 1) < 10 && 0 <= 
-		    i__1 ? i__1 : s_rnge("rnbufc", i__1, "dasrwr_", (ftnlen)
-		    1583)], rcbufc + (((i__2 = node - 1) < 10 && 0 <= i__2 ? 
-		    i__2 : s_rnge("rcbufc", i__2, "dasrwr_", (ftnlen)1583)) <<
-		     10), (ftnlen)5, (ftnlen)1024);
-	    if (failed_()) {
-		chkout_("DASRRC", (ftnlen)6);
-		return 0;
-	    }
-	}
-    } else {
-
-/*        Allocate a new set of buffer entries, but don't link */
-/*        them into the list yet. */
-
-	lnkan_(poolc, &node);
-	++usedc;
-    }
-
-/*     Try to read the record. */
-
-    zzddhhlu_(handle, "DAS", &c_false, &unit, (ftnlen)3);
-    dasioc_("READ", &unit, recno, rcbufc + (((i__1 = node - 1) < 10 && 0 <= 
-	    i__1 ? i__1 : s_rnge("rcbufc", i__1, "dasrwr_", (ftnlen)1611)) << 
-	    10), (ftnlen)4, (ftnlen)1024);
-    if (failed_()) {
-	chkout_("DASRRC", (ftnlen)6);
-	return 0;
-    }
-
-/*     The read was successful.  Link the node pointing to the buffer */
-/*     entries for this record in before the current head of the */
-/*     list, thus putting them at the head. */
-
-/*     Set the file handle, record number, and update flag for */
-/*     this record. */
+/*     Obtain the data from the DAS record buffer, which reads the */
+/*     record from the file if it is not buffered.  (We're not checked */
+/*     in, so we don't check out.) */
 
-    lnkilb_(&node, &headc, poolc);
-    hnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("hnbufc", i__1,
-	     "dasrwr_", (ftnlen)1628)] = *handle;
-    rnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("rnbufc", i__1,
-	     "dasrwr_", (ftnlen)1629)] = *recno;
-    upbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbufc", i__1,
-	     "dasrwr_", (ftnlen)1630)] = FALSE_;
-    headc = node;
-
-/*     Don't forget to return the requested data. */
-
-    s_copy(datac, rcbufc + ((((i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-	    s_rnge("rcbufc", i__1, "dasrwr_", (ftnlen)1636)) << 10) + (*first 
-	    - 1)), datac_len, *last - (*first - 1));
-    chkout_("DASRRC", (ftnlen)6);
+    zzdasbrc_(handle, recno, first, last, datac, datac_len);
     return 0;
 /* $Procedure DASWRD ( DAS, write record, double precision ) */
 
@@ -1564,7 +1102,6 @@ L_daswrd:
 /*     HANDLE     I   Handle of DAS file. */
 /*     RECNO      I   Record number. */
 /*     RECD       I   Double precision data to be written to record. */
-/*     BUFSZD     P   Number of records in the DP record buffer. */
 /*     NWD        P   Number of DP in a single DAS DP record. */
 
 /* $ Detailed_Input */
@@ -1587,8 +1124,6 @@ L_daswrd:
 /*     NWD           is the number of DPs in a single DAS record */
 /*                   containing DPs. */
 
-/*     BUFSZD        is the number of records in the double precision */
-/*                   record buffer. */
 
 /* $ Exceptions */
 
@@ -1714,114 +1249,11 @@ L_daswrd:
 	return 0;
     }
 
-/*     If it hasn't been done yet, initialize the pointer list pools. */
-
-    if (pass1) {
-	lnkini_(&c__10, poold);
-	lnkini_(&c__10, pooli);
-	lnkini_(&c__10, poolc);
-	pass1 = FALSE_;
-    }
-
-/*     See whether double precision record number RECNO from file HANDLE */
-/*     is buffered.  We'll search through the list of buffered records */
-/*     starting at the head of the list.  If the record is already */
-/*     buffered, we'll update the buffer entry, but we'll defer writing */
-/*     the record out until we need to free a record, or until the */
-/*     d.p. buffer is flushed, whichever comes first. */
-
-    node = headd;
-    while(node > 0) {
-	if (*handle == hnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		s_rnge("hnbufd", i__1, "dasrwr_", (ftnlen)1884)] && *recno == 
-		rnbufd[(i__2 = node - 1) < 10 && 0 <= i__2 ? i__2 : s_rnge(
-		"rnbufd", i__2, "dasrwr_", (ftnlen)1884)]) {
-
-/*           Found it.  Update the buffered record. */
-
-	    moved_(recd, &c__128, &rcbufd[(i__1 = (node << 7) - 128) < 1280 &&
-		     0 <= i__1 ? i__1 : s_rnge("rcbufd", i__1, "dasrwr_", (
-		    ftnlen)1889)]);
-
-/*           Set the update flag, indicating that this buffer entry */
-/*           has been modified. */
-
-	    upbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
-		    "fd", i__1, "dasrwr_", (ftnlen)1895)] = TRUE_;
-
-/*           Put the information about this record at the head of the */
-/*           active list, if it is not already there. */
-
-	    if (node != headd) {
-		lnkxsl_(&node, &node, poold);
-		lnkilb_(&node, &headd, poold);
-		headd = node;
-	    }
-	    chkout_("DASWRD", (ftnlen)6);
-	    return 0;
-	}
-	node = poold[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
-		s_rnge("poold", i__1, "dasrwr_", (ftnlen)1914)];
-    }
-
-/*     The record we're writing to is not buffered.  We'll allocate */
-/*     a buffer entry.  If the record buffer is full, we'll */
-/*     commandeer the least recently accessed record.  Before using */
-/*     this record, we'll write its contents out to the corresponding */
-/*     file, if the record has been updated. */
-
-    if (usedd < 10) {
-
-/*        There's a free buffer entry available.  Just allocate it. */
-
-	lnkan_(poold, &node);
-	++usedd;
-    } else {
-
-/*        Grab the buffer entry at the tail end of the list. */
-
-	node = lnktl_(&headd, poold);
-	lnkxsl_(&node, &node, poold);
-
-/*        If the allocated record was updated, write it out. */
-
-	if (upbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
-		"fd", i__1, "dasrwr_", (ftnlen)1944)]) {
-	    zzddhhlu_(&hnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		    s_rnge("hnbufd", i__1, "dasrwr_", (ftnlen)1946)], "DAS", &
-		    c_false, &wrunit, (ftnlen)3);
-	    dasiod_("WRITE", &wrunit, &rnbufd[(i__1 = node - 1) < 10 && 0 <= 
-		    i__1 ? i__1 : s_rnge("rnbufd", i__1, "dasrwr_", (ftnlen)
-		    1948)], &rcbufd[(i__2 = (node << 7) - 128) < 1280 && 0 <= 
-		    i__2 ? i__2 : s_rnge("rcbufd", i__2, "dasrwr_", (ftnlen)
-		    1948)], (ftnlen)5);
-	    if (failed_()) {
-		chkout_("DASWRD", (ftnlen)6);
-		return 0;
-	    }
-	}
-    }
-
-/*     Now update the allocated buffer entry with the input data. */
-
-    moved_(recd, &c__128, &rcbufd[(i__1 = (node << 7) - 128) < 1280 && 0 <= 
-	    i__1 ? i__1 : s_rnge("rcbufd", i__1, "dasrwr_", (ftnlen)1965)]);
-
-/*     Set the update flag, indicating that this buffer entry */
-/*     has been modified. Also set the handle and record number */
-/*     entries. */
-
-    upbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbufd", i__1,
-	     "dasrwr_", (ftnlen)1972)] = TRUE_;
-    hnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("hnbufd", i__1,
-	     "dasrwr_", (ftnlen)1973)] = *handle;
-    rnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("rnbufd", i__1,
-	     "dasrwr_", (ftnlen)1974)] = *recno;
-
-/*     Link this buffer entry to the head of the list. */
+/*     Place the record in the DAS record buffer.  The record is */
+/*     written to the file when its buffer entry is needed for another */
+/*     record, or when DASWBR is called for the file. */
 
-    lnkilb_(&node, &headd, poold);
-    headd = node;
+    zzdasbwd_(handle, recno, recd);
     chkout_("DASWRD", (ftnlen)6);
     return 0;
 /* $Procedure DASWRI ( DAS, write record, integer ) */
@@ -1879,7 +1311,6 @@ L_daswri:
 /*     HANDLE     I   Handle of DAS file. */
 /*     RECNO      I   Record number. */
 /*     RECI       I   Integer data to be written to record. */
-/*     BUFSZI     P   Number of records in the integer record buffer. */
 /*     NWI        P   Number of integers in a single DAS integer record. */
 
 /* $ Detailed_Input */
@@ -1902,8 +1333,6 @@ L_daswri:
 /*     NWI           is the number of integers in a single DAS record */
 /*                   containing integers. */
 
-/*     BUFSZI        is the number of records in the integer record */
-/*                   buffer. */
 
 /* $ Exceptions */
 
@@ -2028,115 +1457,11 @@ L_daswri:
 	return 0;
     }
 
-/*     If it hasn't been done yet, initialize the pointer list pools. */
-
-    if (pass1) {
-	lnkini_(&c__10, poold);
-	lnkini_(&c__10, pooli);
-	lnkini_(&c__10, poolc);
-	pass1 = FALSE_;
-    }
-
-/*     See whether integer record number RECNO from file HANDLE is */
-/*     buffered.  We'll search through the list of buffered records */
-/*     starting at the head of the list.  If the record is already */
-/*     buffered, we'll update the buffer entry, but we'll defer writing */
-/*     the record out until we need to free a record, or until the */
-/*     integer buffer is flushed, whichever comes first. */
-
-    node = headi;
-    while(node > 0) {
-	if (*handle == hnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		s_rnge("hnbufi", i__1, "dasrwr_", (ftnlen)2228)] && *recno == 
-		rnbufi[(i__2 = node - 1) < 10 && 0 <= i__2 ? i__2 : s_rnge(
-		"rnbufi", i__2, "dasrwr_", (ftnlen)2228)]) {
-
-/*           Found it.  Update the buffered record. */
-
-	    movei_(reci, &c__256, &rcbufi[(i__1 = (node << 8) - 256) < 2560 &&
-		     0 <= i__1 ? i__1 : s_rnge("rcbufi", i__1, "dasrwr_", (
-		    ftnlen)2233)]);
-
-/*           Set the update flag, indicating that this buffer entry */
-/*           has been modified. */
-
-	    upbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
-		    "fi", i__1, "dasrwr_", (ftnlen)2239)] = TRUE_;
-
-/*           Put the information about this record at the head of the */
-/*           active list, if it is not already there. */
-
-	    if (node != headi) {
-		lnkxsl_(&node, &node, pooli);
-		lnkilb_(&node, &headi, pooli);
-		headi = node;
-	    }
-	    chkout_("DASWRI", (ftnlen)6);
-	    return 0;
-	}
-	node = pooli[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
-		s_rnge("pooli", i__1, "dasrwr_", (ftnlen)2258)];
-    }
-
-/*     The record we're writing to is not buffered.  We'll allocate */
-/*     a buffer entry.  If the record buffer is full, we'll */
-/*     commandeer the least recently accessed record.  Before using */
-/*     this record, we'll write its contents out to the corresponding */
-/*     file, if the record has been updated. */
+/*     Place the record in the DAS record buffer.  The record is */
+/*     written to the file when its buffer entry is needed for another */
+/*     record, or when DASWBR is called for the file. */
 
-    if (usedi < 10) {
-
-/*        There's a free buffer entry available.  Just allocate it. */
-
-	lnkan_(pooli, &node);
-	++usedi;
-    } else {
-
-/*        Grab the buffer entry at the tail end of the list. */
-
-	node = lnktl_(&headi, pooli);
-	lnkxsl_(&node, &node, pooli);
-
-/*        If the allocated record was updated, write it out. */
-
-	if (upbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
-		"fi", i__1, "dasrwr_", (ftnlen)2287)]) {
-	    zzddhhlu_(&hnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		    s_rnge("hnbufi", i__1, "dasrwr_", (ftnlen)2289)], "DAS", &
-		    c_false, &wrunit, (ftnlen)3);
-	    dasioi_("WRITE", &wrunit, &rnbufi[(i__1 = node - 1) < 10 && 0 <= 
-		    i__1 ? i__1 : s_rnge("rnbufi", i__1, "dasrwr_", (ftnlen)
-		    2291)], &rcbufi[(i__2 = (node << 8) - 256) < 2560 && 0 <= 
-		    i__2 ? i__2 : s_rnge("rcbufi", i__2, "dasrwr_", (ftnlen)
-		    2291)], (ftnlen)5);
-	    if (failed_()) {
-		chkout_("DASWRI", (ftnlen)6);
-		return 0;
-	    }
-	}
-    }
-
-/*     Now update the allocated buffer entry with the input data. */
-
-    movei_(reci, &c__256, &rcbufi[(i__1 = (node << 8) - 256) < 2560 && 0 <= 
-	    i__1 ? i__1 : s_rnge("rcbufi", i__1, "dasrwr_", (ftnlen)2308)]);
-
-/*     Set the update flag, indicating that this buffer entry */
-/*     has been modified.  Also set the handle and record number */
-/*     entries. */
-
-    zzddhhlu_(handle, "DAS", &c_false, &unit, (ftnlen)3);
-    upbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbufi", i__1,
-	     "dasrwr_", (ftnlen)2317)] = TRUE_;
-    hnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("hnbufi", i__1,
-	     "dasrwr_", (ftnlen)2318)] = *handle;
-    rnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("rnbufi", i__1,
-	     "dasrwr_", (ftnlen)2319)] = *recno;
-
-/*     Link this buffer entry to the head of the list. */
-
-    lnkilb_(&node, &headi, pooli);
-    headi = node;
+    zzdasbwi_(handle, recno, reci);
     chkout_("DASWRI", (ftnlen)6);
     return 0;
 /* $Procedure DASWRC ( DAS, write record, character ) */
@@ -2194,7 +1519,6 @@ L_daswrc:
 /*     HANDLE     I   Handle of DAS file. */
 /*     RECNO      I   Record number. */
 /*     RECC       I   Character data to be written to record. */
-/*     BUFSZC     P   Number of records in the character record buffer. */
 /*     NWC        P   Number of characters in a single DAS char. record. */
 
 /* $ Detailed_Input */
@@ -2217,8 +1541,6 @@ L_daswrc:
 /*     NWC           is the number of characters in a single DAS record */
 /*                   containing characters. */
 
-/*     BUFSZC        is the number of records in the character record */
-/*                   buffer. */
 
 /* $ Exceptions */
 
@@ -2344,115 +1666,11 @@ L_daswrc:
 	return 0;
     }
 
-/*     If it hasn't been done yet, initialize the pointer list pools. */
-
-    if (pass1) {
-	lnkini_(&c__10, poold);
-	lnkini_(&c__10, pooli);
-	lnkini_(&c__10, poolc);
-	pass1 = FALSE_;
-    }
-
-/*     See whether character record number RECNO from file HANDLE is */
-/*     buffered.  We'll search through the list of buffered records */
-/*     starting at the head of the list.  If the record is already */
-/*     buffered, we'll update the buffer entry, but we'll defer writing */
-/*     the record out until we need to free a record, or until the */
-/*     character buffer is flushed, whichever comes first. */
-
-    node = headc;
-    while(node > 0) {
-	if (*handle == hnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		s_rnge("hnbufc", i__1, "dasrwr_", (ftnlen)2574)] && *recno == 
-		rnbufc[(i__2 = node - 1) < 10 && 0 <= i__2 ? i__2 : s_rnge(
-		"rnbufc", i__2, "dasrwr_", (ftnlen)2574)]) {
-
-/*           Found it.  Update the buffered record. */
-
-	    s_copy(rcbufc + (((i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		    s_rnge("rcbufc", i__1, "dasrwr_", (ftnlen)2579)) << 10), 
-		    recc, (ftnlen)1024, recc_len);
-
-/*           Set the update flag, indicating that this buffer entry */
-/*           has been modified. */
-
-	    upbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
-		    "fc", i__1, "dasrwr_", (ftnlen)2585)] = TRUE_;
-
-/*           Put the information about this record at the head of the */
-/*           active list, if it is not already there. */
-
-	    if (node != headc) {
-		lnkxsl_(&node, &node, poolc);
-		lnkilb_(&node, &headc, poolc);
-		headc = node;
-	    }
-	    chkout_("DASWRC", (ftnlen)6);
-	    return 0;
-	}
-	node = poolc[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
-		s_rnge("poolc", i__1, "dasrwr_", (ftnlen)2604)];
-    }
-
-/*     The record we're writing to is not buffered.  We'll allocate */
-/*     a buffer entry.  If the record buffer is full, we'll */
-/*     commandeer the least recently accessed record.  Before using */
-/*     this record, we'll write its contents out to the corresponding */
-/*     file, if the record has been updated. */
-
-    if (usedc < 10) {
-
-/*        There's a free buffer entry available.  Just allocate it. */
-
-	lnkan_(poolc, &node);
-	++usedc;
-    } else {
-
-/*        Grab the buffer entry at the tail end of the list. */
-
-	node = lnktl_(&headc, poolc);
-	lnkxsl_(&node, &node, poolc);
-
-/*        If the allocated record was updated, write it out. */
-
-	if (upbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
-		"fc", i__1, "dasrwr_", (ftnlen)2633)]) {
-	    zzddhhlu_(&hnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		    s_rnge("hnbufc", i__1, "dasrwr_", (ftnlen)2635)], "DAS", &
-		    c_false, &wrunit, (ftnlen)3);
-	    dasioc_("WRITE", &wrunit, &rnbufc[(i__1 = node - 1) < 10 && 0 <= 
-		    i__1 ? i__1 : s_rnge("rnbufc", i__1, "dasrwr_", (ftnlen)
-		    2637)], rcbufc + (((i__2 = node - 1) < 10 && 0 <= i__2 ? 
-		    i__2 : s_rnge("rcbufc", i__2, "dasrwr_", (ftnlen)2637)) <<
-		     10), (ftnlen)5, (ftnlen)1024);
-	    if (failed_()) {
-		chkout_("DASWRC", (ftnlen)6);
-		return 0;
-	    }
-	}
-    }
-
-/*     Now update the allocated buffer entry with the input data. */
+/*     Place the record in the DAS record buffer.  The record is */
+/*     written to the file when its buffer entry is needed for another */
+/*     record, or when DASWBR is called for the file. */
 
-    s_copy(rcbufc + (((i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge(
-	    "rcbufc", i__1, "dasrwr_", (ftnlen)2654)) << 10), recc, (ftnlen)
-	    1024, recc_len);
-
-/*     Set the update flag, indicating that this buffer entry */
-/*     has been modified.  Also set the handle and record number */
-/*     entries. */
-
-    upbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbufc", i__1,
-	     "dasrwr_", (ftnlen)2661)] = TRUE_;
-    hnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("hnbufc", i__1,
-	     "dasrwr_", (ftnlen)2662)] = *handle;
-    rnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("rnbufc", i__1,
-	     "dasrwr_", (ftnlen)2663)] = *recno;
-
-/*     Link this buffer entry to the head of the list. */
-
-    lnkilb_(&node, &headc, poolc);
-    headc = node;
+    zzdasbwc_(handle, recno, recc, recc_len);
     chkout_("DASWRC", (ftnlen)6);
     return 0;
 /* $Procedure DASURD ( DAS, update record, double precision ) */
@@ -2514,7 +1732,6 @@ L_dasurd:
 /*     FIRST, */
 /*     LAST       I   First and last indices of range within record. */
 /*     DATAD      I   Double precision data to write to record. */
-/*     BUFSZD     P   Number of records in the DP record buffer. */
 /*     NWD        P   Number of DPs in a single DAS DP record. */
 
 /* $ Detailed_Input */
@@ -2547,8 +1764,6 @@ L_dasurd:
 /*     NWD           is the number of DPs in a single DAS record */
 /*                   containing DPs. */
 
-/*     BUFSZD        is the number of records in the double precision */
-/*                   record buffer. */
 
 /* $ Exceptions */
 
@@ -2693,15 +1908,6 @@ L_dasurd:
 	return 0;
     }
 
-/*     If it hasn't been done yet, initialize the pointer list pools. */
-
-    if (pass1) {
-	lnkini_(&c__10, poold);
-	lnkini_(&c__10, pooli);
-	lnkini_(&c__10, poolc);
-	pass1 = FALSE_;
-    }
-
 /*     If FIRST or LAST are out of range, no dice. */
 
     if (*first < 1 || *first > 128 || *last < 1 || *last > 128) {
@@ -2726,120 +1932,11 @@ L_dasurd:
 	return 0;
     }
 
-/*     See whether double precision record number RECNO from file HANDLE */
-/*     is buffered.  We'll search through the list of buffered records */
-/*     starting at the head of the list.  If the record is already */
-/*     buffered, we'll update the buffer entry, but we'll defer writing */
-/*     the record out until we need to free a record, or until the */
-/*     d.p. buffer is flushed, whichever comes first. */
-
-    node = headd;
-    while(node > 0) {
-	if (*handle == hnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		s_rnge("hnbufd", i__1, "dasrwr_", (ftnlen)2982)] && *recno == 
-		rnbufd[(i__2 = node - 1) < 10 && 0 <= i__2 ? i__2 : s_rnge(
-		"rnbufd", i__2, "dasrwr_", (ftnlen)2982)]) {
-
-/*           Found it.  Update the buffered record. */
-
-	    i__2 = *last - *first + 1;
-	    moved_(datad, &i__2, &rcbufd[(i__1 = *first + (node << 7) - 129) <
-		     1280 && 0 <= i__1 ? i__1 : s_rnge("rcbufd", i__1, "dasr"
-		    "wr_", (ftnlen)2987)]);
-
-/*           Set the update flag, indicating that this buffer entry */
-/*           has been modified. */
-
-	    upbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
-		    "fd", i__1, "dasrwr_", (ftnlen)2993)] = TRUE_;
-
-/*           Put the information about this record at the head of the */
-/*           active list, if it is not already there. */
-
-	    if (node != headd) {
-		lnkxsl_(&node, &node, poold);
-		lnkilb_(&node, &headd, poold);
-		headd = node;
-	    }
-	    chkout_("DASURD", (ftnlen)6);
-	    return 0;
-	}
-	node = poold[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
-		s_rnge("poold", i__1, "dasrwr_", (ftnlen)3012)];
-    }
-
-/*     The record we're writing to is not buffered.  In order to */
-/*     update this record, we'll need to read it first.  But before */
-/*     we do that, we'll need to allocate a buffer entry.  If the record */
-/*     buffer is full, we'll commandeer the least recently accessed */
-/*     record.  Before using this record, we'll write its contents out */
-/*     to the corresponding file, if the record has been updated. */
-
-    if (usedd < 10) {
-
-/*        There's a free buffer entry available.  Just allocate it. */
-
-	lnkan_(poold, &node);
-	++usedd;
-    } else {
-
-/*        Grab the buffer entry at the tail end of the list. */
-
-	node = lnktl_(&headd, poold);
-	lnkxsl_(&node, &node, poold);
-
-/*        If the allocated record was updated, write it out. */
-
-	if (upbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
-		"fd", i__1, "dasrwr_", (ftnlen)3043)]) {
-	    zzddhhlu_(&hnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		    s_rnge("hnbufd", i__1, "dasrwr_", (ftnlen)3045)], "DAS", &
-		    c_false, &wrunit, (ftnlen)3);
-	    dasiod_("WRITE", &wrunit, &rnbufd[(i__1 = node - 1) < 10 && 0 <= 
-		    i__1 ? i__1 : s_rnge("rnbufd", i__1, "dasrwr_", (ftnlen)
-		    3047)], &rcbufd[(i__2 = (node << 7) - 128) < 1280 && 0 <= 
-		    i__2 ? i__2 : s_rnge("rcbufd", i__2, "dasrwr_", (ftnlen)
-		    3047)], (ftnlen)5);
-	    if (failed_()) {
-		chkout_("DASURD", (ftnlen)6);
-		return 0;
-	    }
-	}
-    }
-
-/*     Now try to read the record we're going to update. */
+/*     Update the record in the DAS record buffer, which reads the */
+/*     record from the file first if it is not buffered.  The updated */
+/*     record is written to the file later, as by DASWRD. */
 
-    zzdasgrd_(handle, recno, &rcbufd[(i__1 = (node << 7) - 128) < 1280 && 0 <=
-	     i__1 ? i__1 : s_rnge("rcbufd", i__1, "dasrwr_", (ftnlen)3065)]);
-    if (failed_()) {
-	chkout_("DASURD", (ftnlen)6);
-	return 0;
-    }
-
-/*     The read was successful, so set the record number, handle, */
-/*     and update flag for this buffer entry, and link these buffer */
-/*     entries in before the current head of the list, thus putting */
-/*     them at the head. */
-
-/*     Update the head pointer. */
-
-    lnkilb_(&node, &headd, poold);
-    hnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("hnbufd", i__1,
-	     "dasrwr_", (ftnlen)3082)] = *handle;
-    rnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("rnbufd", i__1,
-	     "dasrwr_", (ftnlen)3083)] = *recno;
-    upbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbufd", i__1,
-	     "dasrwr_", (ftnlen)3084)] = TRUE_;
-    headd = node;
-
-/*     At long last, make the requested update.  Note that we don't */
-/*     have to write the record back to the file; that will get done */
-/*     automatically before or at the time the file is closed. */
-
-    i__2 = *last - *first + 1;
-    moved_(datad, &i__2, &rcbufd[(i__1 = *first + (node << 7) - 129) < 1280 &&
-	     0 <= i__1 ? i__1 : s_rnge("rcbufd", i__1, "dasrwr_", (ftnlen)
-	    3092)]);
+    zzdasbud_(handle, recno, first, last, datad);
     chkout_("DASURD", (ftnlen)6);
     return 0;
 /* $Procedure DASURI ( DAS, update record, integer ) */
@@ -2901,7 +1998,6 @@ L_dasuri:
 /*     FIRST, */
 /*     LAST       I   First and last indices of range within record. */
 /*     DATAI      I   Integer data to write to record. */
-/*     BUFSZI     P   Number of records in the integer record buffer. */
 /*     NWI        P   Number of integers in a single DAS integer record. */
 
 /* $ Detailed_Input */
@@ -2934,8 +2030,6 @@ L_dasuri:
 /*     NWI           is the number of integers in a single DAS record */
 /*                   containing integers. */
 
-/*     BUFSZI        is the number of records in the integer record */
-/*                   buffer. */
 
 /* $ Exceptions */
 
@@ -3080,15 +2174,6 @@ L_dasuri:
 	return 0;
     }
 
-/*     If it hasn't been done yet, initialize the pointer list pools. */
-
-    if (pass1) {
-	lnkini_(&c__10, poold);
-	lnkini_(&c__10, pooli);
-	lnkini_(&c__10, poolc);
-	pass1 = FALSE_;
-    }
-
 /*     If FIRST or LAST are out of range, no dice. */
 
     if (*first < 1 || *first > 256 || *last < 1 || *last > 256) {
@@ -3113,119 +2198,11 @@ L_dasuri:
 	return 0;
     }
 
-/*     See whether integer record number RECNO from file HANDLE is */
-/*     buffered.  We'll search through the list of buffered records */
-/*     starting at the head of the list.  If the record is already */
-/*     buffered, we'll update the buffer entry, but we'll defer writing */
-/*     the record out until we need to free a record, or until the */
-/*     integer buffer is flushed, whichever comes first. */
-
-    node = headi;
-    while(node > 0) {
-	if (*handle == hnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		s_rnge("hnbufi", i__1, "dasrwr_", (ftnlen)3406)] && *recno == 
-		rnbufi[(i__2 = node - 1) < 10 && 0 <= i__2 ? i__2 : s_rnge(
-		"rnbufi", i__2, "dasrwr_", (ftnlen)3406)]) {
-
-/*           Found it.  Update the buffered record. */
-
-	    i__2 = *last - *first + 1;
-	    movei_(datai, &i__2, &rcbufi[(i__1 = *first + (node << 8) - 257) <
-		     2560 && 0 <= i__1 ? i__1 : s_rnge("rcbufi", i__1, "dasr"
-		    "wr_", (ftnlen)3411)]);
-
-/*           Set the update flag, indicating that this buffer entry */
-/*           has been modified. */
-
-	    upbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
-		    "fi", i__1, "dasrwr_", (ftnlen)3417)] = TRUE_;
-
-/*           Put the information about this record at the head of the */
-/*           active list, if it is not already there. */
-
-	    if (node != headi) {
-		lnkxsl_(&node, &node, pooli);
-		lnkilb_(&node, &headi, pooli);
-		headi = node;
-	    }
-	    chkout_("DASURI", (ftnlen)6);
-	    return 0;
-	}
-	node = pooli[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
-		s_rnge("pooli", i__1, "dasrwr_", (ftnlen)3436)];
-    }
-
-/*     The record we're writing to is not buffered.  We'll allocate */
-/*     a buffer entry.  If the record buffer is full, we'll */
-/*     commandeer the least recently accessed record.  Before using */
-/*     this record, we'll write its contents out to the corresponding */
-/*     file, if the record has been updated. */
-
-    if (usedi < 10) {
-
-/*        There's a free buffer entry available.  Just allocate it. */
-
-	lnkan_(pooli, &node);
-	++usedi;
-    } else {
-
-/*        Grab the buffer entry at the tail end of the list. */
-
-	node = lnktl_(&headi, pooli);
-	lnkxsl_(&node, &node, pooli);
-
-/*        If the allocated record was updated, write it out. */
-
-	if (upbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
-		"fi", i__1, "dasrwr_", (ftnlen)3465)]) {
-	    zzddhhlu_(&hnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		    s_rnge("hnbufi", i__1, "dasrwr_", (ftnlen)3467)], "DAS", &
-		    c_false, &wrunit, (ftnlen)3);
-	    dasioi_("WRITE", &wrunit, &rnbufi[(i__1 = node - 1) < 10 && 0 <= 
-		    i__1 ? i__1 : s_rnge("rnbufi", i__1, "dasrwr_", (ftnlen)
-		    3469)], &rcbufi[(i__2 = (node << 8) - 256) < 2560 && 0 <= 
-		    i__2 ? i__2 : s_rnge("rcbufi", i__2, "dasrwr_", (ftnlen)
-		    3469)], (ftnlen)5);
-	    if (failed_()) {
-		chkout_("DASURI", (ftnlen)6);
-		return 0;
-	    }
-	}
-    }
-
-/*     Now try to read the record we're going to update. */
-
-    zzdasgri_(handle, recno, &rcbufi[(i__1 = (node << 8) - 256) < 2560 && 0 <=
-	     i__1 ? i__1 : s_rnge("rcbufi", i__1, "dasrwr_", (ftnlen)3486)]);
-    if (failed_()) {
-	chkout_("DASURI", (ftnlen)6);
-	return 0;
-    }
+/*     Update the record in the DAS record buffer, which reads the */
+/*     record from the file first if it is not buffered.  The updated */
+/*     record is written to the file later, as by DASWRI. */
 
-/*     The read was successful, so set the record number, handle, */
-/*     and update flag for this buffer entry, and link these buffer */
-/*     entries in before the current head of the list, thus putting */
-/*     them at the head. */
-
-/*     Update the head pointer. */
-
-    lnkilb_(&node, &headi, pooli);
-    hnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("hnbufi", i__1,
-	     "dasrwr_", (ftnlen)3503)] = *handle;
-    rnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("rnbufi", i__1,
-	     "dasrwr_", (ftnlen)3504)] = *recno;
-    upbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbufi", i__1,
-	     "dasrwr_", (ftnlen)3505)] = TRUE_;
-    headi = node;
-
-/*     At long last, make the requested update.  Note that we don't */
-/*     have to write the record back to the file; that will get done */
-/*     automatically before or at the time the file is closed. */
-
-    i__2 = *last - *first + 1;
-    movei_(datai, &i__2, &rcbufi[(i__1 = *first + (node << 8) - 257) < 2560 &&
-	     0 <= i__1 ? i__1 : s_rnge("rcbufi", i__1, "dasrwr_", (ftnlen)
-	    3513)]);
+    zzdasbui_(handle, recno, first, last, datai);
     chkout_("DASURI", (ftnlen)6);
     return 0;
 /* $Procedure DASURC ( DAS, update record, character ) */
@@ -3287,7 +2264,6 @@ L_dasurc:
 /*     FIRST, */
 /*     LAST       I   First and last indices of range within record. */
 /*     DATAC      I   Character data to write to record. */
-/*     BUFSZC     P   Number of records in the character record buffer. */
 /*     NWC        P   Number of characters in a single DAS char. record. */
 
 /* $ Detailed_Input */
@@ -3320,8 +2296,6 @@ L_dasurc:
 /*     NWC           is the number of characters in a single DAS record */
 /*                   containing characters. */
 
-/*     BUFSZC        is the number of records in the character record */
-/*                   buffer. */
 
 /* $ Exceptions */
 
@@ -3471,15 +2445,6 @@ L_dasurc:
 	return 0;
     }
 
-/*     If it hasn't been done yet, initialize the pointer list pools. */
-
-    if (pass1) {
-	lnkini_(&c__10, poold);
-	lnkini_(&c__10, pooli);
-	lnkini_(&c__10, poolc);
-	pass1 = FALSE_;
-    }
-
 /*     If FIRST or LAST are out of range, no dice. */
 
     if (*first < 1 || *first > 1024 || *last < 1 || *last > 1024) {
@@ -3504,119 +2469,11 @@ L_dasurc:
 	return 0;
     }
 
-/*     See whether character record number RECNO from file HANDLE is */
-/*     buffered.  We'll search through the list of buffered records */
-/*     starting at the head of the list.  If the record is already */
-/*     buffered, we'll update the buffer entry, but we'll defer writing */
-/*     the record out until we need to free a record, or until the */
-/*     character buffer is flushed, whichever comes first. */
-
-    node = headc;
-    while(node > 0) {
-	if (*handle == hnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		s_rnge("hnbufc", i__1, "dasrwr_", (ftnlen)3833)] && *recno == 
-		rnbufc[(i__2 = node - 1) < 10 && 0 <= i__2 ? i__2 : s_rnge(
-		"rnbufc", i__2, "dasrwr_", (ftnlen)3833)]) {
-
-/*           Found it.  Update the buffered record. */
-
-	    s_copy(rcbufc + ((((i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		    s_rnge("rcbufc", i__1, "dasrwr_", (ftnlen)3838)) << 10) + 
-		    (*first - 1)), datac, *last - (*first - 1), datac_len);
-
-/*           Set the update flag, indicating that this buffer entry */
-/*           has been modified. */
-
-	    upbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
-		    "fc", i__1, "dasrwr_", (ftnlen)3844)] = TRUE_;
-
-/*           Put the information about this record at the head of the */
-/*           active list, if it is not already there. */
-
-	    if (node != headc) {
-		lnkxsl_(&node, &node, poolc);
-		lnkilb_(&node, &headc, poolc);
-		headc = node;
-	    }
-	    chkout_("DASURC", (ftnlen)6);
-	    return 0;
-	}
-	node = poolc[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
-		s_rnge("poolc", i__1, "dasrwr_", (ftnlen)3863)];
-    }
-
-/*     The record we're writing to is not buffered.  We'll allocate */
-/*     a buffer entry.  If the record buffer is full, we'll */
-/*     commandeer the least recently accessed record.  Before using */
-/*     this record, we'll write its contents out to the corresponding */
-/*     file, if the record has been updated. */
-
-    if (usedc < 10) {
-
-/*        There's a free buffer entry available.  Just allocate it. */
-
-	lnkan_(poolc, &node);
-	++usedc;
-    } else {
+/*     Update the record in the DAS record buffer, which reads the */
+/*     record from the file first if it is not buffered.  The updated */
+/*     record is written to the file later, as by DASWRC. */
 
-/*        Grab the buffer entry at the tail end of the list. */
-
-	node = lnktl_(&headc, poolc);
-	lnkxsl_(&node, &node, poolc);
-
-/*        If the allocated record was updated, write it out. */
-
-	if (upbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
-		"fc", i__1, "dasrwr_", (ftnlen)3892)]) {
-	    zzddhhlu_(&hnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		    s_rnge("hnbufc", i__1, "dasrwr_", (ftnlen)3895)], "DAS", &
-		    c_false, &wrunit, (ftnlen)3);
-	    dasioc_("WRITE", &wrunit, &rnbufc[(i__1 = node - 1) < 10 && 0 <= 
-		    i__1 ? i__1 : s_rnge("rnbufc", i__1, "dasrwr_", (ftnlen)
-		    3897)], rcbufc + (((i__2 = node - 1) < 10 && 0 <= i__2 ? 
-		    i__2 : s_rnge("rcbufc", i__2, "dasrwr_", (ftnlen)3897)) <<
-		     10), (ftnlen)5, (ftnlen)1024);
-	    if (failed_()) {
-		chkout_("DASURC", (ftnlen)6);
-		return 0;
-	    }
-	}
-    }
-
-/*     Now try to read the record we're going to update. */
-
-    zzddhhlu_(handle, "DAS", &c_false, &unit, (ftnlen)3);
-    dasioc_("READ", &unit, recno, rcbufc + (((i__1 = node - 1) < 10 && 0 <= 
-	    i__1 ? i__1 : s_rnge("rcbufc", i__1, "dasrwr_", (ftnlen)3916)) << 
-	    10), (ftnlen)4, (ftnlen)1024);
-    if (failed_()) {
-	chkout_("DASURC", (ftnlen)6);
-	return 0;
-    }
-
-/*     The read was successful, so set the record number, handle, */
-/*     and update flag for this buffer entry, and link these buffer */
-/*     entries in before the current head of the list, thus putting */
-/*     them at the head. */
-
-/*     Update the head pointer. */
-
-    lnkilb_(&node, &headc, poolc);
-    hnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("hnbufc", i__1,
-	     "dasrwr_", (ftnlen)3933)] = *handle;
-    rnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("rnbufc", i__1,
-	     "dasrwr_", (ftnlen)3934)] = *recno;
-    upbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbufc", i__1,
-	     "dasrwr_", (ftnlen)3935)] = TRUE_;
-    headc = node;
-
-/*     At long last, make the requested update.  Note that we don't */
-/*     have to write the record back to the file; that will get done */
-/*     automatically before or at the time the file is closed. */
-
-    s_copy(rcbufc + ((((i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge(
-	    "rcbufc", i__1, "dasrwr_", (ftnlen)3943)) << 10) + (*first - 1)), 
-	    datac, *last - (*first - 1), datac_len);
+    zzdasbuc_(handle, recno, first, last, datac, datac_len);
     chkout_("DASURC", (ftnlen)6);
     return 0;
 /* $Procedure DASWBR ( DAS, write buffered records ) */
@@ -3701,9 +2558,11 @@ L_daswbr:
 
 /* $ Particulars */
 
-/*     This routine writes buffered records out to the DAS file to which */
-/*     they correspond.  After the records are written, the buffer */
-/*     elements used to store them are deallocated. */
+/*     This routine writes the updated buffered records of a DAS file */
+/*     out to the file, in order of increasing record number.  Records */
+/*     that have not been updated since they were read from the file */
+/*     are not written.  After the records are written, the buffer */
+/*     elements used to store the records of the file are deallocated. */
 
 /*     Because the DAS system buffers records that are written as well */
 /*     as those that are read, data supplied to the DASWRx and DASURx */
@@ -3824,154 +2683,10 @@ L_daswbr:
 	return 0;
     }
 
-/*     If it hasn't been done yet, initialize the pointer list pools. */
-
-    if (pass1) {
-	lnkini_(&c__10, poold);
-	lnkini_(&c__10, pooli);
-	lnkini_(&c__10, poolc);
-	pass1 = FALSE_;
-    }
-
-/*     Obtain a logical unit for HANDLE. */
+/*     Write the updated buffered records of the file, and free the */
+/*     buffer entries of all of its records. */
 
-    zzddhhlu_(handle, "DAS", &c_false, &wrunit, (ftnlen)3);
-    if (failed_()) {
-	chkout_("DASWBR", (ftnlen)6);
-	return 0;
-    }
-
-/*     For each buffer, find the records belonging to this file, and */
-/*     write them out to the file. */
-
-/*     Double precision records first. */
-
-    node = headd;
-    while(node > 0) {
-	if (*handle == hnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		s_rnge("hnbufd", i__1, "dasrwr_", (ftnlen)4200)]) {
-
-/*           This record belongs to the file of interest, so write the */
-/*           the record out. */
-
-	    dasiod_("WRITE", &wrunit, &rnbufd[(i__1 = node - 1) < 10 && 0 <= 
-		    i__1 ? i__1 : s_rnge("rnbufd", i__1, "dasrwr_", (ftnlen)
-		    4205)], &rcbufd[(i__2 = (node << 7) - 128) < 1280 && 0 <= 
-		    i__2 ? i__2 : s_rnge("rcbufd", i__2, "dasrwr_", (ftnlen)
-		    4205)], (ftnlen)5);
-	    if (failed_()) {
-		chkout_("DASWBR", (ftnlen)6);
-		return 0;
-	    }
-
-/*           The record is no longer in use; return it to the */
-/*           free list.  But grab the successor first.  Update */
-/*           the head of the list, if the node we're freeing is */
-/*           the head node.  Decrement the number of used d.p. */
-/*           buffer elements. */
-
-	    next = poold[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
-		    s_rnge("poold", i__1, "dasrwr_", (ftnlen)4222)];
-	    if (node == headd) {
-		headd = next;
-	    }
-	    lnkfsl_(&node, &node, poold);
-	    node = next;
-	    --usedd;
-	} else {
-
-/*           Just get the next node. */
-
-	    node = poold[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
-		    s_rnge("poold", i__1, "dasrwr_", (ftnlen)4237)];
-	}
-    }
-
-/*     Next, integer records. */
-
-    node = headi;
-    while(node > 0) {
-	if (*handle == hnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		s_rnge("hnbufi", i__1, "dasrwr_", (ftnlen)4252)]) {
-
-/*           This record belongs to the file of interest, so write the */
-/*           the record out. */
-
-	    dasioi_("WRITE", &wrunit, &rnbufi[(i__1 = node - 1) < 10 && 0 <= 
-		    i__1 ? i__1 : s_rnge("rnbufi", i__1, "dasrwr_", (ftnlen)
-		    4257)], &rcbufi[(i__2 = (node << 8) - 256) < 2560 && 0 <= 
-		    i__2 ? i__2 : s_rnge("rcbufi", i__2, "dasrwr_", (ftnlen)
-		    4257)], (ftnlen)5);
-	    if (failed_()) {
-		chkout_("DASWBR", (ftnlen)6);
-		return 0;
-	    }
-
-/*           The record is no longer in use; return it to the */
-/*           free list.  But grab the successor first.  Update */
-/*           the head of the list, if the node we're freeing is */
-/*           the head node.  Decrement the number of used integer */
-/*           buffer elements. */
-
-	    next = pooli[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
-		    s_rnge("pooli", i__1, "dasrwr_", (ftnlen)4274)];
-	    if (node == headi) {
-		headi = next;
-	    }
-	    lnkfsl_(&node, &node, pooli);
-	    node = next;
-	    --usedi;
-	} else {
-
-/*           Just get the next node. */
-
-	    node = pooli[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
-		    s_rnge("pooli", i__1, "dasrwr_", (ftnlen)4289)];
-	}
-    }
-
-/*     And last, character records. */
-
-    node = headc;
-    while(node > 0) {
-	if (*handle == hnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		s_rnge("hnbufc", i__1, "dasrwr_", (ftnlen)4304)]) {
-
-/*           This record belongs to the file of interest, so write the */
-/*           the record out. */
-
-	    dasioc_("WRITE", &wrunit, &rnbufc[(i__1 = node - 1) < 10 && 0 <= 
-		    i__1 ? i__1 : s_rnge("rnbufc", i__1, "dasrwr_", (ftnlen)
-		    4309)], rcbufc + (((i__2 = node - 1) < 10 && 0 <= i__2 ? 
-		    i__2 : s_rnge("rcbufc", i__2, "dasrwr_", (ftnlen)4309)) <<
-		     10), (ftnlen)5, (ftnlen)1024);
-	    if (failed_()) {
-		chkout_("DASWBR", (ftnlen)6);
-		return 0;
-	    }
-
-/*           The record is no longer in use; return it to the */
-/*           free list.  But grab the successor first.  Update */
-/*           the head of the list, if the node we're freeing is */
-/*           the head node.  Decrement the number of used character */
-/*           buffer elements. */
-
-	    next = poolc[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
-		    s_rnge("poolc", i__1, "dasrwr_", (ftnlen)4326)];
-	    if (node == headc) {
-		headc = next;
-	    }
-	    lnkfsl_(&node, &node, poolc);
-	    node = next;
-	    --usedc;
-	} else {
-
-/*           Just get the next node. */
-
-	    node = poolc[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
-		    s_rnge("poolc", i__1, "dasrwr_", (ftnlen)4341)];
-	}
-    }
+    zzdasbwb_(handle);
     chkout_("DASWBR", (ftnlen)6);
     return 0;
 } /* dasrwr_ */
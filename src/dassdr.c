@@ -56,7 +56,8 @@ static integer c__0 = 0;
     integer minadr, maxadr, scrhan, lastla[3];
     extern /* Subroutine */ int dassih_(integer *, char *, ftnlen), dashlu_(
 	    integer *, integer *), daswbr_(integer *), dasrri_(integer *, 
-	    integer *, integer *, integer *, integer *);
+	    integer *, integer *, integer *, integer *), zzdasbiv_(integer *),
+	     zzdascmi_(integer *);
     integer offset;
     extern /* Subroutine */ int dasioi_(char *, integer *, integer *, integer 
 	    *, ftnlen);
@@ -931,6 +932,14 @@ static integer c__0 = 0;
 
     dasioi_("WRITE", &unit, &recno, irec, (ftnlen)5);
 
+/*     The records of the file were moved by direct writes, so any */
+/*     buffered copies of them, including the directory records read */
+/*     above, are out of date, as is the map of the file's clusters */
+/*     kept for DASA2L.  Discard them. */
+
+    zzdasbiv_(handle);
+    zzdascmi_(handle);
+
 /*     Write out the updated file summary. */
 
     dasufs_(handle, &nresvr, &nresvc, &ncomr, &ncomc, &free, lastla, lastrc, 
@@ -9,6 +9,7 @@
 
 static integer c__1 = 1;
 static integer c__2 = 2;
+static integer c__5 = 5;
 static integer c__200 = 200;
 static integer c__400 = 400;
 
@@ -18,12 +19,18 @@ static integer c__400 = 400;
 {
     /* Initialized data */
 
+    static logical first = TRUE_;
     static char missed[20*5] = "DELTET/DELTA_T_A, # " "DELTET/K, #         " 
 	    "DELTET/EB, #        " "DELTET/M, #         " "DELTET/DELTA_AT, "
 	    "#  ";
+    static logical nodata = TRUE_;
+    static char vars__[16*5] = "DELTET/DELTA_T_A" "DELTET/K        " "DELTET"
+	    "/EB       " "DELTET/M        " "DELTET/DELTA_AT ";
+    static integer hintu = 0;
+    static integer hinte = 0;
 
     /* System generated locals */
-    integer i__1, i__2, i__3;
+    integer i__1;
     doublereal d__1;
 
     /* Builtin functions */
@@ -33,25 +40,37 @@ static integer c__400 = 400;
 
     /* Local variables */
     char type__[4];
-    integer i__;
-    doublereal k, m[2];
+    integer i__, j;
+    static doublereal k, m[2];
     integer n;
-    doublereal dleap[400]	/* was [2][200] */;
+    static doublereal dleap[400]	/* was [2][200] */;
     extern /* Subroutine */ int chkin_(char *, ftnlen);
-    integer nleap;
+    static integer nleap;
     extern /* Subroutine */ int ucase_(char *, char *, ftnlen, ftnlen), 
 	    errch_(char *, char *, ftnlen, ftnlen);
     doublereal leaps, ettai;
     logical found[5];
     char dtype[1];
-    doublereal ea, eb, ma, et;
+    static doublereal eb;
+    doublereal ea, ma;
+    static doublereal etleap[200];
+    integer lo, hi, mid;
+    static logical mono;
     extern /* Subroutine */ int gdpool_(char *, integer *, integer *, integer 
 	    *, doublereal *, logical *, ftnlen), sigerr_(char *, ftnlen), 
 	    chkout_(char *, ftnlen), dtpool_(char *, logical *, integer *, 
 	    char *, ftnlen, ftnlen), setmsg_(char *, ftnlen), errint_(char *, 
 	    integer *, ftnlen);
+    extern logical failed_(void);
+    static integer usrctr[2];
+    extern /* Subroutine */ int zzcvpool_(char *, integer *, logical *, 
+	    ftnlen), zzctruin_(integer *);
+    logical update;
+    extern /* Subroutine */ int swpool_(char *, integer *, char *, ftnlen, 
+	    ftnlen);
     extern logical return_(void);
-    doublereal dta, aet;
+    static doublereal dta;
+    doublereal aet;
 
 /* $ Abstract */
 
@@ -159,8 +178,18 @@ static integer c__400 = 400;
 /*      from the kernel pool, where they are assumed to have been */
 /*      loaded from a kernel file. */
 
+/*      The kernel variables are buffered on the first call and */
+/*      re-read only when the kernel pool watcher for this routine */
+/*      reports that one of them has changed. The ephemeris times of */
+/*      the leap seconds are computed when the table is read. */
+
 /*      The tables are consulted to determine the number of leap seconds */
-/*      preceding the input epoch. Also, an approximation to the periodic */
+/*      preceding the input epoch. The search starts from the interval */
+/*      found on the previous call and falls back to a binary search, */
+/*      so for time-ordered input the lookup takes constant time. If */
+/*      the table is not in increasing order it is scanned linearly, */
+/*      as in earlier versions of this routine, so the result does not */
+/*      depend on the search method. Also, an approximation to the periodic */
 /*      yearly variation (which has an amplitude of just under two */
 /*      milliseconds) in the difference between ET and TAI (Atomic Time) */
 /*      is computed. The final value of Delta ET is given by */
@@ -205,9 +234,17 @@ static integer c__400 = 400;
 
 /*      W.M. Owen       (JPL) */
 /*      I.M. Underwood  (JPL) */
+/*      Nabla Zero Labs */
 
 /* $ Version */
 
+/* -    SPICELIB Version 2.0.0, 18-OCT-2026 (NZL) */
+
+/*        The kernel variables are now buffered and refreshed through */
+/*        a kernel pool watcher instead of being fetched on each call. */
+/*        The leap second table is searched using a hint from the */
+/*        previous call and a binary search. */
+
 /* -    SPICELIB Version 1.2.2, 18-APR-2014 (BVS) */
 
 /*        Minor header edits. */
@@ -283,124 +320,162 @@ static integer c__400 = 400;
 
 
 /*     Standard SPICE error handling. */
-
     if (return_()) {
 	return 0;
     } else {
 	chkin_("DELTET", (ftnlen)6);
     }
 
-/*     Convert the epoch type to uppercase, to simplify comparisons. */
+/*     On the first call, set a watch on the kernel variables. */
 
+    if (first) {
+	first = FALSE_;
+	zzctruin_(usrctr);
+	swpool_("DELTET", &c__5, vars__, (ftnlen)6, (ftnlen)16);
+    }
     ucase_(eptype, type__, eptype_len, (ftnlen)4);
 
-/*     Extract the necessary constants from the kernel pool. */
-/*     Leap seconds and their epochs are interleaved in DELTA_AT. */
-
-/*     DLEAP(1,i) is the number of leap seconds at DLEAP(2,i) UTC */
-/*     seconds past J2000. */
-
-    gdpool_("DELTET/DELTA_T_A", &c__1, &c__1, &n, &dta, found, (ftnlen)16);
-    gdpool_("DELTET/K", &c__1, &c__1, &n, &k, &found[1], (ftnlen)8);
-    gdpool_("DELTET/EB", &c__1, &c__1, &n, &eb, &found[2], (ftnlen)9);
-    gdpool_("DELTET/M", &c__1, &c__2, &n, m, &found[3], (ftnlen)8);
-
-/*     Check that the number of leapseconds is not too great for our */
-/*     buffer size (not likely). */
-
-    dtpool_("DELTET/DELTA_AT", &found[4], &nleap, dtype, (ftnlen)15, (ftnlen)
-	    1);
-    if (nleap > 400) {
-	setmsg_("Number of leapseconds, #, is greater than the number that c"
-		"an be buffered, #.", (ftnlen)77);
-	i__1 = nleap / 2;
-	errint_("#", &i__1, (ftnlen)1);
-	errint_("#", &c__200, (ftnlen)1);
-	sigerr_("SPICE(BUFFERTOOSMALL)", (ftnlen)21);
-	chkout_("DELTET", (ftnlen)6);
-	return 0;
-    }
-    gdpool_("DELTET/DELTA_AT", &c__1, &c__400, &nleap, dleap, &found[4], (
-	    ftnlen)15);
-    nleap /= 2;
-    if (! (found[0] && found[1] && found[2] && found[3] && found[4])) {
-	setmsg_("The following, needed to compute Delta ET (ET - UTC), could"
-		" not be found in the kernel pool: #", (ftnlen)94);
-	for (i__ = 1; i__ <= 5; ++i__) {
-	    if (! found[(i__1 = i__ - 1) < 5 && 0 <= i__1 ? i__1 : s_rnge(
-		    "found", i__1, "deltet_", (ftnlen)341)]) {
-		errch_("#", missed + ((i__1 = i__ - 1) < 5 && 0 <= i__1 ? 
-			i__1 : s_rnge("missed", i__1, "deltet_", (ftnlen)342))
-			 * 20, (ftnlen)1, (ftnlen)20);
+/*     Fetch the kernel variables only if they have been updated */
+/*     since the last call, or if the last fetch failed. */
+
+    zzcvpool_("DELTET", usrctr, &update, (ftnlen)6);
+    if (update || nodata) {
+	nodata = TRUE_;
+	gdpool_("DELTET/DELTA_T_A", &c__1, &c__1, &n, &dta, found, (ftnlen)16)
+		;
+	gdpool_("DELTET/K", &c__1, &c__1, &n, &k, &found[1], (ftnlen)8);
+	gdpool_("DELTET/EB", &c__1, &c__1, &n, &eb, &found[2], (ftnlen)9);
+	gdpool_("DELTET/M", &c__1, &c__2, &n, m, &found[3], (ftnlen)8);
+	dtpool_("DELTET/DELTA_AT", &found[4], &nleap, dtype, (ftnlen)15, (
+		ftnlen)1);
+	if (nleap > 400) {
+	    setmsg_("Number of leapseconds, #, is greater than the number th"
+		    "at can be buffered, #.", (ftnlen)77);
+	    i__1 = nleap / 2;
+	    errint_("#", &i__1, (ftnlen)1);
+	    errint_("#", &c__200, (ftnlen)1);
+	    sigerr_("SPICE(BUFFERTOOSMALL)", (ftnlen)21);
+	    chkout_("DELTET", (ftnlen)6);
+	    return 0;
+	}
+	gdpool_("DELTET/DELTA_AT", &c__1, &c__400, &nleap, dleap, &found[4], (
+		ftnlen)15);
+	if (failed_()) {
+	    chkout_("DELTET", (ftnlen)6);
+	    return 0;
+	}
+	nleap /= 2;
+	if (! (found[0] && found[1] && found[2] && found[3] && found[4])) {
+
+/*           Reset the watch so that the variables are fetched again */
+/*           once they are loaded. */
+
+	    swpool_("DELTET", &c__5, vars__, (ftnlen)6, (ftnlen)16);
+	    setmsg_("The following, needed to compute Delta ET (ET - UTC), c"
+		    "ould not be found in the kernel pool: #", (ftnlen)94);
+	    for (i__ = 1; i__ <= 5; ++i__) {
+		if (! found[(i__1 = i__ - 1) < 5 && 0 <= i__1 ? i__1 : 
+			s_rnge("found", i__1, "deltet_", (ftnlen)341)]) {
+		    errch_("#", missed + ((i__1 = i__ - 1) < 5 && 0 <= i__1 ? 
+			    i__1 : s_rnge("missed", i__1, "deltet_", (ftnlen)
+			    342)) * 20, (ftnlen)1, (ftnlen)20);
+		}
 	    }
+	    errch_(", #", ".", (ftnlen)3, (ftnlen)1);
+	    sigerr_("SPICE(KERNELVARNOTFOUND)", (ftnlen)24);
+	    chkout_("DELTET", (ftnlen)6);
+	    return 0;
 	}
-	errch_(", #", ".", (ftnlen)3, (ftnlen)1);
-	sigerr_("SPICE(KERNELVARNOTFOUND)", (ftnlen)24);
-	chkout_("DELTET", (ftnlen)6);
-	return 0;
-    }
-
-/*     There are two separate quantities to be determined. First, */
-/*     the appropriate number of leap seconds. Second, the size of */
-/*     the periodic term ET-TAI. */
 
+/*        Compute the ephemeris time of each leap second, and note */
+/*        whether the table may be searched by bisection. */
+
+	mono = TRUE_;
+	for (i__ = 1; i__ <= nleap; ++i__) {
+	    d__1 = dleap[(i__ << 1) - 1] + dta + dleap[(i__ << 1) - 2];
+	    aet = d_nint(&d__1);
+	    ma = m[0] + m[1] * aet;
+	    ea = ma + eb * sin(ma);
+	    ettai = k * sin(ea);
+	    etleap[i__ - 1] = dleap[(i__ << 1) - 1] + dta + dleap[(i__ << 1) 
+		    - 2] + ettai;
+	    if (i__ > 1) {
+		if (dleap[(i__ << 1) - 1] < dleap[(i__ << 1) - 3] || etleap[
+			i__ - 1] < etleap[i__ - 2]) {
+		    mono = FALSE_;
+		}
+	    }
+	}
+	hintu = 0;
+	hinte = 0;
+	nodata = FALSE_;
+    }
 
-/*     For epochs before the first leap second, return Delta ET at */
-/*     the epoch of the leap second minus one second. */
+/*     Find the last leap second preceding the epoch. The predicate */
+/*     below is true for leap seconds 1 through J and false for the */
+/*     rest when the table is ordered; J is found by checking the */
+/*     interval used last time, then by bisection. */
 
     leaps = dleap[0] - 1;
-
-/*     When counting leap seconds for UTC epochs, we can compare */
-/*     directly against the values in DLEAP. */
-
     if (s_cmp(type__, "UTC", (ftnlen)4, (ftnlen)3) == 0) {
-	i__1 = nleap;
-	for (i__ = 1; i__ <= i__1; ++i__) {
-	    if (*epoch >= dleap[(i__2 = (i__ << 1) - 1) < 400 && 0 <= i__2 ? 
-		    i__2 : s_rnge("dleap", i__2, "deltet_", (ftnlen)375)]) {
-		leaps = dleap[(i__2 = (i__ << 1) - 2) < 400 && 0 <= i__2 ? 
-			i__2 : s_rnge("dleap", i__2, "deltet_", (ftnlen)376)];
+	if (mono) {
+	    j = hintu;
+	    if (! ((j == 0 || *epoch >= dleap[(j << 1) - 1]) && (j == nleap ||
+		     ! (*epoch >= dleap[(j << 1) + 1])))) {
+		lo = 0;
+		hi = nleap;
+		while(lo < hi) {
+		    mid = (lo + hi + 1) / 2;
+		    if (*epoch >= dleap[(mid << 1) - 1]) {
+			lo = mid;
+		    } else {
+			hi = mid - 1;
+		    }
+		}
+		j = lo;
+		hintu = j;
+	    }
+	    if (j > 0) {
+		leaps = dleap[(j << 1) - 2];
+	    }
+	} else {
+	    for (i__ = 1; i__ <= nleap; ++i__) {
+		if (*epoch >= dleap[(i__ << 1) - 1]) {
+		    leaps = dleap[(i__ << 1) - 2];
+		}
 	    }
 	}
-
-/*     For ET epochs, things are a little tougher. In order to compare */
-/*     the input epoch against the epochs of the leap seconds, we need */
-/*     to compute ET-TAI at each of the leap epochs. To make sure that */
-/*     the computation is reversible, it is always done at the nearest */
-/*     ET second (the "approximate ET", or AET). */
-
-/*     There must be a hundred ways to do this more efficiently. */
-/*     For now, we'll settle for one that works. */
-
     } else if (s_cmp(type__, "ET", (ftnlen)4, (ftnlen)2) == 0) {
-	i__1 = nleap;
-	for (i__ = 1; i__ <= i__1; ++i__) {
-	    if (*epoch > dleap[(i__2 = (i__ << 1) - 1) < 400 && 0 <= i__2 ? 
-		    i__2 : s_rnge("dleap", i__2, "deltet_", (ftnlen)393)]) {
-		d__1 = dleap[(i__2 = (i__ << 1) - 1) < 400 && 0 <= i__2 ? 
-			i__2 : s_rnge("dleap", i__2, "deltet_", (ftnlen)395)] 
-			+ dta + dleap[(i__3 = (i__ << 1) - 2) < 400 && 0 <= 
-			i__3 ? i__3 : s_rnge("dleap", i__3, "deltet_", (
-			ftnlen)395)];
-		aet = d_nint(&d__1);
-		ma = m[0] + m[1] * aet;
-		ea = ma + eb * sin(ma);
-		ettai = k * sin(ea);
-		et = dleap[(i__2 = (i__ << 1) - 1) < 400 && 0 <= i__2 ? i__2 :
-			 s_rnge("dleap", i__2, "deltet_", (ftnlen)401)] + dta 
-			+ dleap[(i__3 = (i__ << 1) - 2) < 400 && 0 <= i__3 ? 
-			i__3 : s_rnge("dleap", i__3, "deltet_", (ftnlen)401)] 
-			+ ettai;
-		if (*epoch >= et) {
-		    leaps = dleap[(i__2 = (i__ << 1) - 2) < 400 && 0 <= i__2 ?
-			     i__2 : s_rnge("dleap", i__2, "deltet_", (ftnlen)
-			    404)];
+	if (mono) {
+	    j = hinte;
+	    if (! ((j == 0 || (*epoch > dleap[(j << 1) - 1] && *epoch >= 
+		    etleap[j - 1])) && (j == nleap || ! (*epoch > dleap[(j << 
+		    1) + 1] && *epoch >= etleap[j])))) {
+		lo = 0;
+		hi = nleap;
+		while(lo < hi) {
+		    mid = (lo + hi + 1) / 2;
+		    if (*epoch > dleap[(mid << 1) - 1] && *epoch >= etleap[
+			    mid - 1]) {
+			lo = mid;
+		    } else {
+			hi = mid - 1;
+		    }
+		}
+		j = lo;
+		hinte = j;
+	    }
+	    if (j > 0) {
+		leaps = dleap[(j << 1) - 2];
+	    }
+	} else {
+	    for (i__ = 1; i__ <= nleap; ++i__) {
+		if (*epoch > dleap[(i__ << 1) - 1] && *epoch >= etleap[i__ - 
+			1]) {
+		    leaps = dleap[(i__ << 1) - 2];
 		}
 	    }
 	}
-
-/*     Uh, those are the only choices. */
-
     } else {
 	setmsg_("Epoch type was #", (ftnlen)16);
 	errch_("#", type__, (ftnlen)1, (ftnlen)4);
@@ -408,10 +483,6 @@ static integer c__400 = 400;
 	chkout_("DELTET", (ftnlen)6);
 	return 0;
     }
-
-/*     Add the constant offset, leap seconds, and the relativistic term */
-/*     (as before, computed at the nearest ET second). */
-
     if (s_cmp(type__, "ET", (ftnlen)4, (ftnlen)2) == 0) {
 	aet = d_nint(epoch);
     } else if (s_cmp(type__, "UTC", (ftnlen)4, (ftnlen)3) == 0) {
@@ -582,12 +582,7 @@ static integer c_b20 = 32000000;
 /*     WORKSZ      is the second dimension of the workspace array WORK. */
 /*                 WORKSZ must be at least as large as the greater of */
 
-/*                    - the number of fine voxel-plate associations */
-
-/*                      This number is equal to */
-
-/*                         NP * {average number of fine voxels */
-/*                               intersected by each plate} */
+/*                    - NP + 1 */
 
 /*                    - the number of vertex-plate associations, if */
 /*                      the vertex-plate mapping is constructed. */
@@ -596,6 +591,10 @@ static integer c_b20 = 32000000;
 
 /*                         NV + ( 3 * NP ) */
 
+/*                 The fine voxel-plate associations are built */
+/*                 directly in SPAIXI and no longer require */
+/*                 workspace. */
+
 
 /*     VOXPSZ      is the size of the fine voxel-plate pointer array. */
 /*                 This array maps fine voxels to lists of plates that */
@@ -704,11 +703,10 @@ static integer c_b20 = 32000000;
 /*         SPICE(BADPLATECOUNT) is signaled. */
 
 /*     5)  If the workspace size WORKSZ is less than NP+1, the error */
-/*         SPICE(WORKSPACETOOSMALL) is signaled. This is merely a */
-/*         sanity check; normally the workspace will need to be */
-/*         substantially larger than this reference value. See the */
-/*         description of WORKSZ in the header section Detailed_Input */
-/*         above. */
+/*         SPICE(WORKSPACETOOSMALL) is signaled. If the vertex-plate */
+/*         mapping is constructed, the workspace must be larger than */
+/*         this reference value. See the description of WORKSZ in the */
+/*         header section Detailed_Input above. */
 
 /*     6)  If the voxel-plate pointer array size VOXPSZ is less than 1, */
 /*         the error SPICE(PTRARRAYTOOSMALL) is signaled. This is merely */
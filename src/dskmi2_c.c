@@ -149,12 +149,7 @@
    worksz      is the second dimension of the workspace array `work'. 
                `worksz' must be at least as large as the greater of 
                 
-                  - the number of fine voxel-plate associations 
- 
-                    This number is equal to 
- 
-                       np * {average number of fine voxels  
-                             intersected by each plate} 
+                  - np + 1 
  
                   - the number of vertex-plate associations, if 
                     the vertex-plate mapping is constructed. 
@@ -162,6 +157,9 @@
                     This number is equal to 
  
                        nv + ( 3 * np ) 
+ 
+               The fine voxel-plate associations are built directly 
+               in `spaixi' and no longer require workspace. 
                      
  
    voxpsz      is the size of the fine voxel-plate pointer array. 
@@ -0,0 +1,168 @@
+/*
+
+-Procedure ekbndi_c ( EK, bind integer value to query parameter )
+
+-Abstract
+
+   Bind a integer value to a parameter of a query prepared by
+   ekprep_c.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   EK
+
+-Keywords
+
+   EK
+   SEARCH
+
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+
+
+   void ekbndi_c ( SpiceInt            qryid,
+                   SpiceInt            prmidx,
+                   SpiceInt            ival )
+
+/*
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   qryid      I   ID of a prepared query.
+   prmidx     I   Index of the parameter.
+   ival       I   Integer value to bind.
+
+-Detailed_Input
+
+   qryid       is the ID of a query prepared by ekprep_c.
+
+   prmidx      is the index of the parameter of the query to which
+               the value is bound.  The parameters of a query are the
+               literal values on the right sides of its constraints,
+               numbered from 0 in the order in which they appear in
+               the query.  See ekprep_c.
+
+   ival        is the integer to be bound to the parameter.  The
+               parameter must be a number compared with a numeric
+               column, or a time string compared with a time column.
+               Integers bound to time parameters are ET values.
+
+-Detailed_Output
+
+   None.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1)  If `qryid' is not the ID of a prepared query, the error
+       SPICE(NOSUCHQUERY) is signaled by a routine in the call tree of
+       this routine.
+
+   2)  If `prmidx' is not the index of a parameter of the query, the
+       error SPICE(INVALIDINDEX) is signaled by a routine in the call
+       tree of this routine.
+
+   3)  If the parameter is a string value, the error
+       SPICE(TYPEMISMATCH) is signaled by a routine in the call tree of
+       this routine.
+
+   The value of the parameter is not changed when an error is
+   signaled.
+
+-Files
+
+   None.
+
+-Particulars
+
+   This routine replaces the value of a numeric or time parameter of
+   a prepared query with the integer `ival'.  The new value is used by
+   the next executions of the query by ekexec_c.
+
+-Examples
+
+   See ekprep_c.
+
+-Restrictions
+
+   None.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 19-OCT-2026 (NZL)
+
+-Index_Entries
+
+   bind integer to EK query parameter
+
+-&
+*/
+
+{ /* Begin ekbndi_c */
+
+
+   /*
+   Local variables
+   */
+   SpiceInt                fPrmidx;
+
+
+   /*
+   Participate in error tracing.
+   */
+   if ( return_c() )
+   {
+      return;
+   }
+   chkin_c ( "ekbndi_c" );
+
+   fPrmidx = prmidx + 1;
+
+   zzekpqi_ ( (integer    *) &qryid,
+              (integer    *) &fPrmidx,
+              (integer    *) &ival     );
+
+
+   chkout_c ( "ekbndi_c" );
+
+} /* End ekbndi_c */
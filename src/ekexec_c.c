@@ -0,0 +1,203 @@
+/*
+
+-Procedure ekexec_c ( EK, execute prepared query )
+
+-Abstract
+
+   Find the E-kernel data matching a query prepared by ekprep_c, with
+   the values currently bound to its parameters.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   EK
+
+-Keywords
+
+   EK
+   SEARCH
+
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZst.h"
+   #include "SpiceZmc.h"
+
+
+   void ekexec_c ( SpiceInt            qryid,
+                   SpiceInt            lenout,
+                   SpiceInt          * nmrows,
+                   SpiceBoolean      * error,
+                   SpiceChar         * errmsg )
+
+/*
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   qryid      I   ID of a prepared query.
+   lenout     I   Declared length of output error message string.
+   nmrows     O   Number of matching rows.
+   error      O   Flag indicating whether an error was found.
+   errmsg     O   Error description.
+
+-Detailed_Input
+
+   qryid       is the ID of a query prepared by ekprep_c.
+
+   lenout      is the declared length of the output string `errmsg'.
+
+-Detailed_Output
+
+   nmrows      is the number of rows matching the prepared query, with
+               the values currently bound to its parameters.  The
+               matching rows are fetched by ekgc_c, ekgd_c, ekgi_c and
+               the other EK fetch routines, as those found by
+               ekfind_c.
+
+   error       is a flag indicating whether an error was found during
+               the search, as the ekfind_c output of the same name.
+
+   errmsg      is a description of the error, if `error' is SPICETRUE,
+               and is blank otherwise.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1)  If `qryid' is not the ID of a prepared query, the error
+       SPICE(NOSUCHQUERY) is signaled by a routine in the call tree of
+       this routine.
+
+   2)  If EK files have been loaded or unloaded, by eklef_c, ekuef_c,
+       furnsh_c or unload_c, since the query was prepared, the error
+       SPICE(STALEQUERY) is signaled by a routine in the call tree of
+       this routine.  No search is made; the query must be prepared
+       again by ekprep_c.
+
+   3)  If `errmsg' is a null pointer or `lenout' is less than 2, an
+       error is signaled by a routine in the call tree of this
+       routine.
+
+   4)  Errors found during the search are diagnosed or signaled as by
+       ekfind_c.
+
+-Files
+
+   The EK files loaded by eklef_c are searched.
+
+-Particulars
+
+   This routine performs the search ekfind_c performs for the query
+   `qryid', without scanning, parsing or resolving the query again.
+   The results of the previous query, whether found by ekfind_c or by
+   this routine, are replaced.
+
+-Examples
+
+   See ekprep_c.
+
+-Restrictions
+
+   1)  Queries must be prepared again after EK files are loaded or
+       unloaded.  See Exceptions.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 19-OCT-2026 (NZL)
+
+-Index_Entries
+
+   execute prepared EK query
+
+-&
+*/
+
+{ /* Begin ekexec_c */
+
+
+   /*
+   Local variables
+   */
+   logical                 fError;
+
+
+   /*
+   Participate in error tracing.
+   */
+   if ( return_c() )
+   {
+      return;
+   }
+   chkin_c ( "ekexec_c" );
+
+   /*
+   Make sure the output string has at least enough room for one output
+   character and a null terminator.  Also check for a null pointer.
+   */
+   CHKOSTR ( CHK_STANDARD, "ekexec_c", errmsg, lenout );
+
+   /*
+   Call the f2c'd routine.
+   */
+   zzekpqx_ ( (integer    *) &qryid,
+              (integer    *) nmrows,
+              (logical    *) &fError,
+              (char       *) errmsg,
+              (ftnlen      ) lenout-1 );
+
+   if ( fError )
+   {
+      /*
+      Convert the Fortran error message to a C string by placing a
+      null after the last non-blank character.
+      */
+      F2C_ConvertStr ( lenout, errmsg );
+   }
+   else
+   {
+      errmsg[0] = NULLCHAR;
+   }
+
+   *error = (SpiceBoolean) fError;
+
+
+   chkout_c ( "ekexec_c" );
+
+} /* End ekexec_c */
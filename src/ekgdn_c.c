@@ -0,0 +1,288 @@
+/*
+
+-Procedure ekgdn_c ( EK, get event data, double precision, N rows )
+
+-Abstract
+
+   Return an element of the entries in a column of double precision
+   or time type in each of a range of rows of the result of the last
+   query.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   EK
+
+-Keywords
+
+   ASSIGNMENT
+   EK
+
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZmc.h"
+   #include "zzalloc.h"
+
+
+   void ekgdn_c ( SpiceInt          selidx,
+                  SpiceInt          row,
+                  SpiceInt          nrows,
+                  SpiceInt          elment,
+                  SpiceDouble       dvals  [],
+                  SpiceBoolean      nulls  [],
+                  SpiceBoolean      found  [] )
+
+/*
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   selidx     I   Index of parent column in SELECT clause.
+   row        I   First row to fetch from.
+   nrows      I   Number of rows to fetch from.
+   elment     I   Index of element, within column entries, to fetch.
+   dvals      O   D.p. elements of column entries.
+   nulls      O   Flags indicating whether column entries were null.
+   found      O   Flags indicating whether elements were found.
+
+-Detailed_Input
+
+   selidx      is the SELECT clause index of the column to fetch from.
+               The range of selidx is 0 : (nsel-1), where nsel is the
+               number of items in the SELECT clause of the current
+               query.
+
+   row,
+   nrows       are the first of a range of rows of the query result to
+               fetch from, and the number of rows in the range.  Rows
+               row : row+nrows-1 are fetched from.  The range of row
+               indices is 0 : (nmrows-1), where nmrows is the number
+               of rows matching the query, as returned by ekfind_c.
+
+   elment      is the index of the element of the column entries to
+               fetch, as for ekgd_c.  The normal range of elment is
+               0 : (nelt-1), where nelt is the number of elements of a
+               column entry.  elment may exceed the number of elements
+               in an entry; the corresponding element of `found' is
+               then returned SPICEFALSE.
+
+-Detailed_Output
+
+   dvals       is an array of `nrows' elements.  Element i, for
+               i = 0 : nrows-1, is the requested element of the entry
+               in row row+i.  If the entry in a row is null, the
+               corresponding element is undefined.
+
+   nulls       is an array of `nrows' flags indicating whether the entry
+               of the column in each row is null.
+
+   found       is an array of `nrows' flags indicating whether the
+               requested element was found in each row.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1)  If `elment' is less than 0, the error SPICE(INVALIDINDEX) is
+       signaled by a routine in the call tree of this routine.
+
+   2)  If `selidx' is outside of the range established by the last
+       query passed to ekfind_c, the error SPICE(INVALIDINDEX) is
+       signaled by a routine in the call tree of this routine.
+
+   3)  If `nrows' is less than 1, the error SPICE(INVALIDCOUNT) is
+       signaled.
+
+   4)  If `row' is less than 0, or row+nrows is greater than the
+       number of rows matching the query, the error
+       SPICE(INVALIDINDEX) is signaled by a routine in the call tree
+       of this routine.
+
+   5)  If the specified column does not have double precision or time
+       type, the error SPICE(INVALIDTYPE) is signaled by a routine in
+       the call tree of this routine.
+
+   6)  If memory cannot be allocated for the null and found flags, the
+       error SPICE(MALLOCFAILED) is signaled.
+
+
+   If an error occurs while the elements are fetched, the outputs for
+   the rows preceding the one being fetched are valid; the others are
+   undefined.
+
+-Files
+
+   The EK "query and fetch" suite of functions reads binary `sequence
+   component' EK files.  In order for a binary EK file to be accessible
+   to this routine, the file must be `loaded' via a call to the
+   function eklef_c.
+
+-Particulars
+
+   This routine returns the element ekgd_c returns, for each of a
+   range of rows of the query result, so that a whole result column
+   can be fetched with one call.  Fetching a large result one element
+   at a time repeats, for each element, the checks of the arguments,
+   the lookup of the column, and the reading of the row's full row and
+   segment vectors.  This routine does that work once for the range,
+   reads only the parts of the row vectors it needs, and looks up the
+   column descriptor again only when the segment of the rows changes.
+
+   Row ranges may be fetched in pieces of any size; fetching a result
+   in pieces of a few thousand rows needs little memory and is nearly
+   as fast as fetching it whole.
+
+-Examples
+
+   1)  Fetch the first elements of the entries of the first column of
+       the SELECT clause, for all of the `nmrows' rows matching a
+       query.
+
+          SpiceBoolean        * found;
+          SpiceBoolean        * nulls;
+          SpiceDouble         * dvals;
+
+             ...
+
+          dvals = malloc ( nmrows * sizeof(SpiceDouble)  );
+          nulls = malloc ( nmrows * sizeof(SpiceBoolean) );
+          found = malloc ( nmrows * sizeof(SpiceBoolean) );
+
+          ekgdn_c ( 0, 0, nmrows, 0, dvals, nulls, found );
+
+-Restrictions
+
+   None.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 19-OCT-2026 (NZL)
+
+-Index_Entries
+
+   fetch elements from double precision column entries of many rows
+
+-&
+*/
+
+{ /* Begin ekgdn_c */
+
+
+   /*
+   Local variables
+   */
+   logical               * logicalFlags;
+
+   SpiceInt                fElment;
+   SpiceInt                fRow;
+   SpiceInt                fSelidx;
+   SpiceInt                i;
+   SpiceInt                nBytes;
+
+
+   /*
+   Participate in error tracing.
+   */
+   if ( return_c() )
+   {
+      return;
+   }
+   chkin_c ( "ekgdn_c" );
+
+   if ( nrows < 1 )
+   {
+      setmsg_c ( "The row count # must be at least 1." );
+      errint_c ( "#",  nrows                         );
+      sigerr_c ( "SPICE(INVALIDCOUNT)"               );
+      chkout_c ( "ekgdn_c"                           );
+      return;
+   }
+
+   /*
+   The f2c'd routine returns its null and found flags in an array of
+   type logical.
+   */
+   nBytes = 2 * nrows * sizeof(logical);
+
+   logicalFlags = (logical *) alloc_SpiceMemory( (size_t)nBytes );
+
+   if ( !logicalFlags )
+   {
+      setmsg_c ( "Workspace allocation of # bytes failed due to "
+                 "malloc failure"                               );
+      errint_c ( "#",  nBytes                                   );
+      sigerr_c ( "SPICE(MALLOCFAILED)"                          );
+      chkout_c ( "ekgdn_c"                                      );
+      return;
+   }
+
+   /*
+   Convert indices to Fortran-style.
+   */
+   fSelidx = selidx + 1;
+   fRow    = row    + 1;
+   fElment = elment + 1;
+
+   /*
+   Call the f2c'd routine.
+   */
+   ekgdn_ ( (integer    *) &fSelidx,
+            (integer    *) &fRow,
+            (integer    *) &nrows,
+            (integer    *) &fElment,
+            (doublereal *) dvals,
+            (logical    *) logicalFlags,
+            (logical    *) ( logicalFlags + nrows ) );
+
+   /*
+   Set the SpiceBoolean output flags.
+   */
+   for ( i = 0;  i < nrows;  i++ )
+   {
+      nulls[i] = (SpiceBoolean) logicalFlags[i        ];
+      found[i] = (SpiceBoolean) logicalFlags[i + nrows];
+   }
+
+   free_SpiceMemory( (void *)logicalFlags );
+
+
+   chkout_c ( "ekgdn_c" );
+
+} /* End ekgdn_c */
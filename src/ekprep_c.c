@@ -0,0 +1,274 @@
+/*
+
+-Procedure ekprep_c ( EK, prepare query )
+
+-Abstract
+
+   Compile an EK query once, so that it can be executed many times
+   with different values bound to its literal values.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   EK
+
+-Keywords
+
+   EK
+   PARSE
+   SEARCH
+
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZst.h"
+   #include "SpiceZmc.h"
+
+
+   void ekprep_c ( ConstSpiceChar    * query,
+                   SpiceInt            lenout,
+                   SpiceInt          * qryid,
+                   SpiceBoolean      * error,
+                   SpiceChar         * errmsg )
+
+/*
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   query      I   Query to be prepared.
+   lenout     I   Declared length of output error message string.
+   qryid      O   ID of the prepared query.
+   error      O   Flag indicating whether query parsed correctly.
+   errmsg     O   Parse error description.
+
+-Detailed_Input
+
+   query       is an EK query, of the form accepted by ekfind_c.
+
+               The literal values on the right sides of the
+               constraints of the WHERE clause are the parameters of
+               the prepared query.  The parameters are numbered from
+               0, in the order in which they appear in the query.  A
+               literal value appearing once in the query is a single
+               parameter, even if the query is rearranged internally
+               so that it is used by several constraints.
+               Constraints using the operators IS NULL and IS NOT
+               NULL have no parameter.
+
+               The literal values of the query are the initial values
+               of its parameters.
+
+   lenout      is the declared length of the output string `errmsg'.
+
+-Detailed_Output
+
+   qryid       is the ID of the prepared query, used to refer to it
+               in calls to ekbndc_c, ekbndd_c, ekbndi_c, ekexec_c and
+               ekpclr_c.  qryid is zero if `error' is SPICETRUE.
+
+   error       is a flag indicating whether the query was found to be
+               invalid, as the ekfind_c output of the same name.
+
+   errmsg      is a description of the error in the query, if `error'
+               is SPICETRUE, and is blank otherwise.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1)  Errors in the query are diagnosed through the outputs `error'
+       and `errmsg', as by ekfind_c.
+
+   2)  If 20 queries are already prepared, the error
+       SPICE(TOOMANYQUERIES) is signaled by a routine in the call tree
+       of this routine.
+
+   3)  If memory for the prepared query cannot be allocated, the
+       error SPICE(MALLOCFAILED) is signaled by a routine in the call
+       tree of this routine.
+
+   4)  If `query' is a null pointer or an empty string, an error is
+       signaled by a routine in the call tree of this routine.  If
+       `errmsg' is a null pointer or `lenout' is less than 2, an
+       error is likewise signaled.
+
+   The problems ekfind_c signals as errors, such as the absence of
+   loaded EK files, are also signaled by this routine.
+
+-Files
+
+   The names in the query are resolved against the tables of the EK
+   files loaded by eklef_c.
+
+-Particulars
+
+   ekfind_c scans and parses its query, rearranges its constraints
+   into a disjunction of conjunctions, and resolves its names and
+   time strings, before each search.  When the same query is issued
+   many times with different values, such as different time bounds,
+   this work is repeated at every call; for selective queries it may
+   take longer than the search itself.
+
+   This routine does that work once.  The values of the parameters of
+   the prepared query are then changed by ekbndc_c, ekbndd_c and
+   ekbndi_c, and the query is executed by ekexec_c, which searches for
+   the matching rows as ekfind_c does.  The rows are fetched by the
+   same routines as those found by ekfind_c.
+
+   A prepared query is kept until it is released by ekpclr_c.  Up to
+   20 queries may be prepared at once.
+
+-Examples
+
+   1)  Find the events of types 1 and 3 in each of a series of time
+       windows.
+
+          SpiceBoolean          error;
+          SpiceChar             errmsg [ 1841 ];
+          SpiceInt              i;
+          SpiceInt              nmrows;
+          SpiceInt              qryid;
+
+             ...
+
+          ekprep_c ( "SELECT ID, T FROM EVT "
+                     "WHERE T > '2026 JAN 1' AND T < '2026 JAN 2' "
+                     "AND ( K = 1 OR K = 3 ) ORDER BY T",
+                     1841, &qryid, &error, errmsg               );
+
+          if ( error )
+          {
+             printf ( "%s\n", errmsg );
+             return;
+          }
+
+          for ( i = 0;  i < nwin;  i++ )
+          {
+             ekbndd_c ( qryid, 0, start[i] );
+             ekbndd_c ( qryid, 1, stop [i] );
+
+             ekexec_c ( qryid, 1841, &nmrows, &error, errmsg );
+
+             ...  fetch the rows with ekgd_c or ekgdn_c ...
+          }
+
+          ekpclr_c ( qryid );
+
+       The two time bounds are parameters 0 and 1; the event types 1
+       and 3 are parameters 2 and 3.
+
+-Restrictions
+
+   1)  A prepared query refers to the tables and columns of the EK
+       files loaded when it was prepared.  Queries must be prepared
+       again after EK files are loaded or unloaded; ekexec_c signals
+       an error if they are not.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 19-OCT-2026 (NZL)
+
+-Index_Entries
+
+   prepare EK query
+   compile EK query for repeated execution
+
+-&
+*/
+
+{ /* Begin ekprep_c */
+
+
+   /*
+   Local variables
+   */
+   logical                 fError;
+
+
+   /*
+   Participate in error tracing.
+   */
+   if ( return_c() )
+   {
+      return;
+   }
+   chkin_c ( "ekprep_c" );
+
+   /*
+   Check the query string to make sure the pointer is non-null
+   and the string length is non-zero.
+   */
+   CHKFSTR ( CHK_STANDARD, "ekprep_c", query );
+
+   /*
+   Make sure the output string has at least enough room for one output
+   character and a null terminator.  Also check for a null pointer.
+   */
+   CHKOSTR ( CHK_STANDARD, "ekprep_c", errmsg, lenout );
+
+   /*
+   Call the f2c'd routine.
+   */
+   zzekpqp_ ( (char       *) query,
+              (integer    *) qryid,
+              (logical    *) &fError,
+              (char       *) errmsg,
+              (ftnlen      ) strlen(query),
+              (ftnlen      ) lenout-1       );
+
+   if ( fError )
+   {
+      /*
+      Convert the Fortran error message to a C string by placing a
+      null after the last non-blank character.
+      */
+      F2C_ConvertStr ( lenout, errmsg );
+   }
+   else
+   {
+      errmsg[0] = NULLCHAR;
+   }
+
+   *error = (SpiceBoolean) fError;
+
+
+   chkout_c ( "ekprep_c" );
+
+} /* End ekprep_c */
@@ -126,7 +126,7 @@ static integer c__11000 = 11000;
 	    lnkilb_(integer *, integer *, integer *), zzekpgch_(integer *, 
 	    char *, ftnlen), ssizec_(integer *, char *, ftnlen), validc_(
 	    integer *, integer *, char *, ftnlen), lnkfsl_(integer *, integer 
-	    *, integer *), errint_(char *, integer *, ftnlen);
+	    *, integer *), errint_(char *, integer *, ftnlen), zzekpqu_(void);
     extern logical zzekrmch_(integer *, logical *, integer *, integer *, 
 	    integer *, integer *, integer *, integer *, integer *, char *, 
 	    integer *, integer *, doublereal *, integer *, ftnlen);
@@ -139,7 +139,8 @@ static integer c__11000 = 11000;
 	    integer *, integer *, char *, integer *, char *, integer *, 
 	    ftnlen, ftnlen), zzekreqi_(integer *, char *, integer *, ftnlen), 
 	    appndc_(char *, char *, ftnlen, ftnlen), appndi_(integer *, 
-	    integer *), zzeksdec_(integer *), cleari_(integer *, integer *), 
+	    integer *), zzeksdec_(integer *), zzekjmrs_(void), cleari_(
+	    integer *, integer *), 
 	    zzekqcnj_(integer *, integer *, integer *), zzekqcon_(integer *, 
 	    char *, doublereal *, integer *, integer *, char *, integer *, 
 	    char *, integer *, integer *, char *, integer *, char *, integer *
@@ -165,7 +166,7 @@ static integer c__11000 = 11000;
 	    , integer *, integer *, integer *, integer *, integer *, integer *
 	    , integer *, integer *, integer *, integer *), zzekstop_(integer *
 	    );
-    static integer i__, cjbeg, j;
+    static integer i__, cjbeg, j, lstseg;
     extern integer cardc_(char *, ftnlen);
     static integer k, cbegs[1000], cjend, l, r__, t, cends[1000];
     extern /* Subroutine */ int chkin_(char *, ftnlen);
@@ -1353,28 +1354,28 @@ static integer c__11000 = 11000;
 /*     Variable  I/O  Entry points */
 /*     --------  ---  -------------------------------------------------- */
 /*     CINDEX     I   EKCII */
-/*     ELMENT     I   EKGC, EKGD, EKGI */
+/*     ELMENT     I   EKGC, EKGD, EKGI, EKGCN, EKGDN, EKGIN */
 /*     EQRYC      I   EKSRCH */
 /*     EQRYD      I   EKSRCH */
 /*     EQRYI      I   EKSRCH */
 /*     FNAME      I   EKLEF */
-/*     ROW        I   EKGC, EKGD, EKGI, EKNELT */
-/*     SELIDX     I   EKGC, EKGD, EKGI, EKNELT */
+/*     ROW        I   EKGC, EKGD, EKGI, EKGCN, EKGDN, EKGIN, EKNELT */
+/*     SELIDX     I   EKGC, EKGD, EKGI, EKGCN, EKGDN, EKGIN, EKNELT */
 /*     COLUMN    I-O  EKCIN, EKGC, EKGD, EKGI, EKNELT, EKCII */
 /*     HANDLE    I-O  EKLEF, EKUEF */
-/*     N         I-O  EKTNAM, EKNTAB */
+/*     N         I-O  EKTNAM, EKNTAB, EKGCN, EKGDN, EKGIN */
 /*     TABLE     I-O  EKCCNT, EKCII, EKTNAM */
 /*     ATTDSC     O   EKCII, EKCIN */
 /*     CCOUNT     O   EKCCNT */
-/*     FOUND      O   EKCIN, EKGC, EKGD, EKGI */
+/*     FOUND      O   EKCIN, EKGC, EKGD, EKGI, EKGCN, EKGDN, EKGIN */
 /*     NELT       O   EKNELT */
 /*     NMROWS     O   EKSRCH */
 /*     SEMERR     O   EKSRCH */
 /*     ERRMSG     O   EKSRCH */
-/*     CDATA      O   EKGC */
-/*     DDATA      O   EKGD */
-/*     IDATA      O   EKGI */
-/*     NULL       O   EKGC, EKGD, EKGI */
+/*     CDATA      O   EKGC, EKGCN */
+/*     DDATA      O   EKGD, EKGDN */
+/*     IDATA      O   EKGI, EKGIN */
+/*     NULL       O   EKGC, EKGD, EKGI, EKGCN, EKGDN, EKGIN */
 /*     FTSIZE     P   All */
 /*     MAXCON     P   All */
 /*     MXCLLD     P   All */
@@ -1462,6 +1463,10 @@ static integer c__11000 = 11000;
 /*           EKGD   ( EK, get event data, double precision ) */
 /*           EKGI   ( EK, get event data, integer          ) */
 
+/*           EKGCN  ( EK, get event data, character, N rows        ) */
+/*           EKGDN  ( EK, get event data, double precision, N rows ) */
+/*           EKGIN  ( EK, get event data, integer, N rows          ) */
+
 /*        Utilities: */
 
 /*           EKNTAB ( EK, return the number of loaded tables        ) */
@@ -1941,6 +1946,9 @@ static integer c__11000 = 11000;
 	case 9: goto L_ekgc;
 	case 10: goto L_ekgd;
 	case 11: goto L_ekgi;
+	case 12: goto L_ekgcn;
+	case 13: goto L_ekgdn;
+	case 14: goto L_ekgin;
 	}
 
 
@@ -2260,6 +2268,11 @@ L_eklef:
 
     zzekpgch_(handle, "READ", (ftnlen)4);
 
+/*     The set of loaded EK files is about to change.  Queries prepared */
+/*     against the former set may no longer be executed. */
+
+    zzekpqu_();
+
 /*     Before getting too involved with this new EK file, let's check it */
 /*     out.  We must have enough room to accommodate it in the file */
 /*     table, segment table, table list, and column table. */
@@ -3331,6 +3344,11 @@ L_ekuef:
 	return 0;
     }
 
+/*     The set of loaded EK files is about to change.  Queries prepared */
+/*     against the former set may no longer be executed. */
+
+    zzekpqu_();
+
 /*     If we got to here, HANDLE points to a loaded EK file.  It's */
 /*     time to wipe from the EK tables all trivial fond records */
 /*     pertaining to the file in question. */
@@ -4800,6 +4818,10 @@ L_eksrch:
     zzekstop_(&top);
     zzeksdec_(&top);
 
+/*     Clear the record of join steps kept for EKXPLN. */
+
+    zzekjmrs_();
+
 /*     Initialize the size of the join row set union for the current */
 /*     query.  At this point, no matching rows have been found. */
 
@@ -7386,129 +7408,1092 @@ L_ekgi:
 	    rowidx, elment, idata, null, found);
     chkout_("EKGI", (ftnlen)4);
     return 0;
-} /* ekqmgr_ */
+/* $Procedure     EKGCN  ( EK, get event data, character, N rows ) */
 
-/* Subroutine */ int ekqmgr_(integer *cindex, integer *elment, char *eqryc, 
-	doublereal *eqryd, integer *eqryi, char *fname, integer *row, integer 
-	*selidx, char *column, integer *handle, integer *n, char *table, 
-	integer *attdsc, integer *ccount, logical *found, integer *nelt, 
-	integer *nmrows, logical *semerr, char *errmsg, char *cdata, 
-	doublereal *ddata, integer *idata, logical *null, ftnlen eqryc_len, 
-	ftnlen fname_len, ftnlen column_len, ftnlen table_len, ftnlen 
-	errmsg_len, ftnlen cdata_len)
-{
-    return ekqmgr_0_(0, cindex, elment, eqryc, eqryd, eqryi, fname, row, 
-	    selidx, column, handle, n, table, attdsc, ccount, found, nelt, 
-	    nmrows, semerr, errmsg, cdata, ddata, idata, null, eqryc_len, 
-	    fname_len, column_len, table_len, errmsg_len, cdata_len);
-    }
+L_ekgcn:
+/* $ Abstract */
 
-/* Subroutine */ int eklef_(char *fname, integer *handle, ftnlen fname_len)
-{
-    return ekqmgr_0_(1, (integer *)0, (integer *)0, (char *)0, (doublereal *)
-	    0, (integer *)0, fname, (integer *)0, (integer *)0, (char *)0, 
-	    handle, (integer *)0, (char *)0, (integer *)0, (integer *)0, (
-	    logical *)0, (integer *)0, (integer *)0, (logical *)0, (char *)0, 
-	    (char *)0, (doublereal *)0, (integer *)0, (logical *)0, (ftnint)0,
-	     fname_len, (ftnint)0, (ftnint)0, (ftnint)0, (ftnint)0);
-    }
+/*     Return an element of the entries in a column of character type */
+/*     in each of a range of rows. */
 
-/* Subroutine */ int ekuef_(integer *handle)
-{
-    return ekqmgr_0_(2, (integer *)0, (integer *)0, (char *)0, (doublereal *)
-	    0, (integer *)0, (char *)0, (integer *)0, (integer *)0, (char *)0,
-	     handle, (integer *)0, (char *)0, (integer *)0, (integer *)0, (
-	    logical *)0, (integer *)0, (integer *)0, (logical *)0, (char *)0, 
-	    (char *)0, (doublereal *)0, (integer *)0, (logical *)0, (ftnint)0,
-	     (ftnint)0, (ftnint)0, (ftnint)0, (ftnint)0, (ftnint)0);
-    }
+/* $ Disclaimer */
 
-/* Subroutine */ int ekntab_(integer *n)
-{
-    return ekqmgr_0_(3, (integer *)0, (integer *)0, (char *)0, (doublereal *)
-	    0, (integer *)0, (char *)0, (integer *)0, (integer *)0, (char *)0,
-	     (integer *)0, n, (char *)0, (integer *)0, (integer *)0, (logical 
-	    *)0, (integer *)0, (integer *)0, (logical *)0, (char *)0, (char *)
-	    0, (doublereal *)0, (integer *)0, (logical *)0, (ftnint)0, (
-	    ftnint)0, (ftnint)0, (ftnint)0, (ftnint)0, (ftnint)0);
-    }
+/*     THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE */
+/*     CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S. */
+/*     GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE */
+/*     ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE */
+/*     PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS" */
+/*     TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY */
+/*     WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A */
+/*     PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC */
+/*     SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE */
+/*     SOFTWARE AND RELATED MATERIALS, HOWEVER USED. */
 
-/* Subroutine */ int ektnam_(integer *n, char *table, ftnlen table_len)
-{
-    return ekqmgr_0_(4, (integer *)0, (integer *)0, (char *)0, (doublereal *)
-	    0, (integer *)0, (char *)0, (integer *)0, (integer *)0, (char *)0,
-	     (integer *)0, n, table, (integer *)0, (integer *)0, (logical *)0,
-	     (integer *)0, (integer *)0, (logical *)0, (char *)0, (char *)0, (
-	    doublereal *)0, (integer *)0, (logical *)0, (ftnint)0, (ftnint)0, 
-	    (ftnint)0, table_len, (ftnint)0, (ftnint)0);
-    }
+/*     IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA */
+/*     BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT */
+/*     LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND, */
+/*     INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS, */
+/*     REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE */
+/*     REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY. */
 
-/* Subroutine */ int ekccnt_(char *table, integer *ccount, ftnlen table_len)
-{
-    return ekqmgr_0_(5, (integer *)0, (integer *)0, (char *)0, (doublereal *)
-	    0, (integer *)0, (char *)0, (integer *)0, (integer *)0, (char *)0,
-	     (integer *)0, (integer *)0, table, (integer *)0, ccount, (
-	    logical *)0, (integer *)0, (integer *)0, (logical *)0, (char *)0, 
-	    (char *)0, (doublereal *)0, (integer *)0, (logical *)0, (ftnint)0,
-	     (ftnint)0, (ftnint)0, table_len, (ftnint)0, (ftnint)0);
-    }
+/*     RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF */
+/*     THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY */
+/*     CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE */
+/*     ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE. */
 
-/* Subroutine */ int ekcii_(char *table, integer *cindex, char *column, 
-	integer *attdsc, ftnlen table_len, ftnlen column_len)
-{
-    return ekqmgr_0_(6, cindex, (integer *)0, (char *)0, (doublereal *)0, (
-	    integer *)0, (char *)0, (integer *)0, (integer *)0, column, (
-	    integer *)0, (integer *)0, table, attdsc, (integer *)0, (logical *
-	    )0, (integer *)0, (integer *)0, (logical *)0, (char *)0, (char *)
-	    0, (doublereal *)0, (integer *)0, (logical *)0, (ftnint)0, (
-	    ftnint)0, column_len, table_len, (ftnint)0, (ftnint)0);
+/* $ Required_Reading */
+
+/*     EK */
+
+/* $ Keywords */
+
+/*     ASSIGNMENT */
+/*     EK */
+
+/* $ Declarations */
+
+/*     INTEGER               SELIDX */
+/*     INTEGER               ROW */
+/*     INTEGER               N */
+/*     INTEGER               ELMENT */
+/*     CHARACTER*(*)         CDATA  ( * ) */
+/*     LOGICAL               NULL   ( * ) */
+/*     LOGICAL               FOUND  ( * ) */
+
+/* $ Brief_I/O */
+
+/*     Variable  I/O  Description */
+/*     --------  ---  -------------------------------------------------- */
+/*     SELIDX     I   Index of parent column in SELECT clause. */
+/*     ROW        I   First row to fetch from. */
+/*     N          I   Number of rows to fetch from. */
+/*     ELMENT     I   Index of element, within column entries, to fetch. */
+/*     CDATA      O   Character string elements of column entries. */
+/*     NULL       O   Flags indicating whether column entries were null. */
+/*     FOUND      O   Flags indicating whether elements were found. */
+
+/* $ Detailed_Input */
+
+/*     SELIDX         is the SELECT clause index of the column to */
+/*                    fetch from. */
+
+/*     ROW, */
+/*     N              are the first of a range of output rows containing */
+/*                    the entries to fetch from, and the number of rows */
+/*                    in the range.  Rows ROW : ROW+N-1 are fetched from. */
+
+/*     ELMENT         is the index of the element of the column entries */
+/*                    to fetch, as for EKGC.  ELMENT may exceed */
+/*                    the number of elements in a column entry; the */
+/*                    corresponding element of FOUND is then returned */
+/*                    .FALSE. */
+
+/* $ Detailed_Output */
+
+/*     CDATA          is an array containing the requested element of */
+/*                    the specified column entry in each of the N rows: */
+/*                    CDATA(I) is the element from row ROW+I-1.  If the */
+/*                    entry in a row is null, the corresponding element */
+/*                    of CDATA is undefined. */
+
+/*                    Elements too long to fit in the elements of CDATA */
+/*                    are truncated on the right; shorter ones are */
+/*                    returned blank-padded on the right. */
+
+/*     NULL           is an array of logical flags indicating whether */
+/*                    the entry belonging to the specified column in */
+/*                    each row is null. */
+
+/*     FOUND          is an array of logical flags indicating whether the */
+/*                    specified element was found in each row. */
+
+/* $ Parameters */
+
+/*     None. */
+
+/* $ Exceptions */
+
+/*     1)  If the input argument ELMENT is less than 1, the error */
+/*         SPICE(INVALIDINDEX) is signaled. */
+
+/*     2)  If SELIDX is outside of the range established by the */
+/*         last query passed to EKSRCH, the error SPICE(INVALIDINDEX) */
+/*         is signaled. */
+
+/*     3)  If N is less than 1, the error SPICE(INVALIDCOUNT) is */
+/*         signaled. */
+
+/*     4)  If ROW is less than 1, or ROW+N-1 is greater than the number */
+/*         of rows matching the query, the error SPICE(INVALIDINDEX) is */
+/*         signaled. */
+
+/*     5)  If the specified column does not have character type, the */
+/*         error SPICE(INVALIDTYPE) is signaled. */
+
+/*     6)  If this routine is called when no E-kernels have been loaded, */
+/*         the error SPICE(NOLOADEDFILES) is signaled. */
+
+/*     If an error occurs while the elements are fetched, the outputs */
+/*     for the rows preceding the one being fetched are valid; the */
+/*     others are undefined. */
+
+/* $ Files */
+
+/*     See the header of EKQMGR for a description of files used */
+/*     by this routine. */
+
+/* $ Particulars */
+
+/*     This routine returns the same element as EKGC does from */
+/*     each row of a range of rows of the query result, so that a whole */
+/*     result column can be fetched with one call. */
+
+/*     The checks of the arguments, the location of the column, and */
+/*     the sort of the result are done once for the range rather than */
+/*     once per row.  The descriptor of the column in the segment */
+/*     containing a row is looked up again only when the segment */
+/*     changes, which it rarely does between consecutive rows.  The */
+/*     records of the EK file holding the elements are read through */
+/*     the DAS record buffer, so a record shared by the elements of */
+/*     consecutive rows is read from the file once. */
+
+/* $ Examples */
+
+/*     1)  Fetch the first elements of the entries of column 1 of the */
+/*         result of a query in all matching rows, where NMROWS is */
+/*         the number of matching rows returned by EKFIND and the */
+/*         arrays have room for NMROWS elements. */
+
+/*            CALL EKGCN ( 1, 1, NMROWS, 1, CDATA, NULL, FOUND ) */
+
+/* $ Restrictions */
+
+/*     None. */
+
+/* $ Literature_References */
+
+/*     None. */
+
+/* $ Author_and_Institution */
+
+/*     Nabla Zero Labs */
+
+/* $ Version */
+
+/* -    CSPICE Version 1.0.0, 19-OCT-2026 (NZL) */
+
+/* -& */
+/* $ Index_Entries */
+
+/*     fetch elements from character column entries of many rows */
+
+/* -& */
+
+/*     Standard SPICE error handling. */
+
+    if (return_()) {
+	return 0;
+    } else {
+	chkin_("EKGCN", (ftnlen)5);
     }
 
-/* Subroutine */ int eksrch_(integer *eqryi, char *eqryc, doublereal *eqryd, 
-	integer *nmrows, logical *semerr, char *errmsg, ftnlen eqryc_len, 
-	ftnlen errmsg_len)
-{
-    return ekqmgr_0_(7, (integer *)0, (integer *)0, eqryc, eqryd, eqryi, (
-	    char *)0, (integer *)0, (integer *)0, (char *)0, (integer *)0, (
-	    integer *)0, (char *)0, (integer *)0, (integer *)0, (logical *)0, 
-	    (integer *)0, nmrows, semerr, errmsg, (char *)0, (doublereal *)0, 
-	    (integer *)0, (logical *)0, eqryc_len, (ftnint)0, (ftnint)0, (
-	    ftnint)0, errmsg_len, (ftnint)0);
+/*     There nothing to fetch if no files are loaded. */
+
+    if (fthead <= 0) {
+	setmsg_("No E-kernels are currently loaded.", (ftnlen)34);
+	sigerr_("SPICE(NOLOADEDFILES)", (ftnlen)20);
+	chkout_("EKGCN", (ftnlen)5);
+	return 0;
     }
 
-/* Subroutine */ int eknelt_(integer *selidx, integer *row, integer *nelt)
-{
-    return ekqmgr_0_(8, (integer *)0, (integer *)0, (char *)0, (doublereal *)
-	    0, (integer *)0, (char *)0, row, selidx, (char *)0, (integer *)0, 
-	    (integer *)0, (char *)0, (integer *)0, (integer *)0, (logical *)0,
-	     nelt, (integer *)0, (logical *)0, (char *)0, (char *)0, (
-	    doublereal *)0, (integer *)0, (logical *)0, (ftnint)0, (ftnint)0, 
-	    (ftnint)0, (ftnint)0, (ftnint)0, (ftnint)0);
+/*     The row count must be positive, and the row range must lie */
+/*     within the query result. */
+
+    if (*n < 1) {
+	setmsg_("The row count N must be at least 1 but was #.", (ftnlen)45);
+	errint_("#", n, (ftnlen)1);
+	sigerr_("SPICE(INVALIDCOUNT)", (ftnlen)19);
+	chkout_("EKGCN", (ftnlen)5);
+	return 0;
+    }
+    if (*row < 1 || *row > unrows - *n + 1) {
+	setmsg_("Row indices for query result range from 1 to #; requested r"
+		"ows were #:#.", (ftnlen)72);
+	errint_("#", &unrows, (ftnlen)1);
+	errint_("#", row, (ftnlen)1);
+	i__1 = *row + *n - 1;
+	errint_("#", &i__1, (ftnlen)1);
+	sigerr_("SPICE(INVALIDINDEX)", (ftnlen)19);
+	chkout_("EKGCN", (ftnlen)5);
+	return 0;
     }
 
-/* Subroutine */ int ekgc_(integer *selidx, integer *row, integer *elment, 
-	char *cdata, logical *null, logical *found, ftnlen cdata_len)
-{
-    return ekqmgr_0_(9, (integer *)0, elment, (char *)0, (doublereal *)0, (
-	    integer *)0, (char *)0, row, selidx, (char *)0, (integer *)0, (
-	    integer *)0, (char *)0, (integer *)0, (integer *)0, found, (
-	    integer *)0, (integer *)0, (logical *)0, (char *)0, cdata, (
-	    doublereal *)0, (integer *)0, null, (ftnint)0, (ftnint)0, (ftnint)
-	    0, (ftnint)0, (ftnint)0, cdata_len);
+/*     The element index must be positive. */
+
+    if (*elment < 1) {
+	setmsg_("ELMENT must be positive but was #.", (ftnlen)34);
+	errint_("#", elment, (ftnlen)1);
+	sigerr_("SPICE(INVALIDINDEX)", (ftnlen)19);
+	chkout_("EKGCN", (ftnlen)5);
+	return 0;
     }
 
-/* Subroutine */ int ekgd_(integer *selidx, integer *row, integer *elment, 
-	doublereal *ddata, logical *null, logical *found)
-{
-    return ekqmgr_0_(10, (integer *)0, elment, (char *)0, (doublereal *)0, (
-	    integer *)0, (char *)0, row, selidx, (char *)0, (integer *)0, (
-	    integer *)0, (char *)0, (integer *)0, (integer *)0, found, (
-	    integer *)0, (integer *)0, (logical *)0, (char *)0, (char *)0, 
-	    ddata, (integer *)0, null, (ftnint)0, (ftnint)0, (ftnint)0, (
-	    ftnint)0, (ftnint)0, (ftnint)0);
+/*     Make sure the SELECT clause column index is valid. */
+
+    if (*selidx < 1 || *selidx > nsel) {
+	setmsg_("The SELECT column index # is out of the valid range 1:#", (
+		ftnlen)55);
+	errint_("#", selidx, (ftnlen)1);
+	errint_("#", &nsel, (ftnlen)1);
+	sigerr_("SPICE(INVALIDINDEX)", (ftnlen)19);
+	chkout_("EKGCN", (ftnlen)5);
+	return 0;
     }
 
-/* Subroutine */ int ekgi_(integer *selidx, integer *row, integer *elment, 
+/*     COL is the column's index within the parent */
+/*     table's column list. */
+
+    tabidx = seltab[(i__1 = *selidx - 1) < 50 && 0 <= i__1 ? i__1 : s_rnge(
+	    "seltab", i__1, "ekqmgr_", (ftnlen)6559)];
+    col = selcol[(i__1 = *selidx - 1) < 50 && 0 <= i__1 ? i__1 : s_rnge("sel"
+	    "col", i__1, "ekqmgr_", (ftnlen)6562)];
+    colptr = selctp[(i__1 = *selidx - 1) < 50 && 0 <= i__1 ? i__1 : s_rnge(
+	    "selctp", i__1, "ekqmgr_", (ftnlen)6565)];
+
+/*     Make sure the column has character type. */
+
+    if (cttyps[(i__1 = colptr - 1) < 500 && 0 <= i__1 ? i__1 : s_rnge("cttyps"
+	    , i__1, "ekqmgr_", (ftnlen)6568)] != 1) {
+	setmsg_("Column # has data type #.", (ftnlen)25);
+	errch_("#", ctnams + (((i__1 = colptr - 1) < 500 && 0 <= i__1 ? i__1 :
+		 s_rnge("ctnams", i__1, "ekqmgr_", (ftnlen)6571)) << 5), (
+		ftnlen)1, (ftnlen)32);
+	errch_("#", chtype + (((i__2 = cttyps[(i__1 = colptr - 1) < 500 && 0
+		<= i__1 ? i__1 : s_rnge("cttyps", i__1, "ekqmgr_", (ftnlen)
+		6574)] - 1) < 4 && 0 <= i__2 ? i__2 : s_rnge("chtype", i__2,
+		"ekqmgr_", (ftnlen)6577)) << 2), (ftnlen)1, (ftnlen)4);
+	sigerr_("SPICE(INVALIDTYPE)", (ftnlen)18);
+	chkout_("EKGCN", (ftnlen)5);
+	return 0;
+    }
+
+/*     If it hasn't been done yet, and if it needs to be done, sort the */
+/*     matching row vectors. */
+
+    if (dosort) {
+	zzekjsrt_(&usize, ubase, &norder, otabs, ocols, oelts, sense, sthan,
+		stdscs, stdtpt, dtpool, dtdscs, &ordbas);
+	dosort = FALSE_;
+	sorted = TRUE_;
+    }
+
+/*     Fetch the element from each row in turn.  Only the entries of */
+/*     the row vector and segment vector for the column's table are */
+/*     needed.  Consecutive rows usually come from the same segment, */
+/*     so the column descriptor is looked up only when the segment */
+/*     changes. */
+
+    lstseg = 0;
+    i__1 = *n;
+    for (k = 1; k <= i__1; ++k) {
+	r__ = *row + k - 1;
+	if (sorted) {
+	    i__2 = ordbas + r__;
+	    zzeksrd_(&i__2, &i__2, &i__);
+	    zzekvcal_(&i__, &rwvbas, &sgvbas);
+	} else {
+	    zzekvcal_(&r__, &rwvbas, &sgvbas);
+	}
+	i__2 = rwvbas + tabidx;
+	zzeksrd_(&i__2, &i__2, &rowidx);
+	i__2 = sgvbas + tabidx;
+	zzeksrd_(&i__2, &i__2, &seg);
+	if (seg != lstseg) {
+	    j = stdtpt[(i__2 = seg - 1) < 200 && 0 <= i__2 ? i__2 : s_rnge(
+		    "stdtpt", i__2, "ekqmgr_", (ftnlen)6580)];
+	    i__2 = col;
+	    for (i__ = 2; i__ <= i__2; ++i__) {
+		j = lnknxt_(&j, dtpool);
+	    }
+	    lstseg = seg;
+	}
+	zzekrsc_(&sthan[(i__2 = seg - 1) < 200 && 0 <= i__2 ? i__2 : s_rnge(
+		"sthan", i__2, "ekqmgr_", (ftnlen)6583)], &stdscs[(i__3 = seg *
+		24 - 24) < 4800 && 0 <= i__3 ? i__3 : s_rnge("stdscs", i__3,
+		"ekqmgr_", (ftnlen)6586)], &dtdscs[(i__4 = j * 11 - 11) < 110000
+		&& 0 <= i__4 ? i__4 : s_rnge("dtdscs", i__4, "ekqmgr_", (
+		ftnlen)6589)], &rowidx, elment, &cvlen, cdata + (k - 1) *
+		cdata_len, &null[k - 1], &found[k - 1], cdata_len);
+	if (failed_()) {
+	    chkout_("EKGCN", (ftnlen)5);
+	    return 0;
+	}
+    }
+    chkout_("EKGCN", (ftnlen)5);
+    return 0;
+/* $Procedure     EKGDN  ( EK, get event data, double precision, N rows ) */
+
+L_ekgdn:
+/* $ Abstract */
+
+/*     Return an element of the entries in a column of double precision */
+/*     or `time' type in each of a range of rows. */
+
+/* $ Disclaimer */
+
+/*     THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE */
+/*     CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S. */
+/*     GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE */
+/*     ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE */
+/*     PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS" */
+/*     TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY */
+/*     WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A */
+/*     PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC */
+/*     SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE */
+/*     SOFTWARE AND RELATED MATERIALS, HOWEVER USED. */
+
+/*     IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA */
+/*     BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT */
+/*     LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND, */
+/*     INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS, */
+/*     REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE */
+/*     REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY. */
+
+/*     RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF */
+/*     THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY */
+/*     CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE */
+/*     ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE. */
+
+/* $ Required_Reading */
+
+/*     EK */
+
+/* $ Keywords */
+
+/*     ASSIGNMENT */
+/*     EK */
+
+/* $ Declarations */
+
+/*     INTEGER               SELIDX */
+/*     INTEGER               ROW */
+/*     INTEGER               N */
+/*     INTEGER               ELMENT */
+/*     DOUBLE PRECISION      DDATA  ( * ) */
+/*     LOGICAL               NULL   ( * ) */
+/*     LOGICAL               FOUND  ( * ) */
+
+/* $ Brief_I/O */
+
+/*     Variable  I/O  Description */
+/*     --------  ---  -------------------------------------------------- */
+/*     SELIDX     I   Index of parent column in SELECT clause. */
+/*     ROW        I   First row to fetch from. */
+/*     N          I   Number of rows to fetch from. */
+/*     ELMENT     I   Index of element, within column entries, to fetch. */
+/*     DDATA      O   D.p. elements of column entries. */
+/*     NULL       O   Flags indicating whether column entries were null. */
+/*     FOUND      O   Flags indicating whether elements were found. */
+
+/* $ Detailed_Input */
+
+/*     SELIDX         is the SELECT clause index of the column to */
+/*                    fetch from. */
+
+/*     ROW, */
+/*     N              are the first of a range of output rows containing */
+/*                    the entries to fetch from, and the number of rows */
+/*                    in the range.  Rows ROW : ROW+N-1 are fetched from. */
+
+/*     ELMENT         is the index of the element of the column entries */
+/*                    to fetch, as for EKGD.  ELMENT may exceed */
+/*                    the number of elements in a column entry; the */
+/*                    corresponding element of FOUND is then returned */
+/*                    .FALSE. */
+
+/* $ Detailed_Output */
+
+/*     DDATA          is an array containing the requested element of */
+/*                    the specified column entry in each of the N rows: */
+/*                    DDATA(I) is the element from row ROW+I-1.  If the */
+/*                    entry in a row is null, the corresponding element */
+/*                    of DDATA is undefined. */
+
+/*     NULL           is an array of logical flags indicating whether */
+/*                    the entry belonging to the specified column in */
+/*                    each row is null. */
+
+/*     FOUND          is an array of logical flags indicating whether the */
+/*                    specified element was found in each row. */
+
+/* $ Parameters */
+
+/*     None. */
+
+/* $ Exceptions */
+
+/*     1)  If the input argument ELMENT is less than 1, the error */
+/*         SPICE(INVALIDINDEX) is signaled. */
+
+/*     2)  If SELIDX is outside of the range established by the */
+/*         last query passed to EKSRCH, the error SPICE(INVALIDINDEX) */
+/*         is signaled. */
+
+/*     3)  If N is less than 1, the error SPICE(INVALIDCOUNT) is */
+/*         signaled. */
+
+/*     4)  If ROW is less than 1, or ROW+N-1 is greater than the number */
+/*         of rows matching the query, the error SPICE(INVALIDINDEX) is */
+/*         signaled. */
+
+/*     5)  If the specified column does not have DP or TIME type, the */
+/*         error SPICE(INVALIDTYPE) is signaled. */
+
+/*     6)  If this routine is called when no E-kernels have been loaded, */
+/*         the error SPICE(NOLOADEDFILES) is signaled. */
+
+/*     If an error occurs while the elements are fetched, the outputs */
+/*     for the rows preceding the one being fetched are valid; the */
+/*     others are undefined. */
+
+/* $ Files */
+
+/*     See the header of EKQMGR for a description of files used */
+/*     by this routine. */
+
+/* $ Particulars */
+
+/*     This routine returns the same element as EKGD does from */
+/*     each row of a range of rows of the query result, so that a whole */
+/*     result column can be fetched with one call. */
+
+/*     The checks of the arguments, the location of the column, and */
+/*     the sort of the result are done once for the range rather than */
+/*     once per row.  The descriptor of the column in the segment */
+/*     containing a row is looked up again only when the segment */
+/*     changes, which it rarely does between consecutive rows.  The */
+/*     records of the EK file holding the elements are read through */
+/*     the DAS record buffer, so a record shared by the elements of */
+/*     consecutive rows is read from the file once. */
+
+/* $ Examples */
+
+/*     1)  Fetch the first elements of the entries of column 1 of the */
+/*         result of a query in all matching rows, where NMROWS is */
+/*         the number of matching rows returned by EKFIND and the */
+/*         arrays have room for NMROWS elements. */
+
+/*            CALL EKGDN ( 1, 1, NMROWS, 1, DDATA, NULL, FOUND ) */
+
+/* $ Restrictions */
+
+/*     None. */
+
+/* $ Literature_References */
+
+/*     None. */
+
+/* $ Author_and_Institution */
+
+/*     Nabla Zero Labs */
+
+/* $ Version */
+
+/* -    CSPICE Version 1.0.0, 19-OCT-2026 (NZL) */
+
+/* -& */
+/* $ Index_Entries */
+
+/*     fetch elements from d.p. column entries of many rows */
+
+/* -& */
+
+/*     Standard SPICE error handling. */
+
+    if (return_()) {
+	return 0;
+    } else {
+	chkin_("EKGDN", (ftnlen)5);
+    }
+
+/*     There nothing to fetch if no files are loaded. */
+
+    if (fthead <= 0) {
+	setmsg_("No E-kernels are currently loaded.", (ftnlen)34);
+	sigerr_("SPICE(NOLOADEDFILES)", (ftnlen)20);
+	chkout_("EKGDN", (ftnlen)5);
+	return 0;
+    }
+
+/*     The row count must be positive, and the row range must lie */
+/*     within the query result. */
+
+    if (*n < 1) {
+	setmsg_("The row count N must be at least 1 but was #.", (ftnlen)45);
+	errint_("#", n, (ftnlen)1);
+	sigerr_("SPICE(INVALIDCOUNT)", (ftnlen)19);
+	chkout_("EKGDN", (ftnlen)5);
+	return 0;
+    }
+    if (*row < 1 || *row > unrows - *n + 1) {
+	setmsg_("Row indices for query result range from 1 to #; requested r"
+		"ows were #:#.", (ftnlen)72);
+	errint_("#", &unrows, (ftnlen)1);
+	errint_("#", row, (ftnlen)1);
+	i__1 = *row + *n - 1;
+	errint_("#", &i__1, (ftnlen)1);
+	sigerr_("SPICE(INVALIDINDEX)", (ftnlen)19);
+	chkout_("EKGDN", (ftnlen)5);
+	return 0;
+    }
+
+/*     The element index must be positive. */
+
+    if (*elment < 1) {
+	setmsg_("ELMENT must be positive but was #.", (ftnlen)34);
+	errint_("#", elment, (ftnlen)1);
+	sigerr_("SPICE(INVALIDINDEX)", (ftnlen)19);
+	chkout_("EKGDN", (ftnlen)5);
+	return 0;
+    }
+
+/*     Make sure the SELECT clause column index is valid. */
+
+    if (*selidx < 1 || *selidx > nsel) {
+	setmsg_("The SELECT column index # is out of the valid range 1:#", (
+		ftnlen)55);
+	errint_("#", selidx, (ftnlen)1);
+	errint_("#", &nsel, (ftnlen)1);
+	sigerr_("SPICE(INVALIDINDEX)", (ftnlen)19);
+	chkout_("EKGDN", (ftnlen)5);
+	return 0;
+    }
+
+/*     COL is the column's index within the parent */
+/*     table's column list. */
+
+    tabidx = seltab[(i__1 = *selidx - 1) < 50 && 0 <= i__1 ? i__1 : s_rnge(
+	    "seltab", i__1, "ekqmgr_", (ftnlen)6592)];
+    col = selcol[(i__1 = *selidx - 1) < 50 && 0 <= i__1 ? i__1 : s_rnge("sel"
+	    "col", i__1, "ekqmgr_", (ftnlen)6595)];
+    colptr = selctp[(i__1 = *selidx - 1) < 50 && 0 <= i__1 ? i__1 : s_rnge(
+	    "selctp", i__1, "ekqmgr_", (ftnlen)6598)];
+
+/*     Make sure the column has double precision or `time' type. */
+
+    if (cttyps[(i__1 = colptr - 1) < 500 && 0 <= i__1 ? i__1 : s_rnge("cttyps"
+	    , i__1, "ekqmgr_", (ftnlen)6601)] != 2 && cttyps[(i__2 = colptr -
+	    1) < 500 && 0 <= i__2 ? i__2 : s_rnge("cttyps", i__2, "ekqmgr_", (
+	    ftnlen)6604)] != 4) {
+	setmsg_("Column # has data type #.", (ftnlen)25);
+	errch_("#", ctnams + (((i__1 = colptr - 1) < 500 && 0 <= i__1 ? i__1 :
+		 s_rnge("ctnams", i__1, "ekqmgr_", (ftnlen)6607)) << 5), (
+		ftnlen)1, (ftnlen)32);
+	errch_("#", chtype + (((i__2 = cttyps[(i__1 = colptr - 1) < 500 && 0
+		<= i__1 ? i__1 : s_rnge("cttyps", i__1, "ekqmgr_", (ftnlen)
+		6610)] - 1) < 4 && 0 <= i__2 ? i__2 : s_rnge("chtype", i__2,
+		"ekqmgr_", (ftnlen)6613)) << 2), (ftnlen)1, (ftnlen)4);
+	sigerr_("SPICE(INVALIDTYPE)", (ftnlen)18);
+	chkout_("EKGDN", (ftnlen)5);
+	return 0;
+    }
+
+/*     If it hasn't been done yet, and if it needs to be done, sort the */
+/*     matching row vectors. */
+
+    if (dosort) {
+	zzekjsrt_(&usize, ubase, &norder, otabs, ocols, oelts, sense, sthan,
+		stdscs, stdtpt, dtpool, dtdscs, &ordbas);
+	dosort = FALSE_;
+	sorted = TRUE_;
+    }
+
+/*     Fetch the element from each row in turn.  Only the entries of */
+/*     the row vector and segment vector for the column's table are */
+/*     needed.  Consecutive rows usually come from the same segment, */
+/*     so the column descriptor is looked up only when the segment */
+/*     changes. */
+
+    lstseg = 0;
+    i__1 = *n;
+    for (k = 1; k <= i__1; ++k) {
+	r__ = *row + k - 1;
+	if (sorted) {
+	    i__2 = ordbas + r__;
+	    zzeksrd_(&i__2, &i__2, &i__);
+	    zzekvcal_(&i__, &rwvbas, &sgvbas);
+	} else {
+	    zzekvcal_(&r__, &rwvbas, &sgvbas);
+	}
+	i__2 = rwvbas + tabidx;
+	zzeksrd_(&i__2, &i__2, &rowidx);
+	i__2 = sgvbas + tabidx;
+	zzeksrd_(&i__2, &i__2, &seg);
+	if (seg != lstseg) {
+	    j = stdtpt[(i__2 = seg - 1) < 200 && 0 <= i__2 ? i__2 : s_rnge(
+		    "stdtpt", i__2, "ekqmgr_", (ftnlen)6616)];
+	    i__2 = col;
+	    for (i__ = 2; i__ <= i__2; ++i__) {
+		j = lnknxt_(&j, dtpool);
+	    }
+	    lstseg = seg;
+	}
+	zzekrsd_(&sthan[(i__2 = seg - 1) < 200 && 0 <= i__2 ? i__2 : s_rnge(
+		"sthan", i__2, "ekqmgr_", (ftnlen)6619)], &stdscs[(i__3 = seg *
+		24 - 24) < 4800 && 0 <= i__3 ? i__3 : s_rnge("stdscs", i__3,
+		"ekqmgr_", (ftnlen)6622)], &dtdscs[(i__4 = j * 11 - 11) < 110000
+		&& 0 <= i__4 ? i__4 : s_rnge("dtdscs", i__4, "ekqmgr_", (
+		ftnlen)6625)], &rowidx, elment, &ddata[k - 1], &null[k - 1], &
+		found[k - 1]);
+	if (failed_()) {
+	    chkout_("EKGDN", (ftnlen)5);
+	    return 0;
+	}
+    }
+    chkout_("EKGDN", (ftnlen)5);
+    return 0;
+/* $Procedure     EKGIN  ( EK, get event data, integer, N rows ) */
+
+L_ekgin:
+/* $ Abstract */
+
+/*     Return an element of the entries in a column of integer type in */
+/*     each of a range of rows. */
+
+/* $ Disclaimer */
+
+/*     THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE */
+/*     CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S. */
+/*     GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE */
+/*     ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE */
+/*     PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS" */
+/*     TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY */
+/*     WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A */
+/*     PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC */
+/*     SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE */
+/*     SOFTWARE AND RELATED MATERIALS, HOWEVER USED. */
+
+/*     IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA */
+/*     BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT */
+/*     LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND, */
+/*     INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS, */
+/*     REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE */
+/*     REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY. */
+
+/*     RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF */
+/*     THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY */
+/*     CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE */
+/*     ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE. */
+
+/* $ Required_Reading */
+
+/*     EK */
+
+/* $ Keywords */
+
+/*     ASSIGNMENT */
+/*     EK */
+
+/* $ Declarations */
+
+/*     INTEGER               SELIDX */
+/*     INTEGER               ROW */
+/*     INTEGER               N */
+/*     INTEGER               ELMENT */
+/*     INTEGER               IDATA  ( * ) */
+/*     LOGICAL               NULL   ( * ) */
+/*     LOGICAL               FOUND  ( * ) */
+
+/* $ Brief_I/O */
+
+/*     Variable  I/O  Description */
+/*     --------  ---  -------------------------------------------------- */
+/*     SELIDX     I   Index of parent column in SELECT clause. */
+/*     ROW        I   First row to fetch from. */
+/*     N          I   Number of rows to fetch from. */
+/*     ELMENT     I   Index of element, within column entries, to fetch. */
+/*     IDATA      O   Integer elements of column entries. */
+/*     NULL       O   Flags indicating whether column entries were null. */
+/*     FOUND      O   Flags indicating whether elements were found. */
+
+/* $ Detailed_Input */
+
+/*     SELIDX         is the SELECT clause index of the column to */
+/*                    fetch from. */
+
+/*     ROW, */
+/*     N              are the first of a range of output rows containing */
+/*                    the entries to fetch from, and the number of rows */
+/*                    in the range.  Rows ROW : ROW+N-1 are fetched from. */
+
+/*     ELMENT         is the index of the element of the column entries */
+/*                    to fetch, as for EKGI.  ELMENT may exceed */
+/*                    the number of elements in a column entry; the */
+/*                    corresponding element of FOUND is then returned */
+/*                    .FALSE. */
+
+/* $ Detailed_Output */
+
+/*     IDATA          is an array containing the requested element of */
+/*                    the specified column entry in each of the N rows: */
+/*                    IDATA(I) is the element from row ROW+I-1.  If the */
+/*                    entry in a row is null, the corresponding element */
+/*                    of IDATA is undefined. */
+
+/*     NULL           is an array of logical flags indicating whether */
+/*                    the entry belonging to the specified column in */
+/*                    each row is null. */
+
+/*     FOUND          is an array of logical flags indicating whether the */
+/*                    specified element was found in each row. */
+
+/* $ Parameters */
+
+/*     None. */
+
+/* $ Exceptions */
+
+/*     1)  If the input argument ELMENT is less than 1, the error */
+/*         SPICE(INVALIDINDEX) is signaled. */
+
+/*     2)  If SELIDX is outside of the range established by the */
+/*         last query passed to EKSRCH, the error SPICE(INVALIDINDEX) */
+/*         is signaled. */
+
+/*     3)  If N is less than 1, the error SPICE(INVALIDCOUNT) is */
+/*         signaled. */
+
+/*     4)  If ROW is less than 1, or ROW+N-1 is greater than the number */
+/*         of rows matching the query, the error SPICE(INVALIDINDEX) is */
+/*         signaled. */
+
+/*     5)  If the specified column does not have integer type, the */
+/*         error SPICE(INVALIDTYPE) is signaled. */
+
+/*     6)  If this routine is called when no E-kernels have been loaded, */
+/*         the error SPICE(NOLOADEDFILES) is signaled. */
+
+/*     If an error occurs while the elements are fetched, the outputs */
+/*     for the rows preceding the one being fetched are valid; the */
+/*     others are undefined. */
+
+/* $ Files */
+
+/*     See the header of EKQMGR for a description of files used */
+/*     by this routine. */
+
+/* $ Particulars */
+
+/*     This routine returns the same element as EKGI does from */
+/*     each row of a range of rows of the query result, so that a whole */
+/*     result column can be fetched with one call. */
+
+/*     The checks of the arguments, the location of the column, and */
+/*     the sort of the result are done once for the range rather than */
+/*     once per row.  The descriptor of the column in the segment */
+/*     containing a row is looked up again only when the segment */
+/*     changes, which it rarely does between consecutive rows.  The */
+/*     records of the EK file holding the elements are read through */
+/*     the DAS record buffer, so a record shared by the elements of */
+/*     consecutive rows is read from the file once. */
+
+/* $ Examples */
+
+/*     1)  Fetch the first elements of the entries of column 1 of the */
+/*         result of a query in all matching rows, where NMROWS is */
+/*         the number of matching rows returned by EKFIND and the */
+/*         arrays have room for NMROWS elements. */
+
+/*            CALL EKGIN ( 1, 1, NMROWS, 1, IDATA, NULL, FOUND ) */
+
+/* $ Restrictions */
+
+/*     None. */
+
+/* $ Literature_References */
+
+/*     None. */
+
+/* $ Author_and_Institution */
+
+/*     Nabla Zero Labs */
+
+/* $ Version */
+
+/* -    CSPICE Version 1.0.0, 19-OCT-2026 (NZL) */
+
+/* -& */
+/* $ Index_Entries */
+
+/*     fetch elements from integer column entries of many rows */
+
+/* -& */
+
+/*     Standard SPICE error handling. */
+
+    if (return_()) {
+	return 0;
+    } else {
+	chkin_("EKGIN", (ftnlen)5);
+    }
+
+/*     There nothing to fetch if no files are loaded. */
+
+    if (fthead <= 0) {
+	setmsg_("No E-kernels are currently loaded.", (ftnlen)34);
+	sigerr_("SPICE(NOLOADEDFILES)", (ftnlen)20);
+	chkout_("EKGIN", (ftnlen)5);
+	return 0;
+    }
+
+/*     The row count must be positive, and the row range must lie */
+/*     within the query result. */
+
+    if (*n < 1) {
+	setmsg_("The row count N must be at least 1 but was #.", (ftnlen)45);
+	errint_("#", n, (ftnlen)1);
+	sigerr_("SPICE(INVALIDCOUNT)", (ftnlen)19);
+	chkout_("EKGIN", (ftnlen)5);
+	return 0;
+    }
+    if (*row < 1 || *row > unrows - *n + 1) {
+	setmsg_("Row indices for query result range from 1 to #; requested r"
+		"ows were #:#.", (ftnlen)72);
+	errint_("#", &unrows, (ftnlen)1);
+	errint_("#", row, (ftnlen)1);
+	i__1 = *row + *n - 1;
+	errint_("#", &i__1, (ftnlen)1);
+	sigerr_("SPICE(INVALIDINDEX)", (ftnlen)19);
+	chkout_("EKGIN", (ftnlen)5);
+	return 0;
+    }
+
+/*     The element index must be positive. */
+
+    if (*elment < 1) {
+	setmsg_("ELMENT must be positive but was #.", (ftnlen)34);
+	errint_("#", elment, (ftnlen)1);
+	sigerr_("SPICE(INVALIDINDEX)", (ftnlen)19);
+	chkout_("EKGIN", (ftnlen)5);
+	return 0;
+    }
+
+/*     Make sure the SELECT clause column index is valid. */
+
+    if (*selidx < 1 || *selidx > nsel) {
+	setmsg_("The SELECT column index # is out of the valid range 1:#", (
+		ftnlen)55);
+	errint_("#", selidx, (ftnlen)1);
+	errint_("#", &nsel, (ftnlen)1);
+	sigerr_("SPICE(INVALIDINDEX)", (ftnlen)19);
+	chkout_("EKGIN", (ftnlen)5);
+	return 0;
+    }
+
+/*     COL is the column's index within the parent */
+/*     table's column list. */
+
+    tabidx = seltab[(i__1 = *selidx - 1) < 50 && 0 <= i__1 ? i__1 : s_rnge(
+	    "seltab", i__1, "ekqmgr_", (ftnlen)6628)];
+    col = selcol[(i__1 = *selidx - 1) < 50 && 0 <= i__1 ? i__1 : s_rnge("sel"
+	    "col", i__1, "ekqmgr_", (ftnlen)6631)];
+    colptr = selctp[(i__1 = *selidx - 1) < 50 && 0 <= i__1 ? i__1 : s_rnge(
+	    "selctp", i__1, "ekqmgr_", (ftnlen)6634)];
+
+/*     Make sure the column has integer type. */
+
+    if (cttyps[(i__1 = colptr - 1) < 500 && 0 <= i__1 ? i__1 : s_rnge("cttyps"
+	    , i__1, "ekqmgr_", (ftnlen)6637)] != 3) {
+	setmsg_("Column # has data type #.", (ftnlen)25);
+	errch_("#", ctnams + (((i__1 = colptr - 1) < 500 && 0 <= i__1 ? i__1 :
+		 s_rnge("ctnams", i__1, "ekqmgr_", (ftnlen)6640)) << 5), (
+		ftnlen)1, (ftnlen)32);
+	errch_("#", chtype + (((i__2 = cttyps[(i__1 = colptr - 1) < 500 && 0
+		<= i__1 ? i__1 : s_rnge("cttyps", i__1, "ekqmgr_", (ftnlen)
+		6643)] - 1) < 4 && 0 <= i__2 ? i__2 : s_rnge("chtype", i__2,
+		"ekqmgr_", (ftnlen)6646)) << 2), (ftnlen)1, (ftnlen)4);
+	sigerr_("SPICE(INVALIDTYPE)", (ftnlen)18);
+	chkout_("EKGIN", (ftnlen)5);
+	return 0;
+    }
+
+/*     If it hasn't been done yet, and if it needs to be done, sort the */
+/*     matching row vectors. */
+
+    if (dosort) {
+	zzekjsrt_(&usize, ubase, &norder, otabs, ocols, oelts, sense, sthan,
+		stdscs, stdtpt, dtpool, dtdscs, &ordbas);
+	dosort = FALSE_;
+	sorted = TRUE_;
+    }
+
+/*     Fetch the element from each row in turn.  Only the entries of */
+/*     the row vector and segment vector for the column's table are */
+/*     needed.  Consecutive rows usually come from the same segment, */
+/*     so the column descriptor is looked up only when the segment */
+/*     changes. */
+
+    lstseg = 0;
+    i__1 = *n;
+    for (k = 1; k <= i__1; ++k) {
+	r__ = *row + k - 1;
+	if (sorted) {
+	    i__2 = ordbas + r__;
+	    zzeksrd_(&i__2, &i__2, &i__);
+	    zzekvcal_(&i__, &rwvbas, &sgvbas);
+	} else {
+	    zzekvcal_(&r__, &rwvbas, &sgvbas);
+	}
+	i__2 = rwvbas + tabidx;
+	zzeksrd_(&i__2, &i__2, &rowidx);
+	i__2 = sgvbas + tabidx;
+	zzeksrd_(&i__2, &i__2, &seg);
+	if (seg != lstseg) {
+	    j = stdtpt[(i__2 = seg - 1) < 200 && 0 <= i__2 ? i__2 : s_rnge(
+		    "stdtpt", i__2, "ekqmgr_", (ftnlen)6649)];
+	    i__2 = col;
+	    for (i__ = 2; i__ <= i__2; ++i__) {
+		j = lnknxt_(&j, dtpool);
+	    }
+	    lstseg = seg;
+	}
+	zzekrsi_(&sthan[(i__2 = seg - 1) < 200 && 0 <= i__2 ? i__2 : s_rnge(
+		"sthan", i__2, "ekqmgr_", (ftnlen)6652)], &stdscs[(i__3 = seg *
+		24 - 24) < 4800 && 0 <= i__3 ? i__3 : s_rnge("stdscs", i__3,
+		"ekqmgr_", (ftnlen)6655)], &dtdscs[(i__4 = j * 11 - 11) < 110000
+		&& 0 <= i__4 ? i__4 : s_rnge("dtdscs", i__4, "ekqmgr_", (
+		ftnlen)6658)], &rowidx, elment, &idata[k - 1], &null[k - 1], &
+		found[k - 1]);
+	if (failed_()) {
+	    chkout_("EKGIN", (ftnlen)5);
+	    return 0;
+	}
+    }
+    chkout_("EKGIN", (ftnlen)5);
+    return 0;
+} /* ekqmgr_ */
+
+/* Subroutine */ int ekqmgr_(integer *cindex, integer *elment, char *eqryc, 
+	doublereal *eqryd, integer *eqryi, char *fname, integer *row, integer 
+	*selidx, char *column, integer *handle, integer *n, char *table, 
+	integer *attdsc, integer *ccount, logical *found, integer *nelt, 
+	integer *nmrows, logical *semerr, char *errmsg, char *cdata, 
+	doublereal *ddata, integer *idata, logical *null, ftnlen eqryc_len, 
+	ftnlen fname_len, ftnlen column_len, ftnlen table_len, ftnlen 
+	errmsg_len, ftnlen cdata_len)
+{
+    return ekqmgr_0_(0, cindex, elment, eqryc, eqryd, eqryi, fname, row, 
+	    selidx, column, handle, n, table, attdsc, ccount, found, nelt, 
+	    nmrows, semerr, errmsg, cdata, ddata, idata, null, eqryc_len, 
+	    fname_len, column_len, table_len, errmsg_len, cdata_len);
+    }
+
+/* Subroutine */ int eklef_(char *fname, integer *handle, ftnlen fname_len)
+{
+    return ekqmgr_0_(1, (integer *)0, (integer *)0, (char *)0, (doublereal *)
+	    0, (integer *)0, fname, (integer *)0, (integer *)0, (char *)0, 
+	    handle, (integer *)0, (char *)0, (integer *)0, (integer *)0, (
+	    logical *)0, (integer *)0, (integer *)0, (logical *)0, (char *)0, 
+	    (char *)0, (doublereal *)0, (integer *)0, (logical *)0, (ftnint)0,
+	     fname_len, (ftnint)0, (ftnint)0, (ftnint)0, (ftnint)0);
+    }
+
+/* Subroutine */ int ekuef_(integer *handle)
+{
+    return ekqmgr_0_(2, (integer *)0, (integer *)0, (char *)0, (doublereal *)
+	    0, (integer *)0, (char *)0, (integer *)0, (integer *)0, (char *)0,
+	     handle, (integer *)0, (char *)0, (integer *)0, (integer *)0, (
+	    logical *)0, (integer *)0, (integer *)0, (logical *)0, (char *)0, 
+	    (char *)0, (doublereal *)0, (integer *)0, (logical *)0, (ftnint)0,
+	     (ftnint)0, (ftnint)0, (ftnint)0, (ftnint)0, (ftnint)0);
+    }
+
+/* Subroutine */ int ekntab_(integer *n)
+{
+    return ekqmgr_0_(3, (integer *)0, (integer *)0, (char *)0, (doublereal *)
+	    0, (integer *)0, (char *)0, (integer *)0, (integer *)0, (char *)0,
+	     (integer *)0, n, (char *)0, (integer *)0, (integer *)0, (logical 
+	    *)0, (integer *)0, (integer *)0, (logical *)0, (char *)0, (char *)
+	    0, (doublereal *)0, (integer *)0, (logical *)0, (ftnint)0, (
+	    ftnint)0, (ftnint)0, (ftnint)0, (ftnint)0, (ftnint)0);
+    }
+
+/* Subroutine */ int ektnam_(integer *n, char *table, ftnlen table_len)
+{
+    return ekqmgr_0_(4, (integer *)0, (integer *)0, (char *)0, (doublereal *)
+	    0, (integer *)0, (char *)0, (integer *)0, (integer *)0, (char *)0,
+	     (integer *)0, n, table, (integer *)0, (integer *)0, (logical *)0,
+	     (integer *)0, (integer *)0, (logical *)0, (char *)0, (char *)0, (
+	    doublereal *)0, (integer *)0, (logical *)0, (ftnint)0, (ftnint)0, 
+	    (ftnint)0, table_len, (ftnint)0, (ftnint)0);
+    }
+
+/* Subroutine */ int ekccnt_(char *table, integer *ccount, ftnlen table_len)
+{
+    return ekqmgr_0_(5, (integer *)0, (integer *)0, (char *)0, (doublereal *)
+	    0, (integer *)0, (char *)0, (integer *)0, (integer *)0, (char *)0,
+	     (integer *)0, (integer *)0, table, (integer *)0, ccount, (
+	    logical *)0, (integer *)0, (integer *)0, (logical *)0, (char *)0, 
+	    (char *)0, (doublereal *)0, (integer *)0, (logical *)0, (ftnint)0,
+	     (ftnint)0, (ftnint)0, table_len, (ftnint)0, (ftnint)0);
+    }
+
+/* Subroutine */ int ekcii_(char *table, integer *cindex, char *column, 
+	integer *attdsc, ftnlen table_len, ftnlen column_len)
+{
+    return ekqmgr_0_(6, cindex, (integer *)0, (char *)0, (doublereal *)0, (
+	    integer *)0, (char *)0, (integer *)0, (integer *)0, column, (
+	    integer *)0, (integer *)0, table, attdsc, (integer *)0, (logical *
+	    )0, (integer *)0, (integer *)0, (logical *)0, (char *)0, (char *)
+	    0, (doublereal *)0, (integer *)0, (logical *)0, (ftnint)0, (
+	    ftnint)0, column_len, table_len, (ftnint)0, (ftnint)0);
+    }
+
+/* Subroutine */ int eksrch_(integer *eqryi, char *eqryc, doublereal *eqryd, 
+	integer *nmrows, logical *semerr, char *errmsg, ftnlen eqryc_len, 
+	ftnlen errmsg_len)
+{
+    return ekqmgr_0_(7, (integer *)0, (integer *)0, eqryc, eqryd, eqryi, (
+	    char *)0, (integer *)0, (integer *)0, (char *)0, (integer *)0, (
+	    integer *)0, (char *)0, (integer *)0, (integer *)0, (logical *)0, 
+	    (integer *)0, nmrows, semerr, errmsg, (char *)0, (doublereal *)0, 
+	    (integer *)0, (logical *)0, eqryc_len, (ftnint)0, (ftnint)0, (
+	    ftnint)0, errmsg_len, (ftnint)0);
+    }
+
+/* Subroutine */ int eknelt_(integer *selidx, integer *row, integer *nelt)
+{
+    return ekqmgr_0_(8, (integer *)0, (integer *)0, (char *)0, (doublereal *)
+	    0, (integer *)0, (char *)0, row, selidx, (char *)0, (integer *)0, 
+	    (integer *)0, (char *)0, (integer *)0, (integer *)0, (logical *)0,
+	     nelt, (integer *)0, (logical *)0, (char *)0, (char *)0, (
+	    doublereal *)0, (integer *)0, (logical *)0, (ftnint)0, (ftnint)0, 
+	    (ftnint)0, (ftnint)0, (ftnint)0, (ftnint)0);
+    }
+
+/* Subroutine */ int ekgc_(integer *selidx, integer *row, integer *elment, 
+	char *cdata, logical *null, logical *found, ftnlen cdata_len)
+{
+    return ekqmgr_0_(9, (integer *)0, elment, (char *)0, (doublereal *)0, (
+	    integer *)0, (char *)0, row, selidx, (char *)0, (integer *)0, (
+	    integer *)0, (char *)0, (integer *)0, (integer *)0, found, (
+	    integer *)0, (integer *)0, (logical *)0, (char *)0, cdata, (
+	    doublereal *)0, (integer *)0, null, (ftnint)0, (ftnint)0, (ftnint)
+	    0, (ftnint)0, (ftnint)0, cdata_len);
+    }
+
+/* Subroutine */ int ekgd_(integer *selidx, integer *row, integer *elment, 
+	doublereal *ddata, logical *null, logical *found)
+{
+    return ekqmgr_0_(10, (integer *)0, elment, (char *)0, (doublereal *)0, (
+	    integer *)0, (char *)0, row, selidx, (char *)0, (integer *)0, (
+	    integer *)0, (char *)0, (integer *)0, (integer *)0, found, (
+	    integer *)0, (integer *)0, (logical *)0, (char *)0, (char *)0, 
+	    ddata, (integer *)0, null, (ftnint)0, (ftnint)0, (ftnint)0, (
+	    ftnint)0, (ftnint)0, (ftnint)0);
+    }
+
+/* Subroutine */ int ekgi_(integer *selidx, integer *row, integer *elment, 
 	integer *idata, logical *null, logical *found)
 {
     return ekqmgr_0_(11, (integer *)0, elment, (char *)0, (doublereal *)0, (
@@ -7519,3 +8504,37 @@ L_ekgi:
 	    ftnint)0, (ftnint)0, (ftnint)0);
     }
 
+/* Subroutine */ int ekgcn_(integer *selidx, integer *row, integer *n,
+	integer *elment, char *cdata, logical *null, logical *found, ftnlen
+	cdata_len)
+{
+    return ekqmgr_0_(12, (integer *)0, elment, (char *)0, (doublereal *)0, (
+	    integer *)0, (char *)0, row, selidx, (char *)0, (integer *)0, n, (
+	    char *)0, (integer *)0, (integer *)0, found, (integer *)0, (
+	    integer *)0, (logical *)0, (char *)0, cdata, (doublereal *)0, (
+	    integer *)0, null, (ftnint)0, (ftnint)0, (ftnint)0, (ftnint)0, (
+	    ftnint)0, cdata_len);
+    }
+
+/* Subroutine */ int ekgdn_(integer *selidx, integer *row, integer *n,
+	integer *elment, doublereal *ddata, logical *null, logical *found)
+{
+    return ekqmgr_0_(13, (integer *)0, elment, (char *)0, (doublereal *)0, (
+	    integer *)0, (char *)0, row, selidx, (char *)0, (integer *)0, n, (
+	    char *)0, (integer *)0, (integer *)0, found, (integer *)0, (
+	    integer *)0, (logical *)0, (char *)0, (char *)0, ddata, (integer *
+	    )0, null, (ftnint)0, (ftnint)0, (ftnint)0, (ftnint)0, (ftnint)0, (
+	    ftnint)0);
+    }
+
+/* Subroutine */ int ekgin_(integer *selidx, integer *row, integer *n,
+	integer *elment, integer *idata, logical *null, logical *found)
+{
+    return ekqmgr_0_(14, (integer *)0, elment, (char *)0, (doublereal *)0, (
+	    integer *)0, (char *)0, row, selidx, (char *)0, (integer *)0, n, (
+	    char *)0, (integer *)0, (integer *)0, found, (integer *)0, (
+	    integer *)0, (logical *)0, (char *)0, (char *)0, (doublereal *)0,
+	    idata, null, (ftnint)0, (ftnint)0, (ftnint)0, (ftnint)0, (ftnint)0,
+	     (ftnint)0);
+    }
+
@@ -0,0 +1,304 @@
+/*
+
+-Procedure ekxpln_c  ( EK, explain join execution )
+
+-Abstract
+
+   Return a description of the joins executed by the most recent
+   EK query.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   EK
+
+-Keywords
+
+   EK
+   SEARCH
+
+*/
+
+   #include <stdio.h>
+   #include <string.h>
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZmc.h"
+   #include "SpiceZst.h"
+
+   void ekxpln_c ( SpiceInt       room,
+                   SpiceInt       lenout,
+                   SpiceInt     * n,
+                   void         * plan   )
+
+/*
+
+-Brief_I/O
+
+   Variable  I/O  Description
+   --------  ---  --------------------------------------------------
+   room       I   Maximum number of lines to return.
+   lenout     I   Length of strings in output array plan.
+   n          O   Number of lines returned.
+   plan       O   Description of the joins of the last query.
+
+-Detailed_Input
+
+   room        is the maximum number of lines of the description to
+               return.
+
+   lenout      is the declared length of the strings of `plan',
+               including room for the terminating null.  Lines longer
+               than lenout-1 characters are truncated.  A length of 120
+               is sufficient to hold any line.
+
+-Detailed_Output
+
+   n           is the number of lines returned in `plan'.
+
+   plan        is an array of strings describing the joins executed by
+               the most recent call to ekfind_c.  The caller should
+               declare `plan' as
+
+                  SpiceChar  plan [room][lenout];
+
+               There is one line for each join of two row sets; a query
+               with no joins yields the single line
+
+                  NO JOINS
+
+               Each join line gives the number of tables and rows of the
+               two row sets being joined, the number of segment vector
+               pairs joined by each method, and the number of rows
+               produced, for example
+
+                  JOIN 1: TABLES 1 x 1, ROWS 2000 x 1500, MEMORY
+                  MERGE 2, PAGE MERGE 0, NESTED LOOP 0, EMPTY 0,
+                  RESULT 10296
+
+               (shown here on three lines).  The methods are:
+
+                  MEMORY MERGE   The key values of the join constraint
+                                 were read once into memory, sorted,
+                                 and merged.
+
+                  PAGE MERGE     The rows were sorted and merged using
+                                 key values read from the EK pages.
+
+                  NESTED LOOP    No constraint could drive a merge, so
+                                 every pair of rows was tested.
+
+                  EMPTY          One of the row sets had no rows for
+                                 the segment vector pair.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1)  If room is less than one, the error SPICE(BADARRAYSIZE) is
+       signaled.
+
+   2)  If the output string pointer is null, the error
+       SPICE(NULLPOINTER) is signaled.
+
+   3)  If the output string has length less than two characters, the
+       error SPICE(STRINGTOOSHORT) is signaled.
+
+   4)  If the description has more than `room' lines, only the first
+       `room' lines are returned.
+
+-Files
+
+   None.
+
+-Particulars
+
+   The EK query system joins the tables named in the FROM clause of
+   a query one at a time, each join combining the row set built so
+   far with the rows of the next table that satisfy the query's
+   single-table constraints.  Within a join, every pair of segment
+   vectors is joined separately, and the method is chosen for each
+   pair.
+
+   When one of the join constraints of the query's conjunction is a
+   comparison other than "!=" between two columns, the rows are
+   merged on that constraint.  If both columns are scalar integer,
+   double precision or time columns and the number of rows is within
+   the memory budget of the query system, the merge is done in
+   memory; otherwise the key values are read from the EK pages each
+   time they are compared.  Both methods produce the rows in the same
+   order.
+
+   This routine reports the choices made by the last search, so that
+   the cost of a query can be understood.  For a query having several
+   conjunctions in its WHERE clause, the joins of each conjunction
+   are reported in turn.
+
+-Examples
+
+   1)  Explain the execution of a query joining two tables.
+
+          #include <stdio.h>
+          #include "SpiceUsr.h"
+
+          #define  ROOM          20
+          #define  LNSIZE        121
+          #define  MSGLEN        1025
+
+          SpiceBoolean           error;
+          SpiceChar              errmsg [MSGLEN];
+          SpiceChar              plan   [ROOM][LNSIZE];
+          SpiceInt               i;
+          SpiceInt               n;
+          SpiceInt               nmrows;
+
+          ekfind_c ( "SELECT EVT.ID, CMD.X FROM EVT, CMD "
+                     "WHERE EVT.ID = CMD.ID",
+                     MSGLEN,  &nmrows,  &error,  errmsg   );
+
+          ekxpln_c ( ROOM, LNSIZE, &n, plan );
+
+          for ( i = 0;  i < n;  i++ )
+          {
+             printf ( "%s\n", plan[i] );
+          }
+
+-Restrictions
+
+   1)  Only the joins of the most recent search are described.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   explain EK query execution
+
+-&
+*/
+
+{ /* Begin ekxpln_c */
+
+   /*
+   Local constants
+   */
+   #define  LINLEN         200
+
+   /*
+   Local variables
+   */
+   SpiceChar               line   [LINLEN];
+   SpiceChar             * strptr;
+
+   SpiceInt                i;
+   SpiceInt                method [4];
+   SpiceInt                nout;
+   SpiceInt                nrows  [2];
+   SpiceInt                nstp;
+   SpiceInt                ntab   [2];
+
+
+   /*
+   Participate in error tracing.
+   */
+   chkin_c ( "ekxpln_c" );
+
+   /*
+   Check the output string array.
+   */
+   CHKOSTR ( CHK_STANDARD, "ekxpln_c", plan, lenout );
+
+   if ( room < 1 )
+   {
+      setmsg_c ( "The output array size was #; must be at least 1." );
+      errint_c ( "#",  room                                         );
+      sigerr_c ( "SPICE(BADARRAYSIZE)"                              );
+      chkout_c ( "ekxpln_c"                                         );
+      return;
+   }
+
+   *n = 0;
+
+   zzekjmst_c ( 0, &nstp, ntab, nrows, method, &nout );
+
+   if ( nstp == 0 )
+   {
+      strptr = (SpiceChar *) plan;
+
+      strncpy ( strptr, "NO JOINS", lenout-1 );
+      strptr[lenout-1] = NULLCHAR;
+
+      *n = 1;
+
+      chkout_c ( "ekxpln_c" );
+      return;
+   }
+
+   for ( i = 0;  ( i < nstp ) && ( *n < room );  i++ )
+   {
+      if ( zzekjmst_c ( i, &nstp, ntab, nrows, method, &nout ) )
+      {
+         sprintf ( line,
+                   "JOIN %ld: TABLES %ld x %ld, ROWS %ld x %ld, "
+                   "MEMORY MERGE %ld, PAGE MERGE %ld, NESTED LOOP %ld, "
+                   "EMPTY %ld, RESULT %ld",
+                   (long) (i+1),
+                   (long) ntab[0],   (long) ntab[1],
+                   (long) nrows[0],  (long) nrows[1],
+                   (long) method[0], (long) method[1],
+                   (long) method[2], (long) method[3],
+                   (long) nout                          );
+      }
+      else
+      {
+         sprintf ( line,
+                   "JOIN %ld: NOT RECORDED",
+                   (long) (i+1)             );
+      }
+
+      strptr = ( (SpiceChar *) plan ) + (*n)*lenout;
+
+      strncpy ( strptr, line, lenout-1 );
+      strptr[lenout-1] = NULLCHAR;
+
+      (*n)++;
+   }
+
+   chkout_c ( "ekxpln_c" );
+
+} /* End ekxpln_c */
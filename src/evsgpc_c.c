@@ -0,0 +1,350 @@
+/*
+
+-Procedure evsgpc_c ( Evaluate SGP4 for a catalog of element sets )
+
+-Abstract
+
+   Evaluate the states of a catalog of Earth orbiters, given by NORAD
+   two-line element sets, at each of a set of epochs, using the SGP4
+   propagator.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   None.
+
+-Keywords
+
+   EPHEMERIS
+
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZmc.h"
+   #include "zzalloc.h"
+   #undef    evsgpc_c
+
+
+   void evsgpc_c ( ConstSpiceDouble     geophs [8],
+                   SpiceInt             nelts,
+                   ConstSpiceDouble     elems  [],
+                   ConstSpiceChar     * ref,
+                   SpiceInt             n,
+                   ConstSpiceDouble     ets    [],
+                   SpiceDouble          states [][6] )
+
+/*
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   geophs     I   Geophysical constants.
+   nelts      I   Number of element sets.
+   elems      I   Two-line element sets.
+   ref        I   Reference frame of output states.
+   n          I   Number of epochs.
+   ets        I   Epochs, in seconds past J2000 TDB.
+   states     O   States of the orbiters at the epochs.
+
+-Detailed_Input
+
+   geophs      is the array of geophysical constants used by SGP4, in
+               the order and units described in the header of
+               spkw10_c.
+
+   nelts       is the number of element sets in `elems'.
+
+   elems       is an array containing `nelts' element sets, each of
+               10 elements as returned by getelm_c.  The element set
+               of orbiter i, for i = 0 : nelts-1, occupies elements
+               10*i : 10*i+9.  Element 10*i+9 is the epoch of the set.
+
+   ref         is the name of the reference frame of the output
+               states: either "TEME", the frame in which SGP4
+               computes states, or "J2000".  Case and blanks are not
+               significant.
+
+   n           is the number of epochs.
+
+   ets         is an array of `n' epochs, expressed as seconds past
+               J2000 TDB, at which the states are to be evaluated.
+
+-Detailed_Output
+
+   states      is an array of nelts*n states.  State
+
+                  states[ i*n + k ]
+
+               is the state of orbiter i at ets[k], relative to the
+               center of the Earth, in the frame `ref'.  Units are km
+               and km/sec.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1)  If `nelts' or `n' is less than 1, the error
+       SPICE(INVALIDCOUNT) is signaled.
+
+   2)  If `ref' is neither "TEME" nor "J2000", the error
+       SPICE(INVALIDREFFRAME) is signaled.
+
+   3)  If memory cannot be allocated for the frame transformations,
+       the error SPICE(MALLOCFAILED) is signaled.
+
+   4)  If an element set cannot be evaluated, for example because
+       the orbit decays, the error is signaled by a routine in the
+       call tree of this routine.  The states of the orbiters that
+       precede it are valid; the others are undefined.
+
+   5)  If `ref' is a null pointer or the empty string, an error is
+       signaled by a routine in the call tree of this routine.
+
+-Files
+
+   None.
+
+-Particulars
+
+   This routine evaluates SGP4, as SPK type 10 segments do, for a
+   whole catalog at once.  The SGP4 routines keep the initialized
+   form of a single element set, so evaluating the states of many
+   orbiters epoch by epoch repeats the initialization for every
+   state.  This routine initializes each element set once and
+   evaluates it at all of the epochs, and computes the TEME to J2000
+   transformation once per epoch for the whole catalog.
+
+   The SGP4 evaluation itself is that of SPK type 10.  SGP4 uses
+   different computations for near-Earth and deep-space orbits and
+   for resonant orbits, so it is evaluated for one orbiter at a time.
+
+   CSPICE is not thread-safe, and the SGP4 routines keep their state
+   in static variables, so this routine must not be called from more
+   than one thread.  To divide a large catalog among processes, pass
+   each process a contiguous part of `elems': the element sets of
+   orbiters i0 : i1 start at elems[10*i0].
+
+   The "AFSPC" sidereal time model of the original Spacetrack Report
+   #3 is used, as in SPK type 10.
+
+-Examples
+
+   1)  Propagate the element sets read from a catalog to each hour of
+       a day, in J2000.
+
+          #define NHOUR    24
+
+          SpiceDouble      ets    [NHOUR];
+          SpiceDouble   (* states)[6];
+
+             ...
+
+          for ( k = 0;  k < NHOUR;  k++ )
+          {
+             ets[k] = et0 + 3600.0 * k;
+          }
+
+          states = malloc ( nelts * NHOUR * sizeof(SpiceDouble[6]) );
+
+          evsgpc_c ( geophs, nelts, elems, "J2000", NHOUR, ets, states );
+
+       The state of orbiter i at hour k is states[i*NHOUR+k].
+
+-Restrictions
+
+   1)  The element sets must be suitable for SGP4, as for spkw10_c.
+
+-Literature_References
+
+   [1]  Hoots, F. R., and Roehrich, R. L. 1980. "Models for
+        Propagation of the NORAD Element Sets." Spacetrack Report #3.
+        U.S. Air Force: Aerospace Defense Command.
+
+   [2]  Vallado, David, Crawford, Paul, Hujsak, Richard, and Kelso,
+        T.S. 2006. Revisiting Spacetrack Report #3. Paper AIAA
+        2006-6753.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 19-OCT-2026 (NZL)
+
+-Index_Entries
+
+   evaluate sgp4 for a catalog of two-line element sets
+   propagate many two-line element sets
+
+-&
+*/
+
+{ /* Begin evsgpc_c */
+
+
+   /*
+   Local parameters
+   */
+   #define AFSPC           1
+   #define NELEM           10
+
+
+   /*
+   Local variables
+   */
+   SpiceBoolean            j2000;
+
+   SpiceDouble           * xforms;
+   SpiceDouble             precm  [6][6];
+   SpiceDouble             state  [6];
+   SpiceDouble             t;
+
+   SpiceInt                i;
+   SpiceInt                k;
+   SpiceInt                nBytes;
+
+   integer                 opmode;
+   integer                 six;
+
+
+   /*
+   Participate in error tracing.
+   */
+   if ( return_c() )
+   {
+      return;
+   }
+   chkin_c ( "evsgpc_c" );
+
+   CHKFSTR ( CHK_STANDARD, "evsgpc_c", ref );
+
+   if (  ( nelts < 1 )  ||  ( n < 1 )  )
+   {
+      setmsg_c ( "The element set count # and the epoch count # "
+                 "must both be at least 1."                      );
+      errint_c ( "#",  nelts                                     );
+      errint_c ( "#",  n                                         );
+      sigerr_c ( "SPICE(INVALIDCOUNT)"                           );
+      chkout_c ( "evsgpc_c"                                      );
+      return;
+   }
+
+   /*
+   Identify the output frame; eqstr_c ignores case and blanks.
+   */
+   if ( eqstr_c( ref, "J2000" ) )
+   {
+      j2000 = SPICETRUE;
+   }
+   else if ( eqstr_c( ref, "TEME" ) )
+   {
+      j2000 = SPICEFALSE;
+   }
+   else
+   {
+      setmsg_c ( "The output frame <#> is not supported; only "
+                 "\"TEME\" and \"J2000\" may be used."         );
+      errch_c  ( "#",  ref                                     );
+      sigerr_c ( "SPICE(INVALIDREFFRAME)"                      );
+      chkout_c ( "evsgpc_c"                                    );
+      return;
+   }
+
+   /*
+   For J2000 output, compute the TEME to J2000 state transformation
+   at each epoch.  ZZTEME returns the inverse transformation.
+   */
+   xforms = NULL;
+
+   if ( j2000 )
+   {
+      nBytes = n * 36 * sizeof(SpiceDouble);
+
+      xforms = (SpiceDouble *) alloc_SpiceMemory( (size_t)nBytes );
+
+      if ( !xforms )
+      {
+         setmsg_c ( "Workspace allocation of # bytes failed due to "
+                    "malloc failure"                               );
+         errint_c ( "#",  nBytes                                   );
+         sigerr_c ( "SPICE(MALLOCFAILED)"                          );
+         chkout_c ( "evsgpc_c"                                     );
+         return;
+      }
+
+      for ( k = 0;  k < n;  k++ )
+      {
+         zzteme_ ( (doublereal *) &ets[k],  (doublereal *) precm );
+         invstm_ ( (doublereal *) precm,    xforms + 36*k        );
+      }
+   }
+
+   /*
+   Initialize each element set once, then evaluate it at every epoch.
+   SGP4 measures time in minutes from the epoch of the elements.
+   */
+   opmode = AFSPC;
+   six    = 6;
+
+   for ( i = 0;  ( i < nelts ) && !failed_c();  i++ )
+   {
+      xxsgp4i_ ( (doublereal *) geophs,
+                 (doublereal *) ( elems + NELEM*i ),
+                 &opmode                             );
+
+      for ( k = 0;  ( k < n ) && !failed_c();  k++ )
+      {
+         t = ( ets[k] - elems[ NELEM*i + NELEM-1 ] ) / 60.0;
+
+         if ( j2000 )
+         {
+            xxsgp4e_ ( &t, state );
+
+            mxvg_ ( xforms + 36*k,  state,  &six,  &six,
+                    states[ i*n + k ]                  );
+         }
+         else
+         {
+            xxsgp4e_ ( &t, states[ i*n + k ] );
+         }
+      }
+   }
+
+   if ( xforms )
+   {
+      free_SpiceMemory( (void *)xforms );
+   }
+
+
+   chkout_c ( "evsgpc_c" );
+
+} /* End evsgpc_c */
@@ -0,0 +1,862 @@
+/*
+
+-Procedure gfdstv_c ( GF, distance search, multiple targets )
+
+-Abstract
+
+   Return the time intervals during which the distance between each
+   of a set of targets and an observer is less than, or greater than,
+   a reference value, by stepping all of the targets through the
+   confinement window together.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   GF
+   NAIF_IDS
+   SPK
+   TIME
+   WINDOWS
+
+-Keywords
+
+   EPHEMERIS
+   EVENT
+   GEOMETRY
+   SEARCH
+
+*/
+
+   #include <math.h>
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZmc.h"
+   #include "zzalloc.h"
+   #undef gfdstv_c
+
+
+   /*
+   Local parameters
+   */
+   #define SIDLEN          40
+
+
+   /*
+   Per-target search state.
+   */
+   typedef struct
+   {
+      SpiceDouble      dist;
+      SpiceDouble      rate;
+      SpiceDouble      start;
+      SpiceBoolean     inside;
+
+   } DstvState;
+
+
+   /*
+   Compute the state of the observer used for all of the targets at
+   one epoch: relative to the hub body for geometric states, and
+   relative to the solar system barycenter otherwise.
+   */
+   static void zzdstvob ( integer             obs,
+                          integer             hub,
+                          SpiceBoolean        geom,
+                          SpiceDouble         et,
+                          SpiceDouble         stobs [6] )
+   {
+      doublereal              lt;
+
+      if ( geom )
+      {
+         spkgeo_ ( &obs, &et, (char *) "J2000", &hub, stobs, &lt,
+                   (ftnlen) 5                                   );
+      }
+      else
+      {
+         spkssb_ ( &obs, &et, (char *) "J2000", stobs, (ftnlen) 5 );
+      }
+   }
+
+
+   /*
+   Compute the distance and range rate of one target relative to the
+   observer, given the observer's state from zzdstvob.
+   */
+   static void zzdstvev ( SpiceInt            targ,
+                          integer             hub,
+                          SpiceBoolean        geom,
+                          SpiceDouble         et,
+                          ConstSpiceChar    * abcorr,
+                          SpiceDouble         stobs [6],
+                          SpiceDouble       * dist,
+                          SpiceDouble       * rate     )
+   {
+      doublereal              dlt;
+      doublereal              lt;
+      doublereal              starg  [6];
+      doublereal              sthub  [6];
+      integer                 code;
+
+      code = (integer) targ;
+
+      if ( geom )
+      {
+         spkgeo_ ( &code, &et, (char *) "J2000", &hub, sthub, &lt,
+                   (ftnlen) 5                                    );
+
+         vsubg_c ( sthub, stobs, 6, starg );
+      }
+      else
+      {
+         spkltc_ ( &code,
+                   (doublereal *) &et,
+                   (char       *) "J2000",
+                   (char       *) abcorr,
+                   stobs,
+                   starg,
+                   &lt,
+                   &dlt,
+                   (ftnlen      ) 5,
+                   (ftnlen      ) strlen(abcorr) );
+      }
+
+      *dist = vnorm_c ( starg );
+
+      if ( *dist > 0.0 )
+      {
+         *rate = vdot_c ( starg, starg+3 ) / *dist;
+      }
+      else
+      {
+         *rate = 0.0;
+      }
+   }
+
+
+   void gfdstv_c ( SpiceInt            ntarg,
+                   ConstSpiceInt       targs  [],
+                   ConstSpiceChar    * abcorr,
+                   ConstSpiceChar    * obsrvr,
+                   ConstSpiceChar    * relate,
+                   SpiceDouble         refval,
+                   SpiceDouble         step,
+                   SpiceCell         * cnfine,
+                   SpiceInt            maxn,
+                   SpiceInt          * n,
+                   SpiceInt            tindex [],
+                   SpiceDouble         intvls [][2] )
+
+/*
+
+-Brief_I/O
+
+   VARIABLE         I/O  DESCRIPTION
+   ---------------  ---  ------------------------------------------------
+   SPICE_GF_CNVTOL   P   Convergence tolerance.
+   ntarg             I   Number of targets.
+   targs             I   NAIF ID codes of the targets.
+   abcorr            I   Aberration correction flag.
+   obsrvr            I   Name of the observing body.
+   relate            I   Relational operator.
+   refval            I   Reference distance, in km.
+   step              I   Step size in seconds.
+   cnfine            I   SPICE window to which the search is confined.
+   maxn              I   Maximum number of result intervals.
+   n                 O   Number of result intervals.
+   tindex            O   Target indices of the result intervals.
+   intvls            O   Result intervals.
+
+-Detailed_Input
+
+   ntarg       is the number of targets.
+
+   targs       is an array of `ntarg' NAIF ID codes of target bodies.
+
+   abcorr      is the aberration correction applied to the position of
+               each target relative to the observer.  Any correction
+               accepted by gfdist_c may be used.  Stellar aberration
+               does not change the distance and is ignored.
+
+   obsrvr      is the name of the observing body.  Optionally, you may
+               supply a string containing the integer ID code for the
+               object.
+
+   relate      is the relational operator defining the condition:
+               "<" for distances less than `refval' or ">" for
+               distances greater than `refval'.  Blanks are not
+               significant.
+
+   refval      is the reference distance, in km.
+
+   step        is the step size, in seconds, used to sample the
+               distance of every target.  `step' must be shorter than
+               any interval during which the distance of a target is
+               monotone, exactly as for gfdist_c.
+
+   cnfine      is a double precision SPICE window to which the search
+               is confined.
+
+   maxn        is the number of elements available in `tindex' and
+               `intvls'.
+
+-Detailed_Output
+
+   n           is the number of result intervals found for all of the
+               targets.
+
+   tindex,
+   intvls      are arrays of `n' elements.  Element i of `intvls' is a
+               time interval, given as start and stop times, during
+               which the condition holds for the target
+               targs[tindex[i]].
+
+               The intervals are grouped by target, in the order of
+               `targs', and the intervals of each target are in
+               increasing order of time.  The intervals of one target
+               form the window gfdist_c returns for that target, to
+               within the convergence tolerance.
+
+-Parameters
+
+   SPICE_GF_CNVTOL
+
+               is the convergence tolerance used for finding the
+               endpoints of the intervals.  A tolerance set by gfstol_c
+               is used instead, if there is one.
+
+-Exceptions
+
+   1)  If `ntarg' is less than 1, the error SPICE(INVALIDCOUNT) is
+       signaled.
+
+   2)  If `step' is not positive, the error SPICE(INVALIDSTEP) is
+       signaled.
+
+   3)  If `relate' is not "<" or ">", the error SPICE(NOTSUPPORTED) is
+       signaled.
+
+   4)  If the observer's name cannot be mapped to an ID code, the
+       error SPICE(IDCODENOTFOUND) is signaled.
+
+   5)  If any target is the observer, the error
+       SPICE(BODIESNOTDISTINCT) is signaled.
+
+   6)  If the confinement window does not have double precision type,
+       the error SPICE(TYPEMISMATCH) is signaled.
+
+   7)  If more than `maxn' intervals are found, the error
+       SPICE(ARRAYTOOSMALL) is signaled.
+
+   8)  If memory cannot be allocated for the search, the error
+       SPICE(MALLOCFAILED) is signaled.
+
+   9)  If any input string argument pointer is null, the error
+       SPICE(NULLPOINTER) is signaled.
+
+   10) If any input string argument is empty, the error
+       SPICE(EMPTYSTRING) is signaled.
+
+   11) Errors in the aberration correction, or in the computation of
+       any state, are diagnosed by routines in the call tree of this
+       routine.
+
+-Files
+
+   Appropriate SPK and leapseconds kernels must be loaded, as for
+   gfdist_c.
+
+-Particulars
+
+   Screening a catalog of objects for close approaches to an observer
+   with gfdist_c requires a separate search of the confinement window
+   for each object, and each search evaluates the observer's state at
+   each of its steps.
+
+   This routine makes a single pass over the confinement window.  At
+   each step the observer's state is computed once, and the distance
+   and range rate of every target are computed from it.  For
+   geometric states (`abcorr' is "NONE") the states are taken relative
+   to the center of the observer's SPK segment, so that the state of
+   a target orbiting the same body takes a single segment evaluation.
+
+   As in gfdist_c, the distance of a target is assumed monotone
+   between a step and the next, except where the range rate changes
+   sign.  A change of the condition within a step is located by
+   bisection.  An extremum within a step is located, also by
+   bisection, only if it could lie on the other side of `refval' than
+   the distance at both ends of the step: a minimum, for "<" when the
+   condition does not hold at the ends or for ">" when it does, and a
+   maximum in the other cases.
+   Refinement is carried out for one target at a time.
+
+   The result intervals are gathered by target into the output arrays,
+   which a caller may copy into windows with wninsd_c.
+
+   CSPICE is not thread-safe, so the targets are processed in a
+   single thread.
+
+-Examples
+
+   1)  Find the times in January 2027 at which any of a set of
+       objects lies within 100 km of the spacecraft -77.
+
+          SPICEDOUBLE_CELL ( cnfine, 2 );
+
+          str2et_c ( "2027 JAN 01", &et0 );
+          str2et_c ( "2027 FEB 01", &et1 );
+          wninsd_c ( et0, et1, &cnfine );
+
+          gfdstv_c ( NOBJ,  objids,  "NONE",  "-77",  "<",
+                     100.0, 60.0,    &cnfine, MAXN,   &n,
+                     tindex, intvls                       );
+
+          for ( i = 0;  i < n;  i++ )
+          {
+             printf ( "%d  %f  %f\n", (int)objids[tindex[i]],
+                      intvls[i][0],   intvls[i][1]           );
+          }
+
+-Restrictions
+
+   1)  The distance between the observer and a target must not vary
+       so rapidly that an interval of monotonicity is shorter than
+       `step'.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   GF distance search for multiple targets
+   find close approaches of many objects to an observer
+
+-&
+*/
+
+{ /* Begin gfdstv_c */
+
+
+   /*
+   Local variables
+   */
+   DstvState             * st;
+
+   SpiceChar               op;
+
+   SpiceDouble           * tmp;
+   SpiceDouble             a;
+   SpiceDouble             b;
+   SpiceDouble             fc;
+   SpiceDouble             fm;
+   SpiceDouble             fs   [3];
+   SpiceDouble             hi;
+   SpiceDouble             lo;
+   SpiceDouble             mid;
+   SpiceDouble             rc;
+   SpiceDouble             rm;
+   SpiceDouble             stmid [6];
+   SpiceDouble             stobs [6];
+   SpiceDouble             t;
+   SpiceDouble             tprev;
+   SpiceDouble             ts   [3];
+   SpiceDouble           * data;
+
+   SpiceInt              * cnt;
+   SpiceInt                i;
+   SpiceInt                j;
+   SpiceInt                k;
+   SpiceInt                m;
+   SpiceInt                nseg;
+   SpiceInt                nBytes;
+   SpiceInt                nstep;
+   SpiceInt                s;
+
+   SpiceBoolean            cond;
+   SpiceBoolean            geom;
+   SpiceBoolean            lcond;
+
+   doublereal              dc     [2];
+   doublereal              descr  [5];
+   doublereal              tol;
+
+   integer                 gettol = -1;
+   integer                 handle;
+   integer                 hub;
+   integer                 ic     [6];
+   integer                 nd     = 2;
+   integer                 ni     = 6;
+   integer                 obs;
+   integer                 tolid  = 3;
+
+   logical                 fnd;
+   logical                 ok;
+
+   char                    segid  [SIDLEN];
+
+
+   /*
+   Participate in error tracing.
+   */
+   if ( return_c() )
+   {
+      return;
+   }
+   chkin_c ( "gfdstv_c" );
+
+   *n = 0;
+
+   CELLTYPECHK ( CHK_STANDARD, "gfdstv_c", SPICE_DP, cnfine );
+   CELLINIT    ( cnfine );
+
+   CHKFSTR ( CHK_STANDARD, "gfdstv_c", abcorr );
+   CHKFSTR ( CHK_STANDARD, "gfdstv_c", obsrvr );
+   CHKFSTR ( CHK_STANDARD, "gfdstv_c", relate );
+
+   if ( ntarg < 1 )
+   {
+      setmsg_c ( "The target count must be at least 1 but was #." );
+      errint_c ( "#",  ntarg                                       );
+      sigerr_c ( "SPICE(INVALIDCOUNT)"                             );
+      chkout_c ( "gfdstv_c"                                        );
+      return;
+   }
+
+   if ( step <= 0.0 )
+   {
+      setmsg_c ( "Step has value #; step size must be positive." );
+      errdp_c  ( "#",  step                                       );
+      sigerr_c ( "SPICE(INVALIDSTEP)"                             );
+      chkout_c ( "gfdstv_c"                                       );
+      return;
+   }
+
+   /*
+   Find the relational operator, ignoring blanks.
+   */
+   op = ' ';
+
+   for ( i = 0;  relate[i];  i++ )
+   {
+      if ( relate[i] != ' ' )
+      {
+         if (  ( op == ' ' )
+            && ( ( relate[i] == '<' ) || ( relate[i] == '>' ) )  )
+         {
+            op = relate[i];
+         }
+         else
+         {
+            op = '?';
+         }
+      }
+   }
+
+   if (  ( op != '<' )  &&  ( op != '>' )  )
+   {
+      setmsg_c ( "The relational operator <#> is not supported; "
+                 "only \"<\" and \">\" may be used."            );
+      errch_c  ( "#",  relate                                   );
+      sigerr_c ( "SPICE(NOTSUPPORTED)"                          );
+      chkout_c ( "gfdstv_c"                                     );
+      return;
+   }
+
+   bods2c_ ( (char *) obsrvr, &obs, &fnd, (ftnlen) strlen(obsrvr) );
+
+   if ( !fnd )
+   {
+      setmsg_c ( "The observer, '#', is not a recognized name for an "
+                 "ephemeris object. The cause of this problem may be "
+                 "that you need an updated version of the SPICE "
+                 "Toolkit."                                           );
+      errch_c  ( "#",  obsrvr                                         );
+      sigerr_c ( "SPICE(IDCODENOTFOUND)"                              );
+      chkout_c ( "gfdstv_c"                                           );
+      return;
+   }
+
+   for ( k = 0;  k < ntarg;  k++ )
+   {
+      if ( targs[k] == obs )
+      {
+         setmsg_c ( "The observer and target must be distinct objects, "
+                    "but are not: OBSRVR = #; TARGET = #."             );
+         errch_c  ( "#",  obsrvr                                        );
+         errint_c ( "#",  targs[k]                                      );
+         sigerr_c ( "SPICE(BODIESNOTDISTINCT)"                          );
+         chkout_c ( "gfdstv_c"                                          );
+         return;
+      }
+   }
+
+   /*
+   Retrieve the convergence tolerance, if set.
+   */
+   zzholdd_ ( &gettol, &tolid, &ok, &tol );
+
+   if ( !ok )
+   {
+      tol = SPICE_GF_CNVTOL;
+   }
+
+   /*
+   Geometric states of the targets are computed relative to the
+   center of the observer's SPK segment at the start of the search,
+   which for a catalog of objects is usually also the center of the
+   targets' segments.  The observer's state relative to that body is
+   then shared by all of the targets, and each target's state usually
+   takes a single segment evaluation.  Any body is a valid hub; a
+   poor choice costs only speed.
+   */
+   geom = eqstr_c ( abcorr, "NONE" );
+   hub  = obs;
+
+   if (  geom  &&  ( cnfine->card > 0 )  )
+   {
+      spksfs_ ( &obs,     (doublereal *) cnfine->data,
+                &handle,  descr,        segid,
+                &fnd,     (ftnlen) SIDLEN           );
+
+      if ( fnd )
+      {
+         dafus_ ( descr, &nd, &ni, dc, ic );
+
+         hub = ic[1];
+      }
+   }
+
+   /*
+   Allocate the per-target state and the per-target interval counts.
+   */
+   nBytes = ntarg * ( sizeof(DstvState) + sizeof(SpiceInt) );
+
+   st     = (DstvState *) alloc_SpiceMemory( (size_t)nBytes );
+
+   if ( !st )
+   {
+      setmsg_c ( "Workspace allocation of # bytes failed due to "
+                 "malloc failure"                               );
+      errint_c ( "#",  nBytes                                   );
+      sigerr_c ( "SPICE(MALLOCFAILED)"                          );
+      chkout_c ( "gfdstv_c"                                     );
+      return;
+   }
+
+   cnt  = (SpiceInt *) ( st + ntarg );
+
+   for ( k = 0;  k < ntarg;  k++ )
+   {
+      cnt[k] = 0;
+   }
+
+   data = (SpiceDouble *) cnfine->data;
+
+   /*
+   Step through each interval of the confinement window.
+   */
+   for ( j = 0;  ( j < cnfine->card ) && !failed_c();  j += 2 )
+   {
+      a     = data[j];
+      b     = data[j+1];
+      nstep = (SpiceInt) ceil( ( b - a ) / step );
+      tprev = a;
+
+      for ( s = 0;  ( s <= nstep ) && !failed_c();  s++ )
+      {
+         t = ( s == nstep ) ? b : a + s * step;
+
+         /*
+         The observer's state is shared by all of the targets.  The
+         refinement of a step for one target uses its own observer
+         states, leaving `stobs' intact for the others.
+         */
+         zzdstvob ( obs, hub, geom, t, stobs );
+
+         for ( k = 0;  ( k < ntarg ) && !failed_c();  k++ )
+         {
+            zzdstvev ( targs[k], hub, geom, t, abcorr, stobs, &fc, &rc );
+
+            if ( s == 0 )
+            {
+               st[k].dist   = fc;
+               st[k].rate   = rc;
+               st[k].inside = ( op == '<' ) ? ( fc < refval )
+                                            : ( fc > refval );
+               st[k].start  = a;
+               continue;
+            }
+
+            /*
+            The condition changes at most once within a step unless an
+            extremum of the distance inside the step lies on the other
+            side of `refval' than the distance at both ends.  Only a
+            minimum can do that when the ends don't satisfy "<" (or do
+            satisfy ">"), and only a maximum in the other cases.  Such
+            an extremum is located by bisection on the range rate, and
+            the step is split there.  The bisection stops early at any
+            epoch at which the condition differs from that at the
+            ends, since that also splits the step into two parts in
+            each of which the condition changes once.
+            */
+            ts[0] = tprev;
+            fs[0] = st[k].dist;
+            nseg  = 1;
+
+            lcond = ( op == '<' ) ? ( fs[0] < refval ) : ( fs[0] > refval );
+            cond  = ( op == '<' ) ? ( fc    < refval ) : ( fc    > refval );
+
+            if (     ( cond == lcond )
+                 &&  ( ( st[k].rate > 0.0 ) != ( rc > 0.0 ) )
+                 &&  (    ( rc > 0.0 )
+                       == ( ( op == '<' ) != lcond ) )        )
+            {
+               lo = tprev;
+               hi = t;
+
+               while ( ( hi - lo ) > tol )
+               {
+                  mid = 0.5 * ( lo + hi );
+
+                  zzdstvob ( obs, hub, geom, mid, stmid );
+                  zzdstvev ( targs[k], hub,  geom, mid,
+                             abcorr,   stmid, &fm, &rm    );
+
+                  if ( failed_c() )
+                  {
+                     break;
+                  }
+
+                  if (  ( ( op == '<' ) ? ( fm < refval )
+                                        : ( fm > refval ) )  != lcond  )
+                  {
+                     lo = mid;
+                     hi = mid;
+                  }
+                  else if ( ( rm > 0.0 ) == ( st[k].rate > 0.0 ) )
+                  {
+                     lo = mid;
+                  }
+                  else
+                  {
+                     hi = mid;
+                  }
+               }
+
+               mid = 0.5 * ( lo + hi );
+
+               if ( mid != lo )
+               {
+                  zzdstvob ( obs, hub, geom, mid, stmid );
+                  zzdstvev ( targs[k], hub,  geom, mid,
+                             abcorr,   stmid, &fm, &rm    );
+               }
+
+               ts[1] = mid;
+               fs[1] = fm;
+               nseg  = 2;
+            }
+
+            ts[nseg] = t;
+            fs[nseg] = fc;
+
+            /*
+            Locate the change of the condition, if any, within each
+            segment.
+            */
+            for ( m = 0;  ( m < nseg ) && !failed_c();  m++ )
+            {
+               lcond = ( op == '<' ) ? ( fs[m]   < refval )
+                                     : ( fs[m]   > refval );
+               cond  = ( op == '<' ) ? ( fs[m+1] < refval )
+                                     : ( fs[m+1] > refval );
+
+               if ( cond == lcond )
+               {
+                  continue;
+               }
+
+               lo = ts[m];
+               hi = ts[m+1];
+
+               while ( ( hi - lo ) > tol )
+               {
+                  mid = 0.5 * ( lo + hi );
+
+                  zzdstvob ( obs, hub, geom, mid, stmid );
+                  zzdstvev ( targs[k], hub,  geom, mid,
+                             abcorr,   stmid, &fm, &rm    );
+
+                  if ( failed_c() )
+                  {
+                     break;
+                  }
+
+                  if (  ( ( op == '<' ) ? ( fm < refval )
+                                        : ( fm > refval ) )  == lcond  )
+                  {
+                     lo = mid;
+                  }
+                  else
+                  {
+                     hi = mid;
+                  }
+               }
+
+               mid = 0.5 * ( lo + hi );
+
+               if ( cond )
+               {
+                  st[k].start = mid;
+               }
+               else
+               {
+                  if ( *n == maxn )
+                  {
+                     setmsg_c ( "More than # result intervals were "
+                                "found."                            );
+                     errint_c ( "#",  maxn                          );
+                     sigerr_c ( "SPICE(ARRAYTOOSMALL)"              );
+                     break;
+                  }
+
+                  tindex[*n]    = k;
+                  intvls[*n][0] = st[k].start;
+                  intvls[*n][1] = mid;
+                  ++cnt[k];
+                  ++(*n);
+               }
+
+               st[k].inside = cond;
+            }
+
+            st[k].dist = fc;
+            st[k].rate = rc;
+         }
+
+         tprev = t;
+      }
+
+      /*
+      Close the intervals in progress at the end of the confinement
+      interval.  This includes an interval of a single epoch, which
+      has no steps.
+      */
+      for ( k = 0;  ( k < ntarg ) && !failed_c();  k++ )
+      {
+         if ( st[k].inside )
+         {
+            if ( *n == maxn )
+            {
+               setmsg_c ( "More than # result intervals were found." );
+               errint_c ( "#",  maxn                                 );
+               sigerr_c ( "SPICE(ARRAYTOOSMALL)"                     );
+               break;
+            }
+
+            tindex[*n]    = k;
+            intvls[*n][0] = st[k].start;
+            intvls[*n][1] = b;
+            ++cnt[k];
+            ++(*n);
+         }
+      }
+   }
+
+   /*
+   Gather the intervals by target.  The intervals of each target were
+   found in increasing order of time, so a counting sort preserves
+   that order.
+   */
+   if (  !failed_c()  &&  ( *n > 0 )  )
+   {
+      nBytes = (*n) * 3 * sizeof(SpiceDouble);
+
+      tmp    = (SpiceDouble *) alloc_SpiceMemory( (size_t)nBytes );
+
+      if ( !tmp )
+      {
+         setmsg_c ( "Workspace allocation of # bytes failed due to "
+                    "malloc failure"                               );
+         errint_c ( "#",  nBytes                                   );
+         sigerr_c ( "SPICE(MALLOCFAILED)"                          );
+      }
+      else
+      {
+         for ( i = 0;  i < *n;  i++ )
+         {
+            tmp[3*i  ] = (SpiceDouble) tindex[i];
+            tmp[3*i+1] = intvls[i][0];
+            tmp[3*i+2] = intvls[i][1];
+         }
+
+         /*
+         Convert the counts to starting positions.
+         */
+         m = 0;
+
+         for ( k = 0;  k < ntarg;  k++ )
+         {
+            s      = cnt[k];
+            cnt[k] = m;
+            m     += s;
+         }
+
+         for ( i = 0;  i < *n;  i++ )
+         {
+            k = (SpiceInt) tmp[3*i];
+            m = cnt[k]++;
+
+            tindex[m]    = k;
+            intvls[m][0] = tmp[3*i+1];
+            intvls[m][1] = tmp[3*i+2];
+         }
+
+         free_SpiceMemory( (void *)tmp );
+      }
+   }
+
+   free_SpiceMemory( (void *)st );
+
+   if ( failed_c() )
+   {
+      *n = 0;
+   }
+
+
+   chkout_c ( "gfdstv_c" );
+
+} /* End gfdstv_c */
@@ -0,0 +1,296 @@
+/*
+
+-Procedure gfoclp_c ( GF, find occultation, partitioned )
+
+-Abstract
+
+   Determine time intervals when an observer sees one target occulted
+   by, or in transit across, another, within one of a specified number
+   of parts of a confinement window.
+
+   The union of the results for all of the parts is the result of
+   gfoclt_c for the whole window.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   CELLS
+   DSK
+   FRAMES
+   GF
+   KERNEL
+   NAIF_IDS
+   SPK
+   TIME
+   WINDOWS
+
+-Keywords
+
+   EVENT
+   GEOMETRY
+   SEARCH
+   WINDOW
+
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZmc.h"
+   #include "zzalloc.h"
+
+   void gfoclp_c ( ConstSpiceChar   * occtyp,
+                   ConstSpiceChar   * front,
+                   ConstSpiceChar   * fshape,
+                   ConstSpiceChar   * fframe,
+                   ConstSpiceChar   * back,
+                   ConstSpiceChar   * bshape,
+                   ConstSpiceChar   * bframe,
+                   ConstSpiceChar   * abcorr,
+                   ConstSpiceChar   * obsrvr,
+                   SpiceDouble        step,
+                   SpiceInt           npart,
+                   SpiceInt           ipart,
+                   SpiceCell        * cnfine,
+                   SpiceCell        * result )
+/*
+
+-Brief_I/O
+
+   VARIABLE        I/O  DESCRIPTION
+   --------------- ---  -------------------------------------------------
+   occtyp           I   Type of occultation.
+   front            I   Name of body occulting the other.
+   fshape           I   Type of shape model used for front body.
+   fframe           I   Body-fixed, body-centered frame for front body.
+   back             I   Name of body occulted by the other.
+   bshape           I   Type of shape model used for back body.
+   bframe           I   Body-fixed, body-centered frame for back body.
+   abcorr           I   Aberration correction flag.
+   obsrvr           I   Name of the observing body.
+   step             I   Step size in seconds for finding occultation
+                        events.
+   npart            I   Number of parts of the confinement window.
+   ipart            I   Index of the part to search.
+   cnfine           I   SPICE window to which the search is restricted.
+   result           O   SPICE window containing results for the part.
+
+-Detailed_Input
+
+   npart       is the number of parts of equal measure into which
+               `cnfine' is divided.
+
+   ipart       is the zero-based index, in the range 0 : npart-1, of
+               the part of `cnfine' to be searched.
+
+               The parts are those returned by wnpart_c.
+
+   All other inputs have the meanings given in the header of
+   gfoclt_c.  `cnfine' is not modified.
+
+-Detailed_Output
+
+   result      is a SPICE window containing the time intervals within
+               part `ipart' of `cnfine' during which the specified
+               occultation occurs.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1)  If `npart' is less than 1, the error SPICE(INVALIDCOUNT) is
+       signaled by a routine in the call tree of this routine.
+
+   2)  If `ipart' is outside of the range 0 : npart-1, the error
+       SPICE(INDEXOUTOFRANGE) is signaled by a routine in the call
+       tree of this routine.
+
+   3)  If memory cannot be allocated for the part of the confinement
+       window, the error SPICE(MALLOCFAILED) is signaled.
+
+   4)  All other errors are diagnosed by gfoclt_c or routines in its
+       call tree.
+
+-Files
+
+   See gfoclt_c.
+
+-Particulars
+
+   A search for occultations over a long confinement window, for
+   example all occultations of a spacecraft by the planets over a
+   mission, evaluates the occultation state at every step of the
+   window.  This routine allows such a search to be divided among
+   separate processes, each of which has loaded the same kernels and
+   searches one part of the window.
+
+   CSPICE, including the occultation utilities used by gfoclt_c, keeps
+   its state in static variables and is not thread-safe, so the
+   searches of the parts must not run in threads of one process.
+
+   Each part is searched exactly as gfoclt_c searches a window.  The
+   union of the results for parts 0 through npart-1, formed with
+   wnunid_c, is the result of gfoclt_c for `cnfine' to within the
+   convergence tolerance of the search.  An occultation in progress at
+   a boundary between parts is found in both parts; the intervals
+   found in the two parts share the boundary as an endpoint and are
+   merged by the union.
+
+   As for gfoclt_c, `step' must be shorter than the shortest
+   occultation, and the shortest gap between occultations, to be
+   found.
+
+-Examples
+
+   1)  Search a window in NPART separate processes, then combine the
+       results.  Process `ipart' executes
+
+          furnsh_c ( "kernels.tm" );
+
+          gfoclp_c ( "ANY",   "MOON",     "ellipsoid", "IAU_MOON",
+                     "SUN",   "ellipsoid", "IAU_SUN",  "LT",
+                     "EARTH", 180.0,       NPART,      ipart,
+                     &cnfine, &result                            );
+
+       and writes `result' to a file.  A final step reads the results
+       of all of the processes into the windows part[i] and forms
+       their union:
+
+          copy_c ( &part[0], &total );
+
+          for ( i = 1;  i < NPART;  i++ )
+          {
+             wnunid_c ( &total, &part[i], &work );
+             copy_c   ( &work,  &total );
+          }
+
+-Restrictions
+
+   1)  See gfoclt_c.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   find occultation events in part of a window
+   partitioned search for occultation events
+
+-&
+*/
+
+{ /* Begin gfoclp_c */
+
+
+   /*
+   Local variables
+   */
+   SpiceCell               part;
+
+   SpiceDouble           * work;
+
+   SpiceInt                nBytes;
+   SpiceInt                size;
+
+
+   /*
+   Participate in error tracing.
+   */
+   if ( return_c() )
+   {
+      return;
+   }
+   chkin_c ( "gfoclp_c" );
+
+
+   /*
+   Make sure cell data types are d.p.
+   */
+   CELLTYPECHK2 ( CHK_STANDARD, "gfoclp_c", SPICE_DP, cnfine, result );
+
+   /*
+   Initialize the input cells if necessary.
+   */
+   CELLINIT2 ( cnfine, result );
+
+   /*
+   Each interval of `cnfine' contributes at most one interval to the
+   part, so the part needs no more room than `cnfine' has in use.
+   */
+   size   = maxi_c ( 2, cnfine->card, 2 );
+
+   nBytes = ( size + SPICE_CELL_CTRLSZ ) * sizeof(SpiceDouble);
+
+   work   = (SpiceDouble *) alloc_SpiceMemory( nBytes );
+
+   if ( !work )
+   {
+      setmsg_c ( "Workspace allocation of # bytes failed due to "
+                 "malloc failure"                               );
+      errint_c ( "#",  nBytes                                   );
+      sigerr_c ( "SPICE(MALLOCFAILED)"                          );
+      chkout_c ( "gfoclp_c"                                     );
+      return;
+   }
+
+   part.dtype  = SPICE_DP;
+   part.length = 0;
+   part.size   = size;
+   part.card   = 0;
+   part.isSet  = SPICETRUE;
+   part.adjust = SPICEFALSE;
+   part.init   = SPICEFALSE;
+   part.base   = (void *) work;
+   part.data   = (void *) ( work + SPICE_CELL_CTRLSZ );
+
+   /*
+   Extract the part, then search it.
+   */
+   wnpart_c ( cnfine, npart, ipart, &part );
+
+   if ( !failed_c() )
+   {
+      gfoclt_c ( occtyp, front,  fshape, fframe, back,  bshape,
+                 bframe, abcorr, obsrvr, step,   &part, result );
+   }
+
+   free_SpiceMemory( (void *)work );
+
+
+   chkout_c ( "gfoclp_c" );
+
+} /* End gfoclp_c */
@@ -0,0 +1,800 @@
+/*
+
+-Procedure gftfvv_c ( GF, is target in FOV?, multiple targets )
+
+-Abstract
+
+   Return the time intervals during which each of a set of ephemeris
+   objects intersects the space bounded by the field of view of an
+   instrument, by stepping all of the targets through the confinement
+   window together.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   CK
+   FRAMES
+   GF
+   KERNEL
+   NAIF_IDS
+   PCK
+   SPK
+   TIME
+   WINDOWS
+
+-Keywords
+
+   EVENT
+   FOV
+   GEOMETRY
+   INSTRUMENT
+   SEARCH
+
+*/
+
+   #include <math.h>
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZmc.h"
+   #include "SpiceZst.h"
+   #include "zzalloc.h"
+   #undef gftfvv_c
+
+
+   /*
+   Local parameters
+   */
+   #define FRNMLN          33
+   #define SHPLEN          10
+   #define IDLEN           12
+
+   /*
+   Margin, in radians, added to the bounding cone test.
+   */
+   #define CNMARG          1.0e-6
+
+
+   /*
+   Per-target search state.
+   */
+   typedef struct
+   {
+      SpiceDouble      radius;
+      SpiceDouble      start;
+      SpiceBoolean     inside;
+      SpiceChar        frame [FRNMLN];
+
+   } FvvState;
+
+
+   /*
+   Set up the FOV state routine ZZGFFVST for one target.
+   */
+   static void zzfvvin ( ConstSpiceChar    * inst,
+                         ConstSpiceChar    * tshape,
+                         SpiceInt            targ,
+                         ConstSpiceChar    * tframe,
+                         ConstSpiceChar    * abcorr,
+                         ConstSpiceChar    * obsrvr )
+   {
+      doublereal              raydir [3] = { 0.0, 0.0, 0.0 };
+      integer                 code;
+      char                    target [IDLEN];
+
+      code = (integer) targ;
+
+      intstr_ ( &code, target, (ftnlen) IDLEN );
+
+      zzgffvin_ ( (char *) inst,
+                  (char *) tshape,
+                  raydir,
+                  target,
+                  (char *) tframe,
+                  (char *) abcorr,
+                  (char *) obsrvr,
+                  (ftnlen) strlen(inst),
+                  (ftnlen) strlen(tshape),
+                  (ftnlen) IDLEN,
+                  (ftnlen) strlen(tframe),
+                  (ftnlen) strlen(abcorr),
+                  (ftnlen) strlen(obsrvr)  );
+   }
+
+
+   void gftfvv_c ( ConstSpiceChar    * inst,
+                   SpiceInt            ntarg,
+                   ConstSpiceInt       targs  [],
+                   ConstSpiceChar    * tshape,
+                   ConstSpiceChar    * abcorr,
+                   ConstSpiceChar    * obsrvr,
+                   SpiceDouble         step,
+                   SpiceCell         * cnfine,
+                   SpiceInt            maxn,
+                   SpiceInt          * n,
+                   SpiceInt            tindex [],
+                   SpiceDouble         intvls [][2] )
+
+/*
+
+-Brief_I/O
+
+   VARIABLE         I/O  DESCRIPTION
+   ---------------  ---  ------------------------------------------------
+   SPICE_GF_CNVTOL   P   Convergence tolerance.
+   SPICE_GF_MAXVRT   P   Maximum number of FOV boundary vertices.
+   inst              I   Name of the instrument.
+   ntarg             I   Number of targets.
+   targs             I   NAIF ID codes of the targets.
+   tshape            I   Type of shape model used for the targets.
+   abcorr            I   Aberration correction flag.
+   obsrvr            I   Name of the observing body.
+   step              I   Step size in seconds.
+   cnfine            I   SPICE window to which the search is confined.
+   maxn              I   Maximum number of result intervals.
+   n                 O   Number of result intervals.
+   tindex            O   Target indices of the result intervals.
+   intvls            O   Result intervals.
+
+-Detailed_Input
+
+   inst        is the name of the instrument, as for gftfov_c.
+
+   ntarg       is the number of targets.
+
+   targs       is an array of `ntarg' NAIF ID codes of ephemeris
+               objects.
+
+   tshape      is the shape model used for all of the targets:
+               "ELLIPSOID" or "POINT".  Case and blanks are not
+               significant.
+
+               The body-fixed frame of an ellipsoidal target is the
+               frame associated with it by cidfrm_c, and its radii are
+               given by the kernel variable BODYnnn_RADII.
+
+   abcorr      is the aberration correction, as for gftfov_c.
+
+   obsrvr      is the name of the observing body, as for gftfov_c.
+
+   step        is the step size, in seconds, used to sample the state
+               of every target.  As for gftfov_c, `step' must be
+               shorter than any visibility event of a target, and
+               shorter than any gap between such events.
+
+   cnfine      is a double precision SPICE window to which the search
+               is confined.
+
+   maxn        is the number of elements available in `tindex' and
+               `intvls'.
+
+-Detailed_Output
+
+   n           is the number of result intervals found for all of the
+               targets.
+
+   tindex,
+   intvls      are arrays of `n' elements.  Element i of `intvls' is a
+               time interval, given as start and stop times, during
+               which the target targs[tindex[i]] is in the FOV.
+
+               The intervals are grouped by target, in the order of
+               `targs', and the intervals of each target are in
+               increasing order of time.  The intervals of one target
+               form the window gftfov_c returns for that target.
+
+-Parameters
+
+   SPICE_GF_CNVTOL
+
+               is the convergence tolerance used for finding the
+               endpoints of the intervals.  A tolerance set by gfstol_c
+               is used instead, if there is one.
+
+   SPICE_GF_MAXVRT
+
+               is the maximum number of vertices of the FOV boundary.
+
+-Exceptions
+
+   1)  If `ntarg' is less than 1, the error SPICE(INVALIDCOUNT) is
+       signaled.
+
+   2)  If `step' is not positive, the error SPICE(INVALIDSTEPSIZE) is
+       signaled.
+
+   3)  If `tshape' is not "ELLIPSOID" or "POINT", the error
+       SPICE(INVALIDSHAPE) is signaled.
+
+   4)  If `tshape' is "ELLIPSOID" and no body-fixed frame is
+       associated with a target, the error SPICE(NOFRAME) is
+       signaled.
+
+   5)  If the confinement window does not have double precision type,
+       the error SPICE(TYPEMISMATCH) is signaled.
+
+   6)  If more than `maxn' intervals are found, the error
+       SPICE(ARRAYTOOSMALL) is signaled.
+
+   7)  If memory cannot be allocated for the search, the error
+       SPICE(MALLOCFAILED) is signaled.
+
+   8)  If any input string argument pointer is null, the error
+       SPICE(NULLPOINTER) is signaled.
+
+   9)  If any input string argument is empty, the error
+       SPICE(EMPTYSTRING) is signaled.
+
+   10) Errors in the instrument, the FOV, the aberration correction,
+       the shape, the observer or a target are diagnosed by routines
+       in the call tree of this routine, as they are for gftfov_c.
+
+-Files
+
+   Appropriate kernels must be loaded, as for gftfov_c.
+
+-Particulars
+
+   Planning observations of a catalog of objects with gftfov_c
+   requires a separate search of the confinement window for each
+   object, and each search evaluates the instrument's orientation at
+   each of its steps.
+
+   This routine makes a single pass over the confinement window.  At
+   each step the orientation of the instrument frame and the state of
+   the observer are computed once.  From them, the position of each
+   target is compared with a bounding cone: the right circular cone
+   about the FOV axis that contains the FOV, widened by the angular
+   radius of a sphere enclosing the target.  A target outside that
+   cone is not in the FOV.  The exact FOV test of gftfov_c is applied
+   only to targets inside it.
+
+   The target positions used in the cone test are those of the exact
+   test, and the cone is widened by a small margin, so it rejects only
+   targets that the exact test would also reject.  A change of state
+   within a step is located by bisection on the exact test, one
+   target at a time.
+
+   CSPICE is not thread-safe, so the targets are processed in a
+   single thread.
+
+-Examples
+
+   1)  Find the times in January 2027 at which any of a set of
+       objects, modeled as points, is in the FOV of instrument
+       "CAM".
+
+          SPICEDOUBLE_CELL ( cnfine, 2 );
+
+          str2et_c ( "2027 JAN 01", &et0 );
+          str2et_c ( "2027 FEB 01", &et1 );
+          wninsd_c ( et0, et1, &cnfine );
+
+          gftfvv_c ( "CAM",  NOBJ,   objids,  "POINT",
+                     "LT+S", "-77",  10.0,    &cnfine,
+                     MAXN,   &n,     tindex,  intvls   );
+
+          for ( i = 0;  i < n;  i++ )
+          {
+             printf ( "%d  %f  %f\n", (int)objids[tindex[i]],
+                      intvls[i][0],   intvls[i][1]           );
+          }
+
+-Restrictions
+
+   1)  See gftfov_c.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   GF target in instrument FOV search for multiple targets
+   find times when any of a set of objects is in a FOV
+
+-&
+*/
+
+{ /* Begin gftfvv_c */
+
+
+   /*
+   Local variables
+   */
+   FvvState              * st;
+
+   SpiceDouble           * bounds;
+   SpiceDouble           * data;
+   SpiceDouble           * tmp;
+   SpiceDouble             a;
+   SpiceDouble             arad;
+   SpiceDouble             axis   [3];
+   SpiceDouble             b;
+   SpiceDouble             bsight [3];
+   SpiceDouble             dist;
+   SpiceDouble             hi;
+   SpiceDouble             lo;
+   SpiceDouble             mid;
+   SpiceDouble             dir    [3];
+   SpiceDouble             t;
+   SpiceDouble             tprev;
+
+   SpiceInt              * cnt;
+   SpiceInt                cur;
+   SpiceInt                i;
+   SpiceInt                k;
+   SpiceInt                m;
+   SpiceInt                nBytes;
+   SpiceInt                nstep;
+   SpiceInt                s;
+   SpiceInt                j;
+
+   SpiceBoolean            cond;
+   SpiceBoolean            ellips;
+   SpiceBoolean            geom;
+
+   doublereal              lt;
+   doublereal              ptarg  [3];
+   doublereal              radii  [3];
+   doublereal              rot    [3][3];
+   doublereal              stobs  [6];
+   doublereal              tol;
+
+   integer                 code;
+   integer                 frcode;
+   integer                 gettol = -1;
+   integer                 instid;
+   integer                 nb;
+   integer                 nr;
+   integer                 obs;
+   integer                 room   = SPICE_GF_MAXVRT;
+   integer                 three  = 3;
+   integer                 tolid  = 3;
+
+   logical                 fnd;
+   logical                 ok;
+   logical                 vistat;
+
+   char                    frame  [FRNMLN];
+   char                    shape  [SHPLEN];
+
+
+   /*
+   Participate in error tracing.
+   */
+   if ( return_c() )
+   {
+      return;
+   }
+   chkin_c ( "gftfvv_c" );
+
+   *n = 0;
+
+   CELLTYPECHK ( CHK_STANDARD, "gftfvv_c", SPICE_DP, cnfine );
+   CELLINIT    ( cnfine );
+
+   CHKFSTR ( CHK_STANDARD, "gftfvv_c", inst   );
+   CHKFSTR ( CHK_STANDARD, "gftfvv_c", tshape );
+   CHKFSTR ( CHK_STANDARD, "gftfvv_c", abcorr );
+   CHKFSTR ( CHK_STANDARD, "gftfvv_c", obsrvr );
+
+   if ( ntarg < 1 )
+   {
+      setmsg_c ( "The target count must be at least 1 but was #." );
+      errint_c ( "#",  ntarg                                       );
+      sigerr_c ( "SPICE(INVALIDCOUNT)"                             );
+      chkout_c ( "gftfvv_c"                                        );
+      return;
+   }
+
+   if ( step <= 0.0 )
+   {
+      setmsg_c ( "Step has value #; step size must be positive." );
+      errdp_c  ( "#",  step                                       );
+      sigerr_c ( "SPICE(INVALIDSTEPSIZE)"                         );
+      chkout_c ( "gftfvv_c"                                       );
+      return;
+   }
+
+   /*
+   Retrieve the convergence tolerance, if set.
+   */
+   zzholdd_ ( &gettol, &tolid, &ok, &tol );
+
+   if ( !ok )
+   {
+      tol = SPICE_GF_CNVTOL;
+   }
+
+   ellips = eqstr_c ( tshape, "ELLIPSOID" );
+   geom   = eqstr_c ( abcorr, "NONE"      );
+
+   if (  !ellips  &&  !eqstr_c ( tshape, "POINT" )  )
+   {
+      setmsg_c ( "The target shape # is not supported; the shape "
+                 "must be ELLIPSOID or POINT."                   );
+      errch_c  ( "#",  tshape                                    );
+      sigerr_c ( "SPICE(INVALIDSHAPE)"                           );
+      chkout_c ( "gftfvv_c"                                      );
+      return;
+   }
+
+   /*
+   Allocate the per-target state, the per-target interval counts and
+   the FOV boundary vectors.
+   */
+   nBytes = ntarg * ( sizeof(FvvState) + sizeof(SpiceInt) )
+            + 3 * SPICE_GF_MAXVRT * sizeof(SpiceDouble);
+
+   st     = (FvvState *) alloc_SpiceMemory( (size_t)nBytes );
+
+   if ( !st )
+   {
+      setmsg_c ( "Workspace allocation of # bytes failed due to "
+                 "malloc failure"                               );
+      errint_c ( "#",  nBytes                                   );
+      sigerr_c ( "SPICE(MALLOCFAILED)"                          );
+      chkout_c ( "gftfvv_c"                                     );
+      return;
+   }
+
+   bounds = (SpiceDouble *) ( st + ntarg );
+   cnt    = (SpiceInt    *) ( bounds + 3 * SPICE_GF_MAXVRT );
+
+   /*
+   Find the frame and radius of each target.  Setting up the FOV state
+   routine for each target in turn diagnoses the inputs exactly as
+   gftfov_c would.
+   */
+   for ( k = 0;  ( k < ntarg ) && !failed_c();  k++ )
+   {
+      cnt[k]       = 0;
+      st[k].radius = 0.0;
+      st[k].inside = SPICEFALSE;
+
+      strncpy ( st[k].frame, " ", FRNMLN );
+
+      if ( ellips )
+      {
+         code = (integer) targs[k];
+
+         cidfrm_ ( &code, &frcode, st[k].frame, &fnd, (ftnlen) FRNMLN-1 );
+
+         if ( !fnd )
+         {
+            setmsg_c ( "No body-fixed frame is associated with "
+                       "target #."                               );
+            errint_c ( "#",  targs[k]                            );
+            sigerr_c ( "SPICE(NOFRAME)"                          );
+            break;
+         }
+
+         st[k].frame[FRNMLN-1] = '\0';
+         F2C_ConvertStr ( FRNMLN, st[k].frame );
+      }
+
+      zzfvvin ( inst, tshape, targs[k], st[k].frame, abcorr, obsrvr );
+
+      if (  ellips  &&  !failed_c()  )
+      {
+         bodvcd_ ( &code, (char *) "RADII", &three, &nr, radii,
+                   (ftnlen) 5                                  );
+
+         st[k].radius = maxd_c ( 3, radii[0], radii[1], radii[2] );
+      }
+   }
+
+   cur = ntarg - 1;
+
+   /*
+   Find the axis and angular radius of the FOV's bounding cone, as
+   ZZGFFVIN does.
+   */
+   arad = 0.0;
+
+   if ( !failed_c() )
+   {
+      bods2c_ ( (char *) inst,   &instid,  &fnd,
+                (ftnlen) strlen(inst)          );
+
+      getfov_ ( &instid, &room,  shape,   frame,   bsight,
+                &nb,     bounds, (ftnlen) SHPLEN-1,
+                (ftnlen) FRNMLN-1                         );
+
+      shape[SHPLEN-1] = '\0';
+      frame[FRNMLN-1] = '\0';
+      F2C_ConvertStr ( SHPLEN, shape );
+      F2C_ConvertStr ( FRNMLN, frame );
+
+      if (  eqstr_c ( shape, "RECTANGLE" )
+         || eqstr_c ( shape, "POLYGON"   )  )
+      {
+         zzfovaxi_ ( (char *) inst, &nb, bounds, axis,
+                     (ftnlen) strlen(inst)           );
+      }
+      else
+      {
+         vequ_c ( bsight, axis );
+      }
+
+      for ( i = 0;  i < nb;  i++ )
+      {
+         arad = maxd_c ( 2, arad, vsep_c ( bounds+3*i, axis ) );
+      }
+
+      bods2c_ ( (char *) obsrvr, &obs, &fnd, (ftnlen) strlen(obsrvr) );
+   }
+
+   data = (SpiceDouble *) cnfine->data;
+
+   /*
+   Step through each interval of the confinement window.
+   */
+   for ( j = 0;  ( j < cnfine->card ) && !failed_c();  j += 2 )
+   {
+      a     = data[j];
+      b     = data[j+1];
+      nstep = (SpiceInt) ceil( ( b - a ) / step );
+      tprev = a;
+
+      for ( s = 0;  ( s <= nstep ) && !failed_c();  s++ )
+      {
+         t = ( s == nstep ) ? b : a + s * step;
+
+         /*
+         The orientation of the instrument frame and the state of the
+         observer are shared by all of the targets.
+         */
+         pxform_ ( (char *) "J2000", frame, &t, (doublereal *) rot,
+                   (ftnlen) 5,       (ftnlen) strlen(frame)        );
+
+         if ( !geom )
+         {
+            spkssb_ ( &obs, &t, (char *) "J2000", stobs, (ftnlen) 5 );
+         }
+
+         for ( k = 0;  ( k < ntarg ) && !failed_c();  k++ )
+         {
+            /*
+            Find the position of the target as SPKEZP, and therefore
+            ZZGFFVST, finds it.
+            */
+            code = (integer) targs[k];
+
+            if ( geom )
+            {
+               spkgps_ ( &code,   &t,   (char *) "J2000", &obs,
+                         ptarg,   &lt,  (ftnlen) 5             );
+            }
+            else
+            {
+               spkapo_ ( &code,   &t,     (char *) "J2000", stobs,
+                         (char *) abcorr, ptarg,            &lt,
+                         (ftnlen) 5,      (ftnlen) strlen(abcorr) );
+            }
+
+            mxv_c ( rot, ptarg, dir );
+
+            dist = vnorm_c ( dir );
+
+            cond = SPICETRUE;
+
+            if ( dist > st[k].radius )
+            {
+               cond = (    vsep_c ( dir, axis )
+                        <= arad + asin( st[k].radius / dist ) + CNMARG );
+            }
+
+            /*
+            Apply the exact test to a target that may be in the FOV.
+            */
+            if (  cond  &&  !failed_c()  )
+            {
+               if ( k != cur )
+               {
+                  zzfvvin ( inst,     tshape, targs[k],
+                            st[k].frame, abcorr, obsrvr );
+                  cur = k;
+               }
+
+               zzgffvst_ ( &t, &vistat );
+
+               cond = (SpiceBoolean) vistat;
+            }
+
+            if ( s == 0 )
+            {
+               st[k].inside = cond;
+               st[k].start  = a;
+               continue;
+            }
+
+            /*
+            Locate a change of state within the step.
+            */
+            if (  ( cond != st[k].inside )  &&  !failed_c()  )
+            {
+               if ( k != cur )
+               {
+                  zzfvvin ( inst,     tshape, targs[k],
+                            st[k].frame, abcorr, obsrvr );
+                  cur = k;
+               }
+
+               lo = tprev;
+               hi = t;
+
+               while ( ( hi - lo ) > tol )
+               {
+                  mid = 0.5 * ( lo + hi );
+
+                  zzgffvst_ ( &mid, &vistat );
+
+                  if ( failed_c() )
+                  {
+                     break;
+                  }
+
+                  if ( (SpiceBoolean)vistat == st[k].inside )
+                  {
+                     lo = mid;
+                  }
+                  else
+                  {
+                     hi = mid;
+                  }
+               }
+
+               mid = 0.5 * ( lo + hi );
+
+               if ( cond )
+               {
+                  st[k].start = mid;
+               }
+               else
+               {
+                  if ( *n == maxn )
+                  {
+                     setmsg_c ( "More than # result intervals were "
+                                "found."                            );
+                     errint_c ( "#",  maxn                          );
+                     sigerr_c ( "SPICE(ARRAYTOOSMALL)"              );
+                     break;
+                  }
+
+                  tindex[*n]    = k;
+                  intvls[*n][0] = st[k].start;
+                  intvls[*n][1] = mid;
+                  ++cnt[k];
+                  ++(*n);
+               }
+
+               st[k].inside = cond;
+            }
+         }
+
+         tprev = t;
+      }
+
+      /*
+      Close the intervals in progress at the end of the confinement
+      interval.  This includes an interval of a single epoch, which
+      has no steps.
+      */
+      for ( k = 0;  ( k < ntarg ) && !failed_c();  k++ )
+      {
+         if ( st[k].inside )
+         {
+            if ( *n == maxn )
+            {
+               setmsg_c ( "More than # result intervals were found." );
+               errint_c ( "#",  maxn                                 );
+               sigerr_c ( "SPICE(ARRAYTOOSMALL)"                     );
+               break;
+            }
+
+            tindex[*n]    = k;
+            intvls[*n][0] = st[k].start;
+            intvls[*n][1] = b;
+            ++cnt[k];
+            ++(*n);
+         }
+      }
+   }
+
+   /*
+   Gather the intervals by target.  The intervals of each target were
+   found in increasing order of time, so a counting sort preserves
+   that order.
+   */
+   if (  !failed_c()  &&  ( *n > 0 )  )
+   {
+      nBytes = (*n) * 3 * sizeof(SpiceDouble);
+
+      tmp    = (SpiceDouble *) alloc_SpiceMemory( (size_t)nBytes );
+
+      if ( !tmp )
+      {
+         setmsg_c ( "Workspace allocation of # bytes failed due to "
+                    "malloc failure"                               );
+         errint_c ( "#",  nBytes                                   );
+         sigerr_c ( "SPICE(MALLOCFAILED)"                          );
+      }
+      else
+      {
+         for ( i = 0;  i < *n;  i++ )
+         {
+            tmp[3*i  ] = (SpiceDouble) tindex[i];
+            tmp[3*i+1] = intvls[i][0];
+            tmp[3*i+2] = intvls[i][1];
+         }
+
+         /*
+         Convert the counts to starting positions.
+         */
+         m = 0;
+
+         for ( k = 0;  k < ntarg;  k++ )
+         {
+            s      = cnt[k];
+            cnt[k] = m;
+            m     += s;
+         }
+
+         for ( i = 0;  i < *n;  i++ )
+         {
+            k = (SpiceInt) tmp[3*i];
+            m = cnt[k]++;
+
+            tindex[m]    = k;
+            intvls[m][0] = tmp[3*i+1];
+            intvls[m][1] = tmp[3*i+2];
+         }
+
+         free_SpiceMemory( (void *)tmp );
+      }
+   }
+
+   free_SpiceMemory( (void *)st );
+
+   if ( failed_c() )
+   {
+      *n = 0;
+   }
+
+
+   chkout_c ( "gftfvv_c" );
+
+} /* End gftfvv_c */
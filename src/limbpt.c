@@ -74,6 +74,9 @@ static doublereal c_b129 = 1.;
 	    zzsudski_(integer *, integer *, integer *, integer *), zzctruin_(
 	    integer *);
     integer i__, j;
+    extern /* Subroutine */ int zzcutget_(integer *);
+    integer fcut, cutidx;
+    extern /* Subroutine */ int zztrkcut_(integer *);
     extern integer cardd_(doublereal *);
     extern /* Subroutine */ int zzsrftrk_(integer *, logical *), zzprsmet_(
 	    integer *, char *, integer *, char *, char *, logical *, integer *
@@ -3155,6 +3158,12 @@ static doublereal c_b129 = 1.;
 	prvtrg = trgcde;
     }
 
+/*     Fetch the index of the first cutting half-plane to process. */
+/*     This is zero unless the call is made on behalf of a routine */
+/*     that processes a set of cutting half-planes in portions. */
+
+    zzcutget_(&fcut);
+
 /*     Set up activities are complete at this point. */
 
 
@@ -3248,7 +3257,7 @@ static doublereal c_b129 = 1.;
 
 	i__1 = *ncuts;
 	for (i__ = 1; i__ <= i__1; ++i__) {
-	    roll = (i__ - 1) * *rolstp;
+	    roll = (fcut + i__ - 1) * *rolstp;
 
 /*           Rotation of the half-planes is in the positive */
 /*           sense about AXIS. */
@@ -3278,6 +3287,8 @@ static doublereal c_b129 = 1.;
 /*                 Note that the evaluation epoch for the surface is */
 /*                 optionally corrected for light time. */
 
+		    cutidx = fcut + i__ - 1;
+		    zztrkcut_(&cutidx);
 		    zztangnt_(&c__0, &c_b124, &shape, &trgcde, &nsurf, srflst,
 			     &fxfcde, &trgepc, plnvec, axis, schstp, soltol, 
 			    result, pntbuf);
@@ -3452,7 +3463,7 @@ static doublereal c_b129 = 1.;
 
 	i__1 = *ncuts;
 	for (i__ = 1; i__ <= i__1; ++i__) {
-	    roll = (i__ - 1) * *rolstp;
+	    roll = (fcut + i__ - 1) * *rolstp;
 	    if (uselt) {
 
 /*              We'll do an independent light time and stellar */
@@ -3749,6 +3760,8 @@ static doublereal c_b129 = 1.;
 /*              Note that the evaluation epoch for the surface is */
 /*              corrected for light time. */
 
+		cutidx = fcut + i__ - 1;
+		zztrkcut_(&cutidx);
 		zztangnt_(&c__0, &c_b124, &shape, &trgcde, &nsurf, srflst, &
 			fxfcde, &epoch, plnvec, axis, schstp, soltol, result, 
 			pntbuf);
@@ -8,13 +8,8 @@
 /* $Procedure      ORDERI ( Order of an integer array ) */
 /* Subroutine */ int orderi_(integer *array, integer *ndim, integer *iorder)
 {
-    /* System generated locals */
-    integer i__1;
-
     /* Local variables */
-    integer i__, j;
-    extern /* Subroutine */ int swapi_(integer *, integer *);
-    integer jg, gap;
+    extern /* Subroutine */ int zzordi_(integer *, integer *, integer *);
 
 /* $ Abstract */
 
@@ -96,6 +91,12 @@
 /*     array. This becomes the first element of the order vector. */
 /*     The process is repeated for the rest of the elements. */
 
+/*     The order is stable: the indices of equal elements appear */
+/*     in increasing order. Arrays of a few thousand elements or */
+/*     more are ordered by a radix sort, in time proportional to */
+/*     NDIM; others are ordered by introsort, in time proportional */
+/*     to NDIM*log(NDIM). */
+
 /*     The order vector returned by ORDERI may be used by any of */
 /*     the REORD routines to sort sets of related arrays, as shown */
 /*     in the example below. */
@@ -152,37 +153,9 @@
 
 /* -& */
 
-/*     Local variables */
-
-
-/*     Begin with the initial ordering. */
-
-    i__1 = *ndim;
-    for (i__ = 1; i__ <= i__1; ++i__) {
-	iorder[i__ - 1] = i__;
-    }
-
-/*     Find the smallest element, then the next smallest, and so on. */
-/*     This uses the Shell Sort algorithm, but swaps the elements of */
-/*     the order vector instead of the array itself. */
-
-    gap = *ndim / 2;
-    while(gap > 0) {
-	i__1 = *ndim;
-	for (i__ = gap + 1; i__ <= i__1; ++i__) {
-	    j = i__ - gap;
-	    while(j > 0) {
-		jg = j + gap;
-		if (array[iorder[j - 1] - 1] <= array[iorder[jg - 1] - 1]) {
-		    j = 0;
-		} else {
-		    swapi_(&iorder[j - 1], &iorder[jg - 1]);
-		}
-		j -= gap;
-	    }
-	}
-	gap /= 2;
-    }
+/*     The order vector is found by ZZORDI. */
+
+    zzordi_(array, ndim, iorder);
     return 0;
 } /* orderi_ */
 
@@ -150,6 +150,11 @@
    See the SCLK Required Reading for a list of the entire set of SCLK 
    conversion routines.
   
+   For type 1 clocks, the kernel variables of several recently used
+   clocks are buffered, so alternating between clocks does not cause
+   the variables to be read from the kernel pool again.  To convert
+   arrays of values, see sce2cv_c.
+ 
 -Examples
  
    1)  Convert ET directly to a continuous, encoded SCLK value.  Use 
@@ -232,9 +237,15 @@
 -Author_and_Institution
  
    N.J. Bachman   (JPL) 
+   Nabla Zero Labs
  
 -Version
 
+   -CSPICE Version 1.1.0, 18-OCT-2026 (NZL)
+
+      Converts type 1 clock values using buffered clock data when
+      they are available.
+
    -CSPICE Version 1.0.2, 09-NOV-2009   (EDW)
 
       Corrected typo in header; j2000_c replaced with J2000. Mention of
@@ -262,6 +273,15 @@
    */
    chkin_c ( "sce2c_c");
 
+   /*
+   Use the buffered clock data if possible.
+   */
+   if (  !return_c()  &&  zzsc01ok_c( sc )  &&  zzsc01ec_c( et, sclkdp )  )
+   {
+      chkout_c ( "sce2c_c" );
+      return;
+   }
+
    /*
    Do the conversion.
    */
@@ -269,6 +289,14 @@
             ( doublereal * ) &et, 
             ( doublereal * ) sclkdp );
 
+   /*
+   Buffer the data of this clock for subsequent calls.
+   */
+   if ( !failed_c() )
+   {
+      zzsc01ld_c ( sc );
+   }
+
 
    chkout_c ( "sce2c_c" );
 
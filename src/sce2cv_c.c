@@ -0,0 +1,214 @@
+/*
+
+-Procedure sce2cv_c ( ET to continuous SCLK ticks, vector )
+
+-Abstract
+
+   Convert an array of ephemeris seconds past J2000 (ET) to continuous
+   encoded spacecraft clock ("ticks").  Non-integral tick values may
+   be returned.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   SCLK
+   TIME
+
+-Keywords
+
+   CONVERSION
+   TIME
+
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZst.h"
+   #include "SpiceZmc.h"
+
+   void sce2cv_c ( SpiceInt              sc,
+                   SpiceInt              n,
+                   ConstSpiceDouble    * et,
+                   SpiceDouble         * sclkdp )
+
+/*
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   sc         I   NAIF spacecraft clock ID code.
+   n          I   Number of epochs to convert.
+   et         I   Ephemeris times, seconds past J2000 TDB.
+   sclkdp     O   The equivalent continuous encoded SCLK values.
+
+-Detailed_Input
+
+   sc         is a NAIF integer code for a spacecraft clock.
+
+   n          is the number of epochs in the array `et'.
+
+   et         is an array of epochs, expressed as seconds past
+              J2000 TDB.
+
+-Detailed_Output
+
+   sclkdp     is an array of `n' continuous encoded SCLK values.
+              Element i of `sclkdp' is the value sce2c_c returns for
+              element i of `et'.
+
+              `sclkdp' may overwrite `et'.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1) If any epoch cannot be converted, the error is diagnosed by
+      routines in the call tree of sce2c_c, and this routine returns
+      immediately.  Elements of `sclkdp' at and after the offending
+      epoch are not modified.
+
+   2) If `n' is less than 1, this routine returns without modifying
+      `sclkdp'.
+
+-Files
+
+   An SCLK kernel for the clock `sc' must be loaded.  If the kernel
+   does not map SCLK directly to TDB, a leapseconds kernel must also
+   be loaded.
+
+-Particulars
+
+   This routine is functionally equivalent to calling sce2c_c for
+   each element of `et', and the results are identical.  For type 1
+   clocks the kernel pool is checked once per call, and the search
+   of the clock coefficients begins at the record used for the
+   preceding epoch.
+
+-Examples
+
+   1) Find the continuous tick values of a set of epochs, for use as
+      C-kernel request times.
+
+      #include <stdio.h>
+      #include "SpiceUsr.h"
+
+      #define  N       3
+      #define  SC      -77
+
+      int main()
+      {
+         SpiceDouble  ets   [N] = { -3.2e8, -3.1e8, -3.0e8 };
+         SpiceDouble  ticks [N];
+         SpiceInt     i;
+
+         furnsh_c ( "naif0012.tls" );
+         furnsh_c ( "gll00001.tsc" );
+
+         sce2cv_c ( SC, N, ets, ticks );
+
+         for ( i = 0;  i < N;  i++ )
+         {
+            printf ( "%16.1f %20.6f\n", ets[i], ticks[i] );
+         }
+
+         return ( 0 );
+      }
+
+-Restrictions
+
+   None.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   ephemeris time to continuous spacecraft_clock ticks, vector
+
+-&
+*/
+
+{ /* Begin sce2cv_c */
+
+   /*
+   Local variables
+   */
+   SpiceBoolean            ready;
+
+   SpiceInt                i;
+
+
+   /*
+   Participate in error tracing.
+   */
+   if ( return_c() )
+   {
+      return;
+   }
+   chkin_c ( "sce2cv_c" );
+
+
+   ready = zzsc01ok_c ( sc );
+
+   for ( i = 0;  i < n;  i++ )
+   {
+      if (  ready  &&  zzsc01ec_c ( et[i], sclkdp+i )  )
+      {
+         continue;
+      }
+
+      sce2c_ ( ( integer    * ) &sc,
+               ( doublereal * ) ( et+i     ),
+               ( doublereal * ) ( sclkdp+i )  );
+
+      if ( failed_c() )
+      {
+         break;
+      }
+
+      if ( !ready )
+      {
+         ready = zzsc01ld_c ( sc );
+      }
+   }
+
+
+   chkout_c ( "sce2cv_c" );
+
+} /* End sce2cv_c */
@@ -0,0 +1,243 @@
+/*
+
+-Procedure sce2sv_c ( ET to SCLK strings, vector )
+
+-Abstract
+
+   Convert an array of ephemeris seconds past J2000 (ET) to spacecraft
+   clock strings.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   SCLK
+   TIME
+
+-Keywords
+
+   CONVERSION
+   TIME
+
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZst.h"
+   #include "SpiceZmc.h"
+
+   void sce2sv_c ( SpiceInt              sc,
+                   SpiceInt              n,
+                   ConstSpiceDouble    * et,
+                   SpiceInt              lenout,
+                   void                * sclkch )
+
+/*
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   sc         I   NAIF spacecraft clock ID code.
+   n          I   Number of epochs to convert.
+   et         I   Ephemeris times, seconds past J2000 TDB.
+   lenout     I   Declared length of the strings in `sclkch'.
+   sclkch     O   The equivalent SCLK strings.
+
+-Detailed_Input
+
+   sc         is a NAIF integer code for a spacecraft clock.
+
+   n          is the number of epochs in the array `et'.
+
+   et         is an array of epochs, expressed as seconds past
+              J2000 TDB.
+
+   lenout     is the declared length of each string in `sclkch',
+              including the null terminator.
+
+-Detailed_Output
+
+   sclkch     is an array of `n' SCLK strings.  Element i of
+              `sclkch' is the string sce2s_c returns for element i of
+              `et'.  `sclkch' should be declared as
+
+                 SpiceChar   sclkch [n][lenout];
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1) If any epoch cannot be converted, the error is diagnosed by
+      routines in the call tree of sce2s_c, and this routine returns
+      immediately.  Strings of `sclkch' after the offending epoch are
+      not modified.
+
+   2) The error SPICE(NULLPOINTER) is signaled if `sclkch' is null.
+
+   3) The error SPICE(STRINGTOOSHORT) is signaled if `lenout' is
+      less than 2.
+
+   4) If `n' is less than 1, this routine returns without modifying
+      `sclkch'.
+
+-Files
+
+   An SCLK kernel for the clock `sc' must be loaded.  If the kernel
+   does not map SCLK directly to TDB, a leapseconds kernel must also
+   be loaded.
+
+-Particulars
+
+   This routine is functionally equivalent to calling sce2s_c for
+   each element of `et', and the results are identical.  For type 1
+   clocks the conversion from ET to ticks uses buffered clock data;
+   the ticks are then formatted by scdecd_c.
+
+-Examples
+
+   1) Label a set of epochs with the Galileo clock.
+
+      #include <stdio.h>
+      #include "SpiceUsr.h"
+
+      #define  N       3
+      #define  LNSIZE  32
+      #define  SC      -77
+
+      int main()
+      {
+         SpiceDouble  ets  [N] = { -3.2e8, -3.1e8, -3.0e8 };
+         SpiceChar    strs [N][LNSIZE];
+         SpiceInt     i;
+
+         furnsh_c ( "naif0012.tls" );
+         furnsh_c ( "gll00001.tsc" );
+
+         sce2sv_c ( SC, N, ets, LNSIZE, strs );
+
+         for ( i = 0;  i < N;  i++ )
+         {
+            printf ( "%16.1f %s\n", ets[i], strs[i] );
+         }
+
+         return ( 0 );
+      }
+
+-Restrictions
+
+   None.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   ephemeris time to spacecraft_clock strings, vector
+
+-&
+*/
+
+{ /* Begin sce2sv_c */
+
+   /*
+   Local variables
+   */
+   SpiceBoolean            ready;
+
+   SpiceChar             * str;
+
+   SpiceDouble             ticks;
+
+   SpiceInt                i;
+
+
+   /*
+   Participate in error tracing.
+   */
+   if ( return_c() )
+   {
+      return;
+   }
+   chkin_c ( "sce2sv_c" );
+
+   /*
+   Make sure the output string array has at least enough room for
+   one output character and a null terminator.  Also check for a
+   null pointer.
+   */
+   CHKOSTR ( CHK_STANDARD, "sce2sv_c", sclkch, lenout );
+
+
+   ready = zzsc01ok_c ( sc );
+
+   for ( i = 0;  i < n;  i++ )
+   {
+      str = ( (SpiceChar *) sclkch ) + ( i * lenout );
+
+      if (  ready  &&  zzsc01et_c ( et[i], &ticks )  )
+      {
+         scdecd_ ( ( integer    * ) &sc,
+                   ( doublereal * ) &ticks,
+                   ( char       * ) str,
+                   ( ftnlen       ) lenout-1 );
+      }
+      else
+      {
+         sce2s_ ( ( integer    * ) &sc,
+                  ( doublereal * ) ( et+i ),
+                  ( char       * ) str,
+                  ( ftnlen       ) lenout-1 );
+
+         if (  !failed_c()  &&  !ready  )
+         {
+            ready = zzsc01ld_c ( sc );
+         }
+      }
+
+      if ( failed_c() )
+      {
+         break;
+      }
+
+      F2C_ConvertStr ( lenout, str );
+   }
+
+
+   chkout_c ( "sce2sv_c" );
+
+} /* End sce2sv_c */
@@ -143,6 +143,11 @@
    To convert ET to a string representation of an SCLK value, use 
    the CSPICE function sce2s_c. 
  
+   For type 1 clocks, the kernel variables of several recently used
+   clocks are buffered, so alternating between clocks does not cause
+   the variables to be read from the kernel pool again.  To convert
+   arrays of ET values to SCLK strings, see sce2sv_c.
+ 
 -Examples
  
    1)  Convert ET directly to an encoded SCLK value.  Use both of 
@@ -225,8 +230,14 @@
 -Author_and_Institution
  
    N.J. Bachman   (JPL) 
+   Nabla Zero Labs
  
 -Version
+
+   -CSPICE Version 1.1.0, 18-OCT-2026 (NZL)
+
+      Converts type 1 clock values using buffered clock data when
+      they are available.
  
    -CSPICE Version 1.0.2, 27-JAN-2004 (NJB)  
 
@@ -266,6 +277,15 @@
    */
    chkin_c ( "sce2t_c");
 
+   /*
+   Use the buffered clock data if possible.
+   */
+   if (  !return_c()  &&  zzsc01ok_c( sc )  &&  zzsc01et_c( et, sclkdp )  )
+   {
+      chkout_c ( "sce2t_c");
+      return;
+   }
+
    /*
    Do the conversion.
    */
@@ -278,6 +298,14 @@
    */
    *sclkdp = loc_sclkdp;
 
+   /*
+   Buffer the data of this clock for subsequent calls.
+   */
+   if ( !failed_c() )
+   {
+      zzsc01ld_c ( sc );
+   }
+
 
    chkout_c ( "sce2t_c");
 
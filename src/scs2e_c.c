@@ -125,6 +125,11 @@
       scencd_c ( sc, sclkch, &sclkdp );
       sct2e_c  ( sc, sclkdp, &et     ); 
   
+   For type 1 clocks, the kernel variables of several recently used
+   clocks are buffered, so alternating between clocks does not cause
+   the variables to be read from the kernel pool again.  To convert
+   arrays of values, see scs2ev_c.
+ 
 -Examples
  
    1)  Find the state (position and velocity) of Jupiter, as seen 
@@ -214,9 +219,15 @@
 -Author_and_Institution
  
    N.J. Bachman   (JPL) 
+   Nabla Zero Labs
  
 -Version
 
+   -CSPICE Version 1.2.0, 18-OCT-2026 (NZL)
+
+      Converts type 1 clock values using buffered clock data when
+      they are available.
+
    -CSPICE Version 1.1.1, 14-AUG-2006   (EDW)
 
       Replace mention of ldpool_c with furnsh_c.
@@ -240,6 +251,11 @@
 
 { /* Begin scs2e_c */
 
+   /*
+   Local variables
+   */
+   SpiceDouble             sclkdp;
+
 
    /*
    Participate in error handling
@@ -252,6 +268,20 @@
    is non-null and the string length is non-zero.
    */
    CHKFSTR ( CHK_STANDARD, "scs2e_c", sclkch );
+
+
+   /*
+   Use the buffered clock data if possible.  Only plain numeric
+   clock strings are decoded here.
+   */
+   if (     !return_c()
+         &&  zzsc01ok_c( sc )
+         &&  zzsc01en_c( sclkch, &sclkdp )
+         &&  zzsc01te_c( sclkdp, et       )  )
+   {
+      chkout_c ( "scs2e_c");
+      return;
+   }
    
    
    /*
@@ -261,6 +291,14 @@
              ( char       * ) sclkch,
              ( doublereal * ) et,
              ( ftnlen       ) strlen(sclkch)  );
+
+   /*
+   Buffer the data of this clock for subsequent calls.
+   */
+   if ( !failed_c() )
+   {
+      zzsc01ld_c ( sc );
+   }
    
    
    chkout_c ( "scs2e_c");
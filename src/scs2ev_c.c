@@ -0,0 +1,261 @@
+/*
+
+-Procedure scs2ev_c ( SCLK strings to ET, vector )
+
+-Abstract
+
+   Convert an array of spacecraft clock strings to ephemeris seconds
+   past J2000 (ET).
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   SCLK
+   TIME
+
+-Keywords
+
+   CONVERSION
+   TIME
+
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZst.h"
+   #include "SpiceZmc.h"
+
+   void scs2ev_c ( SpiceInt              sc,
+                   SpiceInt              n,
+                   SpiceInt              lenstr,
+                   const void          * sclkch,
+                   SpiceDouble         * et      )
+
+/*
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   sc         I   NAIF spacecraft clock ID code.
+   n          I   Number of strings to convert.
+   lenstr     I   Declared length of the strings in `sclkch'.
+   sclkch     I   Array of SCLK strings.
+   et         O   The equivalent values in seconds past J2000, TDB.
+
+-Detailed_Input
+
+   sc         is a NAIF integer code for a spacecraft clock.
+
+   n          is the number of strings in the array `sclkch'.
+
+   lenstr     is the declared length of each string in `sclkch',
+              including the null terminator.
+
+   sclkch     is an array of spacecraft clock strings for the clock
+              `sc'.  `sclkch' should be declared as
+
+                 SpiceChar   sclkch [n][lenstr];
+
+              Any string accepted by scs2e_c may appear in the array.
+
+-Detailed_Output
+
+   et         is an array of `n' epochs, expressed as seconds past
+              J2000 TDB.  Element i of `et' corresponds to element i
+              of `sclkch'.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1) If any string cannot be converted, the error is diagnosed by
+      routines in the call tree of scs2e_c, and this routine returns
+      immediately.  Elements of `et' at and after the offending
+      string are not modified.
+
+   2) The error SPICE(EMPTYSTRING) is signaled if any string of
+      `sclkch' is empty.
+
+   3) The error SPICE(NULLPOINTER) is signaled if `sclkch' is null.
+
+   4) The error SPICE(STRINGTOOSHORT) is signaled if `lenstr' is
+      less than 2.
+
+   5) If `n' is less than 1, this routine returns without modifying
+      `et'.
+
+-Files
+
+   An SCLK kernel for the clock `sc' must be loaded.  If the kernel
+   does not map SCLK directly to TDB, a leapseconds kernel must also
+   be loaded.
+
+-Particulars
+
+   This routine is functionally equivalent to calling scs2e_c for
+   each string in `sclkch', and the results are identical.  For type
+   1 clocks, strings consisting of an optional partition number
+   followed by unsigned decimal fields separated by one of the
+   delimiters
+
+      .  :  -  ,
+
+   are decoded without going through the kernel pool, for example
+
+      1/0415258787.21106
+      415258787:21106
+
+   Strings of other forms, such as those containing blanks, may be
+   freely mixed with these; each of those is converted by scs2e_c.
+
+-Examples
+
+   1) Convert the clock strings of a set of telemetry packets to ET.
+
+      #include <stdio.h>
+      #include "SpiceUsr.h"
+
+      #define  N       3
+      #define  LNSIZE  32
+      #define  SC      -77
+
+      int main()
+      {
+         SpiceChar    strs [N][LNSIZE] =
+                      {
+                         "1/00010001:44:2:0",
+                         "1/00010002:00:0:0",
+                         "1/00010002:12:5:3"
+                      };
+
+         SpiceDouble  ets  [N];
+         SpiceInt     i;
+
+         furnsh_c ( "naif0012.tls" );
+         furnsh_c ( "gll00001.tsc" );
+
+         scs2ev_c ( SC, N, LNSIZE, strs, ets );
+
+         for ( i = 0;  i < N;  i++ )
+         {
+            printf ( "%-20s %20.6f\n", strs[i], ets[i] );
+         }
+
+         return ( 0 );
+      }
+
+-Restrictions
+
+   None.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   spacecraft_clock strings to ephemeris time, vector
+
+-&
+*/
+
+{ /* Begin scs2ev_c */
+
+   /*
+   Local variables
+   */
+   ConstSpiceChar        * str;
+
+   SpiceBoolean            ready;
+
+   SpiceDouble             ticks;
+
+   SpiceInt                i;
+
+
+   /*
+   Participate in error tracing.
+   */
+   if ( return_c() )
+   {
+      return;
+   }
+   chkin_c ( "scs2ev_c" );
+
+   /*
+   Make sure the input string array pointer is non-null and the
+   declared string length is sufficient.
+   */
+   CHKOSTR ( CHK_STANDARD, "scs2ev_c", sclkch, lenstr );
+
+
+   ready = zzsc01ok_c ( sc );
+
+   for ( i = 0;  i < n;  i++ )
+   {
+      str = ( (ConstSpiceChar *) sclkch ) + ( i * lenstr );
+
+      CHKFSTR ( CHK_STANDARD, "scs2ev_c", str );
+
+      if (     ready
+           &&  zzsc01en_c ( str,   &ticks )
+           &&  zzsc01te_c ( ticks, et+i   )  )
+      {
+         continue;
+      }
+
+      scs2e_ ( ( integer    * ) &sc,
+               ( char       * ) str,
+               ( doublereal * ) ( et+i ),
+               ( ftnlen       ) strlen(str)  );
+
+      if ( failed_c() )
+      {
+         break;
+      }
+
+      if ( !ready )
+      {
+         ready = zzsc01ld_c ( sc );
+      }
+   }
+
+
+   chkout_c ( "scs2ev_c" );
+
+} /* End scs2ev_c */
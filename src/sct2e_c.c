@@ -133,6 +133,11 @@
    To convert a string representation of an SCLK value to ET, use 
    the CSPICE routine scs2e_c. 
  
+   For type 1 clocks, the kernel variables of several recently used
+   clocks are buffered, so alternating between clocks does not cause
+   the variables to be read from the kernel pool again.  To convert
+   arrays of values, see sct2ev_c.
+ 
 -Examples
  
    1)  Encode a Galileo SCLK string, and convert the encoded value 
@@ -243,9 +248,15 @@
 -Author_and_Institution
  
    N.J. Bachman   (JPL) 
+   Nabla Zero Labs
  
 -Version
 
+   -CSPICE Version 1.1.0, 18-OCT-2026 (NZL)
+
+      Converts type 1 clock values using buffered clock data when
+      they are available.
+
    -CSPICE Version 1.0.1, 14-AUG-2006   (EDW)
 
       Replace mention of ldpool_c with furnsh_c.
@@ -275,6 +286,16 @@
    */
    chkin_c ( "sct2e_c");
 
+
+   /*
+   Use the buffered clock data if possible.
+   */
+   if (  !return_c()  &&  zzsc01ok_c( sc )  &&  zzsc01te_c( sclkdp, et )  )
+   {
+      chkout_c ( "sct2e_c");
+      return;
+   }
+
    
    /*
    Carry out the conversion.
@@ -287,6 +308,14 @@
    Assign the output argument.
    */
    *et =  loc_et;
+
+   /*
+   Buffer the data of this clock for subsequent calls.
+   */
+   if ( !failed_c() )
+   {
+      zzsc01ld_c ( sc );
+   }
    
 
    chkout_c ( "sct2e_c");
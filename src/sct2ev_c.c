@@ -0,0 +1,213 @@
+/*
+
+-Procedure sct2ev_c ( SCLK ticks to ET, vector )
+
+-Abstract
+
+   Convert an array of encoded spacecraft clock values ("ticks") to
+   ephemeris seconds past J2000 (ET).
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   SCLK
+   TIME
+
+-Keywords
+
+   CONVERSION
+   TIME
+
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZst.h"
+   #include "SpiceZmc.h"
+
+   void sct2ev_c ( SpiceInt              sc,
+                   SpiceInt              n,
+                   ConstSpiceDouble    * sclkdp,
+                   SpiceDouble         * et      )
+
+/*
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   sc         I   NAIF spacecraft clock ID code.
+   n          I   Number of values to convert.
+   sclkdp     I   Encoded SCLK values.
+   et         O   The equivalent values in seconds past J2000, TDB.
+
+-Detailed_Input
+
+   sc         is a NAIF integer code for a spacecraft clock.
+
+   n          is the number of values in the array `sclkdp'.
+
+   sclkdp     is an array of encoded SCLK values, as produced by
+              scencd_c or sce2c_c, for the clock `sc'.
+
+-Detailed_Output
+
+   et         is an array of `n' epochs, expressed as seconds past
+              J2000 TDB.  Element i of `et' is the value sct2e_c
+              returns for element i of `sclkdp'.
+
+              `et' may overwrite `sclkdp'.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1) If any value cannot be converted, the error is diagnosed by
+      routines in the call tree of sct2e_c, and this routine returns
+      immediately.  Elements of `et' at and after the offending value
+      are not modified.
+
+   2) If `n' is less than 1, this routine returns without modifying
+      `et'.
+
+-Files
+
+   An SCLK kernel for the clock `sc' must be loaded.  If the kernel
+   does not map SCLK directly to TDB, a leapseconds kernel must also
+   be loaded.
+
+-Particulars
+
+   This routine is functionally equivalent to calling sct2e_c for
+   each element of `sclkdp', and the results are identical.  For type
+   1 clocks the kernel pool is checked once per call, and the search
+   of the clock coefficients begins at the record used for the
+   preceding value, so time-ordered input is converted in constant
+   time per value.
+
+-Examples
+
+   1) Convert the tick counts of a set of telemetry packets to ET.
+
+      #include <stdio.h>
+      #include "SpiceUsr.h"
+
+      #define  N       3
+      #define  SC      -77
+
+      int main()
+      {
+         SpiceDouble  ticks [N] = { 1.e9, 1.1e9, 1.2e9 };
+         SpiceDouble  ets   [N];
+         SpiceInt     i;
+
+         furnsh_c ( "naif0012.tls" );
+         furnsh_c ( "gll00001.tsc" );
+
+         sct2ev_c ( SC, N, ticks, ets );
+
+         for ( i = 0;  i < N;  i++ )
+         {
+            printf ( "%16.1f %20.6f\n", ticks[i], ets[i] );
+         }
+
+         return ( 0 );
+      }
+
+-Restrictions
+
+   None.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   spacecraft_clock ticks to ephemeris time, vector
+
+-&
+*/
+
+{ /* Begin sct2ev_c */
+
+   /*
+   Local variables
+   */
+   SpiceBoolean            ready;
+
+   SpiceInt                i;
+
+
+   /*
+   Participate in error tracing.
+   */
+   if ( return_c() )
+   {
+      return;
+   }
+   chkin_c ( "sct2ev_c" );
+
+
+   ready = zzsc01ok_c ( sc );
+
+   for ( i = 0;  i < n;  i++ )
+   {
+      if (  ready  &&  zzsc01te_c ( sclkdp[i], et+i )  )
+      {
+         continue;
+      }
+
+      sct2e_ ( ( integer    * ) &sc,
+               ( doublereal * ) ( sclkdp+i ),
+               ( doublereal * ) ( et+i     )  );
+
+      if ( failed_c() )
+      {
+         break;
+      }
+
+      if ( !ready )
+      {
+         ready = zzsc01ld_c ( sc );
+      }
+   }
+
+
+   chkout_c ( "sct2ev_c" );
+
+} /* End sct2ev_c */
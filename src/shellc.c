@@ -17,12 +17,16 @@
     /* Local variables */
     integer i__, j;
     extern /* Subroutine */ int swapc_(char *, char *, ftnlen, ftnlen);
-    integer jg, gap;
+    integer jg;
+    logical done;
+    integer gap;
+    extern /* Subroutine */ int zzsortc_(integer *, char *, logical *, 
+	    ftnlen);
 
 /* $ Abstract */
 
 /*      Sort an array of character strings according to the ASCII */
-/*      collating sequence using the Shell Sort algorithm. */
+/*      collating sequence. */
 
 /* $ Disclaimer */
 
@@ -83,7 +87,14 @@
 
 /* $ Particulars */
 
-/*      The Shell Sort Algorithm is well known. */
+/*      The array is sorted by introsort: quicksort, switching to */
+/*      heapsort should the partitioning degrade. The order of the */
+/*      elements is found first and the elements are then moved into */
+/*      place, so that each is copied about once. The time required */
+/*      is proportional to NDIM*log(NDIM) for any input. */
+
+/*      If workspace for the sort cannot be allocated, the array is */
+/*      sorted in place by the Shell sort this routine formerly used. */
 
 /* $ Examples */
 
@@ -145,6 +156,13 @@
 /*     Local variables */
 
 
+/*     Sort the array by ZZSORTC if it can allocate its workspace. */
+
+    zzsortc_(ndim, array, &done, array_len);
+    if (done) {
+	return 0;
+    }
+
 /*     This is a straightforward implementation of the Shell Sort */
 /*     algorithm. */
 
@@ -8,17 +8,12 @@
 /* $Procedure      SHELLD ( Shell sort a double precision array ) */
 /* Subroutine */ int shelld_(integer *ndim, doublereal *array)
 {
-    /* System generated locals */
-    integer i__1;
-
     /* Local variables */
-    integer i__, j;
-    extern /* Subroutine */ int swapd_(doublereal *, doublereal *);
-    integer jg, gap;
+    extern /* Subroutine */ int zzsortd_(integer *, doublereal *);
 
 /* $ Abstract */
 
-/*      Sort a double precision array using the Shell Sort algorithm. */
+/*      Sort a double precision array */
 
 /* $ Disclaimer */
 
@@ -79,7 +74,12 @@
 
 /* $ Particulars */
 
-/*      The Shell Sort Algorithm is well known. */
+/*      The array is sorted by introsort: quicksort, switching to */
+/*      heapsort should the partitioning degrade, with small */
+/*      partitions finished by insertion sort. The time required is */
+/*      proportional to NDIM*log(NDIM) for any input. The Shell sort */
+/*      this routine formerly used could take time proportional to */
+/*      NDIM**2. */
 
 /* $ Examples */
 
@@ -138,29 +138,9 @@
 
 /* -& */
 
-/*     Local variables */
-
-
-/*     This is a straightforward implementation of the Shell Sort */
-/*     algorithm. */
-
-    gap = *ndim / 2;
-    while(gap > 0) {
-	i__1 = *ndim;
-	for (i__ = gap + 1; i__ <= i__1; ++i__) {
-	    j = i__ - gap;
-	    while(j > 0) {
-		jg = j + gap;
-		if (array[j - 1] <= array[jg - 1]) {
-		    j = 0;
-		} else {
-		    swapd_(&array[j - 1], &array[jg - 1]);
-		}
-		j -= gap;
-	    }
-	}
-	gap /= 2;
-    }
+/*     The sort is performed by ZZSORTD. */
+
+    zzsortd_(ndim, array);
     return 0;
 } /* shelld_ */
 
@@ -8,17 +8,12 @@
 /* $Procedure      SHELLI ( Shell sort an integer array ) */
 /* Subroutine */ int shelli_(integer *ndim, integer *array)
 {
-    /* System generated locals */
-    integer i__1;
-
     /* Local variables */
-    integer i__, j;
-    extern /* Subroutine */ int swapi_(integer *, integer *);
-    integer jg, gap;
+    extern /* Subroutine */ int zzsorti_(integer *, integer *);
 
 /* $ Abstract */
 
-/*      Sort an integer array using the Shell Sort algorithm. */
+/*      Sort an integer array */
 
 /* $ Disclaimer */
 
@@ -79,7 +74,12 @@
 
 /* $ Particulars */
 
-/*      The Shell Sort Algorithm is well known. */
+/*      Arrays of a few thousand elements or more are sorted by a */
+/*      radix sort, which takes time proportional to NDIM; smaller */
+/*      arrays, and larger ones if workspace cannot be allocated, are */
+/*      sorted by introsort, which takes time proportional to */
+/*      NDIM*log(NDIM). The Shell sort this routine formerly used */
+/*      could take time proportional to NDIM**2. */
 
 /* $ Examples */
 
@@ -138,29 +138,9 @@
 
 /* -& */
 
-/*     Local variables */
-
-
-/*     This is a straightforward implementation of the Shell Sort */
-/*     algorithm. */
-
-    gap = *ndim / 2;
-    while(gap > 0) {
-	i__1 = *ndim;
-	for (i__ = gap + 1; i__ <= i__1; ++i__) {
-	    j = i__ - gap;
-	    while(j > 0) {
-		jg = j + gap;
-		if (array[j - 1] <= array[jg - 1]) {
-		    j = 0;
-		} else {
-		    swapi_(&array[j - 1], &array[jg - 1]);
-		}
-		j -= gap;
-	    }
-	}
-	gap /= 2;
-    }
+/*     The sort is performed by ZZSORTI. */
+
+    zzsorti_(ndim, array);
     return 0;
 } /* shelli_ */
 
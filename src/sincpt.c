@@ -53,6 +53,11 @@ static integer c__100 = 100;
 	    char *, logical *, integer *, integer *, char *, char *, ftnlen, 
 	    ftnlen, ftnlen, ftnlen, ftnlen), zzsrftrk_(integer *, logical *);
     extern /* Subroutine */ int zzraysfx_();
+    extern /* Subroutine */ int zzsfxbnr_(integer *), zzsfxbrn_(U_fp, U_fp, 
+	    U_fp, integer *, doublereal *, char *, logical *, logical *, 
+	    logical *, logical *, char *, integer *, integer *, integer *, 
+	    integer *, ftnlen, ftnlen);
+    integer nbat;
     extern /* Subroutine */ int chkin_(char *, ftnlen);
     static integer shape;
     extern /* Subroutine */ int errch_(char *, char *, ftnlen, ftnlen);
@@ -2615,12 +2620,21 @@ static integer c__100 = 100;
 	return 0;
     }
 
-/*     Perform the intercept computation. */
+/*     Perform the intercept computation. If a batch of rays has been */
+/*     supplied by SINCPV_C, compute the intercepts of all of them; the */
+/*     setup above is shared by the batch. */
 
-    zzsfxcor_((U_fp)zzraynp_, (U_fp)zzmaxrad_, (U_fp)zzraysfx_, &trgcde, et, 
-	    abcorr, &uselt, &usecn, &usestl, &xmit, fixref, &obscde, &dfrcde, 
-	    &dclass, &dcentr, dvec, spoint, trgepc, srfvec, found, abcorr_len,
-	     fixref_len);
+    zzsfxbnr_(&nbat);
+    if (nbat > 0) {
+	zzsfxbrn_((U_fp)zzraynp_, (U_fp)zzmaxrad_, (U_fp)zzraysfx_, &trgcde, 
+		et, abcorr, &uselt, &usecn, &usestl, &xmit, fixref, &obscde, &
+		dfrcde, &dclass, &dcentr, abcorr_len, fixref_len);
+    } else {
+	zzsfxcor_((U_fp)zzraynp_, (U_fp)zzmaxrad_, (U_fp)zzraysfx_, &trgcde, 
+		et, abcorr, &uselt, &usecn, &usestl, &xmit, fixref, &obscde, &
+		dfrcde, &dclass, &dcentr, dvec, spoint, trgepc, srfvec, found, 
+		abcorr_len, fixref_len);
+    }
     chkout_("SINCPT", (ftnlen)6);
     return 0;
 } /* sincpt_ */
@@ -0,0 +1,343 @@
+/*
+
+-Procedure sincpv_c ( Surface intercepts, vectorized )
+
+-Abstract
+
+   Given an observer and an array of direction vectors defining
+   rays, compute the surface intercepts of the rays on a target body
+   at a specified epoch, optionally corrected for light time and
+   stellar aberration.
+
+   The results for each ray are those sincpt_c would return for
+   that ray.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   CK
+   DSK
+   FRAMES
+   NAIF_IDS
+   PCK
+   SCLK
+   SPK
+   TIME
+
+-Keywords
+
+   GEOMETRY
+
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZmc.h"
+   #include "zzalloc.h"
+   #undef sincpv_c
+
+   void sincpv_c ( ConstSpiceChar      * method,
+                   ConstSpiceChar      * target,
+                   SpiceDouble           et,
+                   ConstSpiceChar      * fixref,
+                   ConstSpiceChar      * abcorr,
+                   ConstSpiceChar      * obsrvr,
+                   ConstSpiceChar      * dref,
+                   SpiceInt              nrays,
+                   ConstSpiceDouble      dvecs  [][3],
+                   SpiceDouble           spoint [][3],
+                   SpiceDouble           trgepc [],
+                   SpiceDouble           srfvec [][3],
+                   SpiceBoolean          found  []    )
+
+/*
+
+-Brief_I/O
+
+   Variable  I/O  Description
+   --------  ---  --------------------------------------------------
+   method     I   Computation method.
+   target     I   Name of target body.
+   et         I   Epoch in TDB seconds past J2000 TDB.
+   fixref     I   Body-fixed, body-centered target body frame.
+   abcorr     I   Aberration correction flag.
+   obsrvr     I   Name of observing body.
+   dref       I   Reference frame of the rays' direction vectors.
+   nrays      I   Number of rays.
+   dvecs      I   Rays' direction vectors.
+   spoint     O   Surface intercept points on the target body.
+   trgepc     O   Intercept epochs.
+   srfvec     O   Vectors from observer to intercept points.
+   found      O   Flags indicating whether intercepts were found.
+
+-Detailed_Input
+
+   nrays       is the number of rays.
+
+   dvecs       is an array of `nrays' ray direction vectors,
+               expressed in the frame designated by `dref'.  All
+               rays emanate from the observer.
+
+   All other inputs have the meanings given in the header of
+   sincpt_c.
+
+-Detailed_Output
+
+   spoint,
+   trgepc,
+   srfvec,
+   found       are arrays of `nrays' elements.  Element i of each
+               array is the corresponding output of sincpt_c for the
+               ray dvecs[i].  Elements of `spoint' and `srfvec' for
+               which `found' is SPICEFALSE are undefined.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1)  If `nrays' is less than 1, the error SPICE(INVALIDCOUNT) is
+       signaled.
+
+   2)  If memory cannot be allocated for the found flags, the error
+       SPICE(MALLOCFAILED) is signaled.
+
+   3)  If any ray direction vector is the zero vector, the error
+       SPICE(ZEROVECTOR) is signaled.
+
+   4)  If any input string argument pointer is null, the error
+       SPICE(NULLPOINTER) is signaled.
+
+   5)  If any input string argument is empty, the error
+       SPICE(EMPTYSTRING) is signaled.
+
+   6)  All other errors are diagnosed by sincpt_c or routines in its
+       call tree.
+
+-Files
+
+   See sincpt_c.
+
+-Particulars
+
+   Computing the intercepts of many rays at one epoch, for example
+   one ray per pixel of an image, with sincpt_c repeats for every
+   ray the translation of the body and frame names, the parsing of
+   the method string, the selection of the target's surface model,
+   the computation of the observer-target position and light time,
+   and the computation of the frame transformations applied to the
+   ray.  None of these depends on the ray.
+
+   This routine performs them once for all of the rays, then
+   computes the intercept of each ray.  When light time corrections
+   are requested, the light time iteration for each intercept
+   depends on the ray and is still carried out for each ray.
+
+   CSPICE is not thread-safe, so the rays are processed in a single
+   thread.  A large set of rays may be divided among separate
+   processes, each of which has loaded the same kernels.
+
+-Examples
+
+   1)  Compute the intercepts of the rays through all of the pixels
+       of an NX by NY image, given the camera's boresight-aligned
+       pixel directions in the camera frame.
+
+          for ( i = 0;  i < NY;  i++ )
+          {
+             for ( j = 0;  j < NX;  j++ )
+             {
+                dvecs[i*NX+j][0] = ( j - NX/2 ) * pixsiz;
+                dvecs[i*NX+j][1] = ( i - NY/2 ) * pixsiz;
+                dvecs[i*NX+j][2] = 1.0;
+             }
+          }
+
+          sincpv_c ( "DSK/UNPRIORITIZED", "PHOBOS", et,
+                     "IAU_PHOBOS",        "CN+S",   "MGS",
+                     camref,              NX*NY,    dvecs,
+                     spoint,              trgepc,   srfvec,  found );
+
+-Restrictions
+
+   None.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   find surface intercepts of multiple rays
+   find surface intercepts for image pixels
+
+-&
+*/
+
+{ /* Begin sincpv_c */
+
+
+   /*
+   Local variables
+   */
+   SpiceInt                arrSize;
+   SpiceInt                i;
+   SpiceInt                zero = 0;
+
+   logical               * foundFlags;
+   logical                 fnd;
+
+
+   /*
+   Participate in error tracing.
+   */
+   chkin_c ( "sincpv_c" );
+
+   /*
+   Check the input string arguments:
+
+      method
+      target
+      fixref
+      abcorr
+      obsrvr
+      dref
+
+   Make sure each pointer is non-null and each string contains
+   at least one data character: that is, one character
+   preceding the null terminator.
+   */
+   CHKFSTR ( CHK_STANDARD, "sincpv_c", method );
+   CHKFSTR ( CHK_STANDARD, "sincpv_c", target );
+   CHKFSTR ( CHK_STANDARD, "sincpv_c", fixref );
+   CHKFSTR ( CHK_STANDARD, "sincpv_c", abcorr );
+   CHKFSTR ( CHK_STANDARD, "sincpv_c", obsrvr );
+   CHKFSTR ( CHK_STANDARD, "sincpv_c", dref   );
+
+   /*
+   Check `nrays' here, since it must be valid in order to
+   allocate memory.
+   */
+   if ( nrays < 1 )
+   {
+      setmsg_c ( "The ray count must be at least 1 "
+                 "but was #."                       );
+      errint_c ( "#",  nrays                        );
+      sigerr_c ( "SPICE(INVALIDCOUNT)"              );
+      chkout_c ( "sincpv_c"                         );
+      return;
+   }
+
+   arrSize = sizeof(logical) * nrays;
+
+   /*
+   Allocate an array of type logical to receive flags
+   returned by f2c'd routine.
+   */
+   foundFlags = (logical *) alloc_SpiceMemory( (size_t)arrSize );
+
+   if ( !foundFlags )
+   {
+      setmsg_c ( "Attempt to allocate # bytes of memory for "
+                 "the foundFlags array failed."               );
+      errint_c ( "#", arrSize                                 );
+      sigerr_c ( "SPICE(MALLOCFAILED)"                        );
+      chkout_c ( "sincpv_c"                                   );
+      return;
+   }
+
+   /*
+   Present the rays to SINCPT as a batch, then call the f2c'd
+   SPICELIB function.  SINCPT checks and uses the first ray as its
+   scalar input; the results for all rays are written to the batch
+   arrays.  The batch is cleared whether or not the call succeeds.
+   */
+   zzsfxbst_ ( (integer     *) &nrays,
+               (doublereal  *) dvecs,
+               (doublereal  *) spoint,
+               (doublereal  *) trgepc,
+               (doublereal  *) srfvec,
+               (logical     *) foundFlags );
+
+   sincpt_ ( (char       *) method,
+             (char       *) target,
+             (doublereal *) &et,
+             (char       *) fixref,
+             (char       *) abcorr,
+             (char       *) obsrvr,
+             (char       *) dref,
+             (doublereal *) dvecs[0],
+             (doublereal *) spoint[0],
+             (doublereal *) trgepc,
+             (doublereal *) srfvec[0],
+             (logical    *) &fnd,
+             (ftnlen      ) strlen(method),
+             (ftnlen      ) strlen(target),
+             (ftnlen      ) strlen(fixref),
+             (ftnlen      ) strlen(abcorr),
+             (ftnlen      ) strlen(obsrvr),
+             (ftnlen      ) strlen(dref)    );
+
+   zzsfxbst_ ( (integer     *) &zero,
+               (doublereal  *) 0,
+               (doublereal  *) 0,
+               (doublereal  *) 0,
+               (doublereal  *) 0,
+               (logical     *) 0          );
+
+   if ( failed_c() )
+   {
+      free_SpiceMemory( (void *)foundFlags );
+
+      chkout_c ( "sincpv_c" );
+      return;
+   }
+
+   /*
+   Transfer the logical flag values to the output
+   SpiceBoolean array.
+   */
+   for ( i = 0;  i < nrays;  i++  )
+   {
+      found[i] = (SpiceBoolean)(foundFlags[i]);
+   }
+
+   free_SpiceMemory( (void *)foundFlags );
+
+
+   chkout_c ( "sincpv_c" );
+
+} /* End sincpv_c */
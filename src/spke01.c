@@ -7,38 +7,15 @@
 
 /* Table of constant values */
 
-static integer c__1 = 1;
 static integer c__15 = 15;
-static integer c__45 = 45;
 
 /* $Procedure      SPKE01 ( S/P Kernel, evaluate, type 1 ) */
 /* Subroutine */ int spke01_(doublereal *et, doublereal *record, doublereal *
 	state)
 {
-    /* Initialized data */
-
-    static doublereal fc[14] = { 1. };
-
-    /* System generated locals */
-    integer i__1, i__2, i__3, i__4, i__5, i__6;
-
-    /* Builtin functions */
-    integer s_rnge(char *, integer, char *, integer);
-
-    /* Local variables */
-    static doublereal g[15];
-    static integer i__, j;
-    static doublereal w[17], delta;
-    extern /* Subroutine */ int moved_(doublereal *, integer *, doublereal *);
-    static integer kqmax1;
-    static doublereal dt[45]	/* was [15][3] */, wc[13];
-    static integer kq[3], ks;
-    static doublereal tl;
-    static integer jx;
-    static doublereal tp, refvel[3], refpos[3];
+    extern /* Subroutine */ int zzmdaev_(doublereal *, integer *, doublereal 
+	    *, doublereal *);
     extern logical return_(void);
-    static integer mq2, ks1, kqq;
-    static doublereal sum;
 
 /* $ Abstract */
 
@@ -129,6 +106,11 @@ static integer c__45 = 45;
 /*     Because the original version was undocumented, only Fred */
 /*     knows how this really works. */
 
+/*     The computation is performed by ZZMDAEV, which is shared with */
+/*     SPKE21. ZZMDAEV accumulates the position and velocity of each */
+/*     component in one pass, with the operations of the original */
+/*     code, so the results are unchanged. */
+
 /* $ Examples */
 
 /*     None. */
@@ -191,172 +173,15 @@ static integer c__45 = 45;
 
 /*     Local variables */
 
-/*     The names below are original to the routine. They correspond */
-/*     roughly to the original memos written by Fred Krogh to explain */
-/*     how all this stuff really works. */
-
-
-/*     Save everything between calls. */
-
-
 /*     If the RETURN function is set, don't even bother with this. */
 
     if (return_()) {
 	return 0;
     }
 
-/*     Unpack the contents of the MDA array. */
-
-/*        Name    Dimension  Description */
-/*        ------  ---------  ------------------------------- */
-/*        TL              1  Final epoch of record */
-/*        G              15  Stepsize function vector */
-/*        REFPOS          3  Reference position vector */
-/*        REFVEL          3  Reference velocity vector */
-/*        DT         15,NTE  Modified divided difference arrays */
-/*        KQMAX1          1  Maximum integration order plus 1 */
-/*        KQ            NTE  Integration order array */
-
-/*     For our purposes, NTE is always 3. */
-
-    moved_(record, &c__1, &tl);
-    moved_(&record[1], &c__15, g);
-
-/*     Collect the reference position and velocity. */
-
-    refpos[0] = record[16];
-    refvel[0] = record[17];
-    refpos[1] = record[18];
-    refvel[1] = record[19];
-    refpos[2] = record[20];
-    refvel[2] = record[21];
-    moved_(&record[22], &c__45, dt);
-    kqmax1 = (integer) record[67];
-    kq[0] = (integer) record[68];
-    kq[1] = (integer) record[69];
-    kq[2] = (integer) record[70];
-
-/*     Next we set up for the computation of the various differences */
-
-    delta = *et - tl;
-    tp = delta;
-    mq2 = kqmax1 - 2;
-    ks = kqmax1 - 1;
-
-/*     This is clearly collecting some kind of coefficients. */
-/*     The problem is that we have no idea what they are... */
-
-/*     The G coefficients are supposed to be some kind of step size */
-/*     vector. */
-
-/*     TP starts out as the delta t between the request time */
-/*     and the time for which we last had a state in the MDL file. */
-/*     We then change it from DELTA  by the components of the stepsize */
-/*     vector G. */
-
-    i__1 = mq2;
-    for (j = 1; j <= i__1; ++j) {
-	fc[(i__2 = j) < 14 && 0 <= i__2 ? i__2 : s_rnge("fc", i__2, "spke01_",
-		 (ftnlen)267)] = tp / g[(i__3 = j - 1) < 15 && 0 <= i__3 ? 
-		i__3 : s_rnge("g", i__3, "spke01_", (ftnlen)267)];
-	wc[(i__2 = j - 1) < 13 && 0 <= i__2 ? i__2 : s_rnge("wc", i__2, "spk"
-		"e01_", (ftnlen)268)] = delta / g[(i__3 = j - 1) < 15 && 0 <= 
-		i__3 ? i__3 : s_rnge("g", i__3, "spke01_", (ftnlen)268)];
-	tp = delta + g[(i__2 = j - 1) < 15 && 0 <= i__2 ? i__2 : s_rnge("g", 
-		i__2, "spke01_", (ftnlen)269)];
-    }
-
-/*     Collect KQMAX1 reciprocals. */
-
-    i__1 = kqmax1;
-    for (j = 1; j <= i__1; ++j) {
-	w[(i__2 = j - 1) < 17 && 0 <= i__2 ? i__2 : s_rnge("w", i__2, "spke0"
-		"1_", (ftnlen)276)] = 1. / (doublereal) j;
-    }
-
-/*     Compute the W(K) terms needed for the position interpolation */
-/*     (Note,  it is assumed throughout this routine that KS, which */
-/*     starts out as KQMAX1-1 (the ``maximum integration'') */
-/*     is at least 2. */
-
-    jx = 0;
-    ks1 = ks - 1;
-    while(ks >= 2) {
-	++jx;
-	i__1 = jx;
-	for (j = 1; j <= i__1; ++j) {
-	    w[(i__2 = j + ks - 1) < 17 && 0 <= i__2 ? i__2 : s_rnge("w", i__2,
-		     "spke01_", (ftnlen)293)] = fc[(i__3 = j) < 14 && 0 <= 
-		    i__3 ? i__3 : s_rnge("fc", i__3, "spke01_", (ftnlen)293)] 
-		    * w[(i__4 = j + ks1 - 1) < 17 && 0 <= i__4 ? i__4 : 
-		    s_rnge("w", i__4, "spke01_", (ftnlen)293)] - wc[(i__5 = j 
-		    - 1) < 13 && 0 <= i__5 ? i__5 : s_rnge("wc", i__5, "spke"
-		    "01_", (ftnlen)293)] * w[(i__6 = j + ks - 1) < 17 && 0 <= 
-		    i__6 ? i__6 : s_rnge("w", i__6, "spke01_", (ftnlen)293)];
-	}
-	ks = ks1;
-	--ks1;
-    }
-
-/*     Perform position interpolation: (Note that KS = 1 right now. */
-/*     We don't know much more than that.) */
-
-    for (i__ = 1; i__ <= 3; ++i__) {
-	kqq = kq[(i__1 = i__ - 1) < 3 && 0 <= i__1 ? i__1 : s_rnge("kq", i__1,
-		 "spke01_", (ftnlen)307)];
-	sum = 0.;
-	for (j = kqq; j >= 1; --j) {
-	    sum += dt[(i__1 = j + i__ * 15 - 16) < 45 && 0 <= i__1 ? i__1 : 
-		    s_rnge("dt", i__1, "spke01_", (ftnlen)311)] * w[(i__2 = j 
-		    + ks - 1) < 17 && 0 <= i__2 ? i__2 : s_rnge("w", i__2, 
-		    "spke01_", (ftnlen)311)];
-	}
-	state[(i__1 = i__ - 1) < 6 && 0 <= i__1 ? i__1 : s_rnge("state", i__1,
-		 "spke01_", (ftnlen)314)] = refpos[(i__2 = i__ - 1) < 3 && 0 
-		<= i__2 ? i__2 : s_rnge("refpos", i__2, "spke01_", (ftnlen)
-		314)] + delta * (refvel[(i__3 = i__ - 1) < 3 && 0 <= i__3 ? 
-		i__3 : s_rnge("refvel", i__3, "spke01_", (ftnlen)314)] + 
-		delta * sum);
-    }
-
-/*     Again we need to compute the W(K) coefficients that are */
-/*     going to be used in the velocity interpolation. */
-/*     (Note, at this point, KS = 1, KS1 = 0.) */
-
-    i__1 = jx;
-    for (j = 1; j <= i__1; ++j) {
-	w[(i__2 = j + ks - 1) < 17 && 0 <= i__2 ? i__2 : s_rnge("w", i__2, 
-		"spke01_", (ftnlen)324)] = fc[(i__3 = j) < 14 && 0 <= i__3 ? 
-		i__3 : s_rnge("fc", i__3, "spke01_", (ftnlen)324)] * w[(i__4 =
-		 j + ks1 - 1) < 17 && 0 <= i__4 ? i__4 : s_rnge("w", i__4, 
-		"spke01_", (ftnlen)324)] - wc[(i__5 = j - 1) < 13 && 0 <= 
-		i__5 ? i__5 : s_rnge("wc", i__5, "spke01_", (ftnlen)324)] * w[
-		(i__6 = j + ks - 1) < 17 && 0 <= i__6 ? i__6 : s_rnge("w", 
-		i__6, "spke01_", (ftnlen)324)];
-    }
-    --ks;
-
-/*     Perform velocity interpolation: */
-
-    for (i__ = 1; i__ <= 3; ++i__) {
-	kqq = kq[(i__1 = i__ - 1) < 3 && 0 <= i__1 ? i__1 : s_rnge("kq", i__1,
-		 "spke01_", (ftnlen)334)];
-	sum = 0.;
-	for (j = kqq; j >= 1; --j) {
-	    sum += dt[(i__1 = j + i__ * 15 - 16) < 45 && 0 <= i__1 ? i__1 : 
-		    s_rnge("dt", i__1, "spke01_", (ftnlen)338)] * w[(i__2 = j 
-		    + ks - 1) < 17 && 0 <= i__2 ? i__2 : s_rnge("w", i__2, 
-		    "spke01_", (ftnlen)338)];
-	}
-	state[(i__1 = i__ + 2) < 6 && 0 <= i__1 ? i__1 : s_rnge("state", i__1,
-		 "spke01_", (ftnlen)341)] = refvel[(i__2 = i__ - 1) < 3 && 0 
-		<= i__2 ? i__2 : s_rnge("refvel", i__2, "spke01_", (ftnlen)
-		341)] + delta * sum;
-    }
-
-/*     That's all folks.  We don't know why we did anything, but */
-/*     at least we can tell structurally what we did. */
+/*     Evaluate the difference line. */
 
+    zzmdaev_(et, &c__15, record, state);
     return 0;
 } /* spke01_ */
 
@@ -13,22 +13,25 @@ static integer c__6 = 6;
 /* Subroutine */ int spke09_(doublereal *et, doublereal *record, doublereal *
 	state)
 {
+    /* Initialized data */
+
+    static integer svn = 0;
+
     /* System generated locals */
     integer i__1;
 
     /* Builtin functions */
-    integer i_dnnt(doublereal *), s_rnge(char *, integer, char *, integer);
+    integer i_dnnt(doublereal *);
 
     /* Local variables */
-    integer i__, n;
+    doublereal c__[28], h__;
+    integer i__, j, k, n;
+    static doublereal svw[28], svx[28];
+    logical same;
+    doublereal sum, w;
     extern /* Subroutine */ int moved_(doublereal *, integer *, doublereal *);
-    doublereal locrec[198];
-    extern doublereal lgrint_(integer *, doublereal *, doublereal *, 
-	    doublereal *, doublereal *);
-    extern /* Subroutine */ int xposeg_(doublereal *, integer *, integer *, 
-	    doublereal *);
     extern logical return_(void);
-    integer xstart, ystart;
+    integer xstart;
 
 /* $ Abstract */
 
@@ -206,6 +209,22 @@ static integer c__6 = 6;
 /*     discrete states, evaluated by Lagrange interpolation) segments are */
 /*     described in the SPK Required Reading file. */
 
+/*     The interpolating polynomials are evaluated in the barycentric */
+/*     form */
+
+/*                  N                       N */
+/*                 ___   W(i) Y(i)         ___    W(i) */
+/*        P(x) =   >     ---------    /    >     ------ */
+/*                 ---    x - X(i)         ---   x - X(i) */
+/*                 i=1                     i=1 */
+
+/*     where the weights W(i) depend only on the epochs X(i). The */
+/*     weights computed for the previous record are saved, so that */
+/*     when consecutive request times use the same record, as they do */
+/*     in a sweep of closely spaced epochs, each state costs O(N) */
+/*     operations rather than the O(N**2) of Lagrange interpolation. */
+/*     The result agrees with that of LGRINT to within round-off. */
+
 /* $ Examples */
 
 /*     The SPKEnn routines are almost always used in conjunction with */
@@ -303,26 +322,74 @@ static integer c__6 = 6;
 	return 0;
     }
 
-/*     We'll transpose the state information in the input record */
-/*     so that contiguous pieces of it can be shoved directly into the */
-/*     interpolation routine LGRINT.  We allow LGRINT to overwrite the */
-/*     state values in the input record, since this saves local storage */
-/*     and does no harm.  (See the header of LGRINT for a description of */
-/*     its work space usage.) */
+/*     The states occupy elements 2 : 6*N+1 of the record; the epochs */
+/*     follow them. */
 
     n = i_dnnt(record);
-    xposeg_(&record[1], &c__6, &n, locrec);
-    i__1 = n * 6;
-    moved_(locrec, &i__1, &record[1]);
+    xstart = n * 6 + 2;
+
+/*     Compute the barycentric weights unless they were computed for */
+/*     the same epochs by the previous call. The differences of the */
+/*     epochs are scaled by the mean spacing H, which keeps the */
+/*     products in range without affecting the result. */
+
+    same = n == svn;
+    j = 1;
+    while(same && j <= n) {
+	same = record[xstart + j - 2] == svx[j - 1];
+	++j;
+    }
+    if (! same) {
+	h__ = 1.;
+	if (n > 1) {
+	    h__ = (record[xstart + n - 2] - record[xstart - 1]) / (n - 1);
+	    if (h__ <= 0.) {
+		h__ = 1.;
+	    }
+	}
+	i__1 = n;
+	for (i__ = 1; i__ <= i__1; ++i__) {
+	    svx[i__ - 1] = record[xstart + i__ - 2];
+	}
+	i__1 = n;
+	for (i__ = 1; i__ <= i__1; ++i__) {
+	    w = 1.;
+	    for (j = 1; j <= n; ++j) {
+		if (j != i__) {
+		    w *= (svx[i__ - 1] - svx[j - 1]) / h__;
+		}
+	    }
+	    svw[i__ - 1] = 1. / w;
+	}
+	svn = n;
+    }
+
+/*     If the request time is one of the epochs, the state at that */
+/*     epoch is the result. */
+
+    i__1 = n;
+    for (i__ = 1; i__ <= i__1; ++i__) {
+	if (*et == svx[i__ - 1]) {
+	    moved_(&record[(i__ - 1) * 6 + 1], &c__6, state);
+	    return 0;
+	}
+    }
+    sum = 0.;
+    i__1 = n;
+    for (i__ = 1; i__ <= i__1; ++i__) {
+	c__[i__ - 1] = svw[i__ - 1] / (*et - svx[i__ - 1]);
+	sum += c__[i__ - 1];
+    }
 
 /*     We interpolate each state component in turn. */
 
-    xstart = n * 6 + 2;
-    for (i__ = 1; i__ <= 6; ++i__) {
-	ystart = n * (i__ - 1) + 2;
-	state[(i__1 = i__ - 1) < 6 && 0 <= i__1 ? i__1 : s_rnge("state", i__1,
-		 "spke09_", (ftnlen)261)] = lgrint_(&n, &record[xstart - 1], &
-		record[ystart - 1], locrec, et);
+    for (k = 1; k <= 6; ++k) {
+	w = 0.;
+	i__1 = n;
+	for (i__ = 1; i__ <= i__1; ++i__) {
+	    w += c__[i__ - 1] * record[(i__ - 1) * 6 + k];
+	}
+	state[k - 1] = w / sum;
     }
     return 0;
 } /* spke09_ */
@@ -9,22 +9,30 @@
 /* Subroutine */ int spke13_(doublereal *et, doublereal *record, doublereal *
 	state)
 {
+    /* Initialized data */
+
+    static integer svsize = 0;
+    static doublereal svh = 1.;
+    static doublereal svxc = 0.;
+
     /* System generated locals */
-    integer i__1, i__2;
+    integer i__1;
 
     /* Builtin functions */
-    integer i_dnnt(doublereal *), s_rnge(char *, integer, char *, integer);
+    integer i_dnnt(doublereal *);
 
     /* Local variables */
     integer from;
-    doublereal work[516]	/* was [258][2] */;
-    integer i__, j, n;
+    doublereal d__;
+    integer i__, j, k, m, n;
+    doublereal p, t;
     extern /* Subroutine */ int chkin_(char *, ftnlen);
-    integer to;
-    doublereal locrec[129];
-    extern /* Subroutine */ int chkout_(char *, ftnlen), hrmint_(integer *, 
-	    doublereal *, doublereal *, doublereal *, doublereal *, 
-	    doublereal *, doublereal *);
+    doublereal dp;
+    static doublereal svcoef[168]	/* was [56][3] */, svrec[198], svz[56];
+    logical same;
+    integer size;
+    extern /* Subroutine */ int moved_(doublereal *, integer *, doublereal *),
+	     chkout_(char *, ftnlen);
     extern logical return_(void);
     integer xstart;
 
@@ -126,6 +134,14 @@
 /*     discrete states, evaluated by Hermite interpolation) SPK segments */
 /*     is described in the SPK Required Reading. */
 
+/*     Each interpolating polynomial is evaluated in Newton form, from */
+/*     its divided differences on the epochs of the record, each epoch */
+/*     taken twice. The divided differences of the previous record are */
+/*     saved, so that when consecutive request times use the same */
+/*     record, as they do in a sweep of closely spaced epochs, each */
+/*     state costs O(N) operations rather than the O(N**2) of HRMINT. */
+/*     The result agrees with that of HRMINT to within round-off. */
+
 /* $ Examples */
 
 /*     The SPKEnn routines are almost always used in conjunction with */
@@ -209,32 +225,87 @@
     }
     chkin_("SPKE13", (ftnlen)6);
     n = i_dnnt(record);
+    xstart = n * 6 + 2;
+    m = n << 1;
+    size = n * 7 + 1;
 
-/*     We interpolate each state component in turn. */
+/*     Compute the divided differences unless they were computed for */
+/*     the same record by the previous call. */
 
-    xstart = n * 6 + 2;
-    for (i__ = 1; i__ <= 3; ++i__) {
+    same = size == svsize;
+    j = 1;
+    while(same && j <= size) {
+	same = record[j - 1] == svrec[j - 1];
+	++j;
+    }
+    if (! same) {
+
+/*        Time is measured by T = ( ET - XC ) / H, where XC is the */
+/*        midpoint of the epochs and H is half their span, so that the */
+/*        divided differences are of moderate size. Derivatives with */
+/*        respect to T are H times those with respect to ET. */
+
+	svxc = record[xstart - 1];
+	svh = 1.;
+	if (n > 1) {
+	    svxc = (record[xstart - 1] + record[xstart + n - 2]) * .5;
+	    svh = (record[xstart + n - 2] - record[xstart - 1]) * .5;
+	    if (svh <= 0.) {
+		svh = 1.;
+	    }
+	}
 	i__1 = n;
 	for (j = 1; j <= i__1; ++j) {
-
-/*           For the Jth input state vector, copy the Ith position and */
-/*           velocity components into the local record buffer LOCREC. */
-
-	    from = (j - 1) * 6 + 1 + i__;
-	    to = (j << 1) - 1;
-	    locrec[(i__2 = to - 1) < 129 && 0 <= i__2 ? i__2 : s_rnge("locrec"
-		    , i__2, "spke13_", (ftnlen)234)] = record[from - 1];
-	    locrec[(i__2 = to) < 129 && 0 <= i__2 ? i__2 : s_rnge("locrec", 
-		    i__2, "spke13_", (ftnlen)235)] = record[from + 2];
+	    t = (record[xstart + j - 2] - svxc) / svh;
+	    svz[(j << 1) - 2] = t;
+	    svz[(j << 1) - 1] = t;
+	}
+	for (i__ = 1; i__ <= 3; ++i__) {
+
+/*           The zeroth differences are the values of the Ith position */
+/*           component. Each first difference on a repeated epoch is */
+/*           the derivative there: the Ith velocity component. */
+
+	    i__1 = n;
+	    for (j = 1; j <= i__1; ++j) {
+		from = (j - 1) * 6 + 1 + i__;
+		svcoef[(j << 1) - 2 + (i__ - 1) * 56] = record[from - 1];
+		svcoef[(j << 1) - 1 + (i__ - 1) * 56] = record[from - 1];
+	    }
+	    i__1 = m - 1;
+	    for (j = 1; j <= i__1; ++j) {
+		for (k = m; k >= j + 1; --k) {
+		    d__ = svz[k - 1] - svz[k - j - 1];
+		    if (d__ == 0.) {
+			from = (k / 2 - 1) * 6 + 4 + i__;
+			svcoef[k - 1 + (i__ - 1) * 56] = record[from - 1] * 
+				svh;
+		    } else {
+			svcoef[k - 1 + (i__ - 1) * 56] = (svcoef[k - 1 + (
+				i__ - 1) * 56] - svcoef[k - 2 + (i__ - 1) * 
+				56]) / d__;
+		    }
+		}
+	    }
 	}
+	moved_(record, &size, svrec);
+	svsize = size;
+    }
 
-/*        Interpolate the Ith position and velocity components of the */
-/*        state. */
+/*     Evaluate the polynomials and their derivatives by Horner's */
+/*     method. */
 
-	hrmint_(&n, &record[xstart - 1], locrec, et, work, &state[(i__1 = i__ 
-		- 1) < 6 && 0 <= i__1 ? i__1 : s_rnge("state", i__1, "spke13_"
-		, (ftnlen)243)], &state[(i__2 = i__ + 2) < 6 && 0 <= i__2 ? 
-		i__2 : s_rnge("state", i__2, "spke13_", (ftnlen)243)]);
+    t = (*et - svxc) / svh;
+    for (i__ = 1; i__ <= 3; ++i__) {
+	p = svcoef[m - 1 + (i__ - 1) * 56];
+	dp = 0.;
+	for (k = m - 1; k >= 1; --k) {
+	    d__ = t - svz[k - 1];
+	    dp = dp * d__ + p;
+	    p = p * d__ + svcoef[k - 1 + (i__ - 1) * 56];
+	}
+	state[i__ - 1] = p;
+	state[i__ + 2] = dp / svh;
     }
     chkout_("SPKE13", (ftnlen)6);
     return 0;
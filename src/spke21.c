@@ -8,44 +8,26 @@
 /* Table of constant values */
 
 static integer c__25 = 25;
-static integer c__1 = 1;
 
 /* $Procedure      SPKE21 ( S/P Kernel, evaluate, type 21 ) */
 /* Subroutine */ int spke21_(doublereal *et, doublereal *record, doublereal *
 	state)
 {
-    /* Initialized data */
-
-    static doublereal fc[25] = { 1. };
-
     /* System generated locals */
-    integer i__1, i__2, i__3, i__4, i__5, i__6;
+    integer i__1;
 
     /* Builtin functions */
-    integer i_dnnt(doublereal *), s_rnge(char *, integer, char *, integer);
+    integer i_dnnt(doublereal *);
 
     /* Local variables */
-    static doublereal g[25];
-    static integer i__, j;
-    static doublereal w[27], delta;
-    extern /* Subroutine */ int chkin_(char *, ftnlen), moved_(doublereal *, 
-	    integer *, doublereal *);
-    static integer kqmax1;
-    static doublereal dt[75]	/* was [25][3] */, wc[24];
-    static integer kq[3], ks;
-    static doublereal tl;
-    static integer jx;
-    static doublereal tp;
-    static integer maxdim;
-    static doublereal refvel[3];
+    integer j;
+    extern /* Subroutine */ int chkin_(char *, ftnlen);
+    integer kqmax1, maxdim;
     extern /* Subroutine */ int sigerr_(char *, ftnlen), chkout_(char *, 
-	    ftnlen);
-    static doublereal refpos[3];
-    extern /* Subroutine */ int setmsg_(char *, ftnlen), errint_(char *, 
-	    integer *, ftnlen);
+	    ftnlen), setmsg_(char *, ftnlen), errint_(char *, integer *, 
+	    ftnlen), zzmdaev_(doublereal *, integer *, doublereal *, 
+	    doublereal *);
     extern logical return_(void);
-    static integer mq2, ks1, kqq;
-    static doublereal sum;
 
 /* $ Abstract */
 
@@ -241,6 +223,9 @@ static integer c__1 = 1;
 /*     SPKE21 is a modified version of SPKE01. The routine has been */
 /*     generalized to support variable size difference lines. */
 
+/*     The computation is performed by ZZMDAEV, which is shared with */
+/*     SPKE01. */
+
 /* $ Examples */
 
 /*     None. */
@@ -280,17 +265,6 @@ static integer c__1 = 1;
 
 /*     Local variables */
 
-/*     The names below are original to the routine. They correspond */
-/*     roughly to the original memos written by Fred Krogh to explain */
-/*     how all this stuff really works. */
-
-
-/*     Save everything between calls. */
-
-
-/*     Initial values */
-
-
 /*     Use discovery check-in. */
 
 /*     If the RETURN function is set, don't even bother with this. */
@@ -316,72 +290,14 @@ static integer c__1 = 1;
 	return 0;
     }
 
-/*     Unpack the contents of the MDA array. */
-
-/*        Name     Dimension  Description */
-/*        ------   ---------  ------------------------------- */
-/*        TL               1  Reference epoch of record */
-/*        G           MAXDIM  Stepsize function vector */
-/*        REFPOS           3  Reference position vector */
-/*        REFVEL           3  Reference velocity vector */
-/*        DT      MAXDIM,NTE  Modified divided difference arrays */
-/*        KQMAX1           1  Maximum integration order plus 1 */
-/*        KQ             NTE  Integration order array */
-
-/*     For our purposes, NTE is always 3. */
-
-    moved_(&record[1], &c__1, &tl);
-    moved_(&record[2], &maxdim, g);
-
-/*     Collect the reference position and velocity. */
-
-    refpos[0] = record[maxdim + 2];
-    refvel[0] = record[maxdim + 3];
-    refpos[1] = record[maxdim + 4];
-    refvel[1] = record[maxdim + 5];
-    refpos[2] = record[maxdim + 6];
-    refvel[2] = record[maxdim + 7];
-
-/*     Initializing the difference table is one aspect of this routine */
-/*     that's a bit different from SPKE01. Here the first dimension of */
-/*     the table in the input record can be smaller than MAXTRM. So, we */
-/*     must transfer separately the portions of the table corresponding */
-/*     to each component. */
-
-    for (i__ = 1; i__ <= 3; ++i__) {
-	moved_(&record[i__ * maxdim + 8], &maxdim, &dt[(i__1 = i__ * 25 - 25) 
-		< 75 && 0 <= i__1 ? i__1 : s_rnge("dt", i__1, "spke21_", (
-		ftnlen)289)]);
-    }
-    kqmax1 = (integer) record[(maxdim << 2) + 8];
-    kq[0] = (integer) record[(maxdim << 2) + 9];
-    kq[1] = (integer) record[(maxdim << 2) + 10];
-    kq[2] = (integer) record[(maxdim << 2) + 11];
-
-/*     Next we set up for the computation of the various differences */
-
-    delta = *et - tl;
-    tp = delta;
-    mq2 = kqmax1 - 2;
-    ks = kqmax1 - 1;
+/*     The stepsize function vector G occupies elements 3 : MAXDIM+2 */
+/*     of the record. Make sure we're not about to attempt division */
+/*     by zero. */
 
-/*     This is clearly collecting some kind of coefficients. */
-/*     The problem is that we have no idea what they are... */
-
-/*     The G coefficients are supposed to be some kind of step size */
-/*     vector. */
-
-/*     TP starts out as the delta t between the request time and the */
-/*     difference line's reference epoch. We then change it from DELTA */
-/*     by the components of the stepsize vector G. */
-
-    i__1 = mq2;
+    kqmax1 = (integer) record[(maxdim << 2) + 8];
+    i__1 = kqmax1 - 2;
     for (j = 1; j <= i__1; ++j) {
-
-/*        Make sure we're not about to attempt division by zero. */
-
-	if (g[(i__2 = j - 1) < 25 && 0 <= i__2 ? i__2 : s_rnge("g", i__2, 
-		"spke21_", (ftnlen)320)] == 0.) {
+	if (record[j + 1] == 0.) {
 	    chkin_("SPKE21", (ftnlen)6);
 	    setmsg_("A  value of zero was found at index # of the step size "
 		    "vector.", (ftnlen)62);
@@ -390,103 +306,11 @@ static integer c__1 = 1;
 	    chkout_("SPKE21", (ftnlen)6);
 	    return 0;
 	}
-	fc[(i__2 = j) < 25 && 0 <= i__2 ? i__2 : s_rnge("fc", i__2, "spke21_",
-		 (ftnlen)332)] = tp / g[(i__3 = j - 1) < 25 && 0 <= i__3 ? 
-		i__3 : s_rnge("g", i__3, "spke21_", (ftnlen)332)];
-	wc[(i__2 = j - 1) < 24 && 0 <= i__2 ? i__2 : s_rnge("wc", i__2, "spk"
-		"e21_", (ftnlen)333)] = delta / g[(i__3 = j - 1) < 25 && 0 <= 
-		i__3 ? i__3 : s_rnge("g", i__3, "spke21_", (ftnlen)333)];
-	tp = delta + g[(i__2 = j - 1) < 25 && 0 <= i__2 ? i__2 : s_rnge("g", 
-		i__2, "spke21_", (ftnlen)334)];
-    }
-
-/*     Collect KQMAX1 reciprocals. */
-
-    i__1 = kqmax1;
-    for (j = 1; j <= i__1; ++j) {
-	w[(i__2 = j - 1) < 27 && 0 <= i__2 ? i__2 : s_rnge("w", i__2, "spke2"
-		"1_", (ftnlen)342)] = 1. / (doublereal) j;
-    }
-
-/*     Compute the W(K) terms needed for the position interpolation */
-/*     (Note,  it is assumed throughout this routine that KS, which */
-/*     starts out as KQMAX1-1 (the ``maximum integration'') */
-/*     is at least 2. */
-
-    jx = 0;
-    ks1 = ks - 1;
-    while(ks >= 2) {
-	++jx;
-	i__1 = jx;
-	for (j = 1; j <= i__1; ++j) {
-	    w[(i__2 = j + ks - 1) < 27 && 0 <= i__2 ? i__2 : s_rnge("w", i__2,
-		     "spke21_", (ftnlen)359)] = fc[(i__3 = j) < 25 && 0 <= 
-		    i__3 ? i__3 : s_rnge("fc", i__3, "spke21_", (ftnlen)359)] 
-		    * w[(i__4 = j + ks1 - 1) < 27 && 0 <= i__4 ? i__4 : 
-		    s_rnge("w", i__4, "spke21_", (ftnlen)359)] - wc[(i__5 = j 
-		    - 1) < 24 && 0 <= i__5 ? i__5 : s_rnge("wc", i__5, "spke"
-		    "21_", (ftnlen)359)] * w[(i__6 = j + ks - 1) < 27 && 0 <= 
-		    i__6 ? i__6 : s_rnge("w", i__6, "spke21_", (ftnlen)359)];
-	}
-	ks = ks1;
-	--ks1;
-    }
-
-/*     Perform position interpolation: (Note that KS = 1 right now. */
-/*     We don't know much more than that.) */
-
-    for (i__ = 1; i__ <= 3; ++i__) {
-	kqq = kq[(i__1 = i__ - 1) < 3 && 0 <= i__1 ? i__1 : s_rnge("kq", i__1,
-		 "spke21_", (ftnlen)373)];
-	sum = 0.;
-	for (j = kqq; j >= 1; --j) {
-	    sum += dt[(i__1 = j + i__ * 25 - 26) < 75 && 0 <= i__1 ? i__1 : 
-		    s_rnge("dt", i__1, "spke21_", (ftnlen)377)] * w[(i__2 = j 
-		    + ks - 1) < 27 && 0 <= i__2 ? i__2 : s_rnge("w", i__2, 
-		    "spke21_", (ftnlen)377)];
-	}
-	state[(i__1 = i__ - 1) < 6 && 0 <= i__1 ? i__1 : s_rnge("state", i__1,
-		 "spke21_", (ftnlen)380)] = refpos[(i__2 = i__ - 1) < 3 && 0 
-		<= i__2 ? i__2 : s_rnge("refpos", i__2, "spke21_", (ftnlen)
-		380)] + delta * (refvel[(i__3 = i__ - 1) < 3 && 0 <= i__3 ? 
-		i__3 : s_rnge("refvel", i__3, "spke21_", (ftnlen)380)] + 
-		delta * sum);
     }
 
-/*     Again we need to compute the W(K) coefficients that are */
-/*     going to be used in the velocity interpolation. */
-/*     (Note, at this point, KS = 1, KS1 = 0.) */
+/*     Evaluate the difference line, which follows MAXDIM. */
 
-    i__1 = jx;
-    for (j = 1; j <= i__1; ++j) {
-	w[(i__2 = j + ks - 1) < 27 && 0 <= i__2 ? i__2 : s_rnge("w", i__2, 
-		"spke21_", (ftnlen)390)] = fc[(i__3 = j) < 25 && 0 <= i__3 ? 
-		i__3 : s_rnge("fc", i__3, "spke21_", (ftnlen)390)] * w[(i__4 =
-		 j + ks1 - 1) < 27 && 0 <= i__4 ? i__4 : s_rnge("w", i__4, 
-		"spke21_", (ftnlen)390)] - wc[(i__5 = j - 1) < 24 && 0 <= 
-		i__5 ? i__5 : s_rnge("wc", i__5, "spke21_", (ftnlen)390)] * w[
-		(i__6 = j + ks - 1) < 27 && 0 <= i__6 ? i__6 : s_rnge("w", 
-		i__6, "spke21_", (ftnlen)390)];
-    }
-    --ks;
-
-/*     Perform velocity interpolation: */
-
-    for (i__ = 1; i__ <= 3; ++i__) {
-	kqq = kq[(i__1 = i__ - 1) < 3 && 0 <= i__1 ? i__1 : s_rnge("kq", i__1,
-		 "spke21_", (ftnlen)400)];
-	sum = 0.;
-	for (j = kqq; j >= 1; --j) {
-	    sum += dt[(i__1 = j + i__ * 25 - 26) < 75 && 0 <= i__1 ? i__1 : 
-		    s_rnge("dt", i__1, "spke21_", (ftnlen)404)] * w[(i__2 = j 
-		    + ks - 1) < 27 && 0 <= i__2 ? i__2 : s_rnge("w", i__2, 
-		    "spke21_", (ftnlen)404)];
-	}
-	state[(i__1 = i__ + 2) < 6 && 0 <= i__1 ? i__1 : s_rnge("state", i__1,
-		 "spke21_", (ftnlen)407)] = refvel[(i__2 = i__ - 1) < 3 && 0 
-		<= i__2 ? i__2 : s_rnge("refvel", i__2, "spke21_", (ftnlen)
-		407)] + delta * sum;
-    }
+    zzmdaev_(et, &maxdim, &record[1], state);
     return 0;
 } /* spke21_ */
 
@@ -0,0 +1,248 @@
+/*
+
+-Procedure spkezrv_c ( S/P Kernel, easier reader, vectorized )
+
+-Abstract
+
+   Return the states (position and velocity) of a target body
+   relative to an observing body at an array of epochs, optionally
+   corrected for light time (planetary aberration) and stellar
+   aberration.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   SPK
+   NAIF_IDS
+   FRAMES
+   TIME
+
+-Keywords
+
+   EPHEMERIS
+
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZmc.h"
+   #undef spkezrv_c
+
+   void spkezrv_c ( ConstSpiceChar     *targ,
+                    SpiceInt            n,
+                    ConstSpiceDouble    et    [],
+                    ConstSpiceChar     *ref,
+                    ConstSpiceChar     *abcorr,
+                    ConstSpiceChar     *obs,
+                    SpiceDouble         starg [][6],
+                    SpiceDouble         lt    []     )
+
+/*
+
+-Brief_I/O
+
+   Variable  I/O  Description
+   --------  ---  --------------------------------------------------
+   targ       I   Target body name.
+   n          I   Number of epochs.
+   et         I   Observer epochs.
+   ref        I   Reference frame of output state vectors.
+   abcorr     I   Aberration correction flag.
+   obs        I   Observing body name.
+   starg      O   States of target.
+   lt         O   One way light times between observer and target.
+
+-Detailed_Input
+
+   n           is the number of epochs.
+
+   et          is an array of `n' ephemeris times, expressed as
+               seconds past J2000 TDB, at which the state of the
+               target body relative to the observer is to be
+               computed.  The epochs may be in any order; sorted
+               epochs are processed most efficiently.
+
+   All other inputs have the meanings given in the header of
+   spkezr_c.
+
+-Detailed_Output
+
+   starg,
+   lt          are arrays of `n' elements.  Element i of each array
+               is the corresponding output of spkezr_c for the
+               epoch et[i].
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1)  If `n' is less than 1, the routine returns without
+       modifying its outputs.
+
+   2)  If any input string argument pointer is null, the error
+       SPICE(NULLPOINTER) is signaled.
+
+   3)  If any input string argument is empty, the error
+       SPICE(EMPTYSTRING) is signaled.
+
+   4)  All other errors are diagnosed by spkezr_c or routines in its
+       call tree.  When an error occurs for an epoch, the outputs for
+       that epoch and all later ones are not modified.
+
+-Files
+
+   See spkezr_c.
+
+-Particulars
+
+   For converged Newtonian corrections ("CN", "CN+S", "XCN",
+   "XCN+S") spkezr_c finds the light time by iteration, starting from
+   the geometric light time.  That costs an SPK evaluation of the
+   geometric state and several iterations, each of which evaluates
+   the target's state again.
+
+   This routine starts the iteration for each epoch from the light
+   time of the previous epoch, extrapolated using its rate of change,
+   provided the two epochs are no more than one day apart.  The
+   geometric evaluation is skipped and the iteration usually ends
+   after one or two steps.  The light times so found agree with
+   those found by spkezr_c to within the convergence tolerance of the
+   iteration, and are not in general bitwise identical to them.
+
+   Results for the other aberration corrections are identical to
+   those of spkezr_c, since their light time estimates do not depend
+   on a starting value.
+
+   Processing the epochs in increasing order also makes successive
+   SPK lookups fall within the same segments and records, which the
+   SPK subsystem's segment buffering exploits.
+
+-Examples
+
+   1)  Compute the apparent state of Mars as seen from Earth, once a
+       minute over a day.
+
+          for ( i = 0;  i < 1440;  i++ )
+          {
+             et[i] = et0 + 60.0 * i;
+          }
+
+          spkezrv_c ( "MARS", 1440, et,     "J2000", "CN+S",
+                      "EARTH",      starg,  lt                );
+
+-Restrictions
+
+   None.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   using body names get target states at multiple epochs
+   get corrected states for an array of epochs
+
+-&
+*/
+
+{ /* Begin spkezrv_c */
+
+
+   /*
+   Local variables
+   */
+   SpiceInt                i;
+
+   logical                 off = 0;
+   logical                 on  = 1;
+
+
+   /*
+   Participate in tracing.
+   */
+   chkin_c ( "spkezrv_c" );
+
+
+   /*
+   Check the input strings to make sure the pointers are non-null
+   and the string lengths are non-zero.
+   */
+   CHKFSTR ( CHK_STANDARD, "spkezrv_c", targ   );
+   CHKFSTR ( CHK_STANDARD, "spkezrv_c", ref    );
+   CHKFSTR ( CHK_STANDARD, "spkezrv_c", abcorr );
+   CHKFSTR ( CHK_STANDARD, "spkezrv_c", obs    );
+
+   if ( n < 1 )
+   {
+      chkout_c ( "spkezrv_c" );
+      return;
+   }
+
+   /*
+   Enable light time seeding for the duration of the loop.  Seeding
+   is disabled, and the seeds cleared, whether or not the loop
+   succeeds.
+   */
+   zzltsset_ ( &on );
+
+   for ( i = 0;  i < n;  i++ )
+   {
+      spkezr_ ( ( char       * )  targ,
+                ( doublereal * )  ( et + i ),
+                ( char       * )  ref,
+                ( char       * )  abcorr,
+                ( char       * )  obs,
+                ( doublereal * )  starg[i],
+                ( doublereal * )  ( lt + i ),
+                ( ftnlen       )  strlen(targ),
+                ( ftnlen       )  strlen(ref),
+                ( ftnlen       )  strlen(abcorr),
+                ( ftnlen       )  strlen(obs)    );
+
+      if ( failed_c() )
+      {
+         break;
+      }
+   }
+
+   zzltsset_ ( &off );
+
+
+   chkout_c ( "spkezrv_c" );
+
+} /* End spkezrv_c */
@@ -60,6 +60,10 @@ static doublereal c_b19 = -1.;
     integer numitr;
     extern logical return_(void);
     logical usestl;
+    extern /* Subroutine */ int zzltsget_(integer *, integer *, logical *, 
+	    doublereal *, logical *, doublereal *), zzltssav_(integer *, 
+	    integer *, logical *, doublereal *, doublereal *, doublereal *);
+    logical seeded;
 
 /* $ Abstract */
 
@@ -747,30 +751,40 @@ static doublereal c_b19 = -1.;
 	return 0;
     }
 
-/*     Find the geometric state of the target body with respect to */
-/*     the solar system barycenter. Subtract the state of the */
-/*     observer to get the relative state. Use this to compute the */
-/*     one-way light time. */
+/*     For converged Newtonian corrections, an initial light time */
+/*     estimate may be available from a nearby epoch; see ZZLTSEED. */
+/*     In that case the geometric state is not needed. */
 
-    spkgeo_(targ, et, ref, &c__0, ssbtrg, &ssblt, ref_len);
-    if (failed_()) {
-	chkout_("SPKLTC", (ftnlen)6);
-	return 0;
+    seeded = FALSE_;
+    if (usecn) {
+	zzltsget_(targ, &refid, &xmit, et, &seeded, lt);
     }
-    vsubg_(ssbtrg, stobs, &c__6, starg);
-    dist = vnorm_(starg);
-    *lt = dist / clight_();
-    if (*lt == 0.) {
+    if (! seeded) {
+
+/*        Find the geometric state of the target body with respect to */
+/*        the solar system barycenter. Subtract the state of the */
+/*        observer to get the relative state. Use this to compute the */
+/*        one-way light time. */
+
+	spkgeo_(targ, et, ref, &c__0, ssbtrg, &ssblt, ref_len);
+	if (failed_()) {
+	    chkout_("SPKLTC", (ftnlen)6);
+	    return 0;
+	}
+	vsubg_(ssbtrg, stobs, &c__6, starg);
+	dist = vnorm_(starg);
+	*lt = dist / clight_();
+	if (*lt == 0.) {
 
 /*        This can happen only if the observer and target are at the */
 /*        same position. We don't consider this an error, but we're not */
 /*        going to compute the light time derivative. */
 
-	*dlt = 0.;
-	chkout_("SPKLTC", (ftnlen)6);
-	return 0;
-    }
-    if (! uselt) {
+	    *dlt = 0.;
+	    chkout_("SPKLTC", (ftnlen)6);
+	    return 0;
+	}
+	if (! uselt) {
 
 /*        This is a special case: we're not using light time */
 /*        corrections, so the derivative */
@@ -778,12 +792,13 @@ static doublereal c_b19 = -1.;
 
 /*           (1/c) * d(VNORM(STARG))/dt */
 
-	*dlt = vdot_(starg, &starg[3]) / (dist * clight_());
+	    *dlt = vdot_(starg, &starg[3]) / (dist * clight_());
 
 /*        LT and DLT are both set, so we can return. */
 
-	chkout_("SPKLTC", (ftnlen)6);
-	return 0;
+	    chkout_("SPKLTC", (ftnlen)6);
+	    return 0;
+	}
     }
 
 /*     To correct for light time, find the state of the target body */
@@ -936,6 +951,12 @@ static doublereal c_b19 = -1.;
 
     *dlt = a * b / (1. - ltsign * c__ * a);
 
+/*     Record the converged light time as a seed for nearby epochs. */
+
+    if (usecn) {
+	zzltssav_(targ, &refid, &xmit, et, lt, dlt);
+    }
+
 /*     Overwrite the velocity portion of the output state */
 /*     with the light-time corrected velocity. */
 
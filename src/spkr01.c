@@ -9,18 +9,17 @@
 
 static integer c__2 = 2;
 static integer c__6 = 6;
-static integer c__100 = 100;
 
 /* $Procedure      SPKR01 ( Read SPK record from segment, type 1 ) */
 /* Subroutine */ int spkr01_(integer *handle, doublereal *descr, doublereal *
 	et, doublereal *record)
 {
     /* System generated locals */
-    integer i__1, i__2, i__3;
+    integer i__1, i__2;
 
     /* Local variables */
     doublereal data[100];
-    integer offd, offe, nrec, ndir, offr, i__, begin;
+    integer offe, nrec, ndir, offr, begin;
     extern /* Subroutine */ int chkin_(char *, ftnlen), dafus_(doublereal *, 
 	    integer *, integer *, doublereal *, integer *);
     integer recno;
@@ -29,9 +28,10 @@ static integer c__100 = 100;
     doublereal dc[2];
     integer ic[6];
     extern /* Subroutine */ int chkout_(char *, ftnlen);
-    extern integer lstltd_(doublereal *, integer *, doublereal *);
+    extern /* Subroutine */ int zzmdaloc_(integer *, integer *, integer *, 
+	    integer *, doublereal *, integer *);
     extern logical return_(void);
-    integer end, off;
+    integer end;
 
 /* $ Abstract */
 
@@ -114,6 +114,10 @@ static integer c__100 = 100;
 /*     See the SPK Required Reading file for a description of the */
 /*     structure of a data type 1 segment. */
 
+/*     The record is located by ZZMDALOC, which keeps the record epochs */
+/*     of recently used segments in memory and searches them by */
+/*     bisection, rather than by reading the epoch directory. */
+
 /* $ Examples */
 
 /*     The data returned by the SPKRnn routine is in its rawest form, */
@@ -212,8 +216,6 @@ static integer c__100 = 100;
 
 /*        NDIR      The number of directory epochs. */
 
-/*        OFFD      The offset of the first directory epoch. */
-
 /*        OFFE      The offset of the first epoch. */
 
 
@@ -222,7 +224,6 @@ static integer c__100 = 100;
     dafgda_(handle, &end, &end, data);
     nrec = (integer) data[0];
     ndir = nrec / 100;
-    offd = end - ndir - 1;
     offe = end - ndir - nrec - 1;
 
 /*     What we want is the record number: once we have that, we can */
@@ -230,57 +231,9 @@ static integer c__100 = 100;
 /*     segment, grab it, and go. But how to find it? */
 
 /*     Ultimately, we want the first record whose epoch is greater */
-/*     than or equal to ET. If there are 100 or fewer records, all */
-/*     the record epochs can be examined in a single group. */
-
-    if (nrec <= 100) {
-	i__1 = offe + 1;
-	i__2 = offe + nrec;
-	dafgda_(handle, &i__1, &i__2, data);
-	recno = lstltd_(et, &nrec, data) + 1;
-	offr = begin - 1 + (recno - 1) * 71;
-	i__1 = offr + 1;
-	i__2 = offr + 71;
-	dafgda_(handle, &i__1, &i__2, record);
-	chkout_("SPKR01", (ftnlen)6);
-	return 0;
-    }
-
-/*     Searching directories is a little more difficult. */
-
-/*     The directory contains epochs 100, 200, and so on. Once we */
-/*     find the first directory epoch greater than or equal to ET, */
-/*     we can grab the corresponding set of 100 record epochs, and */
-/*     search them. */
-
-    i__1 = ndir;
-    for (i__ = 1; i__ <= i__1; ++i__) {
-	i__2 = offd + i__;
-	i__3 = offd + i__;
-	dafgda_(handle, &i__2, &i__3, data);
-	if (data[0] >= *et) {
-	    off = offe + (i__ - 1) * 100;
-	    i__2 = off + 1;
-	    i__3 = off + 100;
-	    dafgda_(handle, &i__2, &i__3, data);
-	    recno = (i__ - 1) * 100 + lstltd_(et, &c__100, data) + 1;
-	    offr = begin - 1 + (recno - 1) * 71;
-	    i__2 = offr + 1;
-	    i__3 = offr + 71;
-	    dafgda_(handle, &i__2, &i__3, record);
-	    chkout_("SPKR01", (ftnlen)6);
-	    return 0;
-	}
-    }
-
-/*     If ET is greater than the final directory epoch, we want one */
-/*     of the final records. */
+/*     than or equal to ET. */
 
-    i__ = nrec % 100;
-    i__1 = end - ndir - i__;
-    i__2 = end - ndir - 1;
-    dafgda_(handle, &i__1, &i__2, data);
-    recno = ndir * 100 + lstltd_(et, &i__, data) + 1;
+    zzmdaloc_(handle, &begin, &nrec, &offe, et, &recno);
     offr = begin - 1 + (recno - 1) * 71;
     i__1 = offr + 1;
     i__2 = offr + 71;
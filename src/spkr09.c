@@ -42,6 +42,18 @@ static integer c__6 = 6;
     integer wndsiz;
     extern logical return_(void), odd_(integer *);
     integer end, low;
+    static integer svbeg = -1;
+    static integer svdeg = -1;
+    static integer svfrst = -1;
+    static integer svhan = 0;
+    static integer svlow = -1;
+    static integer svn = -1;
+    static logical svok = FALSE_;
+    static doublereal svrec[198];
+    static doublereal svthi = 0.;
+    static doublereal svtlo = 0.;
+    extern logical failed_(void);
+    extern /* Subroutine */ int moved_(doublereal *, integer *, doublereal *);
 
 /* $ Abstract */
 
@@ -155,6 +167,13 @@ static integer c__6 = 6;
 /*     See the SPK Required Reading file for a description of the */
 /*     structure of a data type 9 segment. */
 
+/*     The record returned by the previous call is saved, along with */
+/*     the pair of epochs that bracketed the previous request time. */
+/*     When a request time in the same segment lies in the same */
+/*     bracket and selects the same states, the saved record is */
+/*     returned without reading the segment, so that a sweep of */
+/*     closely spaced epochs reads each record once. */
+
 /* $ Examples */
 
 /*     The data returned by the SPKRnn routine is in its rawest form, */
@@ -277,6 +296,44 @@ static integer c__6 = 6;
 	return 0;
     }
 
+/*     If the request time lies in the bracket found by the previous */
+/*     call for this segment, the bracketing epochs are the same, and */
+/*     so are the states selected, unless the choice of the nearest */
+/*     epoch differs. In that case the saved record is the one needed. */
+
+    if (svok && *handle == svhan && begin == svbeg && *et > svtlo && *et 
+	    <= svthi) {
+	degree = svdeg;
+	n = svn;
+	wndsiz = degree + 1;
+	low = svlow;
+	high = low + 1;
+	if (odd_(&wndsiz)) {
+	    if ((d__1 = *et - svtlo, abs(d__1)) < (d__2 = *et - svthi, abs(
+		    d__2))) {
+		near__ = low;
+	    } else {
+		near__ = high;
+	    }
+/* Computing MIN */
+/* Computing MAX */
+	    i__3 = near__ - degree / 2;
+	    i__1 = max(i__3,1), i__2 = n - degree;
+	    first = min(i__1,i__2);
+	} else {
+/* Computing MIN */
+/* Computing MAX */
+	    i__3 = low - degree / 2;
+	    i__1 = max(i__3,1), i__2 = n - degree;
+	    first = min(i__1,i__2);
+	}
+	if (first == svfrst) {
+	    i__1 = wndsiz * 7 + 1;
+	    moved_(svrec, &i__1, record);
+	    return 0;
+	}
+    }
+
 /*     From this point onward, we assume the segment was constructed */
 /*     correctly.  In particular, we assume: */
 
@@ -480,6 +537,27 @@ static integer c__6 = 6;
     i__1 = start + 1;
     i__2 = start + wndsiz;
     dafgda_(handle, &i__1, &i__2, &record[wndsiz * 6 + 1]);
+
+/*     Save the record and the epochs bracketing the request time. */
+/*     The bracket is that of LOW even if the request time matched */
+/*     the first epoch of the segment. */
+
+    if (! failed_()) {
+	svhan = *handle;
+	svbeg = begin;
+	svdeg = degree;
+	svn = n;
+	svlow = low;
+	svfrst = first;
+	i__ = max(i__,1);
+	svtlo = buffer[(i__1 = i__ - 1) < 101 && 0 <= i__1 ? i__1 : s_rnge(
+		"buffer", i__1, "spkr09_", (ftnlen)530)];
+	svthi = buffer[(i__1 = i__) < 101 && 0 <= i__1 ? i__1 : s_rnge(
+		"buffer", i__1, "spkr09_", (ftnlen)531)];
+	i__1 = wndsiz * 7 + 1;
+	moved_(record, &i__1, svrec);
+	svok = TRUE_;
+    }
     return 0;
 } /* spkr09_ */
 
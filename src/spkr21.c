@@ -10,21 +10,20 @@
 static integer c__2 = 2;
 static integer c__6 = 6;
 static integer c__25 = 25;
-static integer c__100 = 100;
 
 /* $Procedure      SPKR21 ( Read SPK record from segment, type 21 ) */
 /* Subroutine */ int spkr21_(integer *handle, doublereal *descr, doublereal *
 	et, doublereal *record)
 {
     /* System generated locals */
-    integer i__1, i__2, i__3;
+    integer i__1, i__2;
 
     /* Builtin functions */
     integer i_dnnt(doublereal *);
 
     /* Local variables */
     doublereal data[100];
-    integer offd, offe, nrec, ndir, offr, i__, begin;
+    integer offe, nrec, ndir, offr, begin;
     extern /* Subroutine */ int chkin_(char *, ftnlen), dafus_(doublereal *, 
 	    integer *, integer *, doublereal *, integer *);
     integer recno;
@@ -35,9 +34,10 @@ static integer c__100 = 100;
     extern /* Subroutine */ int sigerr_(char *, ftnlen), chkout_(char *, 
 	    ftnlen), setmsg_(char *, ftnlen), errint_(char *, integer *, 
 	    ftnlen);
-    extern integer lstltd_(doublereal *, integer *, doublereal *);
+    extern /* Subroutine */ int zzmdaloc_(integer *, integer *, integer *, 
+	    integer *, doublereal *, integer *);
     extern logical return_(void);
-    integer end, off;
+    integer end;
 
 /* $ Abstract */
 
@@ -229,6 +229,10 @@ static integer c__100 = 100;
 /*     See the SPK Required Reading file for a description of the */
 /*     structure of a data type 21 segment. */
 
+/*     The record is located by ZZMDALOC, which keeps the record epochs */
+/*     of recently used segments in memory and searches them by */
+/*     bisection, rather than by reading the epoch directory. */
+
 /* $ Examples */
 
 /*     The data returned by the SPKRnn routine is in its rawest form, */
@@ -312,8 +316,6 @@ static integer c__100 = 100;
 
 /*        NDIR      The number of directory epochs. */
 
-/*        OFFD      The offset of the first directory epoch. */
-
 /*        OFFE      The offset of the first epoch. */
 
 
@@ -325,8 +327,7 @@ static integer c__100 = 100;
     dafgda_(handle, &i__1, &end, data);
     nrec = i_dnnt(&data[1]);
     ndir = nrec / 100;
-    offd = end - ndir - 2;
-    offe = offd - nrec;
+    offe = end - ndir - nrec - 2;
     maxdim = i_dnnt(data);
     if (maxdim > 25) {
 	setmsg_("The input record has a maximum table dimension of #, while "
@@ -354,57 +355,9 @@ static integer c__100 = 100;
 /*     segment, grab it, and go. But how to find it? */
 
 /*     Ultimately, we want the first record whose epoch is greater */
-/*     than or equal to ET. If there are BUFSIZ or fewer records, all */
-/*     the record epochs can be examined in a single group. */
-
-    if (nrec <= 100) {
-	i__1 = offe + 1;
-	i__2 = offe + nrec;
-	dafgda_(handle, &i__1, &i__2, data);
-	recno = lstltd_(et, &nrec, data) + 1;
-	offr = begin - 1 + (recno - 1) * dflsiz;
-	i__1 = offr + 1;
-	i__2 = offr + dflsiz;
-	dafgda_(handle, &i__1, &i__2, &record[1]);
-	chkout_("SPKR21", (ftnlen)6);
-	return 0;
-    }
-
-/*     Searching directories is a little more difficult. */
-
-/*     The directory contains epochs BUFSIZ, 2*BUFSIZ, and so on. Once */
-/*     we find the first directory epoch greater than or equal to ET, we */
-/*     can grab the corresponding set of BUFSIZ record epochs, and */
-/*     search them. */
-
-    i__1 = ndir;
-    for (i__ = 1; i__ <= i__1; ++i__) {
-	i__2 = offd + i__;
-	i__3 = offd + i__;
-	dafgda_(handle, &i__2, &i__3, data);
-	if (data[0] >= *et) {
-	    off = offe + (i__ - 1) * 100;
-	    i__2 = off + 1;
-	    i__3 = off + 100;
-	    dafgda_(handle, &i__2, &i__3, data);
-	    recno = (i__ - 1) * 100 + lstltd_(et, &c__100, data) + 1;
-	    offr = begin - 1 + (recno - 1) * dflsiz;
-	    i__2 = offr + 1;
-	    i__3 = offr + dflsiz;
-	    dafgda_(handle, &i__2, &i__3, &record[1]);
-	    chkout_("SPKR21", (ftnlen)6);
-	    return 0;
-	}
-    }
-
-/*     If ET is greater than the final directory epoch, we want one */
-/*     of the final records. */
+/*     than or equal to ET. */
 
-    i__ = nrec % 100;
-    i__1 = end - ndir - i__ - 1;
-    i__2 = end - ndir - 2;
-    dafgda_(handle, &i__1, &i__2, data);
-    recno = ndir * 100 + lstltd_(et, &i__, data) + 1;
+    zzmdaloc_(handle, &begin, &nrec, &offe, et, &recno);
     offr = begin - 1 + (recno - 1) * dflsiz;
     i__1 = offr + 1;
     i__2 = offr + dflsiz;
@@ -440,6 +440,27 @@
            is interpreted as Year Day-of-Year.  However, I-I/ is
            regarded as ambiguous.
 
+   Fast Path for Fixed-Format UTC Strings
+   --------------------------------------
+
+   When the TIMDEF defaults have not been changed, strings in the
+   fixed formats
+
+      YYYY-MM-DDThh:mm:ss.fff...
+      YYYY-MM-DD hh:mm:ss.fff...
+      YYYY-DDDThh:mm:ss.fff...
+      YYYY-DDD//hh:mm:ss.fff...
+      YYYY-DDD::hh:mm:ss.fff...
+
+   (as well as their truncations to hours or minutes, and bare
+   YYYY-MM-DD dates) are converted without invoking the general
+   parser, using a buffered copy of the leapseconds kernel data. The
+   results are identical to those of the general parser. Strings
+   with any other form, and strings containing leapseconds, are
+   handled by the general parser as described below.
+
+   To convert arrays of strings, see str2etv_c.
+
 -Examples
 
 
@@ -574,9 +595,15 @@
    C.H. Acton         (JPL)
    N.J. Bachman       (JPL)
    W.L. Taber         (JPL)
+   Nabla Zero Labs
 
 -Version
 
+   -CSPICE Version 1.2.0, 18-OCT-2026 (NZL)
+
+      Added fast path for fixed-format ISO-8601 and day-of-year UTC
+      strings.
+
    -CSPICE Version 1.1.5, 02-NOV-2009   (CHA)
 
       A few minor grammar fixes in the header.
@@ -616,6 +643,11 @@
 
 { /* Begin str2et_c */
 
+   /*
+   Local variables
+   */
+   SpiceBoolean            found;
+
    /*
    Participate in error tracing.
    */
@@ -629,6 +661,22 @@
    CHKFSTR ( CHK_STANDARD, "str2et_c", str );
 
 
+   /*
+   Fixed-format ISO and day-of-year UTC strings are converted
+   directly; everything else goes through the f2c'd parser.
+   */
+   if (  !return_c()  &&  zzutcrdy_c()  )
+   {
+      zzutcfst_c ( str, et, &found );
+
+      if ( found )
+      {
+         chkout_c ( "str2et_c" );
+         return;
+      }
+   }
+
+
    /*
    Call the f2c'd Fortran routine.
    */
@@ -0,0 +1,245 @@
+/*
+
+-Procedure str2etv_c ( String array to ET )
+
+-Abstract
+
+   Convert an array of strings representing epochs to an array of
+   double precision values representing the number of TDB seconds
+   past the J2000 epoch corresponding to the input epochs.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   TIME
+
+-Keywords
+
+   TIME
+
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZst.h"
+   #include "SpiceZmc.h"
+
+
+   void str2etv_c ( SpiceInt          n,
+                    SpiceInt          lenstr,
+                    const void      * strs,
+                    SpiceDouble     * ets    )
+
+/*
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   n          I   Number of strings to convert.
+   lenstr     I   Declared length of the strings in `strs'.
+   strs       I   Array of strings representing epochs.
+   ets        O   The equivalent values in seconds past J2000, TDB.
+
+-Detailed_Input
+
+   n          is the number of strings in the array `strs'.
+
+   lenstr     is the declared length of each string in `strs',
+              including the null terminator.
+
+   strs       is an array of strings representing epochs.  `strs'
+              should be declared as
+
+                 SpiceChar   strs [n][lenstr];
+
+              Any string accepted by str2et_c may appear in the
+              array.
+
+-Detailed_Output
+
+   ets        is an array of `n' double precision numbers of TDB
+              seconds past the J2000 epoch.  Element i of `ets'
+              corresponds to element i of `strs'.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1) If any string of `strs' cannot be converted, the error is
+      diagnosed by the routine str2et_c, and this routine returns
+      immediately.  Elements of `ets' at and after the offending
+      string are not modified.
+
+   2) The error SPICE(EMPTYSTRING) is signaled if any string of
+      `strs' is empty.
+
+   3) The error SPICE(NULLPOINTER) is signaled if `strs' is null.
+
+   4) The error SPICE(STRINGTOOSHORT) is signaled if `lenstr' is
+      less than 2.
+
+   5) If `n' is less than 1, this routine returns without modifying
+      `ets'.
+
+-Files
+
+   A leapseconds kernel must be loaded.
+
+-Particulars
+
+   This routine is functionally equivalent to calling str2et_c for
+   each string in `strs'.  It is faster when the strings are in one
+   of the fixed ISO-8601 or day-of-year formats listed in the header
+   of str2et_c, since the check of the time defaults and of the
+   kernel pool performed by str2et_c is made once for the whole
+   array, and the leapseconds table lookup begins at the interval
+   used for the preceding string.
+
+   Strings of other forms may be freely mixed with fixed-format
+   strings; each of those is converted by the general parser.
+
+-Examples
+
+   1) Convert a set of telemetry time tags to ET.
+
+      #include <stdio.h>
+      #include "SpiceUsr.h"
+
+      #define  N       3
+      #define  LNSIZE  32
+
+      int main()
+      {
+         SpiceChar    strs [N][LNSIZE] =
+                      {
+                         "2016-12-31T23:59:58.5",
+                         "2017-001T00:00:00.25",
+                         "Jan 1 2017 00:00:01 UTC"
+                      };
+
+         SpiceDouble  ets  [N];
+         SpiceInt     i;
+
+         furnsh_c  ( "naif0012.tls" );
+
+         str2etv_c ( N, LNSIZE, strs, ets );
+
+         for ( i = 0;  i < N;  i++ )
+         {
+            printf ( "%-26s %18.6f\n", strs[i], ets[i] );
+         }
+
+         return ( 0 );
+      }
+
+-Restrictions
+
+   None.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   Convert an array of strings to TDB seconds past J2000
+
+-&
+*/
+
+{ /* Begin str2etv_c */
+
+   /*
+   Local variables
+   */
+   ConstSpiceChar        * str;
+
+   SpiceBoolean            found;
+   SpiceBoolean            ready;
+
+   SpiceInt                i;
+
+
+   /*
+   Participate in error tracing.
+   */
+   if ( return_c() )
+   {
+      return;
+   }
+   chkin_c ( "str2etv_c" );
+
+   /*
+   Make sure the input string array pointer is non-null and the
+   declared string length is sufficient.
+   */
+   CHKOSTR ( CHK_STANDARD, "str2etv_c", strs, lenstr );
+
+
+   ready = zzutcrdy_c();
+
+   for ( i = 0;  i < n;  i++ )
+   {
+      str = ( (ConstSpiceChar *) strs ) + ( i * lenstr );
+
+      CHKFSTR ( CHK_STANDARD, "str2etv_c", str );
+
+      if ( ready )
+      {
+         zzutcfst_c ( str, ets+i, &found );
+
+         if ( found )
+         {
+            continue;
+         }
+      }
+
+      str2et_ ( ( char       * ) str,
+                ( doublereal * ) ( ets+i ),
+                ( ftnlen       ) strlen(str)  );
+
+      if ( failed_c() )
+      {
+         break;
+      }
+   }
+
+
+   chkout_c ( "str2etv_c" );
+
+} /* End str2etv_c */
@@ -0,0 +1,289 @@
+/*
+
+-Procedure termpr_c ( Terminator points, range of cutting half-planes )
+
+-Abstract
+
+   Find terminator points on a target body for a contiguous range of
+   the cutting half-planes used by termpt_c.  The results of calls for
+   successive ranges, placed one after another, are those of a single
+   call to termpt_c for all of the cutting half-planes.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   CK
+   DSK
+   FRAMES
+   NAIF_IDS
+   PCK
+   SPK
+   TIME
+
+-Keywords
+
+   DSK
+   GEOMETRY
+   SHADOW
+   TERMINATOR
+
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZst.h"
+   #include "SpiceZmc.h"
+   #undef termpr_c
+
+   void termpr_c ( ConstSpiceChar    * method,
+                   ConstSpiceChar    * ilusrc,
+                   ConstSpiceChar    * target,
+                   SpiceDouble         et,
+                   ConstSpiceChar    * fixref,
+                   ConstSpiceChar    * abcorr,
+                   ConstSpiceChar    * corloc,
+                   ConstSpiceChar    * obsrvr,
+                   ConstSpiceDouble    refvec[3],
+                   SpiceDouble         rolstp,
+                   SpiceInt            first,
+                   SpiceInt            ncuts,
+                   SpiceDouble         schstp,
+                   SpiceDouble         soltol,
+                   SpiceInt            maxn,
+                   SpiceInt            npts  [],
+                   SpiceDouble         points[][3],
+                   SpiceDouble         epochs[],
+                   SpiceDouble         trmvcs[][3]  )
+/*
+
+-Brief_I/O
+
+   Variable  I/O  Description
+   --------  ---  --------------------------------------------------
+   method     I   Computation method.
+   ilusrc     I   Illumination source.
+   target     I   Name of target body.
+   et         I   Epoch in ephemeris seconds past J2000 TDB.
+   fixref     I   Body-fixed, body-centered target body frame.
+   abcorr     I   Aberration correction.
+   corloc     I   Aberration correction locus.
+   obsrvr     I   Name of observing body.
+   refvec     I   Reference vector for cutting half-planes.
+   rolstp     I   Roll angular step for cutting half-planes.
+   first      I   Index of the first cutting half-plane of the range.
+   ncuts      I   Number of cutting half-planes in the range.
+   schstp     I   Angular step size for searching.
+   soltol     I   Solution convergence tolerance.
+   maxn       I   Maximum number of entries in output arrays.
+   npts       O   Counts of terminator points corresponding to cuts.
+   points     O   Terminator points.
+   epochs     O   Times associated with terminator points.
+   trmvcs     O   Terminator vectors emanating from the observer.
+
+-Detailed_Input
+
+   first    is the zero-based index of the first cutting half-plane
+            to process.  The cutting half-planes processed by this
+            routine are those at the roll angles
+
+               ( first + i ) * rolstp,   i = 0, ..., ncuts-1
+
+            about the illumination source-target axis, measured from
+            `refvec'.
+            These are the half-planes having indices `first' through
+            first+ncuts-1 in a call to termpt_c using the same
+            `refvec' and `rolstp'.
+
+   ncuts    is the number of cutting half-planes in the range.
+
+   All other inputs have the meanings given in the header of
+   termpt_c.
+
+-Detailed_Output
+
+   npts,
+   points,
+   epochs,
+   trmvcs   have the meanings given in the header of termpt_c, for
+            the cutting half-planes of the range.  Element i of
+            `npts' applies to the half-plane having index first+i.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1)  If `first' is negative, the error SPICE(INVALIDINDEX) is
+       signaled.
+
+   2)  If any input string argument pointer is null, the error
+       SPICE(NULLPOINTER) is signaled.
+
+   3)  If any input string argument is empty, the error
+       SPICE(EMPTYSTRING) is signaled.
+
+   4)  All other errors are diagnosed by termpt_c.
+
+-Files
+
+   See termpt_c.
+
+-Particulars
+
+   A terminator computation for a high-resolution DSK shape model over a
+   large number of cutting half-planes is dominated by the tangent
+   ray search performed for each half-plane, and the searches for
+   different half-planes are independent.  CSPICE itself is not
+   thread-safe; this routine allows the half-planes to be divided
+   among separate processes, each having loaded the same kernels,
+   or among calls interleaved with other work in one process.
+
+   The outputs of calls covering consecutive ranges of half-planes,
+   concatenated in order of `first', equal those of one call to
+   termpt_c covering all of the half-planes, with the exception
+   noted under Restrictions.
+
+-Examples
+
+   1)  Divide 3600 cutting half-planes among NWORK worker processes.
+       Worker k, k = 0, ..., NWORK-1, loads the kernels and makes
+       the call
+
+          first = ( 3600 * k     ) / NWORK;
+          last  = ( 3600 * (k+1) ) / NWORK;
+
+          termpr_c ( method, ilusrc, target, et,     fixref,
+                     abcorr, corloc, obsrvr, refvec, rolstp,
+                     first,  last-first,     schstp, soltol,
+                     MAXN,   npts,   points, epochs, trmvcs );
+
+       The parent process concatenates the workers' `npts',
+       `points', `epochs' and `trmvcs' arrays in order of k.
+
+-Restrictions
+
+   1)  When the "ELLIPSOID TERMINATOR" aberration correction locus is used
+       with light time corrections, termpt_c starts the light time
+       iteration for each half-plane from the light time found for
+       the previous one.  This routine starts the iteration for its
+       first half-plane from the light time of the target center, so
+       the results for that half-plane agree with those of a single
+       call only to within the convergence of the iteration.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   find terminator points for a range of cutting half-planes
+   divide terminator point computation among processes
+
+-&
+*/
+
+{ /* Begin termpr_c */
+
+   /*
+   Local variables
+   */
+   SpiceInt                zero = 0;
+
+
+   /*
+   Participate in error tracing.
+   */
+   chkin_c ( "termpr_c" );
+
+   /*
+   Check the input string arguments.
+   */
+   CHKFSTR ( CHK_STANDARD, "termpr_c", method );
+   CHKFSTR ( CHK_STANDARD, "termpr_c", ilusrc );
+   CHKFSTR ( CHK_STANDARD, "termpr_c", target );
+   CHKFSTR ( CHK_STANDARD, "termpr_c", fixref );
+   CHKFSTR ( CHK_STANDARD, "termpr_c", abcorr );
+   CHKFSTR ( CHK_STANDARD, "termpr_c", corloc );
+   CHKFSTR ( CHK_STANDARD, "termpr_c", obsrvr );
+
+   if ( first < 0 )
+   {
+      setmsg_c ( "The index of the first cutting half-plane was #; "
+                 "it must be non-negative."                         );
+      errint_c ( "#",  first                                        );
+      sigerr_c ( "SPICE(INVALIDINDEX)"                              );
+      chkout_c ( "termpr_c"                                         );
+      return;
+   }
+
+   /*
+   Select the range of half-planes and call the f2c'd SPICELIB
+   function.  The index is restored whether or not the call
+   succeeds.
+   */
+   zzcutset_ ( ( integer * ) &first );
+
+   termpt_ ( ( char         * ) method,
+             ( char         * ) ilusrc,
+             ( char         * ) target,
+             ( doublereal   * ) &et,
+             ( char         * ) fixref,
+             ( char         * ) abcorr,
+             ( char         * ) corloc,
+             ( char         * ) obsrvr,
+             ( doublereal   * ) refvec,
+             ( doublereal   * ) &rolstp,
+             ( integer      * ) &ncuts,
+             ( doublereal   * ) &schstp,
+             ( doublereal   * ) &soltol,
+             ( integer      * ) &maxn,
+             ( integer      * ) npts,
+             ( doublereal   * ) points,
+             ( doublereal   * ) epochs,
+             ( doublereal   * ) trmvcs,
+             ( ftnlen         ) strlen(method),
+             ( ftnlen         ) strlen(ilusrc),
+             ( ftnlen         ) strlen(target),
+             ( ftnlen         ) strlen(fixref),
+             ( ftnlen         ) strlen(abcorr),
+             ( ftnlen         ) strlen(corloc),
+             ( ftnlen         ) strlen(obsrvr)  );
+
+   zzcutset_ ( ( integer * ) &zero );
+
+   chkout_c ( "termpr_c" );
+
+} /* End termpr_c */
@@ -76,6 +76,9 @@ static integer c__0 = 0;
 	    zzsudski_(integer *, integer *, integer *, integer *), zzctruin_(
 	    integer *);
     integer i__, j;
+    extern /* Subroutine */ int zzcutget_(integer *);
+    integer fcut, cutidx;
+    extern /* Subroutine */ int zztrkcut_(integer *);
     extern integer cardd_(doublereal *);
     extern /* Subroutine */ int zzsrftrk_(integer *, logical *), zzprsmet_(
 	    integer *, char *, integer *, char *, char *, logical *, integer *
@@ -3026,6 +3029,12 @@ static integer c__0 = 0;
 	prvtrg = trgcde;
     }
 
+/*     Fetch the index of the first cutting half-plane to process. */
+/*     This is zero unless the call is made on behalf of a routine */
+/*     that processes a set of cutting half-planes in portions. */
+
+    zzcutget_(&fcut);
+
 /*     Set up activities are complete at this point. */
 
 
@@ -3098,7 +3107,7 @@ static integer c__0 = 0;
 
 	i__1 = *ncuts;
 	for (i__ = 1; i__ <= i__1; ++i__) {
-	    roll = (i__ - 1) * *rolstp;
+	    roll = (fcut + i__ - 1) * *rolstp;
 
 /*           Rotation of the half-planes is in the positive */
 /*           sense about AXIS. */
@@ -3128,6 +3137,8 @@ static integer c__0 = 0;
 /*                 The location of the center of the source is passed */
 /*                 to the tangent utilities instead. */
 
+		    cutidx = fcut + i__ - 1;
+		    zztrkcut_(&cutidx);
 		    zztangnt_(&shadow, &ilurad, &shape, &trgcde, &nsurf, 
 			    srflst, &fxfcde, &trgepc, plnvec, axis, schstp, 
 			    soltol, result, pntbuf);
@@ -3285,7 +3296,7 @@ static integer c__0 = 0;
 
 	i__1 = *ncuts;
 	for (i__ = 1; i__ <= i__1; ++i__) {
-	    roll = (i__ - 1) * *rolstp;
+	    roll = (fcut + i__ - 1) * *rolstp;
 	    if (uselt) {
 
 /*              We'll do an independent light time and stellar */
@@ -3483,6 +3494,8 @@ static integer c__0 = 0;
 /*              Note that the evaluation epoch for the surface is */
 /*              corrected for light time. */
 
+		cutidx = fcut + i__ - 1;
+		zztrkcut_(&cutidx);
 		zztangnt_(&shadow, &ilurad, &shape, &trgcde, &nsurf, srflst, &
 			fxfcde, &epoch, plnvec, axis, schstp, soltol, result, 
 			pntbuf);
@@ -0,0 +1,770 @@
+/*
+
+-Procedure timoutv_c ( Time output, vectorized )
+
+-Abstract
+
+   Convert an array of epochs, expressed as seconds past J2000 TDB,
+   to strings using a format picture compiled by timpln_c.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   TIME
+
+-Keywords
+
+   TIME
+
+*/
+
+   #include <math.h>
+   #include <string.h>
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZmc.h"
+   #include "SpiceZst.h"
+
+   /*
+   Local parameters
+   */
+   #define  DN2000         730119
+   #define  SECSPD         86400.0
+   #define  HALFD          43200.0
+
+   /*
+   Length of the internal output buffer of TIMOUT.
+   */
+   #define  STRLEN         256
+
+   /*
+   Prototypes of local functions
+   */
+   static SpiceBoolean     fmtone  ( ConstSpiceTimePlan  * plan,
+                                     SpiceInt              system,
+                                     SpiceInt              calendar,
+                                     SpiceDouble           et,
+                                     SpiceChar           * string );
+
+   static void             rmaind  ( SpiceDouble           num,
+                                     SpiceDouble           denom,
+                                     SpiceDouble         * q,
+                                     SpiceDouble         * rem    );
+
+
+   void timoutv_c ( ConstSpiceTimePlan  * plan,
+                    SpiceInt              n,
+                    ConstSpiceDouble    * ets,
+                    SpiceInt              lenout,
+                    void                * output )
+
+/*
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   plan       I   Time format picture compiled by timpln_c.
+   n          I   Number of epochs to convert.
+   ets        I   Epochs in seconds past J2000 TDB.
+   lenout     I   Declared length of the strings in `output'.
+   output     O   Strings representing the epochs.
+
+-Detailed_Input
+
+   plan       is a time format picture compiled by timpln_c.
+
+   n          is the number of epochs in `ets'.
+
+   ets        is an array of epochs expressed in seconds past
+              J2000 TDB.
+
+   lenout     is the declared length of each string in `output',
+              including the null terminator.
+
+-Detailed_Output
+
+   output     is an array of strings, declared as
+
+                 SpiceChar   output [n][lenout];
+
+              Element i of `output' is the string timout_c would
+              produce for `ets[i]' and the picture from which `plan'
+              was compiled, truncated to lenout-1 characters.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1) The error SPICE(NULLPOINTER) is signaled if `plan' or `output'
+      is null.
+
+   2) The error SPICE(STRINGTOOSHORT) is signaled if `lenout' is less
+      than 2.
+
+   3) If `n' is less than 1, this routine returns without modifying
+      `output'.
+
+   4) Errors detected by timout_c, such as the absence of a
+      leapseconds kernel, are signaled by the routines it calls.
+      This routine then returns immediately; elements of `output' at
+      and after the offending epoch are not modified.
+
+-Files
+
+   A leapseconds kernel must be loaded.
+
+-Particulars
+
+   This routine is functionally equivalent to calling timout_c for
+   each element of `ets' with the picture from which `plan' was
+   compiled.
+
+   When the plan was compiled for direct formatting (see timpln_c),
+   the time system and calendar defaults are checked, and the
+   leapseconds kernel variables are fetched, once per call.  Each
+   epoch is then converted to calendar components using the
+   arithmetic of the SPICELIB routines UNITIM and TTRANS, and the
+   components are written to the output string directly, with the
+   truncation or rounding rules of TIMOUT.
+
+   timout_c is used instead for any epoch that the direct formatter
+   does not handle:
+
+      -  epochs whose year lies outside the range 1000 to 9999, or
+         which fall before the adoption of the Gregorian calendar
+         when the mixed calendar is in effect;
+
+      -  any epoch, when the default time system is a time zone or
+         the default calendar is the Julian calendar and the picture
+         does not override the default;
+
+      -  any epoch, when the plan was not compiled for direct
+         formatting.
+
+-Examples
+
+   1) Write a table of epochs at 30.5 second intervals across the
+      leapsecond at the end of 2016.
+
+      #include <stdio.h>
+      #include "SpiceUsr.h"
+
+      #define  N       5
+      #define  LNSIZE  40
+
+      int main()
+      {
+         SpiceChar       strs [N][LNSIZE];
+
+         SpiceDouble     ets  [N];
+         SpiceDouble     et0;
+
+         SpiceInt        i;
+
+         SpiceTimePlan   plan;
+
+         furnsh_c  ( "naif0012.tls" );
+
+         str2et_c  ( "2016-12-31T23:58:00", &et0 );
+
+         for ( i = 0;  i < N;  i++ )
+         {
+            ets[i] = et0 + i * 30.5;
+         }
+
+         timpln_c  ( "YYYY-MM-DDTHR:MN:SC.### ::RND", &plan );
+         timoutv_c ( &plan, N, ets, LNSIZE, strs );
+
+         for ( i = 0;  i < N;  i++ )
+         {
+            printf ( "%s\n", strs[i] );
+         }
+
+         return ( 0 );
+      }
+
+      The program prints
+
+         2016-12-31T23:58:00.000
+         2016-12-31T23:58:30.500
+         2016-12-31T23:59:01.000
+         2016-12-31T23:59:31.500
+         2017-01-01T00:00:01.000
+
+-Restrictions
+
+   None.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   Convert an array of epochs to strings with a compiled picture
+
+-&
+*/
+
+{ /* Begin timoutv_c */
+
+   /*
+   Local variables
+   */
+   SpiceBoolean            direct;
+
+   SpiceChar               string [STRLEN+1];
+   SpiceChar               value  [STRLEN+1];
+   SpiceChar             * out;
+
+   SpiceInt                calendar;
+   SpiceInt                i;
+   SpiceInt                j;
+   SpiceInt                system;
+
+
+   /*
+   Participate in error tracing.
+   */
+   if ( return_c() )
+   {
+      return;
+   }
+   chkin_c ( "timoutv_c" );
+
+   CHKPTR  ( CHK_STANDARD, "timoutv_c", plan );
+   CHKOSTR ( CHK_STANDARD, "timoutv_c", output, lenout );
+
+   /*
+   Resolve the time system and calendar.  Markers in the picture
+   take precedence over the defaults.
+   */
+   direct   = plan->direct;
+   system   = plan->system;
+   calendar = plan->calendar;
+
+   if ( direct && ( system == 0 ) )
+   {
+      timdef_c ( "GET", "SYSTEM", STRLEN+1, value );
+
+      if ( eqstr_c ( value, "UTC" ) )
+      {
+         system = SPICE_TIMPLN_UTC;
+      }
+      else if ( eqstr_c ( value, "TDB" ) )
+      {
+         system = SPICE_TIMPLN_TDB;
+      }
+      else if ( eqstr_c ( value, "TDT" ) )
+      {
+         system = SPICE_TIMPLN_TDT;
+      }
+      else
+      {
+         direct = SPICEFALSE;
+      }
+   }
+
+   if ( direct && ( calendar == 0 ) )
+   {
+      timdef_c ( "GET", "CALENDAR", STRLEN+1, value );
+
+      if ( eqstr_c ( value, "GREGORIAN" ) )
+      {
+         calendar = SPICE_TIMPLN_GCAL;
+      }
+      else if ( eqstr_c ( value, "MIXED" ) )
+      {
+         calendar = SPICE_TIMPLN_MCAL;
+      }
+      else
+      {
+         direct = SPICEFALSE;
+      }
+   }
+
+   if ( failed_c() )
+   {
+      chkout_c ( "timoutv_c" );
+      return;
+   }
+
+   /*
+   The direct formatter needs the buffered leapseconds data.  If they
+   are not available, timout_c will diagnose the problem.
+   */
+   direct = direct && zzlskok_c();
+
+
+   for ( i = 0;  i < n;  i++ )
+   {
+      out = ( (SpiceChar *) output ) + ( i * lenout );
+
+      if (  direct
+            && fmtone ( plan, system, calendar, ets[i], string )  )
+      {
+         /*
+         Copy the string as timout_c would: truncate it to the
+         output length and drop trailing blanks.
+         */
+         strncpy ( out, string, lenout-1 );
+         out[lenout-1] = NULLCHAR;
+
+         j = (SpiceInt) strlen ( out );
+
+         while ( ( j > 0 ) && ( out[j-1] == ' ' ) )
+         {
+            j -= 1;
+         }
+
+         out[j] = NULLCHAR;
+
+         continue;
+      }
+
+      timout_ ( ( doublereal * ) ( ets+i ),
+                ( char       * ) plan->pictur,
+                ( char       * ) out,
+                ( ftnlen       ) strlen(plan->pictur),
+                ( ftnlen       ) lenout-1              );
+
+      F2C_ConvertStr ( lenout, out );
+
+      if ( failed_c() )
+      {
+         break;
+      }
+   }
+
+
+   chkout_c ( "timoutv_c" );
+
+} /* End timoutv_c */
+
+
+
+
+/*
+   Format one epoch using a compiled picture.  The output is written
+   to `string', which must have room for STRLEN+1 characters.  The
+   function returns SPICEFALSE, without producing output, if the
+   epoch is outside the range handled directly.
+*/
+static SpiceBoolean fmtone ( ConstSpiceTimePlan  * plan,
+                             SpiceInt              system,
+                             SpiceInt              calendar,
+                             SpiceDouble           et,
+                             SpiceChar           * string )
+{
+   /*
+   Local parameters
+   */
+   static ConstSpiceChar * names [6][12] =
+   {
+      { "JAN",       "FEB",       "MAR",       "APR",
+        "MAY",       "JUN",       "JUL",       "AUG",
+        "SEP",       "OCT",       "NOV",       "DEC"       },
+      { "Jan",       "Feb",       "Mar",       "Apr",
+        "May",       "Jun",       "Jul",       "Aug",
+        "Sep",       "Oct",       "Nov",       "Dec"       },
+      { "jan",       "feb",       "mar",       "apr",
+        "may",       "jun",       "jul",       "aug",
+        "sep",       "oct",       "nov",       "dec"       },
+      { "JANUARY",   "FEBRUARY",  "MARCH",     "APRIL",
+        "MAY",       "JUNE",      "JULY",      "AUGUST",
+        "SEPTEMBER", "OCTOBER",   "NOVEMBER",  "DECEMBER"  },
+      { "January",   "February",  "March",     "April",
+        "May",       "June",      "July",      "August",
+        "September", "October",   "November",  "December"  },
+      { "january",   "february",  "march",     "april",
+        "may",       "june",      "july",      "august",
+        "september", "october",   "november",  "december"  }
+   };
+
+   static SpiceInt         dpjan0 [12] =
+                           { 0,31,59,90,120,151,181,212,243,273,304,334 };
+
+   static SpiceInt         dpbegl [12] =
+                           { 0,31,60,91,121,152,182,213,244,274,305,335 };
+
+   static SpiceDouble      power  [10] =
+                           { 1.e0, 1.e1, 1.e2, 1.e3, 1.e4,
+                             1.e5, 1.e6, 1.e7, 1.e8, 1.e9  };
+
+   /*
+   Local variables
+   */
+   ConstSpiceChar        * src;
+
+   SpiceChar               digits [16];
+
+   SpiceDouble             exsecs;
+   SpiceDouble             frac;
+   SpiceDouble             hours;
+   SpiceDouble             mins;
+   SpiceDouble             myet;
+   SpiceDouble             q;
+   SpiceDouble             secs;
+   SpiceDouble             tai;
+   SpiceDouble             tempd;
+   SpiceDouble             tsecs;
+   SpiceDouble             vsecs;
+   SpiceDouble             ptime;
+
+   SpiceInt                appnd;
+   SpiceInt                daynum;
+   SpiceInt                dofyr;
+   SpiceInt                day;
+   SpiceInt                i;
+   SpiceInt                isec;
+   SpiceInt                j;
+   SpiceInt                len;
+   SpiceInt                month;
+   SpiceInt                nd;
+   SpiceInt                rem;
+   SpiceInt                val;
+   SpiceInt                width;
+   SpiceInt                year;
+   SpiceInt                yr1;
+   SpiceInt                yr4;
+   SpiceInt                yr100;
+   SpiceInt                yr400;
+
+   long                    ifrac;
+
+   const SpiceInt        * table;
+
+
+   /*
+   Epochs far outside the supported years are not handled here; this
+   also protects the integer conversions below.
+   */
+   if (  !( fabs(et) < 1.e12 )  )
+   {
+      return ( SPICEFALSE );
+   }
+
+   /*
+   Convert the epoch to a day number and seconds into the day, as
+   TIMOUT does by way of UNITIM and TTRANS.
+   */
+   if ( system == SPICE_TIMPLN_UTC )
+   {
+      myet = zztdbtdt_c ( et ) + plan->pad;
+      tai  = zztdttai_c ( myet );
+
+      zztaiutc_c ( tai, &daynum, &secs );
+
+      if (  ( secs > SECSPD - 1.0 ) || ( secs < 0.0 )  )
+      {
+         tai = zzutctai_c ( daynum, secs );
+         zztaiutc_c ( tai, &daynum, &secs );
+      }
+   }
+   else
+   {
+      if ( system == SPICE_TIMPLN_TDB )
+      {
+         myet = et + plan->pad;
+      }
+      else
+      {
+         myet = zztdbtdt_c ( et ) + plan->pad;
+      }
+
+      rmaind ( myet + HALFD, SECSPD, &q, &secs );
+      daynum = (SpiceInt) q + DN2000;
+
+      rmaind ( secs, SECSPD, &q, &tsecs );
+      daynum += (SpiceInt) q;
+      secs    = tsecs;
+   }
+
+   /*
+   Break the day number into year, month and day.
+   */
+   yr400 = daynum / 146097;
+   rem   = daynum - yr400 * 146097;
+
+   if ( rem < 0 )
+   {
+      yr400 -= 1;
+      rem   += 146097;
+   }
+
+   yr100  = MinVal ( 3,  rem / 36524 );
+   rem   -= yr100 * 36524;
+
+   yr4    = MinVal ( 24, rem / 1461  );
+   rem   -= yr4 * 1461;
+
+   yr1    = MinVal ( 3,  rem / 365   );
+   rem   -= yr1 * 365;
+
+   dofyr  = rem + 1;
+   year   = yr400 * 400 + yr100 * 100 + yr4 * 4 + yr1 + 1;
+
+   if (    ( year < 1000 ) || ( year > 9999 )
+        || ( ( calendar == SPICE_TIMPLN_MCAL ) && ( year < 1583 ) )  )
+   {
+      return ( SPICEFALSE );
+   }
+
+   if (    ( year % 4 == 0 )
+        && ( ( year % 100 != 0 ) || ( year % 400 == 0 ) )  )
+   {
+      table = dpbegl;
+   }
+   else
+   {
+      table = dpjan0;
+   }
+
+   month = 12;
+
+   while ( table[month-1] >= dofyr )
+   {
+      month -= 1;
+   }
+
+   day = dofyr - table[month-1];
+
+   /*
+   Hours, minutes and seconds.  Seconds beyond 86399 belong to a
+   leapsecond and stay with the seconds component.
+   */
+   exsecs = MaxVal ( 0.0, secs - SECSPD + 1.0 );
+   tsecs  = secs - exsecs;
+
+   rmaind ( tsecs, 3600.0, &hours, &tempd );
+   rmaind ( tempd,   60.0, &mins,  &tsecs );
+
+   tsecs += exsecs;
+
+   /*
+   Assemble the string.
+   */
+   appnd = 0;
+
+   for ( i = 0;  i < plan->ntoks;  i++ )
+   {
+      width = 2;
+      nd    = 0;
+      val   = 0;
+      src   = digits;
+
+      switch ( plan->kind[i] )
+      {
+         case SPICE_TIMPLN_LITERAL:
+
+            src   = plan->pictur + plan->begin[i];
+            width = plan->size[i];
+            break;
+
+         case SPICE_TIMPLN_MONNAM:
+
+            src   = names[ plan->size[i] ][ month-1 ];
+            width = (SpiceInt) strlen ( src );
+            break;
+
+         case SPICE_TIMPLN_YEAR:
+
+            val   = year;
+            width = 4;
+            break;
+
+         case SPICE_TIMPLN_MONTH:
+
+            val   = month;
+            break;
+
+         case SPICE_TIMPLN_DAY:
+
+            val   = day;
+            break;
+
+         case SPICE_TIMPLN_DOY:
+
+            val   = dofyr;
+            width = 3;
+            break;
+
+         case SPICE_TIMPLN_HOUR:
+
+            val   = (SpiceInt) hours;
+            break;
+
+         case SPICE_TIMPLN_MINUTE:
+
+            val   = (SpiceInt) mins;
+            break;
+
+         default:
+
+            /*
+            Seconds.  When decimal places are requested, TIMOUT adds
+            to the seconds the difference between the epoch and the
+            epoch recovered from the truncated calendar components.
+            That difference is computed exactly as TTRANS would.
+            */
+            nd    = plan->size[i];
+            vsecs = tsecs;
+
+            if ( nd > 0 )
+            {
+               secs = hours * 3600.0 + mins * 60.0 + tsecs;
+               j    = daynum;
+
+               if ( system == SPICE_TIMPLN_UTC )
+               {
+                  if (  ( secs > SECSPD - 1.0 ) || ( secs < 0.0 )  )
+                  {
+                     tai = zzutctai_c ( j, secs );
+                     zztaiutc_c ( tai, &j, &secs );
+                  }
+
+                  ptime = zztaitdt_c ( zzutctai_c ( j, secs ) );
+               }
+               else
+               {
+                  rmaind ( secs, SECSPD, &q, &tempd );
+                  j    += (SpiceInt) q;
+                  ptime = (SpiceDouble)( j - DN2000 ) * SECSPD
+                          - HALFD + tempd;
+               }
+
+               frac   = brcktd_c ( myet - ptime, 0.0, 1.0 );
+               vsecs += frac;
+            }
+
+            /*
+            Truncate to the requested number of places, as TIMOUT
+            does.
+            */
+            frac = vsecs - ( (vsecs < 0.0) ? ceil(vsecs) : floor(vsecs) );
+
+            if ( frac < 0.0 )
+            {
+               vsecs -= 1.0;
+               frac  += 1.0;
+            }
+
+            isec  = (SpiceInt) floor ( vsecs );
+            ifrac = (long) floor ( frac * power[nd] );
+
+            if ( ( nd > 0 ) && ( ifrac >= (long) power[nd] ) )
+            {
+               ifrac -= (long) power[nd];
+               isec  += 1;
+            }
+
+            val   = isec;
+            break;
+      }
+
+      if ( src == digits )
+      {
+         digits[0] = (SpiceChar)( '0' + (val/10) % 10 );
+         digits[1] = (SpiceChar)( '0' +  val     % 10 );
+
+         if ( width == 3 )
+         {
+            digits[0] = (SpiceChar)( '0' + (val/100) % 10 );
+            digits[1] = (SpiceChar)( '0' + (val/10 ) % 10 );
+            digits[2] = (SpiceChar)( '0' +  val      % 10 );
+         }
+         else if ( width == 4 )
+         {
+            digits[0] = (SpiceChar)( '0' + (val/1000) % 10 );
+            digits[1] = (SpiceChar)( '0' + (val/100 ) % 10 );
+            digits[2] = (SpiceChar)( '0' + (val/10  ) % 10 );
+            digits[3] = (SpiceChar)( '0' +  val       % 10 );
+         }
+
+         if ( nd > 0 )
+         {
+            digits[width] = '.';
+
+            for ( j = nd;  j > 0;  j-- )
+            {
+               digits[width+j] = (SpiceChar)( '0' + ifrac % 10 );
+               ifrac          /= 10;
+            }
+
+            width += nd + 1;
+         }
+      }
+
+      len = MinVal ( width, STRLEN - appnd );
+
+      if ( len > 0 )
+      {
+         memcpy ( string+appnd, src, len );
+         appnd += len;
+      }
+   }
+
+   string[appnd] = NULLCHAR;
+
+   return ( SPICETRUE );
+}
+
+
+
+
+/*
+   Remainder with a non-negative result, as in the SPICELIB routine
+   RMAIND.
+*/
+static void rmaind ( SpiceDouble           num,
+                     SpiceDouble           denom,
+                     SpiceDouble         * q,
+                     SpiceDouble         * rem    )
+{
+   SpiceDouble             x;
+
+   x    = num / denom;
+   *q   = ( x < 0.0 ) ? ceil(x) : floor(x);
+   *rem = num - (*q) * denom;
+
+   if ( *rem < 0.0 )
+   {
+      *q   -= 1.0;
+      *rem += denom;
+   }
+}
@@ -0,0 +1,497 @@
+/*
+
+-Procedure timpln_c ( Compile a time format picture )
+
+-Abstract
+
+   Compile a time format picture into a plan that timoutv_c can use
+   to convert many epochs to strings without re-examining the
+   picture.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   TIME
+
+-Keywords
+
+   TIME
+
+*/
+
+   #include <string.h>
+   #include "SpiceUsr.h"
+   #include "SpiceZmc.h"
+
+
+   void timpln_c ( ConstSpiceChar   * pictur,
+                   SpiceTimePlan    * plan    )
+
+/*
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   pictur     I   A format specification for output time strings.
+   plan       O   Compiled form of `pictur'.
+
+-Detailed_Input
+
+   pictur     is a format picture of the kind accepted by timout_c.
+              See the header of timout_c for a complete description
+              of the markers that may appear in it.
+
+-Detailed_Output
+
+   plan       is a compiled form of `pictur' that may be passed to
+              timoutv_c any number of times.
+
+              The plan records the tokens of the picture and the
+              rounding pad it implies.  It does not record the time
+              system or calendar defaults established by timdef_c;
+              those are examined by timoutv_c at each call, so the
+              plan remains valid if the defaults change.
+
+-Parameters
+
+   SPICE_TIMPLN_PICLEN   is the maximum length of `pictur', including
+                         the null terminator.  See SpiceTim.h.
+
+-Exceptions
+
+   1) The error SPICE(NULLPOINTER) is signaled if `pictur' is null.
+
+   2) The error SPICE(EMPTYSTRING) is signaled if `pictur' is empty.
+
+   3) The error SPICE(PICTURETOOLONG) is signaled if the length of
+      `pictur' is SPICE_TIMPLN_PICLEN or more.
+
+   Errors in the picture itself are not detected here; timout_c does
+   not signal errors for malformed pictures either.
+
+-Files
+
+   None.
+
+-Particulars
+
+   The SPICELIB routine TIMOUT tokenizes its picture, determines the
+   time system, calendar and rounding requested, and constructs a
+   numeric format for each component every time it is called.  When
+   many epochs are to be formatted with one picture, that work is
+   the same for every epoch.  This routine performs it once.
+
+   Pictures made up of the markers
+
+      YYYY  MM  DD  DOY  HR  MN  SC  SC.#...
+      MON  Mon  mon  MONTH  Month  month
+      ::UTC  ::TDB  ::TDT  ::RND  ::TRNC  ::GCAL  ::MCAL
+
+   and arbitrary literal text are compiled for direct formatting by
+   timoutv_c, which computes the calendar components and writes the
+   digits without constructing intermediate format strings.  Up to
+   nine decimal places may follow the seconds marker.
+
+   Any other picture is still accepted: timoutv_c then passes the
+   picture to timout_c for each epoch.  In every case the strings
+   produced by timoutv_c are identical to those produced by
+   timout_c.
+
+-Examples
+
+   See timoutv_c.
+
+-Restrictions
+
+   None.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   compile a time format picture
+
+-&
+*/
+
+{ /* Begin timpln_c */
+
+   /*
+   Local parameters
+   */
+
+   /*
+   Codes for markers that are not time components.
+   */
+   #define DECPT           20
+   #define PLACE           21
+   #define SYSTEM          22
+   #define CALNDR          23
+   #define ROUND           24
+   #define TRUNC           25
+   #define UNSUP           26
+
+   #define NMARKS          42
+
+   /*
+   Maximum number of decimal places formatted directly.
+   */
+   #define MAXDIG          9
+
+   /*
+   Local variables
+   */
+
+   /*
+   The markers recognized by TIMOUT, ordered so that a marker is
+   tried before any marker that is a prefix of it, with the token
+   code and argument assigned to each.  Zone markers and ::JCAL
+   carry a zero argument.
+   */
+   static struct
+   {
+      ConstSpiceChar     * mark;
+      SpiceInt             code;
+      SpiceInt             arg;
+   }
+   marks [NMARKS] =
+   {
+      { "WEEKDAY",  UNSUP,                0                   },
+      { "Weekday",  UNSUP,                0                   },
+      { "weekday",  UNSUP,                0                   },
+      { "JULIAND",  UNSUP,                0                   },
+      { "::UTC+",   SYSTEM,               0                   },
+      { "::UTC-",   SYSTEM,               0                   },
+      { "SP2000",   UNSUP,                0                   },
+      { "SP1950",   UNSUP,                0                   },
+      { "::TRNC",   TRUNC,                0                   },
+      { "::JCAL",   CALNDR,               0                   },
+      { "::GCAL",   CALNDR,               SPICE_TIMPLN_GCAL   },
+      { "::MCAL",   CALNDR,               SPICE_TIMPLN_MCAL   },
+      { "MONTH",    SPICE_TIMPLN_MONNAM,  3                   },
+      { "Month",    SPICE_TIMPLN_MONNAM,  4                   },
+      { "month",    SPICE_TIMPLN_MONNAM,  5                   },
+      { "::UTC",    SYSTEM,               SPICE_TIMPLN_UTC    },
+      { "::TDB",    SYSTEM,               SPICE_TIMPLN_TDB    },
+      { "::TDT",    SYSTEM,               SPICE_TIMPLN_TDT    },
+      { "::RND",    ROUND,                0                   },
+      { "?ERA?",    UNSUP,                0                   },
+      { "?era?",    UNSUP,                0                   },
+      { "YYYY",     SPICE_TIMPLN_YEAR,    0                   },
+      { "AMPM",     UNSUP,                0                   },
+      { "ampm",     UNSUP,                0                   },
+      { "MON",      SPICE_TIMPLN_MONNAM,  0                   },
+      { "Mon",      SPICE_TIMPLN_MONNAM,  1                   },
+      { "mon",      SPICE_TIMPLN_MONNAM,  2                   },
+      { "DOY",      SPICE_TIMPLN_DOY,     0                   },
+      { "WKD",      UNSUP,                0                   },
+      { "Wkd",      UNSUP,                0                   },
+      { "wkd",      UNSUP,                0                   },
+      { "ERA",      UNSUP,                0                   },
+      { "era",      UNSUP,                0                   },
+      { "YR",       UNSUP,                0                   },
+      { "MM",       SPICE_TIMPLN_MONTH,   0                   },
+      { "DD",       SPICE_TIMPLN_DAY,     0                   },
+      { "MN",       SPICE_TIMPLN_MINUTE,  0                   },
+      { "HR",       SPICE_TIMPLN_HOUR,    0                   },
+      { "SC",       SPICE_TIMPLN_SECOND,  0                   },
+      { ".#",       DECPT,                0                   },
+      { "AP",       UNSUP,                0                   },
+      { "#",        PLACE,                0                   }
+   };
+
+   /*
+   Rounding pads of the components, as in TIMOUT.  The table is
+   indexed by token type.
+   */
+   static SpiceDouble      pad   [SPICE_TIMPLN_MONNAM+1] =
+   {
+      0.0,
+      0.0,
+      0.5 * 60.0 * 60.0 * 24.0 * 365.0,
+      0.5 * 60.0 * 60.0 * 24.0 * 30.0,
+      0.5 * 60.0 * 60.0 * 24.0,
+      0.5 * 60.0 * 60.0 * 24.0,
+      0.5 * 60.0 * 60.0,
+      0.5 * 60.0,
+      0.5,
+      0.0
+   };
+
+   SpiceBoolean            calset;
+   SpiceBoolean            round;
+   SpiceBoolean            sysset;
+
+   SpiceDouble             factor;
+   SpiceDouble             incr;
+
+   SpiceInt                b;
+   SpiceInt                i;
+   SpiceInt                j;
+   SpiceInt                len;
+   SpiceInt                mlen;
+   SpiceInt                ntoks;
+   SpiceInt                pos;
+
+   SpiceInt                tokcod [SPICE_TIMPLN_PICLEN];
+   SpiceInt                tokarg [SPICE_TIMPLN_PICLEN];
+   SpiceInt                tokbeg [SPICE_TIMPLN_PICLEN];
+   SpiceInt                toklen [SPICE_TIMPLN_PICLEN];
+
+
+   /*
+   Participate in error tracing.
+   */
+   if ( return_c() )
+   {
+      return;
+   }
+   chkin_c ( "timpln_c" );
+
+   /*
+   Check the input picture.
+   */
+   CHKFSTR ( CHK_STANDARD, "timpln_c", pictur );
+
+   len = (SpiceInt) strlen ( pictur );
+
+   if ( len >= SPICE_TIMPLN_PICLEN )
+   {
+      setmsg_c ( "The length of the time picture is #; the maximum "
+                 "length is #."                                       );
+      errint_c ( "#", len                                             );
+      errint_c ( "#", SPICE_TIMPLN_PICLEN - 1                         );
+      sigerr_c ( "SPICE(PICTURETOOLONG)"                              );
+      chkout_c ( "timpln_c"                                           );
+      return;
+   }
+
+   strcpy ( plan->pictur, pictur );
+
+   plan->direct   = SPICETRUE;
+   plan->system   = 0;
+   plan->calendar = 0;
+   plan->pad      = 0.0;
+   plan->ntoks    = 0;
+
+   /*
+   Break the picture into tokens.  At each position the longest
+   marker that matches is taken; characters not starting any marker
+   are gathered into literal tokens.  Leading blanks are ignored, as
+   TIMOUT left-justifies the picture.
+   */
+   ntoks = 0;
+   pos   = 0;
+
+   while ( pictur[pos] == ' ' )
+   {
+      pos += 1;
+   }
+
+   while ( pos < len )
+   {
+      for ( i = 0;  i < NMARKS;  i++ )
+      {
+         mlen = (SpiceInt) strlen ( marks[i].mark );
+
+         if (    ( pos + mlen <= len )
+              && ( strncmp ( pictur+pos, marks[i].mark, mlen ) == 0 )  )
+         {
+            break;
+         }
+      }
+
+      if ( i < NMARKS )
+      {
+         tokcod[ntoks] = marks[i].code;
+         tokarg[ntoks] = marks[i].arg;
+         tokbeg[ntoks] = pos;
+         toklen[ntoks] = mlen;
+         ntoks        += 1;
+         pos          += mlen;
+      }
+      else if (    ( ntoks > 0 )
+                && ( tokcod[ntoks-1] == SPICE_TIMPLN_LITERAL ) )
+      {
+         toklen[ntoks-1] += 1;
+         pos             += 1;
+      }
+      else
+      {
+         tokcod[ntoks] = SPICE_TIMPLN_LITERAL;
+         tokarg[ntoks] = 0;
+         tokbeg[ntoks] = pos;
+         toklen[ntoks] = 1;
+         ntoks        += 1;
+         pos          += 1;
+      }
+   }
+
+   /*
+   As in TIMOUT, the first time system marker and the first calendar
+   marker take effect.  Time zones and the Julian calendar are left
+   to timout_c.
+   */
+   round  = SPICEFALSE;
+   sysset = SPICEFALSE;
+   calset = SPICEFALSE;
+
+   for ( i = 0;  i < ntoks;  i++ )
+   {
+      if ( ( tokcod[i] == SYSTEM ) && !sysset )
+      {
+         plan->system = tokarg[i];
+         sysset       = SPICETRUE;
+      }
+      else if ( ( tokcod[i] == CALNDR ) && !calset )
+      {
+         plan->calendar = tokarg[i];
+         calset         = SPICETRUE;
+      }
+      else if ( tokcod[i] == ROUND )
+      {
+         round = SPICETRUE;
+      }
+   }
+
+   if (    ( sysset && ( plan->system   == 0 ) )
+        || ( calset && ( plan->calendar == 0 ) )  )
+   {
+      plan->direct = SPICEFALSE;
+   }
+
+   /*
+   Collect the component and literal tokens, discarding the time
+   system, calendar and rounding markers.  A seconds marker absorbs
+   a following decimal point and place holders.
+   */
+   i = 0;
+
+   while ( ( i < ntoks ) && plan->direct )
+   {
+      if (    ( tokcod[i] == SYSTEM ) || ( tokcod[i] == CALNDR )
+           || ( tokcod[i] == ROUND  ) || ( tokcod[i] == TRUNC  ) )
+      {
+         i += 1;
+         continue;
+      }
+
+      if (    ( tokcod[i] == UNSUP ) || ( tokcod[i] == DECPT )
+           || ( tokcod[i] == PLACE )
+           || ( plan->ntoks == SPICE_TIMPLN_MAXTOK          )  )
+      {
+         plan->direct = SPICEFALSE;
+         break;
+      }
+
+      b                       = plan->ntoks;
+      plan->kind [b]          = tokcod[i];
+      plan->begin[b]          = tokbeg[i];
+      plan->size [b]          = ( tokcod[i] == SPICE_TIMPLN_LITERAL )
+                                ? toklen[i] : tokarg[i];
+      plan->ntoks            += 1;
+      i                      += 1;
+
+      /*
+      Find the next token that is not a discarded marker.
+      */
+      j = i;
+
+      while (    ( j < ntoks )
+              && (    ( tokcod[j] == SYSTEM ) || ( tokcod[j] == CALNDR )
+                   || ( tokcod[j] == ROUND  ) || ( tokcod[j] == TRUNC  ) ) )
+      {
+         j += 1;
+      }
+
+      if (    ( plan->kind[b] == SPICE_TIMPLN_SECOND )
+           && ( j < ntoks                            )
+           && ( tokcod[j] == DECPT                   )  )
+      {
+         plan->size[b] = 1;
+         i             = j + 1;
+
+         while ( ( i < ntoks ) && ( tokcod[i] == PLACE ) )
+         {
+            plan->size[b] += 1;
+            i             += 1;
+         }
+
+         if ( plan->size[b] > MAXDIG )
+         {
+            plan->direct = SPICEFALSE;
+         }
+      }
+
+      /*
+      Accumulate the rounding pad as TIMOUT does: the pad for the
+      least significant component present, scaled down by a factor
+      of ten for each decimal place.
+      */
+      if (    round
+           && ( plan->kind[b] != SPICE_TIMPLN_LITERAL )
+           && ( plan->kind[b] != SPICE_TIMPLN_MONNAM  )  )
+      {
+         factor = 1.0;
+         incr   = pad[ plan->kind[b] ];
+
+         if ( plan->kind[b] == SPICE_TIMPLN_SECOND )
+         {
+            for ( j = 0;  j < plan->size[b];  j++ )
+            {
+               factor *= 0.1;
+            }
+         }
+
+         incr *= factor;
+
+         if ( plan->pad != 0.0 )
+         {
+            plan->pad = MinVal ( plan->pad, incr );
+         }
+         else
+         {
+            plan->pad = incr;
+         }
+      }
+   }
+
+
+   chkout_c ( "timpln_c" );
+
+} /* End timpln_c */
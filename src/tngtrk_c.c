@@ -0,0 +1,201 @@
+/*
+
+-Procedure tngtrk_c ( Tangent point tracking for limbs and terminators )
+
+-Abstract
+
+   Enable or disable tracking of DSK tangent points from one call of
+   limbpt_c or termpt_c to the next, so that a sequence of limb or
+   terminator computations at closely spaced epochs can reuse the
+   tangent points found at the previous epoch.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   DSK
+
+-Keywords
+
+   DSK
+   GEOMETRY
+   TERMINATOR
+
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+
+   void tngtrk_c ( SpiceBoolean    enable,
+                   SpiceDouble     margin )
+
+/*
+
+-Brief_I/O
+
+   Variable  I/O  Description
+   --------  ---  --------------------------------------------------
+   enable     I   Flag enabling tracking.
+   margin     I   Angular margin around previous tangent points.
+
+-Detailed_Input
+
+   enable      is SPICETRUE to enable tracking and SPICEFALSE to
+               disable it.  Every call clears the tangent points
+               recorded so far.
+
+   margin      is an angle, in radians, by which the search for
+               tangent rays in a cutting half-plane extends beyond the
+               tangent rays found in that half-plane by the previous
+               computation.  `margin' must exceed the largest change,
+               between successive computations, of the angle between
+               a tangent ray and the observer-target (or source-target)
+               axis.  `margin' is ignored if `enable' is SPICEFALSE.
+
+-Detailed_Output
+
+   None.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1)  If `enable' is SPICETRUE and `margin' is not positive, the
+       error SPICE(VALUEOUTOFRANGE) is signaled.  Tracking is not
+       changed.
+
+-Files
+
+   None.
+
+-Particulars
+
+   For DSK targets, the "TANGENT" methods of limbpt_c and termpt_c
+   find the tangent rays in each cutting half-plane by stepping the
+   angle of a ray from the axis, in steps of `schstp', over the whole
+   range of angles in which the ray could touch the target.  For a
+   distant observer and a small search step, this takes thousands of
+   ray-surface intercept computations per half-plane.
+
+   With tracking enabled, each cutting half-plane keeps the range of
+   tangent angles it had in the previous computation for the same
+   target and curve type.  The next search covers only that range
+   widened by `margin' on both sides.  The narrowed range is used
+   only if the occultation states at its ends are those at the ends
+   of the full range.  Otherwise the full search is done, as it is
+   for the first computation and whenever the target changes.
+
+   Results are the same as those of untracked computations, provided
+   `margin' is large enough that no tangent ray moves out of the
+   narrowed range between computations.  A surface feature that
+   becomes tangent to a ray entirely outside of the narrowed range is
+   not found unless it changes the occultation state at an end of the
+   range.
+
+   Tracking has no effect on ellipsoidal targets or on the "GUIDED"
+   methods.
+
+-Examples
+
+   1)  Compute the limb of a DSK target for each frame of an image
+       sequence, with the limb moving by at most 1 mrad between
+       frames.
+
+          tngtrk_c ( SPICETRUE, 2.e-3 );
+
+          for ( i = 0;  i < nframes;  i++ )
+          {
+             limbpt_c ( "TANGENT/DSK/UNPRIORITIZED", target,
+                        et[i],    fixref,  abcorr,  "CENTER",
+                        obsrvr,   refvec,  rolstp,  ncuts,
+                        schstp,   soltol,  MAXN,    npts,
+                        points,   epochs,  tangts            );
+             ...
+          }
+
+          tngtrk_c ( SPICEFALSE, 0.0 );
+
+-Restrictions
+
+   1)  Tangent points are recorded by cutting half-plane index.  The
+       reference vector, roll step and observer of a tracked sequence
+       must remain fixed; call tngtrk_c again to clear the recorded
+       points when they change.
+
+   2)  A limb and a terminator, or two shadow types, may be tracked
+       at the same time, but each replaces the points recorded by
+       the other for the same half-plane index.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   track limb or terminator points across epochs
+
+-&
+*/
+
+{ /* Begin tngtrk_c */
+
+   /*
+   Local variables
+   */
+   logical                 on;
+
+
+   /*
+   Participate in error tracing.
+   */
+   chkin_c ( "tngtrk_c" );
+
+   if (  enable  &&  ( margin <= 0.0 )  )
+   {
+      setmsg_c ( "The tracking margin was #; it must be positive." );
+      errdp_c  ( "#",  margin                                      );
+      sigerr_c ( "SPICE(VALUEOUTOFRANGE)"                          );
+      chkout_c ( "tngtrk_c"                                        );
+      return;
+   }
+
+   on = (logical) enable;
+
+   zztrkset_ ( &on, (doublereal *) &margin );
+
+   chkout_c ( "tngtrk_c" );
+
+} /* End tngtrk_c */
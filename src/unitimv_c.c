@@ -0,0 +1,389 @@
+/*
+
+-Procedure unitimv_c ( Uniform time scale transformation, vector )
+
+-Abstract
+
+   Transform an array of epochs from one uniform time scale to
+   another.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   TIME
+
+-Keywords
+
+   CONVERSION
+   TIME
+
+*/
+
+   #include <ctype.h>
+   #include <string.h>
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZmc.h"
+
+
+   /*
+   Local parameters
+   */
+   #define  TYPLEN          8
+
+   #define  TAI             1
+   #define  TDT             2
+   #define  JDTDT           3
+   #define  TDB             4
+   #define  JDTDB           5
+
+
+   static SpiceInt  systyp ( ConstSpiceChar   * sys,
+                             SpiceChar        * name );
+
+
+   void unitimv_c ( SpiceInt              n,
+                    ConstSpiceDouble    * epochs,
+                    ConstSpiceChar      * insys,
+                    ConstSpiceChar      * outsys,
+                    SpiceDouble         * outs    )
+
+/*
+
+-Brief_I/O
+
+   Variable  I/O  Description
+   --------  ---  --------------------------------------------------
+   n          I   Number of epochs to convert.
+   epochs     I   Epochs to be converted.
+   insys      I   The time scale associated with the input epochs.
+   outsys     I   The time scale associated with the output epochs.
+   outs       O   The epochs on the `outsys' time scale.
+
+-Detailed_Input
+
+   n          is the number of epochs in the array `epochs'.
+
+   epochs     is an array of epochs relative to the `insys' time
+              scale.
+
+   insys      is a time scale.  Acceptable values are those
+              recognized by unitim_c:
+
+              "TAI"     International Atomic Time.
+              "TDB"     Barycentric Dynamical Time.
+              "TDT"     Terrestrial Dynamical Time.
+              "ET"      Ephemeris time (in the SPICE system, this is
+                        equivalent to TDB).
+              "JDTDB"   Julian Date relative to TDB.
+              "JDTDT"   Julian Date relative to TDT.
+              "JED"     Julian Ephemeris date (in the SPICE system
+                        this is equivalent to JDTDB).
+
+              The routine is not sensitive to the case of the
+              characters in `insys'.
+
+   outsys     is the time scale to which the epochs should be
+              converted.  Acceptable values are the same as for
+              `insys'.
+
+-Detailed_Output
+
+   outs       is an array of `n' epochs on the `outsys' time scale.
+              Element i of `outs' is the value unitim_c returns for
+              element i of `epochs'.
+
+              `outs' may overwrite `epochs'.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1) Errors in the time scale names, or the absence of the
+      leapseconds kernel variables, are diagnosed by the routine
+      unitim_c.  In that case `outs' is not modified beyond its first
+      element.
+
+   2) The error SPICE(EMPTYSTRING) is signaled if either input
+      string does not contain at least one character.
+
+   3) The error SPICE(NULLPOINTER) is signaled if either input
+      string pointer is null.
+
+   4) If `n' is less than 1, this routine returns without modifying
+      `outs'.
+
+-Files
+
+   None.
+
+-Particulars
+
+   This routine is functionally equivalent to calling unitim_c for
+   each element of `epochs', and the results are identical.  The
+   time scale names are validated and the leapseconds kernel
+   variables are checked once per call rather than once per epoch,
+   and no kernel pool access is made inside the loop.
+
+-Examples
+
+   1) Convert a set of TDB epochs to Julian dates relative to TDT.
+
+      #include <stdio.h>
+      #include "SpiceUsr.h"
+
+      #define  N       3
+
+      int main()
+      {
+         SpiceDouble  ets  [N] = { 0.0, 86400.0, 6.e8 };
+         SpiceDouble  jds  [N];
+         SpiceInt     i;
+
+         furnsh_c  ( "naif0012.tls" );
+
+         unitimv_c ( N, ets, "ET", "JDTDT", jds );
+
+         for ( i = 0;  i < N;  i++ )
+         {
+            printf ( "%14.1f %20.10f\n", ets[i], jds[i] );
+         }
+
+         return ( 0 );
+      }
+
+-Restrictions
+
+   The appropriate variables must be loaded into the SPICE kernel
+   pool (normally by loading a leapseconds kernel with furnsh_c) prior
+   to calling this routine.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   Transform an array of epochs between uniform time systems
+
+-&
+*/
+
+{ /* Begin unitimv_c */
+
+   /*
+   Local variables
+   */
+   SpiceChar               inname  [ TYPLEN + 1 ];
+   SpiceChar               outname [ TYPLEN + 1 ];
+
+   SpiceDouble             jd2000;
+   SpiceDouble             secspd;
+   SpiceDouble             t;
+
+   SpiceInt                i;
+   SpiceInt                intyp;
+   SpiceInt                outtyp;
+
+
+   /*
+   Participate in error tracing.
+   */
+   if ( return_c() )
+   {
+      return;
+   }
+   chkin_c ( "unitimv_c" );
+
+   /*
+   Check the input strings to make sure the pointers are non-null
+   and the string lengths are non-zero.
+   */
+   CHKFSTR ( CHK_STANDARD, "unitimv_c", insys  );
+   CHKFSTR ( CHK_STANDARD, "unitimv_c", outsys );
+
+   if ( n < 1 )
+   {
+      chkout_c ( "unitimv_c" );
+      return;
+   }
+
+   /*
+   Convert the first epoch with unitim_.  This validates the time
+   scale names and the kernel pool contents.
+   */
+   outs[0] = (SpiceDouble) unitim_ ( ( doublereal * ) epochs,
+                                     ( char       * ) insys,
+                                     ( char       * ) outsys,
+                                     ( ftnlen       ) strlen(insys),
+                                     ( ftnlen       ) strlen(outsys) );
+
+   if ( failed_c() || ( n == 1 ) )
+   {
+      chkout_c ( "unitimv_c" );
+      return;
+   }
+
+   intyp  = systyp ( insys,  inname  );
+   outtyp = systyp ( outsys, outname );
+
+   /*
+   Without the buffered leapseconds table, convert each epoch with
+   unitim_.
+   */
+   if (  ( intyp == 0 ) || ( outtyp == 0 ) || !zzlskok_c()  )
+   {
+      for ( i = 1;  i < n;  i++ )
+      {
+         outs[i] = (SpiceDouble) unitim_ ( ( doublereal * ) ( epochs+i ),
+                                           ( char       * ) insys,
+                                           ( char       * ) outsys,
+                                           ( ftnlen       ) strlen(insys),
+                                           ( ftnlen       ) strlen(outsys) );
+         if ( failed_c() )
+         {
+            break;
+         }
+      }
+
+      chkout_c ( "unitimv_c" );
+      return;
+   }
+
+   /*
+   UNITIM returns the input unchanged when the normalized names
+   match.
+   */
+   if ( strcmp ( inname, outname ) == 0 )
+   {
+      if ( outs != epochs )
+      {
+         memmove ( outs+1, epochs+1, (size_t)(n-1) * sizeof(SpiceDouble) );
+      }
+
+      chkout_c ( "unitimv_c" );
+      return;
+   }
+
+   jd2000 = j2000_c();
+   secspd = spd_c();
+
+   /*
+   The arithmetic below follows UNITIM: convert to TDT or TDB,
+   change between those if necessary, then convert to the output
+   scale.
+   */
+   for ( i = 1;  i < n;  i++ )
+   {
+      t = epochs[i];
+
+      if ( intyp == TAI )
+      {
+         t = zztaitdt_c ( t );
+      }
+      else if (  ( intyp == JDTDT ) || ( intyp == JDTDB )  )
+      {
+         t = ( t - jd2000 ) * secspd;
+      }
+
+      if (  ( intyp <= JDTDT ) && ( outtyp >= TDB )  )
+      {
+         t = zztdttdb_c ( t );
+      }
+      else if (  ( intyp >= TDB ) && ( outtyp <= JDTDT )  )
+      {
+         t = zztdbtdt_c ( t );
+      }
+
+      if ( outtyp == TAI )
+      {
+         t = zztdttai_c ( t );
+      }
+      else if (  ( outtyp == JDTDT ) || ( outtyp == JDTDB )  )
+      {
+         t = t / secspd + jd2000;
+      }
+
+      outs[i] = t;
+   }
+
+
+   chkout_c ( "unitimv_c" );
+
+} /* End unitimv_c */
+
+
+
+/*
+
+   systyp: map a time scale name to one of the codes TAI, TDT, JDTDT,
+   TDB or JDTDB, as UNITIM would after converting the name to upper
+   case in a string of length TYPLEN.  The normalized name is
+   returned in `name'.  The function returns zero if the name is not
+   recognized.
+
+*/
+
+   static SpiceInt  systyp ( ConstSpiceChar   * sys,
+                             SpiceChar        * name )
+{
+   SpiceInt                i;
+
+   for ( i = 0;  ( i < TYPLEN ) && ( sys[i] != '\0' );  i++ )
+   {
+      name[i] = (SpiceChar) toupper ( (unsigned char) sys[i] );
+   }
+
+   /*
+   Trailing blanks are not significant in the Fortran comparison.
+   */
+   while (  ( i > 0 ) && ( name[i-1] == ' ' )  )
+   {
+      i--;
+   }
+   name[i] = '\0';
+
+   if ( strcmp ( name, "TAI"   ) == 0 )   return ( TAI   );
+   if ( strcmp ( name, "TDT"   ) == 0 )   return ( TDT   );
+   if ( strcmp ( name, "JDTDT" ) == 0 )   return ( JDTDT );
+   if ( strcmp ( name, "TDB"   ) == 0 )   return ( TDB   );
+   if ( strcmp ( name, "ET"    ) == 0 )   return ( TDB   );
+   if ( strcmp ( name, "JDTDB" ) == 0 )   return ( JDTDB );
+   if ( strcmp ( name, "JED"   ) == 0 )   return ( JDTDB );
+
+   return ( 0 );
+}
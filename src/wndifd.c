@@ -325,8 +325,6 @@
 		    if (put < csize) {
 			c__[put + 5] = f;
 			c__[put + 6] = b[bpb + 5];
-			i__1 = put + 1;
-			scardd_(&i__1, c__);
 			put += 2;
 		    } else {
 			over += 2;
@@ -370,8 +368,6 @@
 	    if (put < csize) {
 		c__[put + 5] = f;
 		c__[put + 6] = l;
-		i__1 = put + 1;
-		scardd_(&i__1, c__);
 		put += 2;
 	    } else {
 		over += 2;
@@ -384,6 +380,11 @@
 	ape += 2;
     }
 
+/*     Set the cardinality of the output window. */
+
+    i__1 = put - 1;
+    scardd_(&i__1, c__);
+
 /*     We've examined all of the intervals of A and B, but if we */
 /*     didn't actually store all of the difference, signal an error. */
 
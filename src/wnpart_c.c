@@ -0,0 +1,313 @@
+/*
+
+-Procedure wnpart_c ( Partition a DP window )
+
+-Abstract
+
+   Return one of a specified number of parts, of equal measure, into
+   which a double precision window is divided.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   WINDOWS
+
+-Keywords
+
+   WINDOWS
+
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZmc.h"
+
+
+   void wnpart_c ( SpiceCell    * window,
+                   SpiceInt       npart,
+                   SpiceInt       ipart,
+                   SpiceCell    * part   )
+
+/*
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   window     I   Window to be partitioned.
+   npart      I   Number of parts.
+   ipart      I   Index of the part to return.
+   part       O   Part `ipart' of `window'.
+
+-Detailed_Input
+
+   window      is a window containing zero or more intervals.
+
+               window must be declared as a double precision
+               SpiceCell.
+
+   npart       is the number of parts into which `window' is divided.
+
+   ipart       is the zero-based index of the part to return, in the
+               range 0 : npart-1.  Parts are numbered in increasing
+               order of time.
+
+-Detailed_Output
+
+   part        is the intersection of `window' with the interval
+
+                  [ T(ipart), T(ipart+1) ]
+
+               where T(0) and T(npart) are the most negative and most
+               positive double precision numbers, and the cut times
+               T(1), ..., T(npart-1) divide `window' into `npart' parts
+               of equal measure.
+
+               part must be declared as a double precision SpiceCell
+               and must be distinct from `window'.  Its size must be
+               at least that of `window'.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1) If either window does not have double precision type,
+      the error SPICE(TYPEMISMATCH) is signaled.
+
+   2) If `npart' is less than 1, the error SPICE(INVALIDCOUNT) is
+      signaled.
+
+   3) If `ipart' is outside of the range 0 : npart-1, the error
+      SPICE(INDEXOUTOFRANGE) is signaled.
+
+   4) If `part' is too small to hold its intervals, the error is
+      signaled by a routine in the call tree of this routine.
+
+-Files
+
+   None.
+
+-Particulars
+
+   This routine divides a confinement window among independent
+   searches, for example geometry finder searches run in separate
+   processes.  The parts are disjoint except at the cut times, which
+   are endpoints of both adjacent parts, and their union is `window'.
+   An interval of `window' containing a cut time is split there.
+
+   A singleton interval at a cut time belongs to the later part.  If
+   the measure of `window' is zero, all of its intervals belong to
+   part 0.
+
+   Geometry finder searches of the parts yield results whose union,
+   formed by wnunid_c, is the result of a search of `window', to
+   within the convergence tolerance of the search.  An event found
+   on both sides of a cut time yields an interval ending at the cut
+   time in one result and starting there in the other; the union
+   merges them.
+
+-Examples
+
+   Let window contain the intervals
+
+      [ 0, 10 ]  [ 20, 25 ]  [ 30, 45 ]
+
+   which have a total measure of 30.  Then the calls
+
+      wnpart_c ( &window, 3, 0, &part );              (1)
+      wnpart_c ( &window, 3, 1, &part );              (2)
+      wnpart_c ( &window, 3, 2, &part );              (3)
+
+   produce the windows
+
+      [ 0, 10 ]                                       (1)
+      [ 20, 25 ]  [ 30, 35 ]                          (2)
+      [ 35, 45 ]                                      (3)
+
+   The cut times are 10 and 35.
+
+-Restrictions
+
+   None.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   partition a d.p. window into parts of equal measure
+
+-&
+*/
+
+{ /* Begin wnpart_c */
+
+
+   /*
+   Local variables
+   */
+   SpiceDouble           * data;
+   SpiceDouble             cum;
+   SpiceDouble             cut    [2];
+   SpiceDouble             left;
+   SpiceDouble             meas;
+   SpiceDouble             right;
+   SpiceDouble             target;
+
+   SpiceInt                card;
+   SpiceInt                i;
+   SpiceInt                j;
+   SpiceInt                k;
+
+
+   /*
+   Participate in error tracing.
+   */
+   if ( return_c() )
+   {
+      return;
+   }
+   chkin_c ( "wnpart_c" );
+
+   /*
+   Make sure cell data types are d.p.
+   */
+   CELLTYPECHK2 ( CHK_STANDARD, "wnpart_c", SPICE_DP, window, part );
+
+   /*
+   Initialize the cells if necessary.
+   */
+   CELLINIT2 ( window, part );
+
+   if ( npart < 1 )
+   {
+      setmsg_c ( "The part count must be at least 1 but was #." );
+      errint_c ( "#",  npart                                     );
+      sigerr_c ( "SPICE(INVALIDCOUNT)"                           );
+      chkout_c ( "wnpart_c"                                      );
+      return;
+   }
+
+   if (  ( ipart < 0 )  ||  ( ipart >= npart )  )
+   {
+      setmsg_c ( "The part index # is outside of the range 0:#." );
+      errint_c ( "#",  ipart                                      );
+      errint_c ( "#",  npart-1                                    );
+      sigerr_c ( "SPICE(INDEXOUTOFRANGE)"                         );
+      chkout_c ( "wnpart_c"                                       );
+      return;
+   }
+
+   data = (SpiceDouble *) window->data;
+   card = window->card;
+
+   meas = 0.0;
+
+   for ( i = 0;  i < card;  i += 2 )
+   {
+      meas += data[i+1] - data[i];
+   }
+
+   /*
+   Find the cut times bounding the requested part.  The cut time at
+   cumulative measure `target' lies in the first interval at whose
+   right endpoint the cumulative measure reaches `target'.
+   */
+   for ( k = 0;  k < 2;  k++ )
+   {
+      j = ipart + k;
+
+      if ( j == 0 )
+      {
+         cut[k] = -dpmax_c();
+      }
+      else if (  ( j == npart )  ||  ( meas == 0.0 )  )
+      {
+         cut[k] =  dpmax_c();
+      }
+      else
+      {
+         target = meas * (SpiceDouble)j / (SpiceDouble)npart;
+         cum    = 0.0;
+         cut[k] = dpmax_c();
+
+         for ( i = 0;  i < card;  i += 2 )
+         {
+            cum += data[i+1] - data[i];
+
+            if ( cum >= target )
+            {
+               cut[k] = maxd_c ( 2, data[i], data[i+1] - (cum - target) );
+               break;
+            }
+         }
+      }
+   }
+
+   /*
+   Clip the intervals of the window to the part.
+   */
+   scard_c ( 0, part );
+
+   for ( i = 0;  i < card;  i += 2 )
+   {
+      left  = maxd_c ( 2, data[i],   cut[0] );
+      right = mind_c ( 2, data[i+1], cut[1] );
+
+      if ( left < right )
+      {
+         wninsd_c ( left, right, part );
+      }
+      else if (     ( data[i] == data[i+1] )
+                && ( data[i] >= cut[0]    )
+                && (    ( data[i] < cut[1] )
+                     || ( cut[1] == dpmax_c() ) )  )
+      {
+         wninsd_c ( data[i], data[i], part );
+      }
+
+      if ( failed_c() )
+      {
+         break;
+      }
+   }
+
+
+   chkout_c ( "wnpart_c" );
+
+} /* End wnpart_c */
@@ -12,14 +12,21 @@ static integer c__0 = 0;
 /* $Procedure      WNVALD ( Validate a DP window ) */
 /* Subroutine */ int wnvald_(integer *size, integer *n, doublereal *a)
 {
+    /* System generated locals */
+    integer i__1;
+    doublereal d__1, d__2;
+
+    /* Local variables */
     doublereal left;
     integer i__;
     extern /* Subroutine */ int chkin_(char *, ftnlen);
+    integer npair;
     doublereal right;
     extern /* Subroutine */ int scardd_(integer *, doublereal *), sigerr_(
 	    char *, ftnlen), chkout_(char *, ftnlen), ssized_(integer *, 
-	    doublereal *), setmsg_(char *, ftnlen), wninsd_(doublereal *, 
-	    doublereal *, doublereal *);
+	    doublereal *), setmsg_(char *, ftnlen);
+    integer put;
+    extern /* Subroutine */ int zzsortp_(integer *, doublereal *);
     extern logical return_(void), odd_(integer *);
 
 /* $ Abstract */
@@ -111,6 +118,15 @@ static integer c__0 = 0;
 /*     intervals read from input files or initialized in DATA */
 /*     statements. */
 
+/*     Validation is also the efficient way to build a large window */
+/*     from intervals in no particular order, such as the coverage */
+/*     intervals of many segments: store the intervals in A and */
+/*     validate A once. The intervals are sorted, then merged in a */
+/*     single pass, so the time required is proportional to */
+/*     N*log(N). Inserting the intervals one at a time with WNINSD */
+/*     requires time proportional to N**2 when they are not in */
+/*     order. */
+
 /* $ Examples */
 
 /*     The following small program */
@@ -253,30 +269,48 @@ static integer c__0 = 0;
 	return 0;
     }
 
-/*     Taking the easy way out, we will simply insert each new interval */
-/*     as we happen upon it. We can do this safely in place. The output */
-/*     window can't possibly contain more intervals than the input array. */
-
 /*     What can go wrong is this: a left endpoint might be greater than */
-/*     the corresponding left endpoint. This is a boo-boo, and should be */
-/*     reported. */
+/*     the corresponding right endpoint. This is a boo-boo, and should */
+/*     be reported. */
 
     ssized_(size, a);
     scardd_(&c__0, a);
-    i__ = 1;
-    while(i__ < *n) {
-	left = a[i__ + 5];
-	right = a[i__ + 6];
-	if (left > right) {
+    i__1 = *n;
+    for (i__ = 1; i__ <= i__1; i__ += 2) {
+	if (a[i__ + 5] > a[i__ + 6]) {
 	    setmsg_("WNVALD: Left endpoint may not exceed right endpoint.", (
 		    ftnlen)52);
 	    sigerr_("SPICE(BADENDPOINTS)", (ftnlen)19);
 	    chkout_("WNVALD", (ftnlen)6);
 	    return 0;
 	}
-	wninsd_(&left, &right, a);
-	i__ += 2;
     }
+
+/*     Sort the intervals by their left endpoints, then merge each */
+/*     interval with the latest output interval if the two overlap or */
+/*     touch, as WNINSD would. We can do this safely in place: the */
+/*     output window can't possibly contain more intervals than the */
+/*     input array. (PUT points to the right endpoint of the latest */
+/*     output interval.) */
+
+    npair = *n / 2;
+    zzsortp_(&npair, &a[6]);
+    put = 0;
+    i__1 = *n;
+    for (i__ = 1; i__ <= i__1; i__ += 2) {
+	left = a[i__ + 5];
+	right = a[i__ + 6];
+	if (put > 0 && left <= a[put + 5]) {
+/* Computing MAX */
+	    d__1 = a[put + 5], d__2 = right;
+	    a[put + 5] = max(d__1,d__2);
+	} else {
+	    put += 2;
+	    a[put + 4] = left;
+	    a[put + 5] = right;
+	}
+    }
+    scardd_(&put, a);
     chkout_("WNVALD", (ftnlen)6);
     return 0;
 } /* wnvald_ */
@@ -117,6 +117,13 @@
    Because validation is done in place, there is no chance of 
    overflow. 
  
+   Validation is also the efficient way to build a large window 
+   from intervals in no particular order: store the endpoints in 
+   the data array of the cell and validate it once.  The intervals 
+   are sorted and then merged in a single pass, where inserting 
+   them one at a time with wninsd_c takes time proportional to the 
+   square of their number when they are not in order. 
+ 
 -Examples
  
    The following small program 
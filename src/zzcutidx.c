@@ -0,0 +1,169 @@
+/*
+
+-Procedure zzcutidx ( Index of first cutting half-plane, umbrella )
+
+-Abstract
+
+   SPICE Private routine intended solely for the support of SPICE
+   routines.  Users should not call this routine directly due
+   to the volatile nature of this routine.
+
+   Set or fetch the index of the first cutting half-plane to be
+   processed by LIMBPT or TERMPT.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   None.
+
+-Keywords
+
+   GEOMETRY
+   PRIVATE
+
+-Brief_I/O
+
+   VARIABLE  I/O  ENTRY POINTS
+   --------  ---  --------------------------------------------------
+   first     I-O  zzcutset_, zzcutget_
+
+-Detailed_Input
+
+   See the individual routines.
+
+-Detailed_Output
+
+   See the individual routines.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   None.
+
+-Files
+
+   None.
+
+-Particulars
+
+   LIMBPT and TERMPT compute points for the cutting half-planes at
+   roll angles
+
+      ( first + i ) * rolstp,   i = 0, ..., ncuts-1
+
+   where `first' is the value held by this umbrella.  The value is
+   zero unless limbpr_c or termpr_c has set it for the duration of a
+   call, so that a set of cutting half-planes may be processed in
+   separate calls.  Each half-plane then has the same roll angle as
+   in a single call covering all of them.
+
+      zzcutset_      Set the index of the first cutting half-plane.
+      zzcutget_      Return the index of the first cutting half-plane.
+
+-Examples
+
+   See limbpr_c.
+
+-Restrictions
+
+   1) The caller of zzcutset_ must restore the index to zero before
+      returning.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   index of first limb or terminator cutting half-plane
+
+-&
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+
+
+   /*
+   Static variables
+   */
+   static integer          svfrst = 0;
+
+
+
+/*
+
+-Procedure zzcutset_ ( Set index of first cutting half-plane )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   first      I   Zero-based index of the first cutting half-plane.
+
+-&
+*/
+
+   int zzcutset_ ( integer   * first )
+{
+   svfrst = *first;
+
+   return 0;
+}
+
+
+
+/*
+
+-Procedure zzcutget_ ( Return index of first cutting half-plane )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   first      O   Zero-based index of the first cutting half-plane.
+
+-&
+*/
+
+   int zzcutget_ ( integer   * first )
+{
+   *first = svfrst;
+
+   return 0;
+}
@@ -0,0 +1,276 @@
+/*
+
+-Procedure zzdafwb ( DAF write-behind buffer )
+
+-Abstract
+
+   SPICE Private routine intended solely for the support of SPICE
+   routines.  Users should not call this routine directly due
+   to the volatile nature of this routine.
+
+   Buffer the data added to a new DAF array, and write it to the
+   file in whole records.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   DAF
+
+-Keywords
+
+   FILES
+   PRIVATE
+
+-Brief_I/O
+
+   VARIABLE  I/O  ENTRY POINTS
+   --------  ---  --------------------------------------------------
+   handle     I   All
+   begin      I   zzdafwba
+   n          I   zzdafwba
+   data       I   zzdafwba
+   recno      I   zzdafwbr
+   WBSIZE     P   zzdafwba
+
+-Detailed_Input
+
+   handle      is the handle of a DAF open for write access.
+
+   begin,
+   n           are the address of the first of a set of contiguous
+               double precision numbers to be written to the file
+               `handle', and the number of them.
+
+   data        is an array containing the `n' numbers to be written
+               to addresses begin : begin+n-1 of the file.
+
+   recno       is the number of a record of the file `handle' that
+               is about to be read or written by DAFRWD.
+
+-Detailed_Output
+
+   None.  See Particulars.
+
+-Parameters
+
+   WBSIZE      is the number of double precision numbers the buffer
+               holds: 4 megabytes, or 4096 DAF records.
+
+-Exceptions
+
+   1)  Errors writing the buffered data to the file are signaled by
+       routines in the call tree of these entry points, when the data
+       are written.  The data are not written at the time they are
+       added to the buffer, so an error reported by DAFENA, DAFCLS or
+       a DAF read may be one that DAFADA reported formerly.
+
+-Files
+
+   See argument `handle'.
+
+-Particulars
+
+   DAFADA formerly wrote each addition to a new array to the file at
+   once, through DAFWDA.  Writers that add a few numbers at a time,
+   such as CKW03 adding the quaternion and angular velocity of each
+   pointing instance separately, then read and rewrote the same
+   partial record once for each addition.
+
+   The entry points of this routine hold the additions instead in a
+   buffer of WBSIZE numbers, and write them with a single call to
+   DAFWDA when the buffer must be emptied, so that every record but
+   the first and last is written exactly once, and in sequence.
+
+      zzdafwba    adds `n' numbers, to be written at addresses
+                  begin : begin+n-1 of the file `handle', to the
+                  buffer.  The buffer is emptied first if it holds
+                  data of another file, or data that do not end just
+                  before `begin', or if the new numbers do not fit in
+                  it.  Additions larger than the buffer are written
+                  at once.
+
+      zzdafwbf    empties the buffer, writing its contents to the file
+                  `handle', if the buffer holds data of that file.
+                  DAFENA calls it before updating the summary and name
+                  records of the array, and DAFCLS before closing the
+                  file.
+
+      zzdafwbr    empties the buffer if it holds data of record
+                  `recno' of the file `handle'.  DAFRWD calls it
+                  before each record it reads or writes, so that DAF
+                  reads of a new array, as SGSEQW performs, see the
+                  data added to it.
+
+   The file contents are the same as those the former DAFADA wrote.
+
+-Examples
+
+   See DAFANA.
+
+-Restrictions
+
+   1)  Only one array, in one file, is buffered at a time.  Writers
+       that add data to arrays of several files in alternation, using
+       DAFCAD, empty the buffer at each change of file.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 19-OCT-2026 (NZL)
+
+-Index_Entries
+
+   buffer data added to a new daf array
+
+-&
+*/
+
+   #include <string.h>
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+
+
+   /*
+   Local parameters
+   */
+   #define NWREC           128
+   #define WBSIZE          ( 4096 * NWREC )
+
+
+   /*
+   Static variables
+
+   The buffer holds `wbn' numbers to be written at addresses
+   wbfrst : wbfrst+wbn-1 of the file `wbhan', which lie in records
+   wbrec1 : wbrec2.
+   */
+   static doublereal       wbdata [WBSIZE];
+
+   static integer          wbfrst = 0;
+   static integer          wbhan  = 0;
+   static integer          wbn    = 0;
+   static integer          wbrec1 = 0;
+   static integer          wbrec2 = 0;
+
+
+   /*
+   Write the contents of the buffer to the file, and empty it.  The
+   buffer is marked empty first, so that the DAFRWD calls made by
+   DAFWDA do not empty it again.
+   */
+   static void flush ( void )
+   {
+      integer                 first;
+      integer                 handle;
+      integer                 last;
+
+      handle = wbhan;
+      first  = wbfrst;
+      last   = wbfrst + wbn - 1;
+
+      wbn    = 0;
+
+      dafwda_ ( &handle, &first, &last, wbdata );
+   }
+
+
+   int zzdafwba_ ( integer      * handle,
+                   integer      * begin,
+                   integer      * n,
+                   doublereal   * data    )
+   {
+      integer                 last;
+
+      if ( *n < 1 )
+      {
+         return 0;
+      }
+
+      if (    ( wbn > 0 )
+           && (    ( *handle       != wbhan           )
+                || ( *begin        != wbfrst + wbn    )
+                || ( wbn + *n      >  WBSIZE          ) )  )
+      {
+         flush();
+      }
+
+      if ( *n > WBSIZE )
+      {
+         last = *begin + *n - 1;
+
+         dafwda_ ( handle, begin, &last, data );
+
+         return 0;
+      }
+
+      if ( wbn == 0 )
+      {
+         wbhan  = *handle;
+         wbfrst = *begin;
+         wbrec1 = ( *begin - 1 ) / NWREC  +  1;
+      }
+
+      memcpy ( wbdata + wbn,  data,  (size_t)(*n) * sizeof(doublereal) );
+
+      wbn   += *n;
+      wbrec2 = ( wbfrst + wbn - 2 ) / NWREC  +  1;
+
+      return 0;
+   }
+
+
+   int zzdafwbf_ ( integer      * handle )
+   {
+      if (  ( wbn > 0 )  &&  ( *handle == wbhan )  )
+      {
+         flush();
+      }
+
+      return 0;
+   }
+
+
+   int zzdafwbr_ ( integer      * handle,
+                   integer      * recno   )
+   {
+      if (    ( wbn     >  0      )
+           && ( *handle == wbhan  )
+           && ( *recno  >= wbrec1 )
+           && ( *recno  <= wbrec2 )  )
+      {
+         flush();
+      }
+
+      return 0;
+   }
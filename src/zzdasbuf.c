@@ -0,0 +1,1175 @@
+/*
+
+-Procedure zzdasbuf ( DAS record buffer )
+
+-Abstract
+
+   SPICE Private routine intended solely for the support of SPICE
+   routines.  Users should not call this routine directly due
+   to the volatile nature of this routine.
+
+   Maintain the buffer of DAS records shared by the character, double
+   precision and integer record routines of DASRWR.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   DAS
+
+-Keywords
+
+   DAS
+   FILES
+   PRIVATE
+
+-Brief_I/O
+
+   VARIABLE  I/O  ENTRY POINTS
+   --------  ---  --------------------------------------------------
+   handle     I   All except zzdasbsz, zzdasnrr
+   recno      I   All except zzdasbwb, zzdasbiv, zzdasbsz, zzdasnrr
+   first,
+   last       I   zzdasbrd, zzdasbri, zzdasbrc, zzdasbud, zzdasbui,
+                  zzdasbuc
+   recd,
+   reci,
+   recc       I   zzdasbwd, zzdasbwi, zzdasbwc
+   n          I   zzdasbxd, zzdasbxi
+   datad,
+   datai,
+   datac     I-O  zzdasbrd, zzdasbri, zzdasbrc, zzdasbud, zzdasbui,
+                  zzdasbuc, zzdasbxd, zzdasbxi
+   nrec       I   zzdasbsz
+   reads,
+   reqs       O   zzdasnrr
+   NWD,
+   NWI,
+   NWC        P   All
+   DEFSZ      P   zzdasbsz
+   MINSZ      P   zzdasbsz
+
+-Detailed_Input
+
+   handle      is the handle of a DAS file.  The file must be open for
+               write access for all entry points except the read
+               entry points zzdasbrd, zzdasbri and zzdasbrc.
+
+   recno       is the number of a record of the file.
+
+   first,
+   last        are the indices of the first and last elements of the
+               record to be read or updated.  The caller must ensure
+               that 1 <= first <= last <= NWD, NWI or NWC.
+
+   recd,
+   reci,
+   recc        are the new contents of a whole record, for the write
+               entry points.  `recc' is truncated or padded with
+               blanks to NWC characters.
+
+   datad,
+   datai,
+   datac       on input to the update entry points, are the new
+               contents of elements first : last of the record.
+               `datac' is truncated or padded with blanks to
+               last-first+1 characters.
+
+   n           is the number of consecutive records, starting with
+               record `recno', to be read by zzdasbxd or zzdasbxi.
+
+   nrec        is the number of records the buffer is to hold.
+
+-Detailed_Output
+
+   datad,
+   datai,
+   datac       on output from the read entry points, are elements
+               first : last of the record.  `datac' is padded with
+               blanks if it is longer than last-first+1 characters.
+
+               On output from zzdasbxd and zzdasbxi, `datad' or
+               `datai' contains the `n' records, one after another.
+
+   reads,
+   reqs        are the number of records read from DAS files, and the
+               number of requests for records made by the read and
+               update entry points, during the current execution of
+               the calling program.
+
+-Parameters
+
+   NWD,
+   NWI,
+   NWC         are the numbers of double precision numbers, integers
+               and characters in a DAS record of each type.
+
+   DEFSZ       is the number of records the buffer holds until
+               zzdasbsz is called.
+
+   MINSZ       is the smallest number of records zzdasbsz accepts.
+
+-Exceptions
+
+   1)  Errors reading or writing records are signaled by routines in
+       the call tree of these entry points.  If a read fails, the
+       output data are undefined.  If the writing of an updated
+       record fails, the record is removed from the buffer.
+
+   2)  If zzdasbsz is called with `nrec' less than MINSZ, the error
+       SPICE(INVALIDSIZE) is signaled.
+
+   3)  If zzdasbsz cannot allocate memory for the buffer, the error
+       SPICE(MALLOCFAILED) is signaled.  The buffer is then restored
+       to its default size.
+
+-Files
+
+   See argument `handle'.
+
+-Particulars
+
+   DASRWR formerly kept a buffer of 10 records of each data type,
+   and located a record by searching the buffer of its type
+   linearly.  DSK plate and voxel lookups and EK queries access many
+   more records than that at random, so most of their record
+   requests were file reads.
+
+   These entry points keep one buffer of records of all three types,
+   DEFSZ records in size unless zzdasbsz sets another size.  Records
+   are located through a hash table of file handles and record
+   numbers, and the least recently used record is replaced when the
+   buffer is full.  A record updated by the write or update entry
+   points is written to its file only when it is replaced, or when
+   zzdasbwb is called for the file.
+
+      zzdasbrd
+      zzdasbri
+      zzdasbrc    read elements first : last of a record of the
+                  respective type.
+
+      zzdasbwd
+      zzdasbwi
+      zzdasbwc    replace the contents of a record.  The record is not
+                  read from the file.
+
+      zzdasbud
+      zzdasbui
+      zzdasbuc    update elements first : last of a record.
+
+      zzdasbxd
+      zzdasbxi    read `n' consecutive whole records of the respective
+                  type directly into the caller's array.  Records held
+                  by the buffer, which may have been updated, are
+                  copied from it; the others are read from the file
+                  without being added to the buffer, so that a long
+                  read neither replaces the records an application
+                  is using nor copies each record twice.  DASRDD and
+                  DASRDI call them for long runs of records.
+
+      zzdasbwb    writes the updated records of a file, in order of
+                  record number, and removes all records of the file
+                  from the buffer.  DASWBR calls it.
+
+      zzdasbiv    removes all records of a file from the buffer
+                  without writing them.  DASSDR calls it after moving
+                  the records of a file by direct writes, which leave
+                  any buffered copies of the moved records out of
+                  date.
+
+      zzdasbsz    writes all updated records, empties the buffer and
+                  sets its size.
+
+      zzdasnrr    returns the numbers of record reads and requests.
+                  The ratio of reads to requests indicates how well
+                  the buffer size suits an application.
+
+-Examples
+
+   See DASRWR.
+
+-Restrictions
+
+   1)  The caller must check the element ranges and the access of
+       the file, as DASRWR does.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 19-OCT-2026 (NZL)
+
+-Index_Entries
+
+   buffer das records
+
+-&
+*/
+
+   #include <stdlib.h>
+   #include <string.h>
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+
+
+   /*
+   Local parameters
+   */
+   #define NWD             128
+   #define NWI             256
+   #define NWC             1024
+
+   #define DEFSZ           1024
+   #define MINSZ           30
+
+   #define CHR             1
+   #define DP              2
+   #define INT             3
+
+   #define NIL             ( -1 )
+
+
+   /*
+   A buffer entry.  Entries in use are linked into a hash chain,
+   through `hnext', and into the list of entries in order of use, most
+   recent first, through `prev' and `next'.  Free entries are linked
+   through `next'.
+   */
+   typedef struct
+   {
+      integer          handle;
+      integer          recno;
+      integer          type;
+      SpiceBoolean     dirty;
+      int              hnext;
+      int              prev;
+      int              next;
+
+   } Entry;
+
+   typedef union
+   {
+      doublereal       d [NWD];
+      integer          i [NWI];
+      char             c [NWC];
+
+   } Record;
+
+
+   /*
+   Static variables
+   */
+   static Entry            defent [DEFSZ];
+   static Record           defrec [DEFSZ];
+   static int              defhsh [2*DEFSZ];
+   static int              defsrt [DEFSZ];
+
+   static Entry          * ents   = defent;
+   static Record         * recs   = defrec;
+   static int            * htab   = defhsh;
+   static int            * sorted = defsrt;
+
+   static SpiceBoolean     pass1  = SPICETRUE;
+   static int              nent   = DEFSZ;
+   static int              hmask  = 2*DEFSZ - 1;
+   static int              head   = NIL;
+   static int              tail   = NIL;
+   static int              free1  = NIL;
+
+   static integer          nread  = 0;
+   static integer          nreq   = 0;
+
+
+   /*
+   Initialize the buffer to hold `n' entries, in the arrays given.
+   The hash table size, `nhash', must be a power of 2.
+   */
+   static void init ( int       n,
+                      int       nhash,
+                      Entry   * e,
+                      Record  * r,
+                      int     * h,
+                      int     * s     )
+   {
+      int                     i;
+
+      ents   = e;
+      recs   = r;
+      htab   = h;
+      sorted = s;
+      nent   = n;
+      hmask  = nhash - 1;
+      head   = NIL;
+      tail   = NIL;
+
+      for ( i = 0;  i < nhash;  i++ )
+      {
+         htab[i] = NIL;
+      }
+
+      for ( i = 0;  i < n;  i++ )
+      {
+         ents[i].next = i + 1;
+      }
+
+      ents[n-1].next = NIL;
+      free1          = 0;
+
+      pass1 = SPICEFALSE;
+   }
+
+
+   static int slot ( integer handle, integer recno )
+   {
+      unsigned long           k;
+
+      k = (unsigned long)recno * 2654435761UL  +  (unsigned long)handle;
+
+      return (int)( ( k ^ (k >> 15) ) & (unsigned long)hmask );
+   }
+
+
+   /*
+   Remove entry `e' from its hash chain and from the list in order of
+   use.
+   */
+   static void detach ( int e )
+   {
+      int                   * p;
+
+      p = htab + slot( ents[e].handle, ents[e].recno );
+
+      while ( *p != e )
+      {
+         p = &ents[*p].hnext;
+      }
+
+      *p = ents[e].hnext;
+
+      if ( ents[e].prev == NIL )
+      {
+         head = ents[e].next;
+      }
+      else
+      {
+         ents[ ents[e].prev ].next = ents[e].next;
+      }
+
+      if ( ents[e].next == NIL )
+      {
+         tail = ents[e].prev;
+      }
+      else
+      {
+         ents[ ents[e].next ].prev = ents[e].prev;
+      }
+   }
+
+
+   /*
+   Put entry `e', which is linked into no list, at the head of the
+   list in order of use.
+   */
+   static void tohead ( int e )
+   {
+      ents[e].prev = NIL;
+      ents[e].next = head;
+
+      if ( head == NIL )
+      {
+         tail = e;
+      }
+      else
+      {
+         ents[head].prev = e;
+      }
+
+      head = e;
+   }
+
+
+   static void release ( int e )
+   {
+      ents[e].next = free1;
+      free1        = e;
+   }
+
+
+   /*
+   Write the record of entry `e' to its file.
+   */
+   static void wrrec ( int e )
+   {
+      integer                 unit;
+      logical                 lock;
+
+      lock = SPICEFALSE;
+
+      zzddhhlu_ ( &ents[e].handle, "DAS", &lock, &unit, 3 );
+
+      if ( failed_() )
+      {
+         return;
+      }
+
+      if ( ents[e].type == DP )
+      {
+         dasiod_ ( "WRITE", &unit, &ents[e].recno, recs[e].d, 5 );
+      }
+      else if ( ents[e].type == INT )
+      {
+         dasioi_ ( "WRITE", &unit, &ents[e].recno, recs[e].i, 5 );
+      }
+      else
+      {
+         dasioc_ ( "WRITE", &unit, &ents[e].recno, recs[e].c, 5, NWC );
+      }
+   }
+
+
+   /*
+   Return the entry holding record `recno' of type `type' of file
+   `handle', or NIL if the record is not buffered.
+   */
+   static int find ( integer handle, integer recno, integer type )
+   {
+      int                     e;
+
+      for ( e = htab[ slot(handle, recno) ];  e != NIL;  e = ents[e].hnext )
+      {
+         if (    ( ents[e].recno  == recno  )
+              && ( ents[e].handle == handle )
+              && ( ents[e].type   == type   )  )
+         {
+            return e;
+         }
+      }
+
+      return NIL;
+   }
+
+
+   /*
+   Return the entry holding record `recno' of type `type' of file
+   `handle', making it the most recently used.  If the record is not
+   buffered, allocate an entry for it, replacing the least recently
+   used entry if none is free, and read the record into it if `rdflag'
+   is true.  Return NIL if an error occurs.
+   */
+   static int lookup ( integer       * handle,
+                       integer       * recno,
+                       integer         type,
+                       SpiceBoolean    rdflag,
+                       char          * name    )
+   {
+      int                     e;
+      int                     h;
+      integer                 unit;
+      logical                 lock;
+
+      if ( pass1 )
+      {
+         init ( DEFSZ, 2*DEFSZ, defent, defrec, defhsh, defsrt );
+      }
+
+      h = slot ( *handle, *recno );
+      e = find ( *handle, *recno, type );
+
+      if ( e != NIL )
+      {
+         if ( e != head )
+         {
+            detach ( e );
+
+            ents[e].hnext = htab[h];
+            htab[h]       = e;
+
+            tohead ( e );
+         }
+
+         return e;
+      }
+
+      /*
+      The record is not buffered.  Since there is file I/O to do,
+      participate in error tracing.
+      */
+      chkin_c ( name );
+
+      if ( free1 != NIL )
+      {
+         e     = free1;
+         free1 = ents[e].next;
+      }
+      else
+      {
+         e = tail;
+
+         detach ( e );
+
+         if ( ents[e].dirty )
+         {
+            wrrec ( e );
+
+            if ( failed_() )
+            {
+               release ( e );
+
+               chkout_c ( name );
+               return NIL;
+            }
+         }
+      }
+
+      if ( rdflag )
+      {
+         if ( type == DP )
+         {
+            zzdasgrd_ ( handle, recno, recs[e].d );
+         }
+         else if ( type == INT )
+         {
+            zzdasgri_ ( handle, recno, recs[e].i );
+         }
+         else
+         {
+            lock = SPICEFALSE;
+
+            zzddhhlu_ ( handle, "DAS", &lock, &unit, 3 );
+
+            if ( !failed_() )
+            {
+               dasioc_ ( "READ", &unit, recno, recs[e].c, 4, NWC );
+            }
+         }
+
+         ++nread;
+
+         if ( failed_() )
+         {
+            release ( e );
+
+            chkout_c ( name );
+            return NIL;
+         }
+      }
+
+      ents[e].handle = *handle;
+      ents[e].recno  = *recno;
+      ents[e].type   = type;
+      ents[e].dirty  = SPICEFALSE;
+
+      ents[e].hnext  = htab[h];
+      htab[h]        = e;
+
+      tohead ( e );
+
+      chkout_c ( name );
+      return e;
+   }
+
+
+   /*
+   Copy `n' characters from `src', of length `srclen', to `dst',
+   padding with blanks.
+   */
+   static void chcopy ( char     * dst,
+                        integer    n,
+                        char     * src,
+                        ftnlen     srclen )
+   {
+      if ( srclen >= n )
+      {
+         memcpy ( dst, src, (size_t)n );
+      }
+      else
+      {
+         memcpy ( dst,          src, (size_t)srclen       );
+         memset ( dst + srclen, ' ', (size_t)(n - srclen) );
+      }
+   }
+
+
+   int zzdasbrd_ ( integer      * handle,
+                   integer      * recno,
+                   integer      * first,
+                   integer      * last,
+                   doublereal   * datad   )
+   {
+      int                     e;
+
+      ++nreq;
+
+      e = lookup ( handle, recno, DP, SPICETRUE, "ZZDASBRD" );
+
+      if ( e != NIL )
+      {
+         memcpy ( datad,
+                  recs[e].d + *first - 1,
+                  (size_t)(*last - *first + 1) * sizeof(doublereal) );
+      }
+
+      return 0;
+   }
+
+
+   int zzdasbri_ ( integer      * handle,
+                   integer      * recno,
+                   integer      * first,
+                   integer      * last,
+                   integer      * datai   )
+   {
+      int                     e;
+
+      ++nreq;
+
+      e = lookup ( handle, recno, INT, SPICETRUE, "ZZDASBRI" );
+
+      if ( e != NIL )
+      {
+         memcpy ( datai,
+                  recs[e].i + *first - 1,
+                  (size_t)(*last - *first + 1) * sizeof(integer) );
+      }
+
+      return 0;
+   }
+
+
+   int zzdasbrc_ ( integer      * handle,
+                   integer      * recno,
+                   integer      * first,
+                   integer      * last,
+                   char         * datac,
+                   ftnlen         datac_len )
+   {
+      int                     e;
+      integer                 n;
+
+      ++nreq;
+
+      e = lookup ( handle, recno, CHR, SPICETRUE, "ZZDASBRC" );
+
+      if ( e != NIL )
+      {
+         n = *last - *first + 1;
+
+         if ( datac_len <= n )
+         {
+            memcpy ( datac, recs[e].c + *first - 1, (size_t)datac_len );
+         }
+         else
+         {
+            memcpy ( datac,     recs[e].c + *first - 1, (size_t)n );
+            memset ( datac + n, ' ', (size_t)(datac_len - n)    );
+         }
+      }
+
+      return 0;
+   }
+
+
+   int zzdasbwd_ ( integer      * handle,
+                   integer      * recno,
+                   doublereal   * recd    )
+   {
+      int                     e;
+
+      e = lookup ( handle, recno, DP, SPICEFALSE, "ZZDASBWD" );
+
+      if ( e != NIL )
+      {
+         memcpy ( recs[e].d, recd, NWD * sizeof(doublereal) );
+
+         ents[e].dirty = SPICETRUE;
+      }
+
+      return 0;
+   }
+
+
+   int zzdasbwi_ ( integer      * handle,
+                   integer      * recno,
+                   integer      * reci    )
+   {
+      int                     e;
+
+      e = lookup ( handle, recno, INT, SPICEFALSE, "ZZDASBWI" );
+
+      if ( e != NIL )
+      {
+         memcpy ( recs[e].i, reci, NWI * sizeof(integer) );
+
+         ents[e].dirty = SPICETRUE;
+      }
+
+      return 0;
+   }
+
+
+   int zzdasbwc_ ( integer      * handle,
+                   integer      * recno,
+                   char         * recc,
+                   ftnlen         recc_len )
+   {
+      int                     e;
+
+      e = lookup ( handle, recno, CHR, SPICEFALSE, "ZZDASBWC" );
+
+      if ( e != NIL )
+      {
+         chcopy ( recs[e].c, NWC, recc, recc_len );
+
+         ents[e].dirty = SPICETRUE;
+      }
+
+      return 0;
+   }
+
+
+   int zzdasbud_ ( integer      * handle,
+                   integer      * recno,
+                   integer      * first,
+                   integer      * last,
+                   doublereal   * datad   )
+   {
+      int                     e;
+
+      ++nreq;
+
+      e = lookup ( handle, recno, DP, SPICETRUE, "ZZDASBUD" );
+
+      if ( e != NIL )
+      {
+         memcpy ( recs[e].d + *first - 1,
+                  datad,
+                  (size_t)(*last - *first + 1) * sizeof(doublereal) );
+
+         ents[e].dirty = SPICETRUE;
+      }
+
+      return 0;
+   }
+
+
+   int zzdasbui_ ( integer      * handle,
+                   integer      * recno,
+                   integer      * first,
+                   integer      * last,
+                   integer      * datai   )
+   {
+      int                     e;
+
+      ++nreq;
+
+      e = lookup ( handle, recno, INT, SPICETRUE, "ZZDASBUI" );
+
+      if ( e != NIL )
+      {
+         memcpy ( recs[e].i + *first - 1,
+                  datai,
+                  (size_t)(*last - *first + 1) * sizeof(integer) );
+
+         ents[e].dirty = SPICETRUE;
+      }
+
+      return 0;
+   }
+
+
+   int zzdasbuc_ ( integer      * handle,
+                   integer      * recno,
+                   integer      * first,
+                   integer      * last,
+                   char         * datac,
+                   ftnlen         datac_len )
+   {
+      int                     e;
+
+      ++nreq;
+
+      e = lookup ( handle, recno, CHR, SPICETRUE, "ZZDASBUC" );
+
+      if ( e != NIL )
+      {
+         chcopy ( recs[e].c + *first - 1,
+                  *last - *first + 1,
+                  datac,
+                  datac_len                );
+
+         ents[e].dirty = SPICETRUE;
+      }
+
+      return 0;
+   }
+
+
+   /*
+   Return the logical unit of the file `handle' in `unit', and true if
+   the file has the native binary format, so that its records may be
+   read by DASIOD and DASIOI.  Non-native records must be translated
+   by ZZDASGRD and ZZDASGRI.
+   */
+   static SpiceBoolean natunt ( integer * handle, integer * unit )
+   {
+      static integer          natbff = 0;
+
+      char                    fname  [255];
+      integer                 arch;
+      integer                 bff;
+      integer                 amh;
+      logical                 found;
+      logical                 lock;
+
+      if ( natbff == 0 )
+      {
+         zzddhnfc_ ( &natbff );
+      }
+
+      zzddhnfo_ ( handle, fname, &arch, &bff, &amh, &found, 255 );
+
+      if ( failed_()  ||  !found  ||  ( bff != natbff ) )
+      {
+         return SPICEFALSE;
+      }
+
+      lock = SPICEFALSE;
+
+      zzddhhlu_ ( handle, "DAS", &lock, unit, 3 );
+
+      return !failed_();
+   }
+
+
+   int zzdasbxd_ ( integer      * handle,
+                   integer      * recno,
+                   integer      * n,
+                   doublereal   * datad   )
+   {
+      SpiceBoolean            native;
+      int                     e;
+      integer                 k;
+      integer                 r;
+      integer                 unit;
+
+      if ( pass1 )
+      {
+         init ( DEFSZ, 2*DEFSZ, defent, defrec, defhsh, defsrt );
+      }
+
+      chkin_c ( "ZZDASBXD" );
+
+      native = natunt ( handle, &unit );
+
+      for ( k = 0;  ( k < *n ) && !failed_();  k++ )
+      {
+         r = *recno + k;
+         e = find ( *handle, r, DP );
+
+         if ( e != NIL )
+         {
+            memcpy ( datad + k*NWD, recs[e].d, NWD * sizeof(doublereal) );
+         }
+         else
+         {
+            if ( native )
+            {
+               dasiod_ ( "READ", &unit, &r, datad + k*NWD, 4 );
+            }
+            else
+            {
+               zzdasgrd_ ( handle, &r, datad + k*NWD );
+            }
+
+            ++nread;
+         }
+      }
+
+      nreq += *n;
+
+      chkout_c ( "ZZDASBXD" );
+      return 0;
+   }
+
+
+   int zzdasbxi_ ( integer      * handle,
+                   integer      * recno,
+                   integer      * n,
+                   integer      * datai   )
+   {
+      SpiceBoolean            native;
+      int                     e;
+      integer                 k;
+      integer                 r;
+      integer                 unit;
+
+      if ( pass1 )
+      {
+         init ( DEFSZ, 2*DEFSZ, defent, defrec, defhsh, defsrt );
+      }
+
+      chkin_c ( "ZZDASBXI" );
+
+      native = natunt ( handle, &unit );
+
+      for ( k = 0;  ( k < *n ) && !failed_();  k++ )
+      {
+         r = *recno + k;
+         e = find ( *handle, r, INT );
+
+         if ( e != NIL )
+         {
+            memcpy ( datai + k*NWI, recs[e].i, NWI * sizeof(integer) );
+         }
+         else
+         {
+            if ( native )
+            {
+               dasioi_ ( "READ", &unit, &r, datai + k*NWI, 4 );
+            }
+            else
+            {
+               zzdasgri_ ( handle, &r, datai + k*NWI );
+            }
+
+            ++nread;
+         }
+      }
+
+      nreq += *n;
+
+      chkout_c ( "ZZDASBXI" );
+      return 0;
+   }
+
+
+   static int byrec ( const void * a, const void * b )
+   {
+      integer                 ra;
+      integer                 rb;
+
+      ra = ents[ *(const int *)a ].recno;
+      rb = ents[ *(const int *)b ].recno;
+
+      return ( ra < rb ) ? -1 : ( ra > rb );
+   }
+
+
+   int zzdasbwb_ ( integer      * handle )
+   {
+      int                     e;
+      int                     i;
+      int                     n;
+
+      if ( pass1 )
+      {
+         return 0;
+      }
+
+      chkin_c ( "ZZDASBWB" );
+
+      /*
+      Collect the entries of the file and remove them from the buffer,
+      then write the updated records in order of record number.
+      */
+      n = 0;
+
+      for ( e = head;  e != NIL;  e = ents[e].next )
+      {
+         if ( ents[e].handle == *handle )
+         {
+            sorted[n++] = e;
+         }
+      }
+
+      for ( i = 0;  i < n;  i++ )
+      {
+         detach ( sorted[i] );
+      }
+
+      qsort ( sorted, (size_t)n, sizeof(int), byrec );
+
+      for ( i = 0;  i < n;  i++ )
+      {
+         e = sorted[i];
+
+         if ( ents[e].dirty && !failed_() )
+         {
+            wrrec ( e );
+         }
+
+         release ( e );
+      }
+
+      chkout_c ( "ZZDASBWB" );
+      return 0;
+   }
+
+
+   int zzdasbiv_ ( integer      * handle )
+   {
+      int                     e;
+      int                     i;
+      int                     n;
+
+      if ( pass1 )
+      {
+         return 0;
+      }
+
+      n = 0;
+
+      for ( e = head;  e != NIL;  e = ents[e].next )
+      {
+         if ( ents[e].handle == *handle )
+         {
+            sorted[n++] = e;
+         }
+      }
+
+      for ( i = 0;  i < n;  i++ )
+      {
+         detach  ( sorted[i] );
+         release ( sorted[i] );
+      }
+
+      return 0;
+   }
+
+
+   int zzdasbsz_ ( integer      * nrec )
+   {
+      int                     e;
+      int                     nhash;
+      size_t                  n;
+
+      void                  * mem    [4];
+
+      if ( return_c() )
+      {
+         return 0;
+      }
+
+      chkin_c ( "ZZDASBSZ" );
+
+      if ( *nrec < MINSZ )
+      {
+         setmsg_c ( "The DAS record buffer size must be at least #; "
+                    "the requested size was #."                       );
+         errint_c ( "#",  MINSZ                                       );
+         errint_c ( "#",  *nrec                                       );
+         sigerr_c ( "SPICE(INVALIDSIZE)"                              );
+         chkout_c ( "ZZDASBSZ"                                       );
+         return 0;
+      }
+
+      /*
+      Write all updated records.
+      */
+      if ( !pass1 )
+      {
+         for ( e = head;  ( e != NIL ) && !failed_();  e = ents[e].next )
+         {
+            if ( ents[e].dirty )
+            {
+               wrrec ( e );
+            }
+         }
+
+         if ( failed_() )
+         {
+            chkout_c ( "ZZDASBSZ" );
+            return 0;
+         }
+      }
+
+      if ( ents != defent )
+      {
+         free ( ents   );
+         free ( recs   );
+         free ( htab   );
+         free ( sorted );
+      }
+
+      if ( *nrec <= DEFSZ )
+      {
+         init ( *nrec, 2*DEFSZ, defent, defrec, defhsh, defsrt );
+
+         chkout_c ( "ZZDASBSZ" );
+         return 0;
+      }
+
+      n     = (size_t)(*nrec);
+      nhash = 2*DEFSZ;
+
+      while ( (size_t)nhash < 2*n )
+      {
+         nhash *= 2;
+      }
+
+      mem[0] = malloc ( n * sizeof(Entry)  );
+      mem[1] = malloc ( n * sizeof(Record) );
+      mem[2] = malloc ( (size_t)nhash * sizeof(int) );
+      mem[3] = malloc ( n * sizeof(int)    );
+
+      if ( !mem[0] || !mem[1] || !mem[2] || !mem[3] )
+      {
+         free ( mem[0] );
+         free ( mem[1] );
+         free ( mem[2] );
+         free ( mem[3] );
+
+         init ( DEFSZ, 2*DEFSZ, defent, defrec, defhsh, defsrt );
+
+         setmsg_c ( "Memory for a DAS record buffer of # records could "
+                    "not be allocated."                                  );
+         errint_c ( "#",  *nrec                                          );
+         sigerr_c ( "SPICE(MALLOCFAILED)"                                );
+         chkout_c ( "ZZDASBSZ"                                          );
+         return 0;
+      }
+
+      init ( (int)n, nhash, mem[0], mem[1], mem[2], mem[3] );
+
+      chkout_c ( "ZZDASBSZ" );
+      return 0;
+   }
+
+
+   int zzdasnrr_ ( integer      * reads,
+                   integer      * reqs   )
+   {
+      *reads = nread;
+      *reqs  = nreq;
+
+      return 0;
+   }
@@ -0,0 +1,506 @@
+/*
+
+-Procedure zzdascm ( DAS cluster map )
+
+-Abstract
+
+   SPICE Private routine intended solely for the support of SPICE
+   routines.  Users should not call this routine directly due
+   to the volatile nature of this routine.
+
+   Find the cluster of a DAS file containing a given logical address,
+   using a map of the file's clusters held in memory.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   DAS
+
+-Keywords
+
+   DAS
+   FILES
+   PRIVATE
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   handle     I   DAS file handle.
+   fwrd       I   Record number of the first directory record.
+   type       I   Data type: 1 = character, 2 = d.p., 3 = integer.
+   addrss     I   Logical address.
+   clbase     O   Number of the first record of the cluster.
+   clsize     O   Number of records in the cluster.
+   hiaddr     O   Last logical address of the cluster.
+   MAXMAP     P   Number of files whose maps are held.
+
+-Detailed_Input
+
+   handle      is the handle of an open DAS file.
+
+   fwrd        is the record number of the first directory record of
+               the file, which follows its reserved and comment
+               records.
+
+   type        is the data type of the logical address `addrss':
+               1 for character, 2 for double precision and 3 for
+               integer data.
+
+   addrss      is a logical address of the given type.  The caller
+               must ensure that the address is in use in the file.
+
+-Detailed_Output
+
+   clbase      is the number of the first record of the cluster of
+               the file containing the address `addrss'.
+
+   clsize      is the number of records in the cluster.
+
+   hiaddr      is the logical address of the last word of the last
+               record of the cluster.
+
+-Parameters
+
+   MAXMAP      is the number of files whose cluster maps are held at
+               once.  When a map is needed for another file, the
+               least recently used map is replaced.
+
+-Exceptions
+
+   1)  If the cluster containing `addrss' is not found in the
+       directory records of the file, the error
+       SPICE(BADDASDIRECTORY) is signaled.
+
+   2)  If memory for the map cannot be allocated, the error
+       SPICE(MALLOCFAILED) is signaled.
+
+   3)  Errors reading the directory records are signaled by routines
+       in the call tree of this routine.
+
+   After an error, the map of the file is discarded.
+
+-Files
+
+   See argument `handle'.
+
+-Particulars
+
+   The clusters of a DAS file are described by a chain of directory
+   records.  DASA2L formerly found the cluster containing an address
+   by reading the directory records in order until it found the one
+   covering the address, then adding up the sizes of the clusters
+   the record describes.  Files with many clusters, such as EK files
+   being written, spent most of their time in these searches.
+
+   This routine reads the directory records of a file once, and
+   keeps, for each data type, the list of the file's clusters of
+   that type in order of address.  The cluster containing an address
+   is found in the list by binary search.
+
+   DAS files are only appended to: a cluster can grow only if it is
+   the last cluster of the file, and new clusters are described by
+   the last directory record or by records added after it.  When an
+   address past the last mapped cluster of its type is requested,
+   the clusters of the last directory record read and any records
+   following it are read again, so that the map follows the appends
+   made through DASCUD.
+
+   Adding or removing comment records moves the directory records,
+   and segregating a file rewrites them.  DASACR, DASRCR and DASSDR,
+   which do this, call the entry point zzdascmi to discard the map
+   of the file; the map is rebuilt when it is next needed.  The map
+   is also rebuilt if `fwrd' changes.
+
+-Examples
+
+   See DASA2L.
+
+-Restrictions
+
+   1)  The map of a file is valid only while the file is open.  DAS
+       handles are not reused, so the map of a closed file is never
+       used again; it is replaced when room is needed.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 19-OCT-2026 (NZL)
+
+-Index_Entries
+
+   map das logical addresses to clusters
+
+-&
+*/
+
+   #include <stdlib.h>
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+
+
+   /*
+   Local parameters
+   */
+   #define MAXMAP          20
+   #define NDIRWD          256
+   #define DSCLOC          10
+   #define TYPLOC          9
+   #define FWDLOC          2
+   #define MINCAP          64
+
+
+   /*
+   A cluster of one data type, and the map of one file.  For each
+   type t, cl[t][0 : n[t]-1] are the file's clusters of that type in
+   order of address.  The clusters described by directory records
+   preceding `lstdir', the last directory record read, number
+   nprev[t].
+   */
+   typedef struct
+   {
+      integer          hiaddr;
+      integer          base;
+      integer          size;
+
+   } Cluster;
+
+   typedef struct
+   {
+      integer          handle;
+      integer          fwrd;
+      integer          lstdir;
+      integer          nprev  [3];
+      integer          n      [3];
+      integer          cap    [3];
+      Cluster        * cl     [3];
+      unsigned long    stamp;
+
+   } Map;
+
+
+   /*
+   Static variables
+   */
+   static Map              maps   [MAXMAP];
+
+   static unsigned long    tick   = 0;
+   static int              lastm  = 0;
+
+   static integer          next   [3] = { 2, 3, 1 };
+   static integer          prev   [3] = { 3, 1, 2 };
+   static integer          nw     [3] = { 1024, 128, 256 };
+   static integer          rngloc [3] = { 3, 5, 7 };
+
+
+   static void discard ( Map * m )
+   {
+      m->handle = 0;
+      m->stamp  = 0;
+   }
+
+
+   /*
+   Add a cluster of type index t to map `m'.  Return SPICEFALSE if
+   memory cannot be allocated.
+   */
+   static SpiceBoolean append ( Map      * m,
+                                int        t,
+                                integer    hiaddr,
+                                integer    base,
+                                integer    size   )
+   {
+      Cluster               * p;
+      integer                 cap;
+
+      if ( m->n[t] == m->cap[t] )
+      {
+         cap = ( m->cap[t] > 0 ) ? 2 * m->cap[t] : MINCAP;
+
+         p = (Cluster *) realloc ( m->cl[t],  (size_t)cap * sizeof(Cluster) );
+
+         if ( !p )
+         {
+            return SPICEFALSE;
+         }
+
+         m->cl [t] = p;
+         m->cap[t] = cap;
+      }
+
+      p = m->cl[t] + m->n[t];
+
+      p->hiaddr = hiaddr;
+      p->base   = base;
+      p->size   = size;
+
+      ++ m->n[t];
+
+      return SPICETRUE;
+   }
+
+
+   /*
+   Read the directory records of the file of map `m', starting with
+   record m->lstdir, and add the clusters they describe to the map.
+   The clusters of record m->lstdir itself, which may have grown
+   since they were read, replace those read before.
+   */
+   static void scan ( Map * m )
+   {
+      integer                 base;
+      integer                 dirrec [NDIRWD];
+      integer                 first;
+      integer                 hi     [3];
+      integer                 last;
+      integer                 rec;
+      integer                 size;
+      int                     cur;
+      int                     loc;
+      int                     prvtyp;
+      int                     t;
+
+      first = 1;
+      last  = NDIRWD;
+
+      for ( t = 0;  t < 3;  t++ )
+      {
+         m->n[t] = m->nprev[t];
+      }
+
+      rec = m->lstdir;
+
+      while ( rec > 0 )
+      {
+         dasrri_ ( &m->handle, &rec, &first, &last, dirrec );
+
+         if ( failed_() )
+         {
+            return;
+         }
+
+         m->lstdir = rec;
+
+         for ( t = 0;  t < 3;  t++ )
+         {
+            m->nprev[t] = m->n[t];
+            hi[t]       = dirrec[ rngloc[t] - 1 ] - 1;
+         }
+
+         /*
+         A directory record added when its predecessor filled up has
+         no clusters until data are added to it.
+         */
+         if (  ( dirrec[TYPLOC-1] >= 1 )  &&  ( dirrec[TYPLOC-1] <= 3 )  )
+         {
+            prvtyp = prev[ dirrec[TYPLOC-1] - 1 ];
+            base   = rec + 1;
+
+            for ( loc = DSCLOC;
+                  ( loc <= NDIRWD ) && ( dirrec[loc-1] != 0 );
+                  loc++                                        )
+            {
+               if ( dirrec[loc-1] > 0 )
+               {
+                  cur = next[ prvtyp - 1 ];
+               }
+               else
+               {
+                  cur = prev[ prvtyp - 1 ];
+               }
+
+               size       = ( dirrec[loc-1] < 0 ) ? -dirrec[loc-1]
+                                                : dirrec[loc-1];
+               hi[cur-1] += nw[cur-1] * size;
+
+               if ( !append( m, cur-1, hi[cur-1], base, size ) )
+               {
+                  setmsg_c ( "Memory for the cluster map of the DAS "
+                             "file with handle # could not be "
+                             "allocated."                             );
+                  errint_c ( "#",  m->handle                          );
+                  sigerr_c ( "SPICE(MALLOCFAILED)"                    );
+                  return;
+               }
+
+               base  += size;
+               prvtyp = cur;
+            }
+         }
+
+         rec = dirrec[FWDLOC-1];
+      }
+   }
+
+
+   int zzdascm_ ( integer      * handle,
+                  integer      * fwrd,
+                  integer      * type,
+                  integer      * addrss,
+                  integer      * clbase,
+                  integer      * clsize,
+                  integer      * hiaddr  )
+   {
+      Cluster               * cl;
+      Map                   * m;
+      int                     i;
+      int                     lo;
+      int                     hi;
+      int                     mid;
+      int                     t;
+
+      /*
+      Find the map of the file, or replace the least recently used
+      map with a new, empty one.
+      */
+      if ( maps[lastm].handle != *handle )
+      {
+         for ( i = 0;  ( i < MAXMAP ) && ( maps[i].handle != *handle );  i++ )
+         {
+         }
+
+         if ( i == MAXMAP )
+         {
+            i = 0;
+
+            for ( mid = 1;  mid < MAXMAP;  mid++ )
+            {
+               if ( maps[mid].stamp < maps[i].stamp )
+               {
+                  i = mid;
+               }
+            }
+
+            maps[i].handle = *handle;
+            maps[i].fwrd   = 0;
+         }
+
+         lastm = i;
+      }
+
+      m        = maps + lastm;
+      m->stamp = ++tick;
+
+      if ( m->fwrd != *fwrd )
+      {
+         m->fwrd   = *fwrd;
+         m->lstdir = *fwrd;
+
+         for ( t = 0;  t < 3;  t++ )
+         {
+            m->nprev[t] = 0;
+            m->n    [t] = 0;
+         }
+      }
+
+      t = *type - 1;
+
+      if (  ( m->n[t] == 0 )  ||  ( m->cl[t][m->n[t]-1].hiaddr < *addrss )  )
+      {
+         chkin_c ( "ZZDASCM" );
+
+         scan ( m );
+
+         if ( failed_() )
+         {
+            discard ( m );
+
+            chkout_c ( "ZZDASCM" );
+            return 0;
+         }
+
+         chkout_c ( "ZZDASCM" );
+      }
+
+      /*
+      Find the first cluster whose last address is at or above the
+      input address.
+      */
+      cl = m->cl[t];
+      lo = 0;
+      hi = m->n[t];
+
+      while ( lo < hi )
+      {
+         mid = ( lo + hi ) / 2;
+
+         if ( cl[mid].hiaddr < *addrss )
+         {
+            lo = mid + 1;
+         }
+         else
+         {
+            hi = mid;
+         }
+      }
+
+      if ( lo == m->n[t] )
+      {
+         discard ( m );
+
+         chkin_c  ( "ZZDASCM" );
+         setmsg_c ( "The directory records of the DAS file with handle "
+                    "# are probably corrupted.  No cluster containing "
+                    "address # of data type # was found, though one "
+                    "should have been."                                 );
+         errint_c ( "#",  *handle                                       );
+         errint_c ( "#",  *addrss                                       );
+         errint_c ( "#",  *type                                         );
+         sigerr_c ( "SPICE(BADDASDIRECTORY)"                            );
+         chkout_c ( "ZZDASCM"                                           );
+         return 0;
+      }
+
+      *clbase = cl[lo].base;
+      *clsize = cl[lo].size;
+      *hiaddr = cl[lo].hiaddr;
+
+      return 0;
+   }
+
+
+   int zzdascmi_ ( integer      * handle )
+   {
+      int                     i;
+
+      for ( i = 0;  i < MAXMAP;  i++ )
+      {
+         if ( maps[i].handle == *handle )
+         {
+            discard ( maps + i );
+         }
+      }
+
+      return 0;
+   }
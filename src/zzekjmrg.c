@@ -0,0 +1,1077 @@
+/*
+
+-Procedure zzekjmrg ( EK, in-memory merge join, umbrella )
+
+-Abstract
+
+   SPICE Private routine intended solely for the support of SPICE
+   routines.  Users should not call this routine directly due
+   to the volatile nature of this routine.
+
+   Execute the row vector matching step of an EK join on key values
+   held in memory, and keep a record of the join methods used by the
+   most recent EK search.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   EK
+
+-Keywords
+
+   EK
+   PRIVATE
+
+-Brief_I/O
+
+   See the individual routines.
+
+-Detailed_Input
+
+   See the individual routines.
+
+-Detailed_Output
+
+   See the individual routines.
+
+-Parameters
+
+   MEMLIM      is the largest number of key values, summed over both
+               sides of a join, that will be held in memory.  Joins
+               of larger row sets are executed by reading key values
+               from the EK as needed.
+
+   MAXSTP      is the number of join steps recorded for a search.
+               Further steps are counted but not recorded.
+
+-Exceptions
+
+   The routines in this file do not signal errors.  Errors signaled
+   by the EK readers they call are left for the caller to detect.
+
+-Files
+
+   This routine reads from EK files loaded by EKLEF and from the EK
+   scratch area.
+
+-Particulars
+
+   Routines coded in this file:
+
+      zzekjmpr_      Prepare an in-memory join of two row vector sets.
+      zzekjmnx_      Return the next candidate pair of row vectors.
+      zzekjmrs_      Start the join record of a new search.
+      zzekjmlg_      Record the method used to join a segment vector
+                     pair.
+      zzekjmsp_      Record the completion of a join step.
+      zzekjmst_c     Return the record of a join step.
+
+   These routines have f2c-style calling sequences, except for
+   zzekjmst_c, so that they can be called by the EK query routines.
+
+   ZZEKJPRP and ZZEKJNXT join the row vectors of two segment vectors
+   by sorting both sets on the columns of one equality or order join
+   constraint and then walking the two order vectors. Both the sort
+   and the walk compare column entries read from the EK on each
+   comparison, so joins of large tables spend nearly all their time
+   re-reading the same key values.
+
+   zzekjmpr_ reads each key value once, builds both order vectors in
+   memory and runs the walk of ZZEKJNXT on the buffered values.  The
+   order vectors are built with the Shell sort of ZZEKJSRT and the
+   comparisons of ZZEKJSRT, ZZEKECMP and ZZEKVCMP, so the candidate
+   pairs are produced in exactly the order ZZEKJNXT would produce
+   them, and query results, including the order of rows matched by
+   queries without an ORDER BY clause, are unchanged.
+
+   The join method for each pair of segment vectors is chosen by
+   ZZEKJPRP as follows:
+
+      - If either row vector set is empty, nothing is joined.
+
+      - If no active constraint relates the two sets by one of the
+        operators EQ, LT, LE, GT or GE, every pair of row vectors is
+        tested (nested loop).
+
+      - If the key columns of the chosen constraint are scalar
+        numeric or time columns and the key values fit within MEMLIM,
+        the in-memory merge is used.
+
+      - Otherwise the key values are read from the EK as needed
+        (merge on EK pages).
+
+   A hash join and an index-driven join were considered; both would
+   find the same rows but would return rows having equal keys in a
+   different order, so neither is used.
+
+   zzekjmrs_, zzekjmlg_ and zzekjmsp_ maintain a record of the join
+   methods used by the most recent search; ekxpln_c formats it.
+
+-Examples
+
+   See ZZEKJTST.
+
+-Restrictions
+
+   1) This is a CSPICE private routine. The interface may be changed
+      without notice, so these routines should not be called except
+      by the EK system.
+
+   2) zzekjmnx_ may be called only after zzekjmpr_ has returned
+      .TRUE., and before the next call to zzekjmpr_.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   in-memory EK join
+
+-&
+*/
+
+   #include <stdlib.h>
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+
+
+   /*
+   Local parameters
+   */
+   #define  MEMLIM         16000000
+   #define  MAXSTP         1000
+
+   /*
+   The row count above which ZZEKJSRT sorts by reading column
+   entries from the EK rather than from memory.
+   */
+   #define  MXJRS          250000
+
+   /*
+   Relational operator codes, as in ekopcd.inc.
+   */
+   #define  EQ             1
+   #define  GE             2
+   #define  GT             3
+   #define  LE             4
+   #define  LT             5
+
+   /*
+   EK data type codes, as in ektype.inc.
+   */
+   #define  DP             2
+   #define  INT            3
+   #define  TIME           4
+
+   /*
+   Join methods.
+   */
+   #define  MEMMRG         1
+   #define  PAGMRG         2
+   #define  NESTED         3
+   #define  EMPTY          4
+   #define  NMETH          4
+
+   /*
+   Column classes of scalar integer and double precision columns.
+   */
+   #define  SCALAR(cls)    (    ( (cls) == 1 ) || ( (cls) == 2 )       \
+                             || ( (cls) == 7 ) || ( (cls) == 8 )  )
+
+
+   /*
+   Buffered keys of one side of a join.  `key' and `null' are indexed
+   by row vector index minus one; `ord' holds the row vector indices
+   in key order.
+   */
+   typedef struct
+   {
+      SpiceInt         n;
+      SpiceDouble    * key;
+      SpiceChar      * null;
+      SpiceInt       * ord;
+
+   } JoinSide;
+
+
+   /*
+   Record of one join step.
+   */
+   typedef struct
+   {
+      SpiceInt         ntab   [2];
+      SpiceInt         nrows  [2];
+      SpiceInt         method [NMETH];
+      SpiceInt         nout;
+
+   } JoinStep;
+
+
+   /*
+   Static variables
+   */
+   static JoinSide         sides  [2];
+   static SpiceInt         jop;
+   static SpiceInt         lptr;
+   static SpiceInt         lcur;
+   static SpiceInt         rptr;
+   static SpiceBoolean     done   = SPICETRUE;
+   static SpiceBoolean     lsmall;
+
+   static JoinStep         steps  [MAXSTP];
+   static SpiceInt         cmeth  [NMETH];
+   static SpiceInt         nstep  = 0;
+
+
+   static void          release ( void );
+
+   static SpiceBoolean  load    ( JoinSide     * side,
+                                  integer      * handle,
+                                  integer      * segdsc,
+                                  integer      * coldsc,
+                                  integer        rvbase,
+                                  integer        nt,
+                                  integer        tab,
+                                  integer        nr     );
+
+   static void          order   ( JoinSide     * side    );
+
+   static SpiceInt      relate  ( SpiceInt       l,
+                                  SpiceInt       r       );
+
+
+
+
+/*
+
+-Procedure zzekjmpr_ ( Prepare in-memory join )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   op         I   Operator code of the join constraint.
+   lhan       I   Handle of the EK containing the LHS column.
+   lsgdsc     I   Segment descriptor of the LHS column's segment.
+   lcldsc     I   Descriptor of the LHS column.
+   lrvbas     I   Scratch area base of the LHS row vector set.
+   lnt        I   Number of tables in the LHS row vectors.
+   ltab       I   Position of the LHS table in the LHS row vectors.
+   lnr        I   Number of LHS row vectors.
+   rhan,
+   rsgdsc,
+   rcldsc,
+   rrvbas,
+   rnt,
+   rtab,
+   rnr        I   The same items for the RHS of the constraint.
+
+   The function returns .TRUE. if the join will be executed in
+   memory.
+
+-Detailed_Input
+
+   op          is the operator code of the join constraint whose
+               columns are used as keys: one of EQ, GE, GT, LE, LT.
+
+   lhan,
+   lsgdsc,
+   lcldsc      are the handle, segment descriptor and column
+               descriptor of the column on the left hand side of the
+               constraint.
+
+   lrvbas      is the scratch area address preceding the first row
+               vector of the set containing the left hand table.  The
+               Ith row vector occupies NT+1 integers starting at
+               lrvbas + (I-1)*(NT+1) + 1.
+
+   lnt,
+   ltab,
+   lnr         are the number of tables in each row vector of that
+               set, the position of the left hand table within the
+               row vectors, and the number of row vectors.
+
+   rhan,
+   rsgdsc,
+   rcldsc,
+   rrvbas,
+   rnt,
+   rtab,
+   rnr         are the corresponding items for the right hand side.
+
+-Detailed_Output
+
+   The function returns .TRUE. if both key columns are scalar numeric
+   or time columns, the key values could be buffered and the order
+   vectors built.  Candidate pairs are then returned by zzekjmnx_.
+
+   The function returns .FALSE. otherwise, in which case the caller
+   must execute the join by reading key values from the EK.
+
+-&
+*/
+
+   logical zzekjmpr_ ( integer   * op,
+                       integer   * lhan,
+                       integer   * lsgdsc,
+                       integer   * lcldsc,
+                       integer   * lrvbas,
+                       integer   * lnt,
+                       integer   * ltab,
+                       integer   * lnr,
+                       integer   * rhan,
+                       integer   * rsgdsc,
+                       integer   * rcldsc,
+                       integer   * rrvbas,
+                       integer   * rnt,
+                       integer   * rtab,
+                       integer   * rnr     )
+{
+   /*
+   Local variables
+   */
+   SpiceInt                lcls;
+   SpiceInt                ltyp;
+   SpiceInt                rcls;
+   SpiceInt                rtyp;
+
+
+   release();
+
+   done = SPICETRUE;
+
+   /*
+   The key columns must hold scalar numeric or time values; ZZEKECMP
+   compares integer and double precision values with each other, but
+   time values only with time values.
+   */
+   lcls = lcldsc[0];
+   rcls = rcldsc[0];
+   ltyp = lcldsc[1];
+   rtyp = rcldsc[1];
+
+   if (  !SCALAR( lcls )  ||  !SCALAR( rcls )  )
+   {
+      return ( SPICEFALSE );
+   }
+
+   if ( ltyp == TIME  ||  rtyp == TIME )
+   {
+      if ( ltyp != rtyp )
+      {
+         return ( SPICEFALSE );
+      }
+   }
+   else if (    ( ltyp != DP && ltyp != INT )
+             || ( rtyp != DP && rtyp != INT ) )
+   {
+      return ( SPICEFALSE );
+   }
+
+   if (  ( *lnr < 1 ) || ( *rnr < 1 ) || ( *lnr > MEMLIM - *rnr )  )
+   {
+      return ( SPICEFALSE );
+   }
+
+   if (    !load ( sides,   lhan, lsgdsc, lcldsc, *lrvbas, *lnt,
+                   *ltab,   *lnr                                  )
+        || !load ( sides+1, rhan, rsgdsc, rcldsc, *rrvbas, *rnt,
+                   *rtab,   *rnr                                  ) )
+   {
+      release();
+
+      return ( SPICEFALSE );
+   }
+
+   /*
+   If a read failed, leave the join empty; the caller will see the
+   error.
+   */
+   if ( failed_() )
+   {
+      release();
+
+      return ( SPICETRUE );
+   }
+
+   order ( sides   );
+   order ( sides+1 );
+
+   /*
+   Initialize the walk as ZZEKJPRP does.
+   */
+   jop    = *op;
+   lsmall = ( jop == LT ) || ( jop == LE );
+   lptr   = 1;
+   lcur   = 1;
+   rptr   = 1;
+   done   = SPICEFALSE;
+
+   return ( SPICETRUE );
+}
+
+
+
+
+/*
+
+-Procedure zzekjmnx_ ( Next in-memory join candidate )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   found      O   Flag indicating whether a pair was found.
+   lrvidx     O   Index of the LHS row vector.
+   rrvidx     O   Index of the RHS row vector.
+
+-Detailed_Output
+
+   found       is .TRUE. if a further pair of row vectors satisfying
+               the join constraint passed to zzekjmpr_ was found.
+
+   lrvidx,
+   rrvidx      are the indices, within the sets passed to zzekjmpr_,
+               of the left and right row vectors of the pair.
+
+-Particulars
+
+   The pairs are returned in the order in which ZZEKJNXT visits them.
+   The caller applies the remaining join constraints.
+
+-&
+*/
+
+   int zzekjmnx_ ( logical   * found,
+                   integer   * lrvidx,
+                   integer   * rrvidx  )
+{
+   /*
+   Local variables
+   */
+   SpiceInt                n1;
+   SpiceInt                n2;
+   SpiceInt                rel;
+   SpiceBoolean            met;
+
+
+   *found = SPICEFALSE;
+
+   n1 = sides[0].n;
+   n2 = sides[1].n;
+
+   if ( jop == EQ )
+   {
+      while ( !done )
+      {
+         rel = relate ( sides[0].ord[lcur-1], sides[1].ord[rptr-1] );
+
+         if ( rel == LT )
+         {
+            if ( lptr < n1 )
+            {
+               ++lptr;
+               lcur = lptr;
+            }
+            else
+            {
+               done = SPICETRUE;
+            }
+         }
+         else if ( rel == EQ )
+         {
+            *found  = SPICETRUE;
+            *lrvidx = sides[0].ord[lcur-1];
+            *rrvidx = sides[1].ord[rptr-1];
+
+            if ( lcur < n1 )
+            {
+               ++lcur;
+            }
+            else if ( rptr < n2 )
+            {
+               ++rptr;
+               lcur = lptr;
+            }
+            else
+            {
+               done = SPICETRUE;
+            }
+
+            return ( 0 );
+         }
+         else
+         {
+            if ( rptr < n2 )
+            {
+               ++rptr;
+               lcur = lptr;
+            }
+            else
+            {
+               done = SPICETRUE;
+            }
+         }
+      }
+   }
+   else
+   {
+      while ( !done )
+      {
+         rel = relate ( sides[0].ord[lptr-1], sides[1].ord[rptr-1] );
+
+         if ( jop == LT )
+         {
+            met = ( rel == LT );
+         }
+         else if ( jop == LE )
+         {
+            met = ( rel != GT );
+         }
+         else if ( jop == GT )
+         {
+            met = ( rel == GT );
+         }
+         else
+         {
+            met = ( rel != LT );
+         }
+
+         if ( met )
+         {
+            *found  = SPICETRUE;
+            *lrvidx = sides[0].ord[lptr-1];
+            *rrvidx = sides[1].ord[rptr-1];
+         }
+
+         /*
+         Advance the pointers as ZZEKJNXT does.  A pair that fails
+         the constraint never leads back to the start of the other
+         order vector.
+         */
+         if ( lsmall )
+         {
+            if ( rptr < n2 )
+            {
+               ++rptr;
+            }
+            else if ( met && ( lptr < n1 ) )
+            {
+               ++lptr;
+               rptr = 1;
+            }
+            else
+            {
+               done = SPICETRUE;
+            }
+         }
+         else
+         {
+            if ( lptr < n1 )
+            {
+               ++lptr;
+            }
+            else if ( met && ( rptr < n2 ) )
+            {
+               ++rptr;
+               lptr = 1;
+            }
+            else
+            {
+               done = SPICETRUE;
+            }
+         }
+
+         if ( met )
+         {
+            return ( 0 );
+         }
+      }
+   }
+
+   release();
+
+   return ( 0 );
+}
+
+
+
+
+/*
+
+-Procedure zzekjmrs_ ( Start join record )
+
+-Particulars
+
+   Discard the record of the previous search.  EKSRCH calls this
+   routine at the start of each search.
+
+-&
+*/
+
+   int zzekjmrs_ ( void )
+{
+   SpiceInt                i;
+
+   nstep = 0;
+
+   for ( i = 0;  i < NMETH;  i++ )
+   {
+      cmeth[i] = 0;
+   }
+
+   return ( 0 );
+}
+
+
+
+
+/*
+
+-Procedure zzekjmlg_ ( Record join method )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   method     I   Join method code.
+
+-Detailed_Input
+
+   method      is the method used to join one pair of segment
+               vectors: 1 for the in-memory merge, 2 for the merge on
+               EK pages, 3 for the nested loop, 4 if either row
+               vector set was empty.
+
+-&
+*/
+
+   int zzekjmlg_ ( integer   * method )
+{
+   if (  ( *method >= 1 ) && ( *method <= NMETH )  )
+   {
+      ++cmeth[ *method - 1 ];
+   }
+
+   return ( 0 );
+}
+
+
+
+
+/*
+
+-Procedure zzekjmsp_ ( Record join step )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   nt1,
+   nt2        I   Numbers of tables in the joined row sets.
+   nr1,
+   nr2        I   Numbers of rows in the joined row sets.
+   nrows      I   Number of rows in the result.
+
+-Particulars
+
+   ZZEKJOIN calls this routine after joining two row sets.  The
+   methods recorded by zzekjmlg_ since the previous step are assigned
+   to this step.
+
+-&
+*/
+
+   int zzekjmsp_ ( integer   * nt1,
+                   integer   * nt2,
+                   integer   * nr1,
+                   integer   * nr2,
+                   integer   * nrows )
+{
+   SpiceInt                i;
+
+   if ( nstep < MAXSTP )
+   {
+      steps[nstep].ntab [0] = *nt1;
+      steps[nstep].ntab [1] = *nt2;
+      steps[nstep].nrows[0] = *nr1;
+      steps[nstep].nrows[1] = *nr2;
+      steps[nstep].nout     = *nrows;
+
+      for ( i = 0;  i < NMETH;  i++ )
+      {
+         steps[nstep].method[i] = cmeth[i];
+      }
+   }
+
+   ++nstep;
+
+   for ( i = 0;  i < NMETH;  i++ )
+   {
+      cmeth[i] = 0;
+   }
+
+   return ( 0 );
+}
+
+
+
+
+/*
+
+-Procedure zzekjmst_c ( Return join step record )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   step       I   Index of a join step.
+   nstp       O   Number of join steps of the most recent search.
+   ntab       O   Numbers of tables in the joined row sets.
+   nrows      O   Numbers of rows in the joined row sets.
+   method     O   Numbers of segment vector pairs joined by method.
+   nout       O   Number of rows in the result.
+
+   The function returns SPICETRUE if a record of the step exists.
+
+-Detailed_Input
+
+   step        is the zero-based index of a join step of the most
+               recent EK search.
+
+-Detailed_Output
+
+   nstp        is the number of join steps executed by the most
+               recent search, including any that were not recorded.
+
+   ntab,
+   nrows       are the numbers of tables and rows of the two row sets
+               joined by the step.
+
+   method      contains, for each join method, the number of pairs of
+               segment vectors joined with it: in order, the in-memory
+               merge, the merge on EK pages, the nested loop, and pairs
+               with an empty side.
+
+   nout        is the number of rows produced by the step.
+
+   The function returns SPICEFALSE, and the outputs other than `nstp'
+   are not set, if `step' is out of range or the step was not
+   recorded.
+
+-&
+*/
+
+   SpiceBoolean zzekjmst_c ( SpiceInt     step,
+                             SpiceInt   * nstp,
+                             SpiceInt     ntab   [2],
+                             SpiceInt     nrows  [2],
+                             SpiceInt     method [4],
+                             SpiceInt   * nout        )
+{
+   SpiceInt                i;
+
+   *nstp = nstep;
+
+   if (  ( step < 0 ) || ( step >= nstep ) || ( step >= MAXSTP )  )
+   {
+      return ( SPICEFALSE );
+   }
+
+   for ( i = 0;  i < 2;  i++ )
+   {
+      ntab [i] = steps[step].ntab [i];
+      nrows[i] = steps[step].nrows[i];
+   }
+
+   for ( i = 0;  i < NMETH;  i++ )
+   {
+      method[i] = steps[step].method[i];
+   }
+
+   *nout = steps[step].nout;
+
+   return ( SPICETRUE );
+}
+
+
+
+
+/*
+Free the buffered keys.
+*/
+   static void release ( void )
+{
+   SpiceInt                i;
+
+   for ( i = 0;  i < 2;  i++ )
+   {
+      free ( sides[i].key  );
+      free ( sides[i].null );
+      free ( sides[i].ord  );
+
+      sides[i].key  = 0;
+      sides[i].null = 0;
+      sides[i].ord  = 0;
+      sides[i].n    = 0;
+   }
+}
+
+
+
+
+/*
+Buffer the key values of one side of a join.  The row numbers are
+taken from the row vectors in the scratch area, and the values are
+read with the readers used by ZZEKJSRT and ZZEKECMP.  Returns
+SPICEFALSE if memory could not be allocated.
+*/
+   static SpiceBoolean load ( JoinSide     * side,
+                              integer      * handle,
+                              integer      * segdsc,
+                              integer      * coldsc,
+                              integer        rvbase,
+                              integer        nt,
+                              integer        tab,
+                              integer        nr     )
+{
+   /*
+   Local variables
+   */
+   integer                 beg;
+   integer                 end;
+   integer                 eltidx;
+   integer                 ival;
+   integer                 row;
+   integer               * rvecs;
+
+   logical                 found;
+   logical                 null;
+
+   SpiceInt                i;
+
+
+   side->n    = nr;
+   side->key  = (SpiceDouble *) malloc ( nr * sizeof(SpiceDouble) );
+   side->null = (SpiceChar   *) malloc ( nr * sizeof(SpiceChar)   );
+   side->ord  = (SpiceInt    *) malloc ( nr * sizeof(SpiceInt)    );
+   rvecs      = (integer     *) malloc ( nr * (nt+1) * sizeof(integer) );
+
+   if (    ( side->key == 0 ) || ( side->null == 0 )
+        || ( side->ord == 0 ) || ( rvecs      == 0 ) )
+   {
+      free ( rvecs );
+
+      return ( SPICEFALSE );
+   }
+
+   /*
+   Read all of the row vectors at once.
+   */
+   beg = rvbase + 1;
+   end = rvbase + nr * (nt+1);
+
+   zzeksrd_ ( &beg, &end, rvecs );
+
+   /*
+   The element index is ignored for scalar columns.
+   */
+   eltidx = 1;
+
+   for ( i = 0;  i < nr;  i++ )
+   {
+      row = rvecs[ i*(nt+1) + tab - 1 ];
+
+      if ( coldsc[1] == INT )
+      {
+         zzekrsi_ ( handle, segdsc, coldsc, &row, &eltidx,
+                    &ival,  &null,  &found                );
+
+         side->key[i] = (SpiceDouble) ival;
+      }
+      else
+      {
+         zzekrsd_ ( handle, segdsc, coldsc, &row, &eltidx,
+                    side->key + i,  &null,  &found        );
+      }
+
+      if ( failed_() )
+      {
+         break;
+      }
+
+      side->null[i] = (SpiceChar) ( null != 0 );
+      side->ord [i] = i + 1;
+   }
+
+   free ( rvecs );
+
+   return ( SPICETRUE );
+}
+
+
+
+
+/*
+Sort the order vector of one side.  This is the Shell sort of
+ZZEKJSRT with a single ascending key.  ZZEKJSRT compares buffered
+values when there are at most MXJRS rows and otherwise uses ZZEKVCMP;
+the two tests differ only for NaN values, which ZZEKVCMP treats as
+equal to everything.
+*/
+   static void order ( JoinSide   * side )
+{
+   /*
+   Local variables
+   */
+   SpiceBoolean            dasrul;
+   SpiceBoolean            jle;
+
+   SpiceDouble           * key;
+   SpiceChar             * null;
+   SpiceInt              * ord;
+
+   SpiceInt                gap;
+   SpiceInt                i;
+   SpiceInt                j;
+   SpiceInt                jg;
+   SpiceInt                n;
+   SpiceInt                rj;
+   SpiceInt                rjg;
+
+
+   n      = side->n;
+   key    = side->key  - 1;
+   null   = side->null - 1;
+   ord    = side->ord  - 1;
+   dasrul = ( n > MXJRS );
+
+   gap = n / 2;
+
+   while ( gap > 0 )
+   {
+      for ( i = gap + 1;  i <= n;  i++ )
+      {
+         j = i - gap;
+
+         while ( j > 0 )
+         {
+            jg  = j + gap;
+            rj  = ord[j];
+            rjg = ord[jg];
+
+            if ( null[rj] )
+            {
+               jle = SPICETRUE;
+            }
+            else if ( null[rjg] )
+            {
+               jle = SPICEFALSE;
+            }
+            else if ( dasrul )
+            {
+               jle = !( key[rj] > key[rjg] );
+            }
+            else
+            {
+               jle = ( key[rj] <= key[rjg] );
+            }
+
+            if ( jle )
+            {
+               j = 0;
+            }
+            else
+            {
+               ord[j]  = rjg;
+               ord[jg] = rj;
+            }
+
+            j -= gap;
+         }
+      }
+
+      gap /= 2;
+   }
+}
+
+
+
+
+/*
+Return the relation between the keys of the Ith left and Jth right row
+vectors, as ZZEKECMP does: null values precede all others and are
+equal to each other.
+*/
+   static SpiceInt relate ( SpiceInt   l,
+                            SpiceInt   r )
+{
+   SpiceBoolean            lnull;
+   SpiceBoolean            rnull;
+   SpiceDouble             lkey;
+   SpiceDouble             rkey;
+
+   lnull = sides[0].null[l-1];
+   rnull = sides[1].null[r-1];
+
+   if ( lnull || rnull )
+   {
+      if ( !rnull )
+      {
+         return ( LT );
+      }
+      else if ( !lnull )
+      {
+         return ( GT );
+      }
+
+      return ( EQ );
+   }
+
+   lkey = sides[0].key[l-1];
+   rkey = sides[1].key[r-1];
+
+   if ( lkey < rkey )
+   {
+      return ( LT );
+   }
+   else if ( lkey > rkey )
+   {
+      return ( GT );
+   }
+
+   return ( EQ );
+}
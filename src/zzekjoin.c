@@ -33,7 +33,8 @@ static integer c__0 = 0;
 	    integer *, integer *, integer *, integer *, integer *, integer *, 
 	    integer *, integer *, integer *, integer *, integer *, integer *),
 	     zzekspsh_(integer *, integer *), zzekjnxt_(logical *, integer *),
-	     zzekstop_(integer *);
+	     zzekstop_(integer *), zzekjmsp_(integer *, integer *, integer *, 
+	    integer *, integer *);
     integer i__;
     extern /* Subroutine */ int chkin_(char *, ftnlen);
     logical found;
@@ -1002,6 +1003,17 @@ static integer c__0 = 0;
     i__2 = *jbase3 + 2;
     zzeksupd_(&i__1, &i__2, nrows);
 
+/*     Record the table and row counts of this join step, along with */
+/*     the output row count, for use by EKXPLN. */
+
+    i__1 = *jbase1 + 2;
+    i__2 = *jbase1 + 2;
+    zzeksrd_(&i__1, &i__2, &nr1);
+    i__1 = *jbase2 + 2;
+    i__2 = *jbase2 + 2;
+    zzeksrd_(&i__1, &i__2, &nr2);
+    zzekjmsp_(&nt1, &nt2, &nr1, &nr2, nrows);
+
 /*     We've constructed the output join row set resulting from */
 /*     joining the input row sets. */
 
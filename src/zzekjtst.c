@@ -14,6 +14,8 @@ static integer c__0 = 0;
 static integer c__7 = 7;
 static integer c__2 = 2;
 static integer c__5 = 5;
+static integer c__4 = 4;
+static integer c__3 = 3;
 
 /* $Procedure  ZZEKJTST  ( Test join candidates ) */
 /* Subroutine */ int zzekjtst_0_(int n__, integer *segvec, integer *jbase1, 
@@ -59,7 +61,13 @@ static integer c__5 = 5;
     static integer addrss, ldscrs[1100]	/* was [11][100] */, lovbas, lrvidx, 
 	    minirv[2], offset, nt3, rdscrs[1100]	/* was [11][100] */, 
 	    rovbas, rrvidx, svncon, tab, top;
-    static logical fnd, lsmall;
+    static logical fnd, more, inmem, lsmall;
+    static integer lpos, rpos, lrvbas, rrvbas;
+    extern logical zzekjmpr_(integer *, integer *, integer *, integer *, 
+	    integer *, integer *, integer *, integer *, integer *, integer *, 
+	    integer *, integer *, integer *, integer *, integer *);
+    extern /* Subroutine */ int zzekjmnx_(logical *, integer *, integer *),
+	     zzekjmlg_(integer *);
     extern /* Subroutine */ int sigerr_(char *, ftnlen), chkout_(char *, 
 	    ftnlen), zzeksrd_(integer *, integer *, integer *);
 
@@ -1403,8 +1411,10 @@ L_zzekjprp:
 /*     Not much preparation is required if either input row count is */
 /*     zero, since the cartesian product will be zero. */
 
+    inmem = FALSE_;
     if (*nr1 == 0 || *nr2 == 0) {
 	case__ = 4;
+	zzekjmlg_(&c__4);
 	chkout_("ZZEKJPRP", (ftnlen)8);
 	return 0;
     }
@@ -1523,47 +1533,81 @@ L_zzekjprp:
 
     if (case__ != 3) {
 
-/*        Produce an order vector for the column on the left side of */
-/*        the CNSTR constraint.  We'll do this by turning the set of */
-/*        row vectors we want to sort into a join row set.  We'll */
-/*        create the join row set metadata and just make it point to */
-/*        the collection of row vectors we wish to sort.  Consult the */
-/*        join row set include file for a picture of the data structure */
-/*        we're creating. */
+/*        Locate the row vectors containing the columns on each side */
+/*        of the CNSTR constraint.  Set SVBAS1, SVNT1, SVNR1 and SVRB1 */
+/*        to indicate, respectively, the base address, table count, */
+/*        row count, and row vector base of the join row set containing */
+/*        the parent table of the LHS column.  Set LPOS to the position */
+/*        of that table relative to the tables of its join row set. */
+/*        Set the corresponding items for the RHS column. */
 
-	zzekstop_(&lbase);
 	ltab = cpidx1[cnstr - 1];
 	lcol = clidx1[cnstr - 1];
 	lelt = elts1[cnstr - 1];
-
-/*        Set JBASE to the base address of the join row set containing */
-/*        the table indicated by LTAB.  Set NT, NR and RB to indicate, */
-/*        respectively, the number of tables in this join row set, the */
-/*        number of rows in the join row set, and the base address of the */
-/*        relevant row vector set.  If LTAB is in the second join row */
-/*        set, we'll adjust TAB to indicate position relative to the set */
-/*        of tables defining the second join row set. */
-
 	if (ltab <= *nt1) {
-	    jbase = *jbase1;
-	    nt = *nt1;
-	    nr = *nr1;
-	    rb = *rb1;
-	    tab = ltab;
+	    svbas1 = *jbase1;
+	    svnt1 = *nt1;
+	    svnr1 = *nr1;
+	    svrb1 = *rb1;
+	    lpos = ltab;
+	} else {
+	    svbas1 = *jbase2;
+	    svnt1 = *nt2;
+	    svnr1 = *nr2;
+	    svrb1 = *rb2;
+	    lpos = ltab - *nt1;
+	}
+	rtab = cpidx2[cnstr - 1];
+	rcol = clidx2[cnstr - 1];
+	relt = elts2[cnstr - 1];
+	if (rtab <= *nt1) {
+	    svbas2 = *jbase1;
+	    svnt2 = *nt1;
+	    svnr2 = *nr1;
+	    svrb2 = *rb1;
+	    rpos = rtab;
 	} else {
-	    jbase = *jbase2;
-	    nt = *nt2;
-	    nr = *nr2;
-	    rb = *rb2;
-	    tab = ltab - *nt1;
+	    svbas2 = *jbase2;
+	    svnt2 = *nt2;
+	    svnr2 = *nr2;
+	    svrb2 = *rb2;
+	    rpos = rtab - *nt1;
 	}
 
-/*        Save the dimensions and base addresses we'll need later. */
+/*        If both key columns are scalar numeric or time columns and */
+/*        the key values fit in the memory budget, ZZEKJMPR buffers the */
+/*        keys and builds both order vectors in memory.  ZZEKJMNX will */
+/*        then hand back the matching row vector pairs in the same order */
+/*        as the merge below would. */
+
+	lrvbas = svbas1 + svrb1;
+	rrvbas = svbas2 + svrb2;
+	inmem = zzekjmpr_(&ops[cnstr - 1], &lhans[cnstr - 1], &lsdsc[cnstr * 
+		24 - 24], &ldscrs[cnstr * 11 - 11], &lrvbas, &svnt1, &lpos, &
+		svnr1, &rhans[cnstr - 1], &rsdsc[cnstr * 24 - 24], &rdscrs[
+		cnstr * 11 - 11], &rrvbas, &svnt2, &rpos, &svnr2);
+	if (inmem) {
+	    zzekjmlg_(&c__1);
+	} else {
+	    zzekjmlg_(&c__2);
+	}
+    }
+    if (case__ != 3 && ! inmem) {
+
+/*        Produce an order vector for the column on the left side of */
+/*        the CNSTR constraint.  We'll do this by turning the set of */
+/*        row vectors we want to sort into a join row set.  We'll */
+/*        create the join row set metadata and just make it point to */
+/*        the collection of row vectors we wish to sort.  Consult the */
+/*        join row set include file for a picture of the data structure */
+/*        we're creating. */
 
-	svbas1 = jbase;
-	svnt1 = nt;
-	svrb1 = rb;
-	svnr1 = nr;
+	zzekstop_(&lbase);
+	jbase = svbas1;
+	nt = svnt1;
+	nr = svnr1;
+	rb = svrb1;
+	tab = lpos;
 	zzekspsh_(&c__1, &c__0);
 	zzekspsh_(&c__1, &nr);
 	zzekspsh_(&c__1, &c__1);
@@ -1604,38 +1648,11 @@ L_zzekjprp:
 /*        the CNSTR constraint. */
 
 	zzekstop_(&rbase);
-	rtab = cpidx2[cnstr - 1];
-	rcol = clidx2[cnstr - 1];
-	relt = elts2[cnstr - 1];
-
-/*        Set JBASE to the base address of the join row set containing */
-/*        the table indicated by RTAB.  Set NT, NR and RB to indicate, */
-/*        respectively, the number of tables in this join row set, the */
-/*        number of rows in the join row set, and the base address of the */
-/*        relevant row vector set.  If RTAB is in the second join row */
-/*        set, we'll adjust TAB to indicate position relative to the set */
-/*        of tables defining the second join row set. */
-
-	if (rtab <= *nt1) {
-	    jbase = *jbase1;
-	    nt = *nt1;
-	    nr = *nr1;
-	    rb = *rb1;
-	    tab = rtab;
-	} else {
-	    jbase = *jbase2;
-	    nt = *nt2;
-	    nr = *nr2;
-	    rb = *rb2;
-	    tab = rtab - *nt1;
-	}
-
-/*        Save the dimensions and base addresses we'll need later. */
-
-	svbas2 = jbase;
-	svnt2 = nt;
-	svrb2 = rb;
-	svnr2 = nr;
+	jbase = svbas2;
+	nt = svnt2;
+	nr = svnr2;
+	rb = svrb2;
+	tab = rpos;
 	zzekspsh_(&c__1, &c__0);
 	zzekspsh_(&c__1, &nr);
 	zzekspsh_(&c__1, &c__1);
@@ -1671,6 +1688,8 @@ L_zzekjprp:
 	zzeksupd_(&i__1, &i__2, &i__3);
 	zzekjsrt_(&c__1, &rbase, &c__1, &c__1, &rcol, &relt, &c__0, sthan, 
 		stsdsc, stdtpt, dtpool, dtdscs, &rovbas);
+    }
+    if (case__ != 3) {
 
 /*        Keep a local copy of the active constraint flags, deactivating */
 /*        the distinguished one. */
@@ -1686,6 +1705,8 @@ L_zzekjprp:
 
 /*        This is the `no luck' case.  Save all of the constraints. */
 
+	zzekjmlg_(&c__3);
+
 	i__1 = *njcnst;
 	for (i__ = 1; i__ <= i__1; ++i__) {
 	    locact[(i__2 = i__ - 1) < 100 && 0 <= i__2 ? i__2 : s_rnge("loca"
@@ -1885,6 +1906,67 @@ L_zzekjnxt:
 
     if (case__ == 4) {
 	return 0;
+    } else if (inmem) {
+
+/*        The key values and order vectors are held in memory.  Fetch */
+/*        row vector pairs satisfying the distinguished constraint from */
+/*        ZZEKJMNX and test each composite row vector against the */
+/*        remaining active constraints. */
+
+	while(! (*found)) {
+	    zzekjmnx_(&more, &lrvidx, &rrvidx);
+	    if (! more) {
+		return 0;
+	    }
+	    if (svcp1[(i__1 = cnstr - 1) < 100 && 0 <= i__1 ? i__1 : 
+		    s_rnge("svcp1", i__1, "zzekjtst_", (ftnlen)1241)] <= 
+		    svnt1) {
+
+/*              The parent table of the column on the LHS of the */
+/*              distinguished constraint belongs to the first join */
+/*              row set. */
+
+		j = 1;
+		k = svnt1 + 1;
+	    } else {
+		j = svnt2 + 1;
+		k = 1;
+	    }
+	    offset = svrb1 + (lrvidx - 1) * (svnt1 + 1);
+	    i__1 = svbas1 + offset + 1;
+	    i__2 = svbas1 + offset + svnt1;
+	    zzeksrd_(&i__1, &i__2, &rowvec[j - 1]);
+	    offset = svrb2 + (rrvidx - 1) * (svnt2 + 1);
+	    i__1 = svbas2 + offset + 1;
+	    i__2 = svbas2 + offset + svnt2;
+	    zzeksrd_(&i__1, &i__2, &rowvec[k - 1]);
+
+/*           Create row arrays for both sides of each active */
+/*           relational constraint. */
+
+	    i__1 = svncon;
+	    for (j = 1; j <= i__1; ++j) {
+		if (locact[(i__2 = j - 1) < 100 && 0 <= i__2 ? i__2 : 
+			s_rnge("locact", i__2, "zzekjtst_", (ftnlen)1274)]
+			) {
+		    ltab = svcp1[(i__2 = j - 1) < 100 && 0 <= i__2 ? i__2 
+			    : s_rnge("svcp1", i__2, "zzekjtst_", (ftnlen)
+			    1275)];
+		    rtab = svcp2[(i__2 = j - 1) < 100 && 0 <= i__2 ? i__2 
+			    : s_rnge("svcp2", i__2, "zzekjtst_", (ftnlen)
+			    1276)];
+		    lrows[(i__2 = j - 1) < 100 && 0 <= i__2 ? i__2 : 
+			    s_rnge("lrows", i__2, "zzekjtst_", (ftnlen)
+			    1277)] = rowvec[ltab - 1];
+		    rrows[(i__2 = j - 1) < 100 && 0 <= i__2 ? i__2 : 
+			    s_rnge("rrows", i__2, "zzekjtst_", (ftnlen)
+			    1278)] = rowvec[rtab - 1];
+		}
+	    }
+	    *found = zzekvmch_(&svncon, locact, lhans, lsdsc, ldscrs, 
+		    lrows, lelts, svops, rhans, rsdsc, rdscrs, rrows, 
+		    relts);
+	}
     } else if (case__ == 1) {
 	while(! done && ! (*found)) {
 
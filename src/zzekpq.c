@@ -0,0 +1,899 @@
+/*
+
+-Procedure zzekpq ( EK, prepared queries )
+
+-Abstract
+
+   SPICE Private routine intended solely for the support of SPICE
+   routines.  Users should not call this routine directly due
+   to the volatile nature of this routine.
+
+   Compile EK queries once, bind new values to their literal values,
+   and execute them repeatedly.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   EK
+
+-Keywords
+
+   EK
+   PRIVATE
+   SEARCH
+
+-Brief_I/O
+
+   VARIABLE  I/O  ENTRY POINTS
+   --------  ---  --------------------------------------------------
+   query      I   zzekpqp
+   qryid     I-O  All
+   prmidx     I   zzekpqc, zzekpqd, zzekpqi
+   cval       I   zzekpqc
+   dval       I   zzekpqd
+   ival       I   zzekpqi
+   nmrows     O   zzekpqx
+   error      O   zzekpqp, zzekpqx
+   errmsg     O   zzekpqp, zzekpqx
+   MAXPQ      P   zzekpqp
+
+-Detailed_Input
+
+   query       is an EK query, as accepted by EKFIND.
+
+   qryid       is the ID of a query prepared by zzekpqp.
+
+   prmidx      is the index of a parameter of the query `qryid'.  The
+               parameters of a query are the literal values on the
+               right sides of its constraints, numbered from 1 in
+               the order in which they appear in the query text.
+               Constraints using the IS NULL and IS NOT NULL
+               operators have no parameter.
+
+   cval        is a string to be bound to a parameter.  The
+               parameter's literal value must be a string, compared
+               with a character column, or a time string, compared
+               with a time column.  Time strings are converted to ET
+               as EKFIND converts them.
+
+   dval        is a number to be bound to a parameter.  The
+               parameter's literal value must be a number, compared
+               with a numeric column, or a time string, in which case
+               `dval' is the ET value of the time.
+
+   ival        is an integer to be bound to a parameter, under the
+               same conditions as `dval'.
+
+-Detailed_Output
+
+   qryid       is, on output from zzekpqp, the ID of the prepared
+               query.  The ID is zero if the query could not be
+               prepared.
+
+   nmrows      is the number of rows matching the prepared query,
+               with the values currently bound to its parameters.
+
+   error       is a flag indicating whether an error in the query
+               was found, as the EKFIND output of the same name.
+
+   errmsg      is the diagnosis of the error, if `error' is true.
+
+-Parameters
+
+   MAXPQ       is the number of prepared queries that may exist at
+               once.
+
+-Exceptions
+
+   1)  Errors in the query text are reported by zzekpqp through the
+       outputs `error' and `errmsg', and no query is prepared.
+
+   2)  If MAXPQ queries are already prepared, the error
+       SPICE(TOOMANYQUERIES) is signaled.
+
+   3)  If memory for the prepared query cannot be allocated, the
+       error SPICE(MALLOCFAILED) is signaled.
+
+   4)  If `qryid' is not the ID of a prepared query, the error
+       SPICE(NOSUCHQUERY) is signaled.
+
+   5)  If `prmidx' is not the index of a parameter of the query, the
+       error SPICE(INVALIDINDEX) is signaled.
+
+   6)  If the value bound to a parameter does not have a type
+       compatible with the parameter, the error SPICE(TYPEMISMATCH)
+       is signaled.
+
+   7)  If a string bound to a time parameter cannot be converted to
+       ET, the error SPICE(INVALIDTIMESTRING) is signaled.
+
+   8)  If the strings bound to the parameters of a query do not fit
+       in its character buffer, the error SPICE(BUFFERTOOSMALL) is
+       signaled.
+
+   9)  If EK files have been loaded or unloaded since the query was
+       prepared, the error SPICE(STALEQUERY) is signaled by zzekpqx,
+       and no search is made.
+
+   10) Errors during the search for matching rows are reported or
+       signaled by EKSRCH.
+
+   The bound values are not changed by a call that signals an error.
+
+-Files
+
+   The prepared queries are resolved against, and search, the EK
+   files loaded by EKLEF.
+
+-Particulars
+
+   EKFIND scans, parses, normalizes and resolves the names, time
+   strings and semantics of its query before each search.  An
+   application that issues the same query many times with different
+   values, for instance different time bounds, pays for this
+   compilation at every call.
+
+   The entry points of this routine keep the encoded queries built by
+   this compilation, and let the literal values of a query be
+   replaced before the encoded query is handed again to EKSRCH.
+
+      zzekpqp     compiles the query `query' exactly as EKFIND does,
+                  and keeps the encoded query.  Its literal values
+                  become the initial values of its parameters.
+
+      zzekpqc,
+      zzekpqd,
+      zzekpqi     bind a new string, double precision or integer
+                  value to a parameter of a prepared query.  Each
+                  literal value may appear in several constraints of
+                  the encoded query, which holds the query in
+                  disjunctive normal form; the value of every such
+                  constraint is updated.  A number bound to an
+                  integer literal, or an integer bound to a double
+                  precision literal, is compared with the column
+                  values as a literal of the new type would be.
+
+      zzekpqx     searches the loaded EK files for the rows matching
+                  the prepared query, as EKFIND does.  The matching
+                  rows are fetched by the EK fetch routines.
+
+      zzekpqr     releases a prepared query.
+
+      zzekpqu     notes that the set of loaded EK files is changing.
+                  EKLEF and EKUEF call it, so that the queries
+                  prepared before are not executed against tables and
+                  columns other than those their names were resolved
+                  to.
+
+-Examples
+
+   See ekprep_c.
+
+-Restrictions
+
+   1)  A prepared query refers to the tables and columns of the EK
+       files loaded when it was prepared.  Queries must be prepared
+       again after EK files are loaded or unloaded; see Exceptions.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 19-OCT-2026 (NZL)
+
+-Index_Entries
+
+   prepare EK queries for repeated execution
+
+-&
+*/
+
+   #include <stdlib.h>
+   #include <string.h>
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+
+
+   /*
+   Local parameters
+
+   The sizes of the parts of an encoded query, and of the buffers of
+   the query scanner, are those EKFIND uses.  The character part is
+   larger, to leave room for the strings bound to parameters after
+   the strings of the compiled query.
+   */
+   #define MAXPQ           20
+   #define EQIMAX          27869
+   #define EQDSIZ          100
+   #define CHRSIZ          4000
+   #define MAXQRY          2000
+   #define MAXTOK          500
+   #define MAXNUM          100
+
+   /*
+   Layout of the integer part of an encoded query: the size of its
+   fixed part, of a value descriptor and of a constraint descriptor,
+   and the offsets of the constraint descriptor elements used here.
+   */
+   #define EQVBAS          19
+   #define EQVDSZ          6
+   #define EQCDSZ          26
+   #define EQCTYP          6
+   #define EQOPCD          19
+   #define EQVTYP          20
+   #define EQVLXB          21
+   #define EQVPTR          23
+   #define EQVEND          24
+
+   /*
+   Constraint type, operator and data type codes.
+   */
+   #define EQVAL           2
+   #define ISNULL          9
+   #define NOTNUL          10
+
+   #define CHR             1
+   #define DP              2
+   #define INT             3
+   #define TIME            4
+
+
+   /*
+   A prepared query.  Parameter k has the lexeme beginning at
+   prmlxb[k] of the query text, and the data type prmtyp[k]; string
+   parameters have their current values at prmcb[k] : prmce[k] of
+   eqryc.  The strings of the compiled query end before cfree.  The
+   query was prepared when the load count was ldcnt.
+   */
+   typedef struct
+   {
+      integer          id;
+      integer          ldcnt;
+      integer          nprm;
+      integer          cfree;
+      integer          prmlxb [MAXTOK];
+      integer          prmtyp [MAXTOK];
+      integer          prmcb  [MAXTOK];
+      integer          prmce  [MAXTOK];
+      integer          eqryi  [EQIMAX + 6];
+      doublereal       eqryd  [EQDSIZ];
+      char             eqryc  [CHRSIZ];
+
+   } Query;
+
+
+   /*
+   Static variables
+   */
+   static Query          * qrys   [MAXPQ];
+
+   static integer          ldcnt  = 0;
+   static integer          nextid = 0;
+
+   static char             chrbuf [MAXQRY];
+   static char             strbuf [CHRSIZ];
+   static doublereal       numvls [MAXNUM];
+   static integer          chbegs [MAXTOK];
+   static integer          chends [MAXTOK];
+   static integer          lxbegs [MAXTOK];
+   static integer          lxends [MAXTOK];
+   static integer          tokens [MAXTOK];
+   static integer          values [MAXTOK];
+
+
+   /*
+   Return the slot of the query `qryid', or signal an error on
+   behalf of `caller' and return -1.
+   */
+   static int slot ( integer       qryid,
+                     const char  * caller )
+   {
+      int                     i;
+
+      for ( i = 0;  i < MAXPQ;  i++ )
+      {
+         if (  qrys[i]  &&  ( qrys[i]->id == qryid )  )
+         {
+            return i;
+         }
+      }
+
+      chkin_c  ( caller                                  );
+      setmsg_c ( "No prepared query has the ID #."       );
+      errint_c ( "#",  qryid                             );
+      sigerr_c ( "SPICE(NOSUCHQUERY)"                    );
+      chkout_c ( caller                                  );
+
+      return -1;
+   }
+
+
+   /*
+   Return the query `qryid' if `prmidx' is the index of one of its
+   parameters, or signal an error on behalf of `caller' and return
+   NULL.
+   */
+   static Query * param ( integer       qryid,
+                          integer       prmidx,
+                          const char  * caller )
+   {
+      Query                 * q;
+      int                     i;
+
+      i = slot ( qryid, caller );
+
+      if ( i < 0 )
+      {
+         return NULL;
+      }
+
+      q = qrys[i];
+
+      if (  ( prmidx < 1 )  ||  ( prmidx > q->nprm )  )
+      {
+         chkin_c  ( caller                                          );
+         setmsg_c ( "Parameter index # is out of range; prepared "
+                    "query # has # parameters."                     );
+         errint_c ( "#",  prmidx                                    );
+         errint_c ( "#",  qryid                                     );
+         errint_c ( "#",  q->nprm                                   );
+         sigerr_c ( "SPICE(INVALIDINDEX)"                           );
+         chkout_c ( caller                                          );
+
+         return NULL;
+      }
+
+      return q;
+   }
+
+
+   static void typerr ( integer       qryid,
+                        integer       prmidx,
+                        const char  * bound,
+                        const char  * caller )
+   {
+      chkin_c  ( caller                                          );
+      setmsg_c ( "A # value cannot be bound to parameter # of "
+                 "prepared query #, which is compared with a "
+                 "column of another data type."                  );
+      errch_c  ( "#",  bound                                     );
+      errint_c ( "#",  prmidx                                    );
+      errint_c ( "#",  qryid                                     );
+      sigerr_c ( "SPICE(TYPEMISMATCH)"                           );
+      chkout_c ( caller                                          );
+   }
+
+
+   /*
+   Return the base address of the descriptor of constraint i of the
+   query `q' if it compares a column with the value of parameter k,
+   or -1.
+   */
+   static integer cnsbas ( Query       * q,
+                           integer       ntab,
+                           integer       i,
+                           int           k    )
+   {
+      integer                 base;
+      integer                 opcode;
+
+      base   = EQVBAS  +  ntab * 2 * EQVDSZ  +  i * EQCDSZ;
+      opcode = q->eqryi[base + EQOPCD];
+
+      if (    ( q->eqryi[base + EQCTYP] == EQVAL       )
+           && ( opcode                  != ISNULL      )
+           && ( opcode                  != NOTNUL      )
+           && ( q->eqryi[base + EQVLXB] == q->prmlxb[k] )  )
+      {
+         return base;
+      }
+
+      return -1;
+   }
+
+
+   /*
+   Set the value of parameter k of the query `q' in every constraint
+   using it: the number `value' of type `dtype', or the string at the
+   current location of the parameter.
+   */
+   static void setval ( Query       * q,
+                        int           k,
+                        doublereal    value,
+                        integer       dtype )
+   {
+      integer                 base;
+      integer                 i;
+      integer                 ncns;
+      integer                 ntab;
+
+      zzekreqi_ ( q->eqryi, "NUM_TABLES",      &ntab, (ftnlen)10 );
+      zzekreqi_ ( q->eqryi, "NUM_CONSTRAINTS", &ncns, (ftnlen)15 );
+
+      for ( i = 0;  i < ncns;  i++ )
+      {
+         base = cnsbas ( q, ntab, i, k );
+
+         if ( base < 0 )
+         {
+            continue;
+         }
+
+         if ( dtype == CHR )
+         {
+            q->eqryi[base + EQVPTR] = q->prmcb[k];
+            q->eqryi[base + EQVEND] = q->prmce[k];
+         }
+         else
+         {
+            q->eqryd[ q->eqryi[base + EQVPTR] - 1 ] = value;
+            q->eqryi[base + EQVTYP]                 = dtype;
+         }
+      }
+   }
+
+
+   /*
+   Find the parameters of the compiled query `q', in the order of
+   their lexemes in the query text.
+   */
+   static void params ( Query * q )
+   {
+      integer                 base;
+      integer                 i;
+      integer                 lxb;
+      integer                 ncns;
+      integer                 ntab;
+      integer                 t;
+      int                     j;
+      int                     k;
+
+      zzekreqi_ ( q->eqryi, "NUM_TABLES",      &ntab,     (ftnlen)10 );
+      zzekreqi_ ( q->eqryi, "NUM_CONSTRAINTS", &ncns,     (ftnlen)15 );
+      zzekreqi_ ( q->eqryi, "FREE_CHR",        &q->cfree, (ftnlen)8  );
+
+      q->nprm = 0;
+
+      for ( i = 0;  i < ncns;  i++ )
+      {
+         base = EQVBAS  +  ntab * 2 * EQVDSZ  +  i * EQCDSZ;
+
+         if (    ( q->eqryi[base + EQCTYP] != EQVAL  )
+              || ( q->eqryi[base + EQOPCD] == ISNULL )
+              || ( q->eqryi[base + EQOPCD] == NOTNUL )  )
+         {
+            continue;
+         }
+
+         lxb = q->eqryi[base + EQVLXB];
+
+         for ( k = 0;  ( k < q->nprm ) && ( q->prmlxb[k] != lxb );  k++ )
+         {
+         }
+
+         if ( k < q->nprm )
+         {
+            continue;
+         }
+
+         /*
+         Insert the new parameter in lexeme order.
+         */
+         for ( j = q->nprm;  ( j > 0 ) && ( q->prmlxb[j-1] > lxb );  j-- )
+         {
+            q->prmlxb[j] = q->prmlxb[j-1];
+            q->prmtyp[j] = q->prmtyp[j-1];
+            q->prmcb [j] = q->prmcb [j-1];
+            q->prmce [j] = q->prmce [j-1];
+         }
+
+         t = q->eqryi[base + EQVTYP];
+
+         q->prmlxb[j] = lxb;
+         q->prmtyp[j] = t;
+         q->prmcb [j] = ( t == CHR ) ? q->eqryi[base + EQVPTR] : 0;
+         q->prmce [j] = ( t == CHR ) ? q->eqryi[base + EQVEND] : 0;
+
+         ++ q->nprm;
+      }
+   }
+
+
+   int zzekpqp_ ( char         * query,
+                  integer      * qryid,
+                  logical      * error,
+                  char         * errmsg,
+                  ftnlen         query_len,
+                  ftnlen         errmsg_len )
+   {
+      Query                 * q;
+      integer                 errptr;
+      integer                 ntoken;
+      int                     i;
+
+      static integer          isize = EQIMAX;
+      static integer          dsize = EQDSIZ;
+      static integer          maxtok = MAXTOK;
+      static integer          maxnum = MAXNUM;
+
+      *qryid = 0;
+      *error = SPICEFALSE;
+
+      chkin_c ( "ZZEKPQP" );
+
+      for ( i = 0;  ( i < MAXPQ ) && qrys[i];  i++ )
+      {
+      }
+
+      if ( i == MAXPQ )
+      {
+         setmsg_c ( "No more than # queries may be prepared at once." );
+         errint_c ( "#",  MAXPQ                                      );
+         sigerr_c ( "SPICE(TOOMANYQUERIES)"                          );
+         chkout_c ( "ZZEKPQP"                                        );
+         return 0;
+      }
+
+      q = (Query *) malloc ( sizeof(Query) );
+
+      if ( !q )
+      {
+         setmsg_c ( "Memory for a prepared query could not be "
+                    "allocated."                                );
+         sigerr_c ( "SPICE(MALLOCFAILED)"                       );
+         chkout_c ( "ZZEKPQP"                                   );
+         return 0;
+      }
+
+      /*
+      Compile the query as EKFIND does.
+      */
+      zzekqini_ ( &isize, &dsize, q->eqryi, q->eqryc, q->eqryd,
+                  (ftnlen)CHRSIZ                                );
+
+      zzekscan_ ( query,  &maxtok, &maxnum, &ntoken, tokens,
+                  lxbegs, lxends,  values,  numvls,  chrbuf,
+                  chbegs, chends,  error,   errmsg,
+                  query_len, (ftnlen)MAXQRY, errmsg_len          );
+
+      if ( !*error  &&  !failed_() )
+      {
+         zzekpars_ ( query,  &ntoken, lxbegs,   lxends,   tokens,
+                     values, numvls,  chrbuf,   chbegs,   chends,
+                     q->eqryi, q->eqryc, q->eqryd, error, errmsg,
+                     query_len, (ftnlen)MAXQRY, (ftnlen)CHRSIZ,
+                     errmsg_len                                  );
+      }
+
+      if ( !*error  &&  !failed_() )
+      {
+         zzeknres_ ( query, q->eqryi, q->eqryc, error, errmsg, &errptr,
+                     query_len, (ftnlen)CHRSIZ, errmsg_len            );
+      }
+
+      if ( !*error  &&  !failed_() )
+      {
+         zzektres_ ( query, q->eqryi, q->eqryc, q->eqryd, error, errmsg,
+                     &errptr, query_len, (ftnlen)CHRSIZ, errmsg_len    );
+      }
+
+      if ( !*error  &&  !failed_() )
+      {
+         zzeksemc_ ( query, q->eqryi, q->eqryc, error, errmsg, &errptr,
+                     query_len, (ftnlen)CHRSIZ, errmsg_len            );
+      }
+
+      if ( *error  ||  failed_() )
+      {
+         free ( q );
+
+         chkout_c ( "ZZEKPQP" );
+         return 0;
+      }
+
+      params ( q );
+
+      q->id    = ++nextid;
+      q->ldcnt = ldcnt;
+      qrys[i]  = q;
+      *qryid   = q->id;
+
+      chkout_c ( "ZZEKPQP" );
+      return 0;
+   }
+
+
+   int zzekpqc_ ( integer      * qryid,
+                  integer      * prmidx,
+                  char         * cval,
+                  ftnlen         cval_len )
+   {
+      Query                 * q;
+      doublereal              et;
+      integer                 k;
+      integer                 len;
+      integer                 n;
+      integer                 room;
+      logical                 error;
+      char                    errmsg [256];
+      int                     j;
+
+      q = param ( *qryid, *prmidx, "ZZEKPQC" );
+
+      if ( !q )
+      {
+         return 0;
+      }
+
+      k = *prmidx - 1;
+
+      if ( q->prmtyp[k] == TIME )
+      {
+         zzektcnv_ ( cval, &et, &error, errmsg, cval_len,
+                     (ftnlen)sizeof(errmsg)               );
+
+         if ( failed_() )
+         {
+            return 0;
+         }
+
+         if ( error )
+         {
+            chkin_c  ( "ZZEKPQC"                                      );
+            setmsg_c ( "The string bound to parameter # of prepared "
+                       "query # is not a valid time: #"               );
+            errint_c ( "#",  *prmidx                                  );
+            errint_c ( "#",  *qryid                                   );
+            errch_   ( "#",  errmsg,  (ftnlen)1,  (ftnlen)sizeof(errmsg) );
+            sigerr_c ( "SPICE(INVALIDTIMESTRING)"                     );
+            chkout_c ( "ZZEKPQC"                                      );
+            return 0;
+         }
+
+         setval ( q, k, et, TIME );
+
+         return 0;
+      }
+
+      if ( q->prmtyp[k] != CHR )
+      {
+         typerr ( *qryid, *prmidx, "string", "ZZEKPQC" );
+         return 0;
+      }
+
+      /*
+      An empty string is bound as a blank, which compares equal to it.
+      */
+      len = ( cval_len > 0 ) ? cval_len : 1;
+
+      /*
+      The bound strings follow those of the compiled query.  Gather
+      the strings bound to the other parameters, then lay them out
+      again, followed by the new string.
+      */
+      room = CHRSIZ - q->cfree + 1;
+      n    = 0;
+
+      for ( j = 0;  j < q->nprm;  j++ )
+      {
+         if (    ( j != k                 )
+              && ( q->prmtyp[j] == CHR    )
+              && ( q->prmcb [j] >= q->cfree )  )
+         {
+            n += q->prmce[j] - q->prmcb[j] + 1;
+         }
+      }
+
+      if ( n + len > room )
+      {
+         chkin_c  ( "ZZEKPQC"                                           );
+         setmsg_c ( "The strings bound to the parameters of prepared "
+                    "query # need # characters; only # are available." );
+         errint_c ( "#",  *qryid                                        );
+         errint_c ( "#",  n + len                                       );
+         errint_c ( "#",  room                                          );
+         sigerr_c ( "SPICE(BUFFERTOOSMALL)"                             );
+         chkout_c ( "ZZEKPQC"                                           );
+         return 0;
+      }
+
+      n = 0;
+
+      for ( j = 0;  j < q->nprm;  j++ )
+      {
+         if (    ( j != k                 )
+              && ( q->prmtyp[j] == CHR    )
+              && ( q->prmcb [j] >= q->cfree )  )
+         {
+            len = q->prmce[j] - q->prmcb[j] + 1;
+
+            memcpy ( strbuf + n,  q->eqryc + q->prmcb[j] - 1,  (size_t)len );
+
+            q->prmcb[j] = q->cfree + n;
+            q->prmce[j] = q->cfree + n + len - 1;
+
+            n += len;
+         }
+      }
+
+      memcpy ( q->eqryc + q->cfree - 1,  strbuf,  (size_t)n );
+
+      if ( cval_len > 0 )
+      {
+         memcpy ( q->eqryc + q->cfree - 1 + n,  cval,  (size_t)cval_len );
+         len = cval_len;
+      }
+      else
+      {
+         q->eqryc[ q->cfree - 1 + n ] = ' ';
+         len = 1;
+      }
+
+      q->prmcb[k] = q->cfree + n;
+      q->prmce[k] = q->cfree + n + len - 1;
+
+      for ( j = 0;  j < q->nprm;  j++ )
+      {
+         if ( q->prmtyp[j] == CHR )
+         {
+            setval ( q, j, 0.0, CHR );
+         }
+      }
+
+      return 0;
+   }
+
+
+   int zzekpqd_ ( integer      * qryid,
+                  integer      * prmidx,
+                  doublereal   * dval    )
+   {
+      Query                 * q;
+      integer                 k;
+
+      q = param ( *qryid, *prmidx, "ZZEKPQD" );
+
+      if ( !q )
+      {
+         return 0;
+      }
+
+      k = *prmidx - 1;
+
+      if ( q->prmtyp[k] == CHR )
+      {
+         typerr ( *qryid, *prmidx, "double precision", "ZZEKPQD" );
+         return 0;
+      }
+
+      setval ( q,  k,  *dval,
+               ( q->prmtyp[k] == TIME ) ? TIME : DP );
+
+      return 0;
+   }
+
+
+   int zzekpqi_ ( integer      * qryid,
+                  integer      * prmidx,
+                  integer      * ival    )
+   {
+      Query                 * q;
+      integer                 k;
+
+      q = param ( *qryid, *prmidx, "ZZEKPQI" );
+
+      if ( !q )
+      {
+         return 0;
+      }
+
+      k = *prmidx - 1;
+
+      if ( q->prmtyp[k] == CHR )
+      {
+         typerr ( *qryid, *prmidx, "integer", "ZZEKPQI" );
+         return 0;
+      }
+
+      setval ( q,  k,  (doublereal)*ival,
+               ( q->prmtyp[k] == TIME ) ? TIME : INT );
+
+      return 0;
+   }
+
+
+   int zzekpqx_ ( integer      * qryid,
+                  integer      * nmrows,
+                  logical      * error,
+                  char         * errmsg,
+                  ftnlen         errmsg_len )
+   {
+      Query                 * q;
+      int                     i;
+
+      *nmrows = 0;
+      *error  = SPICEFALSE;
+
+      i = slot ( *qryid, "ZZEKPQX" );
+
+      if ( i < 0 )
+      {
+         return 0;
+      }
+
+      q = qrys[i];
+
+      if ( q->ldcnt != ldcnt )
+      {
+         chkin_c  ( "ZZEKPQX"                                          );
+         setmsg_c ( "EK files have been loaded or unloaded since "
+                    "prepared query # was prepared.  The query must be "
+                    "prepared again."                                  );
+         errint_c ( "#",  *qryid                                       );
+         sigerr_c ( "SPICE(STALEQUERY)"                                );
+         chkout_c ( "ZZEKPQX"                                          );
+         return 0;
+      }
+
+      eksrch_ ( q->eqryi, q->eqryc, q->eqryd, nmrows, error, errmsg,
+                (ftnlen)CHRSIZ, errmsg_len                           );
+
+      return 0;
+   }
+
+
+   int zzekpqr_ ( integer      * qryid )
+   {
+      int                     i;
+
+      i = slot ( *qryid, "ZZEKPQR" );
+
+      if ( i < 0 )
+      {
+         return 0;
+      }
+
+      free ( qrys[i] );
+
+      qrys[i] = NULL;
+
+      return 0;
+   }
+
+
+   int zzekpqu_ ( void )
+   {
+      ++ ldcnt;
+
+      return 0;
+   }
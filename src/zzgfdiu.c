@@ -14,6 +14,8 @@ static integer c__0 = 0;
 	obsrvr, U_fp udfunc, doublereal *et, logical *decres, doublereal *
 	dist, ftnlen target_len, ftnlen abcorr_len, ftnlen obsrvr_len)
 {
+    extern /* Subroutine */ int zzgfdrsv_(doublereal *, doublereal *);
+    doublereal drvval;
     extern doublereal vdot_(doublereal *, doublereal *);
     extern /* Subroutine */ int zzvalcor_(char *, logical *, ftnlen), chkin_(
 	    char *, ftnlen), ucase_(char *, char *, ftnlen, ftnlen), errch_(
@@ -717,7 +719,9 @@ L_zzgfdidc:
 /*     if the dot product of the velocity and position is */
 /*     negative. */
 
-    *decres = vdot_(state, &state[3]) < 0.;
+    drvval = vdot_(state, &state[3]);
+    zzgfdrsv_(et, &drvval);
+    *decres = drvval < 0.;
     chkout_("ZZGFDIDC", (ftnlen)8);
     return 0;
 /* $Procedure ZZGFDIGQ ( Private --- GF, get observer-target distance ) */
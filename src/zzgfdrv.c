@@ -0,0 +1,214 @@
+/*
+
+-Procedure zzgfdrv ( GF, quantity derivative values, umbrella )
+
+-Abstract
+
+   SPICE Private routine intended solely for the support of SPICE
+   routines.  Users should not call this routine directly due
+   to the volatile nature of this routine.
+
+   Pass the value of the time derivative of a GF scalar quantity,
+   computed by a routine that reports whether the quantity is
+   decreasing, to the GF root finder.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   GF
+
+-Keywords
+
+   GEOMETRY
+   PRIVATE
+   SEARCH
+
+-Brief_I/O
+
+   VARIABLE  I/O  ENTRY POINTS
+   --------  ---  --------------------------------------------------
+   et         I   zzgfdrsv_, zzgfdrgt_
+   value     I-O  zzgfdrsv_, zzgfdrgt_
+   found      O   zzgfdrgt_
+
+-Detailed_Input
+
+   See the individual routines.
+
+-Detailed_Output
+
+   See the individual routines.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   None.
+
+-Files
+
+   None.
+
+-Particulars
+
+   The GF routines that indicate whether a quantity is decreasing
+   (ZZGFDIDC, ZZGFSPDC, ZZGFRRDC, ZZGFPADC, ZZGFILDC) compute the
+   time derivative of the quantity, or a quantity with the same sign,
+   and return only its sign.  They record the value here, and
+   ZZGFSOLVX retrieves it right after each call, so that it can
+   locate the zeros of the derivative by regula falsi instead of by
+   bisection.
+
+   Only the most recent value is kept, and it is returned at most
+   once, for the epoch at which it was recorded.
+
+      zzgfdrsv_      Record a derivative value.
+      zzgfdrgt_      Retrieve and discard the recorded value.
+      zzgfdrcl_      Discard the recorded value.
+
+-Examples
+
+   See ZZGFSOLVX.
+
+-Restrictions
+
+   None.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   pass GF quantity derivative values to root finder
+
+-&
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+
+
+   /*
+   Static variables
+   */
+   static logical          svok  = 0;
+   static doublereal       svet  = 0.0;
+   static doublereal       svval = 0.0;
+
+
+
+/*
+
+-Procedure zzgfdrsv_ ( Record derivative value )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   et         I   Epoch.
+   value      I   Derivative, or a quantity of the same sign, at `et'.
+
+-&
+*/
+
+   int zzgfdrsv_ ( doublereal   * et,
+                   doublereal   * value )
+{
+   svok  = 1;
+   svet  = *et;
+   svval = *value;
+
+   return 0;
+}
+
+
+
+/*
+
+-Procedure zzgfdrgt_ ( Retrieve derivative value )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   et         I   Epoch.
+   found      O   Flag indicating a value was recorded for `et'.
+   value      O   Recorded value.
+
+-Detailed_Output
+
+   found       is .TRUE. if a value was recorded for `et' since the
+               last call to zzgfdrgt_ or zzgfdrcl_.
+
+   value       is the recorded value.  `value' is defined only if
+               `found' is .TRUE.
+
+-&
+*/
+
+   int zzgfdrgt_ ( doublereal   * et,
+                   logical      * found,
+                   doublereal   * value )
+{
+   *found = svok && ( svet == *et );
+
+   if ( *found )
+   {
+      *value = svval;
+   }
+
+   svok = 0;
+
+   return 0;
+}
+
+
+
+/*
+
+-Procedure zzgfdrcl_ ( Discard derivative value )
+
+-&
+*/
+
+   int zzgfdrcl_ ( void )
+{
+   svok = 0;
+
+   return 0;
+}
@@ -36,7 +36,8 @@ static doublereal c_b130 = 2.;
     /* Subroutine */ int s_copy(char *, char *, ftnlen, ftnlen);
     integer s_cmp(char *, char *, ftnlen, ftnlen), s_rnge(char *, integer, 
 	    char *, integer);
-    double pow_dd(doublereal *, doublereal *), sqrt(doublereal);
+    double pow_dd(doublereal *, doublereal *), sqrt(doublereal), asin(
+	    doublereal);
 
     /* Local variables */
     extern /* Subroutine */ int vadd_(doublereal *, doublereal *, doublereal *
@@ -105,6 +106,7 @@ static doublereal c_b130 = 2.;
 	    svplan[4], svrdir[3], svsemi[6]	/* was [3][2] */, svtrad[3], 
 	    svxmag[2];
     doublereal trgctr[3], trgsmx[9]	/* was [3][3] */;
+    doublereal trgdst, trgmxr;
     integer clssid, frcent, frclss, ocstat;
     static integer svinst, svnvrt, svtarg;
     logical attblk[15];
@@ -1944,6 +1946,28 @@ L_zzgffvst:
 	    return 0;
 	}
 	mxm_(m2, m1, insmat);
+
+/*        Before applying an exact test, compare the angular separation */
+/*        of the target center from the FOV axis against the sum of the */
+/*        angular radius SVARAD of the FOV's bounding cone and the */
+/*        angular radius of a sphere enclosing the target. If the */
+/*        separation is greater, with a small margin, the target can't */
+/*        be seen. The test is skipped if the observer is within the */
+/*        sphere. */
+
+/* Computing MAX */
+	d__1 = max(svtrad[0],svtrad[1]);
+	trgmxr = max(d__1,svtrad[2]);
+	trgdst = vnorm_(pos);
+	if (trgdst > trgmxr) {
+	    mxv_(insmat, pos, trgctr);
+	    sep = vsep_(trgctr, svfaxi);
+	    d__1 = trgmxr / trgdst;
+	    if (sep > svarad + asin(d__1) + 1e-6) {
+		chkout_("ZZGFFVST", (ftnlen)8);
+		return 0;
+	    }
+	}
 	if (s_cmp(svishp, "RECTANGLE", (ftnlen)9, (ftnlen)9) == 0 || s_cmp(
 		svishp, "POLYGON", (ftnlen)9, (ftnlen)7) == 0) {
 
@@ -18,6 +18,7 @@ static integer c__3 = 3;
 	target_len, ftnlen illum_len, ftnlen fixref_len, ftnlen abcorr_len, 
 	ftnlen obsrvr_len)
 {
+    extern /* Subroutine */ int zzgfdrsv_(doublereal *, doublereal *);
     /* Initialized data */
 
     static char angnms[50*3] = "PHASE                                       "
@@ -943,6 +944,7 @@ L_zzgfildc:
 /*     The observer-target illumination angle is decreasing if and only */
 /*     the derivative of the angle with respect to time is negative. */
 
+    zzgfdrsv_(et, &rate);
     *decres = rate < 0.;
     chkout_("ZZGFILDC", (ftnlen)8);
     return 0;
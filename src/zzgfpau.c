@@ -16,6 +16,8 @@ static integer c__0 = 0;
 	integer *xobs, logical *xablk, ftnlen target_len, ftnlen illmn_len, 
 	ftnlen abcorr_len, ftnlen obsrvr_len, ftnlen xabcor_len)
 {
+    extern /* Subroutine */ int zzgfdrsv_(doublereal *, doublereal *);
+    doublereal drvval;
     /* System generated locals */
     integer i__1, i__2;
     doublereal d__1;
@@ -877,7 +879,9 @@ L_zzgfpadc:
 /*         dt         dt */
 
     dsep = dvsep_(s1, s2);
-    *decres = -dsep < 0.;
+    drvval = -dsep;
+    zzgfdrsv_(et, &drvval);
+    *decres = drvval < 0.;
     chkout_("ZZGFPADC", (ftnlen)8);
     return 0;
 /* $Procedure ZZGFPAGQ ( Private --- GF, phase angle between two bodies ) */
@@ -16,6 +16,7 @@ static integer c__0 = 0;
 	doublereal *xdt, ftnlen target_len, ftnlen abcorr_len, ftnlen 
 	obsrvr_len, ftnlen xabcor_len)
 {
+    extern /* Subroutine */ int zzgfdrsv_(doublereal *, doublereal *);
     /* System generated locals */
     doublereal d__1;
 
@@ -873,6 +874,7 @@ L_zzgfrrdc:
 
     dvhat_(state, srhat);
     drvel = vdot_(&dfdt[3], srhat) + vdot_(&state[3], &srhat[3]);
+    zzgfdrsv_(et, &drvel);
     *decres = drvel < 0.;
     chkout_("ZZGFRRDC", (ftnlen)8);
     return 0;
@@ -8,6 +8,8 @@
 /* Table of constant values */
 
 static integer c__1000 = 1000;
+static integer c_n1 = -1;
+static integer c__2 = 2;
 
 /* $Procedure ZZGFSOLVX ( Private --- GF, event finding routine ) */
 /* Subroutine */ int zzgfsolvx_(U_fp udfuns, S_fp udfunb, S_fp udstep, S_fp 
@@ -48,6 +50,13 @@ static integer c__1000 = 1000;
     extern logical return_(void);
     char contxt[256];
     doublereal trnstn;
+    extern /* Subroutine */ int gfrefn_(doublereal *, doublereal *, logical *,
+	     logical *, doublereal *), zzgfudlt_(S_fp, doublereal *, logical *
+	    ), zzgfdrgt_(doublereal *, logical *, doublereal *), zzgfdrcl_(
+	    void), zzholdd_(integer *, integer *, logical *, doublereal *);
+    doublereal g, g1, g2, gcur, gsav, refval;
+    integer lastsd, nslow;
+    logical gok, g1ok, g2ok, gcurok, gsavok, ok, usefal, userf;
 
 /* $ Abstract */
 
@@ -368,6 +377,26 @@ static integer c__1000 = 1000;
 /*     The routines that do the decision making, can be modified */
 /*     and made smarter as time permits. */
 
+/*     When UDREFN is the default bisection routine GFREFN, this */
+/*     routine refines transitions by the Illinois variant of regula */
+/*     falsi wherever it has values, at both ends of the bracket, of a */
+/*     continuous function that is negative exactly when the state is */
+/*     .TRUE.: */
+
+/*        - If UDFUNB is ZZGFUDLT, the state is UDFUNS(ET) < REFVAL. */
+/*          UDFUNS is called directly and UDFUNS - REFVAL is used. */
+
+/*        - If UDFUNB is one of the "decreasing" routines that records */
+/*          its derivative value through ZZGFDRSV, that value is used. */
+
+/*     Regula falsi converges superlinearly on a smooth function, */
+/*     rather than gaining one bit per evaluation. The bracket is */
+/*     kept: every estimate lies strictly inside it, at least TOL/2 */
+/*     from either end, and the search falls back to bisection after */
+/*     two successive steps that fail to halve the bracket. The */
+/*     transition time found therefore meets the same tolerance as a */
+/*     bisection search, but is not in general identical to it. */
+
 /* $ Examples */
 
 /*      See GFUDS and ZZGFRELX. */
@@ -443,6 +472,12 @@ static integer c__1000 = 1000;
 	return 0;
     }
     chkin_("ZZGFSOLVX", (ftnlen)9);
+    g = 0.;
+    gcur = 0.;
+    gsav = 0.;
+    gok = FALSE_;
+    gcurok = FALSE_;
+    gsavok = FALSE_;
 
 /*     Check the convergence tolerance. */
 
@@ -486,6 +521,25 @@ static integer c__1000 = 1000;
 /*     Again, this may or may not be a transition point. */
 
 
+/*     When the default bisection refinement GFREFN has been */
+/*     requested, transitions are instead refined by regula falsi */
+/*     wherever values of a continuous function whose sign gives the */
+/*     state are available at both ends of the bracket. See the */
+/*     Particulars section. */
+
+/*     If the state is "quantity less than the reference value," as */
+/*     tested by ZZGFUDLT, the quantity is evaluated here directly. */
+/*     Otherwise the derivative values recorded by the "decreasing" */
+/*     routines through ZZGFDRSV are used, if there are any. */
+
+    userf = (U_fp)udrefn == (U_fp)gfrefn_;
+    usefal = userf && (U_fp)udfunb == (U_fp)zzgfudlt_;
+    if (usefal) {
+	zzholdd_(&c_n1, &c__2, &ok, &refval);
+	usefal = ok;
+    }
+    zzgfdrcl_();
+
 /*     Initially the current time is the beginning of the search */
 /*     interval. */
 
@@ -495,7 +549,17 @@ static integer c__1000 = 1000;
 /*     constraint. This constraint may indicate only existence of */
 /*     a state. */
 
-    (*udfunb)((U_fp)udfuns, &curtim, &curste);
+    if (usefal) {
+	(*udfuns)(&curtim, &g);
+	curste = g < refval;
+	gcur = g - refval;
+	gcurok = TRUE_;
+    } else {
+	(*udfunb)((U_fp)udfuns, &curtim, &curste);
+	if (userf) {
+	    zzgfdrgt_(&curtim, &gcurok, &gcur);
+	}
+    }
     if (failed_()) {
 	chkout_("ZZGFSOLVX", (ftnlen)9);
 	return 0;
@@ -521,6 +585,8 @@ static integer c__1000 = 1000;
 
     svdtim = curtim;
     savst = curste;
+    gsav = gcur;
+    gsavok = gcurok;
 
 /*     Once initializations have been performed keep working */
 /*     until the search interval has been exhausted. */
@@ -550,7 +616,17 @@ static integer c__1000 = 1000;
 
 /*        Compute the state at time CURTIM. */
 
-	(*udfunb)((U_fp)udfuns, &curtim, &curste);
+	if (usefal) {
+	    (*udfuns)(&curtim, &g);
+	    curste = g < refval;
+	    gcur = g - refval;
+	    gcurok = TRUE_;
+	} else {
+	    (*udfunb)((U_fp)udfuns, &curtim, &curste);
+	    if (userf) {
+		zzgfdrgt_(&curtim, &gcurok, &gcur);
+	    }
+	}
 	if (failed_()) {
 	    chkout_("ZZGFSOLVX", (ftnlen)9);
 	    return 0;
@@ -581,6 +657,8 @@ static integer c__1000 = 1000;
 
 	    svdtim = curtim;
 	    savst = curste;
+	    gsav = gcur;
+	    gsavok = gcurok;
 
 /*           Compute a new current time so that we will not step */
 /*           past the end of the interval.  This time will be */
@@ -604,7 +682,17 @@ static integer c__1000 = 1000;
 
 /*           Compute the current state */
 
-	    (*udfunb)((U_fp)udfuns, &curtim, &curste);
+	    if (usefal) {
+		(*udfuns)(&curtim, &g);
+		curste = g < refval;
+		gcur = g - refval;
+		gcurok = TRUE_;
+	    } else {
+		(*udfunb)((U_fp)udfuns, &curtim, &curste);
+		if (userf) {
+		    zzgfdrgt_(&curtim, &gcurok, &gcur);
+		}
+	    }
 	    if (failed_()) {
 		chkout_("ZZGFSOLVX", (ftnlen)9);
 		return 0;
@@ -630,6 +718,10 @@ static integer c__1000 = 1000;
 	    state1 = savst;
 	    t1 = svdtim;
 	    t2 = curtim;
+	    g1 = gsav;
+	    g2 = gcur;
+	    g1ok = gsavok;
+	    g2ok = gcurok;
 
 /*           Set the states at T1 and T2 for use by the refinement */
 /*           function, in case the caller has passed in a function */
@@ -649,6 +741,8 @@ static integer c__1000 = 1000;
 	    }
 	    svdtim = curtim;
 	    savst = curste;
+	    gsav = gcur;
+	    gsavok = gcurok;
 
 /*           T1 and T2 bracket the time of transition.  Squeeze this */
 /*           interval down until it is less than some tolerance in */
@@ -663,6 +757,8 @@ static integer c__1000 = 1000;
 	    d__2 = (d__1 = t2 - t1, abs(d__1));
 	    diff = touchd_(&d__2);
 	    nloop = 0;
+	    nslow = 0;
+	    lastsd = 0;
 	    while(diff > *tol && diff < prvdif) {
 		++nloop;
 
@@ -694,7 +790,25 @@ static integer c__1000 = 1000;
 /*              Select a time T, between T1 and T2 (possibly based on the */
 /*              values of L1 and L2). */
 
-		(*udrefn)(&t1, &t2, &l1, &l2, &t);
+		if (userf && g1ok && g2ok && (g1 < 0.) != (g2 < 0.) && 
+			nslow < 2) {
+
+/*                 Take the regula falsi estimate, kept at least TOL/2 */
+/*                 from either end of the bracket, so that a root near */
+/*                 an end is closed in on from both sides. */
+
+		    t = t1 - g1 * (t2 - t1) / (g2 - g1);
+		    d__1 = t1 + *tol * .5;
+		    d__2 = t2 - *tol * .5;
+		    t = brcktd_(&t, &d__1, &d__2);
+		} else {
+
+/*                 Bisect; also after two successive regula falsi */
+/*                 steps that failed to halve the bracket. */
+
+		    (*udrefn)(&t1, &t2, &l1, &l2, &t);
+		    nslow = 0;
+		}
 
 /*              Check for an error signal. The default refinement */
 /*              routine, GFREFN, does not include error checks. */
@@ -720,13 +834,45 @@ static integer c__1000 = 1000;
 /*                 equals STATE1, set T1 to T, otherwise set */
 /*                 T2 to T. */
 
-		    (*udfunb)((U_fp)udfuns, &t, &s);
+		    if (usefal) {
+			(*udfuns)(&t, &g);
+			s = g < refval;
+			g -= refval;
+			gok = TRUE_;
+		    } else {
+			(*udfunb)((U_fp)udfuns, &t, &s);
+			if (userf) {
+			    zzgfdrgt_(&t, &gok, &g);
+			}
+		    }
 		    if (s == state1) {
 			t1 = t;
 			l1 = s;
+			g1 = g;
+			g1ok = gok;
+
+/*                    Illinois modification: when the same end of the */
+/*                    bracket is replaced twice in a row, halve the */
+/*                    value retained at the other end. */
+
+			if (lastsd == 1) {
+			    g2 *= .5;
+			}
+			lastsd = 1;
 		    } else {
 			t2 = t;
 			l2 = s;
+			g2 = g;
+			g2ok = gok;
+			if (lastsd == 2) {
+			    g1 *= .5;
+			}
+			lastsd = 2;
+		    }
+		    if ((d__1 = t2 - t1, abs(d__1)) > diff * .5) {
+			++nslow;
+		    } else {
+			nslow = 0;
 		    }
 		}
 
@@ -18,6 +18,7 @@ static integer c__2 = 2;
 	ftnlen from_len, ftnlen shape_len, ftnlen frame_len, ftnlen 
 	abcorr_len, ftnlen xabcr_len, ftnlen yref_len, ftnlen xref_len)
 {
+    extern /* Subroutine */ int zzgfdrsv_(doublereal *, doublereal *);
     /* Initialized data */
 
     static char svshap[32*2] = "POINT                           " "SPHERE   "
@@ -1086,6 +1087,7 @@ L_zzgfspdc:
 	return 0;
     }
     dtheta = dtheta - dhfa_(pv1, &svrad1) - dhfa_(pv2, &svrad2);
+    zzgfdrsv_(et, &dtheta);
     if (dtheta < 0.) {
 	*decres = TRUE_;
     } else {
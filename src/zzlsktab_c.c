@@ -0,0 +1,681 @@
+/*
+
+-Procedure zzlsktab_c ( Cached leapseconds table, umbrella )
+
+-Abstract
+
+   CSPICE Private routine intended solely for the support of CSPICE
+   routines.  Users should not call this routine directly due
+   to the volatile nature of this routine.
+
+   Maintain a parsed copy of the leapseconds kernel variables and
+   use it to convert between UTC day numbers, TAI and TDB without
+   going through the kernel pool on each call.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   TIME
+
+-Keywords
+
+   PRIVATE
+   TIME
+
+-Brief_I/O
+
+   See the individual routines.
+
+-Detailed_Input
+
+   See the individual routines.
+
+-Detailed_Output
+
+   See the individual routines.
+
+-Parameters
+
+   LSKROOM     is the maximum number of values of the kernel variable
+               DELTET/DELTA_AT that can be buffered. This is the same
+               limit used by the SPICELIB routine TTRANS.
+
+-Exceptions
+
+   The routines in this file do not signal errors. If the required
+   kernel variables are absent or malformed, zzlskok_c returns
+   SPICEFALSE and callers are expected to fall back to the general
+   SPICELIB conversion path, which diagnoses the problem.
+
+-Files
+
+   A leapseconds kernel must be loaded for the conversions to be
+   available.
+
+-Particulars
+
+   Routines coded in this file:
+
+      zzlskok_c      Refresh the buffered table; indicate availability.
+      zzutctai_c     Convert UTC day number and seconds to TAI.
+      zztaiutc_c     Convert TAI to UTC day number and seconds.
+      zztaitdb_c     Convert TAI seconds past J2000 to TDB.
+      zztaitdt_c     Convert TAI seconds past J2000 to TDT.
+      zztdttai_c     Convert TDT seconds past J2000 to TAI.
+      zztdbtdt_c     Convert TDB seconds past J2000 to TDT.
+      zztdttdb_c     Convert TDT seconds past J2000 to TDB.
+
+   The leapseconds kernel variables
+
+      DELTET/DELTA_T_A
+      DELTET/K
+      DELTET/EB
+      DELTET/M
+      DELTET/DELTA_AT
+
+   are buffered the first time zzlskok_c is called and re-read only
+   when the kernel pool watcher established for the agent ZZLSKTAB
+   indicates that one of them has changed.
+
+   The buffered DELTA_AT table is transformed exactly as in the
+   SPICELIB routine TTRANS: each pair of entries is converted to the
+   TAI epoch at the start of the UTC day preceding a change in TAI-UTC
+   and the TAI epoch at the start of the following day, along with
+   the matching day numbers measured from 1 January, 1 A.D. The
+   arithmetic in the conversion routines follows TTRANS and UNITIM
+   operation for operation, so results are bit-for-bit identical to
+   those of the SPICELIB conversion path.
+
+   Table lookups start from the interval found on the previous call;
+   the binary searches of LSTLEI and LSTLED are used only when the
+   hint fails. For time-ordered input the lookup is therefore O(1).
+
+-Examples
+
+   See zzutcfst_c.
+
+-Restrictions
+
+   1) This is a CSPICE private routine. The interface may be changed
+      without notice, so these routines should not be called except
+      by other CSPICE routines.
+
+   2) The conversion routines may be called only after zzlskok_c has
+      returned SPICETRUE.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.2.0, 18-OCT-2026 (NZL)
+
+      Added zztdttdb_c.
+
+   -CSPICE Version 1.1.0, 18-OCT-2026 (NZL)
+
+      Added zztaiutc_c, zztaitdt_c, zztdttai_c and zztdbtdt_c.
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   buffered leapseconds table
+
+-&
+*/
+
+   #include <math.h>
+   #include <string.h>
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+
+
+   /*
+   Local parameters
+   */
+   #define  AGENT          "ZZLSKTAB"
+   #define  NVARS          5
+   #define  VARLEN         16
+   #define  LSKROOM        280
+
+   /*
+   Day number of 1 January 2000, counting from 1 January 1 A.D.
+   */
+   #define  DN2000         730119
+
+   /*
+   Seconds per day and half day.
+   */
+   #define  SECSPD         86400.0
+   #define  HALFD          43200.0
+
+
+   /*
+   Static variables
+   */
+   static SpiceBoolean     first  = SPICETRUE;
+   static SpiceBoolean     nodata = SPICETRUE;
+
+   static integer          usrctr [2];
+
+   static SpiceInt         nref;
+   static SpiceInt         hint   = 1;
+   static SpiceInt         taihnt = 1;
+
+   static integer          daytab [LSKROOM];
+   static SpiceDouble      taitab [LSKROOM];
+
+   static SpiceDouble      dta;
+   static SpiceDouble      k;
+   static SpiceDouble      eb;
+   static SpiceDouble      m      [2];
+
+
+
+
+/*
+
+-Procedure zzlskok_c ( Refresh buffered leapseconds table )
+
+-Brief_I/O
+
+   The function returns SPICETRUE if the buffered leapseconds data
+   are available.
+
+-Detailed_Output
+
+   The function returns SPICETRUE if all of the leapseconds kernel
+   variables are present in the kernel pool and the DELTA_AT table
+   is properly ordered. Otherwise it returns SPICEFALSE.
+
+-Particulars
+
+   The table is rebuilt only when the kernel pool watcher for the
+   agent ZZLSKTAB reports an update, or when the previous attempt
+   found the data missing.
+
+-&
+*/
+
+   SpiceBoolean zzlskok_c ( void )
+{
+   /*
+   Local variables
+   */
+   static ConstSpiceChar   vars [NVARS][VARLEN+1] =
+                           {
+                              "DELTET/DELTA_T_A",
+                              "DELTET/K",
+                              "DELTET/EB",
+                              "DELTET/M",
+                              "DELTET/DELTA_AT"
+                           };
+
+   SpiceChar               fvars [NVARS][VARLEN];
+
+   SpiceDouble             dt;
+   SpiceDouble             formal;
+   SpiceDouble             lastdt;
+
+   SpiceInt                i;
+   SpiceInt                j;
+
+   integer                 n;
+   integer                 nvars;
+   integer                 room;
+   integer                 start;
+
+   logical                 found  [NVARS];
+   logical                 update;
+
+
+   if ( first )
+   {
+      /*
+      Set the watch on the leapseconds variables.  The names are
+      passed to swpool_ as a blank-padded Fortran string array.
+      */
+      for ( i = 0;  i < NVARS;  i++ )
+      {
+         memset  ( fvars[i], ' ', VARLEN );
+         memcpy  ( fvars[i], vars[i],  strlen(vars[i]) );
+      }
+
+      zzctruin_ ( usrctr );
+
+      nvars = NVARS;
+
+      swpool_ ( ( char    * ) AGENT,
+                ( integer * ) &nvars,
+                ( char    * ) fvars,
+                ( ftnlen    ) strlen(AGENT),
+                ( ftnlen    ) VARLEN          );
+
+      if ( failed_c() )
+      {
+         return ( SPICEFALSE );
+      }
+
+      first = SPICEFALSE;
+   }
+
+   zzcvpool_ ( ( char    * ) AGENT,
+               ( integer * ) usrctr,
+               ( logical * ) &update,
+               ( ftnlen    ) strlen(AGENT) );
+
+   if ( !update && !nodata )
+   {
+      return ( SPICETRUE );
+   }
+
+   nodata = SPICETRUE;
+   start  = 1;
+
+   room   = 1;
+   gdpool_ ( "DELTET/DELTA_T_A", &start, &room, &n, &dta, found,   16 );
+   gdpool_ ( "DELTET/K",         &start, &room, &n, &k,   found+1,  8 );
+   gdpool_ ( "DELTET/EB",        &start, &room, &n, &eb,  found+2,  9 );
+
+   room   = 2;
+   gdpool_ ( "DELTET/M",         &start, &room, &n, m,    found+3,  8 );
+
+   room   = LSKROOM;
+   gdpool_ ( "DELTET/DELTA_AT",  &start, &room, &n, taitab, found+4, 15 );
+
+   if ( failed_c() )
+   {
+      return ( SPICEFALSE );
+   }
+
+   for ( i = 0;  i < NVARS;  i++ )
+   {
+      if ( !found[i] )
+      {
+         return ( SPICEFALSE );
+      }
+   }
+
+   if (  ( n < 2 ) || odd_( &n )  )
+   {
+      return ( SPICEFALSE );
+   }
+
+   nref = (SpiceInt) n;
+
+   /*
+   Transform the table in place, as in TTRANS.
+   */
+   lastdt = taitab[0] - 1.0;
+
+   for ( i = 0;  i < nref;  i += 2 )
+   {
+      dt          = taitab[i];
+      formal      = taitab[i+1];
+
+      taitab[i]   = formal - SECSPD + lastdt;
+      taitab[i+1] = formal + dt;
+
+      j           = (integer) ( (formal + HALFD) / SECSPD ) + DN2000;
+
+      daytab[i]   = j - 1;
+      daytab[i+1] = j;
+
+      lastdt      = dt;
+   }
+
+   for ( i = 1;  i < nref;  i++ )
+   {
+      if ( taitab[i-1] >= taitab[i] )
+      {
+         return ( SPICEFALSE );
+      }
+   }
+
+   hint   = 1;
+   taihnt = 1;
+   nodata = SPICEFALSE;
+
+   return ( SPICETRUE );
+}
+
+
+
+
+/*
+
+-Procedure zzutctai_c ( UTC day number and seconds to TAI )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   daynum     I   Day number of UTC calendar date, from 1 Jan 1 A.D.
+   secs       I   UTC seconds past the start of the day.
+
+   The function returns TAI seconds past J2000.
+
+-Detailed_Input
+
+   daynum     is the number of days between 1 January 1 A.D. and
+              the UTC calendar date of interest; 1 January 1 A.D.
+              is day zero.
+
+   secs       is the number of UTC seconds elapsed since the start of
+              the day.  secs must lie in the range [0, 86399].
+
+-Particulars
+
+   This routine reproduces the final UTC-to-TAI step of TTRANS.
+
+-&
+*/
+
+   SpiceDouble zzutctai_c ( SpiceInt      daynum,
+                            SpiceDouble   secs   )
+{
+   /*
+   Local variables
+   */
+   SpiceInt                dayptr;
+
+   integer                 n;
+   integer                 x;
+
+
+   /*
+   Locate the last table day number less than or equal to daynum.
+   Try the interval found last time before searching.
+   */
+   dayptr = hint;
+
+   if (    ( daytab[dayptr-1] > daynum )
+        || (    ( dayptr < nref            )
+             && ( daytab[dayptr] <= daynum ) )  )
+   {
+      n      = nref;
+      x      = daynum;
+      dayptr = lstlei_ ( &x, &n, daytab );
+
+      if ( dayptr < 1 )
+      {
+         dayptr = 1;
+      }
+
+      hint = dayptr;
+   }
+
+   secs += (SpiceDouble)( daynum - daytab[dayptr-1] ) * SECSPD;
+
+   return (  taitab[dayptr-1] + secs  );
+}
+
+
+
+
+/*
+
+-Procedure zztaitdb_c ( TAI to TDB )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   tai        I   TAI seconds past J2000.
+
+   The function returns TDB seconds past J2000.
+
+-Particulars
+
+   This routine reproduces the TAI-to-TDB conversion of UNITIM.
+
+-&
+*/
+
+   SpiceDouble zztaitdb_c ( SpiceDouble   tai )
+{
+   return (  zztdttdb_c ( tai + dta )  );
+}
+
+
+
+
+/*
+
+-Procedure zztaiutc_c ( TAI to UTC day number and seconds )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   tai        I   TAI seconds past J2000.
+   daynum     O   Day number of UTC calendar date, from 1 Jan 1 A.D.
+   secs       O   UTC seconds past the start of the day.
+
+-Detailed_Output
+
+   daynum     is the number of days between 1 January 1 A.D. and
+              the UTC calendar date containing `tai'.
+
+   secs       is the number of UTC seconds elapsed since the start of
+              that day.  During a positive leapsecond secs exceeds
+              86399.
+
+-Particulars
+
+   This routine reproduces the TAI-to-day-number step of TTRANS. It
+   does not perform the range normalization TTRANS applies to input
+   seconds outside [0, 86399]; callers compose that from this routine
+   and zzutctai_c exactly as TTRANS does.
+
+-&
+*/
+
+   void zztaiutc_c ( SpiceDouble     tai,
+                     SpiceInt      * daynum,
+                     SpiceDouble   * secs    )
+{
+   /*
+   Local variables
+   */
+   SpiceDouble             daydp;
+   SpiceDouble             q;
+   SpiceDouble             r;
+
+   SpiceInt                taiptr;
+
+   integer                 n;
+
+
+   /*
+   Locate the last table epoch less than or equal to tai. Try the
+   interval found last time before searching.
+   */
+   taiptr = taihnt;
+
+   if (    ( taitab[taiptr-1] > tai )
+        || (    ( taiptr < nref            )
+             && ( taitab[taiptr] <= tai    ) )  )
+   {
+      n      = nref;
+      taiptr = lstled_ ( &tai, &n, taitab );
+
+      if ( taiptr >= 1 )
+      {
+         taihnt = taiptr;
+      }
+   }
+
+   if ( taiptr % 2 == 1 )
+   {
+      /*
+      tai falls in a day containing a leapsecond.
+      */
+      *daynum = daytab[taiptr-1];
+      *secs   = tai - taitab[taiptr-1];
+   }
+   else
+   {
+      if ( taiptr < 1 )
+      {
+         taiptr = 1;
+      }
+
+      /*
+      This is RMAIND, inline.
+      */
+      r     = tai - taitab[taiptr-1];
+      q     = r / SECSPD;
+      daydp = ( q < 0.0 ) ? ceil(q) : floor(q);
+      r     = r - daydp * SECSPD;
+
+      if ( r < 0.0 )
+      {
+         daydp -= 1.0;
+         r     += SECSPD;
+      }
+
+      *daynum = (SpiceInt) daydp + daytab[taiptr-1];
+      *secs   = r;
+   }
+}
+
+
+
+
+/*
+
+-Procedure zztaitdt_c ( TAI to TDT )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   tai        I   TAI seconds past J2000.
+
+   The function returns TDT seconds past J2000.
+
+-&
+*/
+
+   SpiceDouble zztaitdt_c ( SpiceDouble   tai )
+{
+   return ( tai + dta );
+}
+
+
+
+
+/*
+
+-Procedure zztdttai_c ( TDT to TAI )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   tdt        I   TDT seconds past J2000.
+
+   The function returns TAI seconds past J2000.
+
+-&
+*/
+
+   SpiceDouble zztdttai_c ( SpiceDouble   tdt )
+{
+   return ( tdt - dta );
+}
+
+
+
+
+/*
+
+-Procedure zztdbtdt_c ( TDB to TDT )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   tdb        I   TDB seconds past J2000.
+
+   The function returns TDT seconds past J2000.
+
+-Particulars
+
+   This routine reproduces the three-step fixed point iteration
+   UNITIM uses to invert the TDT-to-TDB relation.
+
+-&
+*/
+
+   SpiceDouble zztdbtdt_c ( SpiceDouble   tdb )
+{
+   SpiceDouble             tdt;
+   SpiceInt                i;
+
+   tdt = tdb;
+
+   for ( i = 0;  i < 3;  i++ )
+   {
+      tdt = tdb - k * sin( m[0] + m[1]*tdt + eb*sin( m[0] + m[1]*tdt ) );
+   }
+
+   return ( tdt );
+}
+
+
+
+/*
+
+-Procedure zztdttdb_c ( TDT to TDB )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   tdt        I   TDT seconds past J2000.
+
+   The function returns TDB seconds past J2000.
+
+-Particulars
+
+   This routine reproduces the TDT-to-TDB conversion of UNITIM.
+
+-&
+*/
+
+   SpiceDouble zztdttdb_c ( SpiceDouble   tdt )
+{
+   return (  tdt + k * sin( m[0] + m[1]*tdt + eb*sin( m[0] + m[1]*tdt ) )  );
+}
@@ -0,0 +1,350 @@
+/*
+
+-Procedure zzltseed ( Light time seeds, umbrella )
+
+-Abstract
+
+   SPICE Private routine intended solely for the support of SPICE
+   routines.  Users should not call this routine directly due
+   to the volatile nature of this routine.
+
+   Keep the converged light times found by SPKLTC for recent epochs,
+   and supply initial estimates of light time for nearby epochs.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   SPK
+
+-Keywords
+
+   EPHEMERIS
+   PRIVATE
+
+-Brief_I/O
+
+   VARIABLE  I/O  ENTRY POINTS
+   --------  ---  --------------------------------------------------
+   enable     I   zzltsset_
+   targ       I   zzltsget_, zzltssav_
+   refid      I   zzltsget_, zzltssav_
+   xmit       I   zzltsget_, zzltssav_
+   et         I   zzltsget_, zzltssav_
+   found      O   zzltsget_
+   lt        I-O  zzltsget_, zzltssav_
+   dlt        I   zzltssav_
+   MAXSED     P   Number of seeds kept.
+   MAXGAP     P   Largest epoch gap over which a seed is used.
+
+-Detailed_Input
+
+   See the individual routines.
+
+-Detailed_Output
+
+   See the individual routines.
+
+-Parameters
+
+   MAXSED      is the number of (target, frame, direction)
+               combinations for which a seed is kept.  A state in a
+               non-inertial frame may use light times to the target
+               and to the frame center, so more than one is needed.
+
+   MAXGAP      is the largest difference, in seconds, between the
+               epoch of a seed and the epoch for which it is used.
+
+-Exceptions
+
+   None.
+
+-Files
+
+   None.
+
+-Particulars
+
+   For converged Newtonian corrections SPKLTC finds the light time by
+   fixed-point iteration, starting from the geometric light time.
+   The geometric estimate requires an SPK evaluation of its own, and
+   its error, of order v/c times the light time, takes several
+   iterations to remove.
+
+   When seeding is enabled by spkezrv_c, SPKLTC records the converged
+   light time and its rate for each target, frame and direction it
+   computes.  For the next epoch within MAXGAP seconds it starts the
+   iteration from
+
+      lt + dlt * ( et - seed epoch )
+
+   instead, skipping the geometric evaluation.  The iteration
+   converges to the same light time to within the tolerance SPKLTC
+   applies; usually fewer iterations are needed.
+
+   Seeds are not used for single-iteration (LT) corrections, whose
+   result depends on the initial estimate.
+
+      zzltsset_      Enable or disable seeding, clearing all seeds.
+      zzltsget_      Return the seed for an epoch, if any.
+      zzltssav_      Record a converged light time.
+
+-Examples
+
+   See spkezrv_c.
+
+-Restrictions
+
+   1) Seeds are not keyed by observer.  Seeding must be enabled only
+      while a single observer is in use.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   light time initial estimates for converged corrections
+
+-&
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+
+
+   /*
+   Local parameters
+   */
+   #define MAXSED          4
+   #define MAXGAP          86400.0
+
+
+   /*
+   Seed table entry.
+   */
+   typedef struct
+   {
+      logical          valid;
+      integer          targ;
+      integer          refid;
+      logical          xmit;
+      doublereal       et;
+      doublereal       lt;
+      doublereal       dlt;
+
+   } LtSeed;
+
+
+   /*
+   Static variables
+   */
+   static logical          svon  = 0;
+   static integer          svnxt = 0;
+   static LtSeed           seeds [MAXSED];
+
+
+
+/*
+
+-Procedure zzltsset_ ( Enable or disable light time seeding )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   enable     I   Flag enabling seeding.
+
+-Detailed_Input
+
+   enable      is .TRUE. to enable seeding and .FALSE. to disable it.
+               All seeds are cleared in either case.
+
+-&
+*/
+
+   int zzltsset_ ( logical   * enable )
+{
+   integer                 i;
+
+
+   for ( i = 0;  i < MAXSED;  i++ )
+   {
+      seeds[i].valid = 0;
+   }
+
+   svnxt = 0;
+   svon  = *enable;
+
+   return 0;
+}
+
+
+
+/*
+
+-Procedure zzltsget_ ( Return light time seed )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   targ       I   Target ID code.
+   refid      I   Inertial frame ID code.
+   xmit       I   Flag indicating transmission correction.
+   et         I   Epoch.
+   found      O   Flag indicating a seed was found.
+   lt         O   Initial light time estimate.
+
+-Detailed_Output
+
+   found       is .TRUE. if seeding is enabled and a seed for `targ',
+               `refid' and `xmit' lies within MAXGAP seconds of `et'.
+
+   lt          is the light time at `et' extrapolated from the seed.
+               `lt' is defined only if `found' is .TRUE.
+
+-&
+*/
+
+   int zzltsget_ ( integer      * targ,
+                   integer      * refid,
+                   logical      * xmit,
+                   doublereal   * et,
+                   logical      * found,
+                   doublereal   * lt     )
+{
+   doublereal              gap;
+
+   integer                 i;
+
+
+   *found = 0;
+
+   if ( !svon )
+   {
+      return 0;
+   }
+
+   for ( i = 0;  i < MAXSED;  i++ )
+   {
+      if (     seeds[i].valid
+           && ( seeds[i].targ  == *targ  )
+           && ( seeds[i].refid == *refid )
+           && ( seeds[i].xmit  == *xmit  )  )
+      {
+         gap = *et - seeds[i].et;
+
+         if (  ( gap <= MAXGAP )  &&  ( gap >= -MAXGAP )  )
+         {
+            *lt    = seeds[i].lt  +  seeds[i].dlt * gap;
+            *found = ( *lt > 0.0 );
+         }
+
+         return 0;
+      }
+   }
+
+   return 0;
+}
+
+
+
+/*
+
+-Procedure zzltssav_ ( Record converged light time )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   targ       I   Target ID code.
+   refid      I   Inertial frame ID code.
+   xmit       I   Flag indicating transmission correction.
+   et         I   Epoch.
+   lt         I   Converged light time at `et'.
+   dlt        I   Rate of change of light time at `et'.
+
+-&
+*/
+
+   int zzltssav_ ( integer      * targ,
+                   integer      * refid,
+                   logical      * xmit,
+                   doublereal   * et,
+                   doublereal   * lt,
+                   doublereal   * dlt    )
+{
+   integer                 i;
+   integer                 slot;
+
+
+   if ( !svon )
+   {
+      return 0;
+   }
+
+   /*
+   Replace the seed for this combination if there is one; otherwise
+   replace the entries in turn.
+   */
+   slot = -1;
+
+   for ( i = 0;  ( i < MAXSED ) && ( slot < 0 );  i++ )
+   {
+      if (     seeds[i].valid
+           && ( seeds[i].targ  == *targ  )
+           && ( seeds[i].refid == *refid )
+           && ( seeds[i].xmit  == *xmit  )  )
+      {
+         slot = i;
+      }
+   }
+
+   if ( slot < 0 )
+   {
+      slot  = svnxt;
+      svnxt = ( svnxt + 1 ) % MAXSED;
+   }
+
+   seeds[slot].valid = 1;
+   seeds[slot].targ  = *targ;
+   seeds[slot].refid = *refid;
+   seeds[slot].xmit  = *xmit;
+   seeds[slot].et    = *et;
+   seeds[slot].lt    = *lt;
+   seeds[slot].dlt   = *dlt;
+
+   return 0;
+}
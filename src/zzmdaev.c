@@ -0,0 +1,263 @@
+/*
+
+-Procedure zzmdaev ( Evaluate modified difference array )
+
+-Abstract
+
+   SPICE Private routine intended solely for the support of SPICE
+   routines.  Users should not call this routine directly due
+   to the volatile nature of this routine.
+
+   Evaluate the state given by a difference line of an SPK type 1 or
+   type 21 segment.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   SPK
+
+-Keywords
+
+   EPHEMERIS
+   PRIVATE
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   et         I   Evaluation epoch.
+   maxdim     I   Difference table dimension per component.
+   dline      I   Difference line.
+   state      O   State (position and velocity).
+   MAXTRM     P   Maximum difference table dimension.
+
+-Detailed_Input
+
+   et          is an epoch, expressed as seconds past J2000 TDB, at
+               which the state is to be evaluated.
+
+   maxdim      is the dimension of each component of the difference
+               table of `dline': 15 for type 1, and the first element
+               of the record for type 21.
+
+   dline       is a difference line, containing in order
+
+                  Dimension  Description
+                  ---------  ----------------------------------
+                  1          Reference epoch of difference line
+                  maxdim     Stepsize function vector
+                  6          Reference position and velocity,
+                             interleaved by component
+                  maxdim,3   Modified divided difference arrays
+                  1          Maximum integration order plus 1
+                  3          Integration order array
+
+-Detailed_Output
+
+   state       is the state at `et' given by `dline'.
+
+-Parameters
+
+   MAXTRM      is the largest difference table dimension supported,
+               that of SPK type 21.
+
+-Exceptions
+
+   None.  The caller must ensure that `maxdim' does not exceed
+   MAXTRM and that the stepsize function vector contains no zero
+   elements.
+
+-Files
+
+   None.
+
+-Particulars
+
+   This routine performs the computation of SPKE01 and SPKE21.  The
+   coefficients applied to the difference arrays depend only on the
+   epoch, so they are computed once, and the position and velocity
+   of each component are then accumulated in a single pass over its
+   difference array.  The operations and their order are those of
+   the original routines, so the results are identical.
+
+-Examples
+
+   See SPKE01 and SPKE21.
+
+-Restrictions
+
+   None.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 19-OCT-2026 (NZL)
+
+-Index_Entries
+
+   evaluate modified difference array
+
+-&
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+
+
+   /*
+   Local parameters
+   */
+   #define MAXTRM          25
+
+
+   int zzmdaev_ ( doublereal   * et,
+                  integer      * maxdim,
+                  doublereal   * dline,
+                  doublereal   * state   )
+{
+   /*
+   Local variables
+   */
+   doublereal            * dt;
+   doublereal            * g;
+   doublereal            * ref;
+   doublereal              delta;
+   doublereal              fc     [ MAXTRM ];
+   doublereal              sump;
+   doublereal              sumv;
+   doublereal              tp;
+   doublereal              w      [ MAXTRM + 2 ];
+   doublereal              wc     [ MAXTRM - 1 ];
+   doublereal              wp     [ MAXTRM + 2 ];
+
+   integer                 i;
+   integer                 j;
+   integer                 jx;
+   integer                 kq     [ 3 ];
+   integer                 kqmax1;
+   integer                 kqq;
+   integer                 ks;
+   integer                 ks1;
+   integer                 md;
+   integer                 mq2;
+
+
+   /*
+   Unpack the difference line.
+   */
+   md     = *maxdim;
+
+   g      = dline + 1;
+   ref    = dline + 1 + md;
+   dt     = dline + 7 + md;
+
+   kqmax1 = (integer) dline[ 7 + 4*md ];
+   kq[0]  = (integer) dline[ 8 + 4*md ];
+   kq[1]  = (integer) dline[ 9 + 4*md ];
+   kq[2]  = (integer) dline[10 + 4*md ];
+
+   /*
+   Compute the coefficients, as SPKE01 does.
+   */
+   delta  = *et - dline[0];
+   tp     = delta;
+   mq2    = kqmax1 - 2;
+   ks     = kqmax1 - 1;
+
+   fc[0]  = 1.0;
+
+   for ( j = 1;  j <= mq2;  j++ )
+   {
+      fc[j]   = tp    / g[j-1];
+      wc[j-1] = delta / g[j-1];
+      tp      = delta + g[j-1];
+   }
+
+   for ( j = 1;  j <= kqmax1;  j++ )
+   {
+      w[j-1] = 1.0 / (doublereal) j;
+   }
+
+   jx  = 0;
+   ks1 = ks - 1;
+
+   while ( ks >= 2 )
+   {
+      jx++;
+
+      for ( j = 1;  j <= jx;  j++ )
+      {
+         w[j+ks-1] = fc[j] * w[j+ks1-1]  -  wc[j-1] * w[j+ks-1];
+      }
+
+      ks = ks1;
+      ks1--;
+   }
+
+   /*
+   KS is now 1.  W(2:KQMAX1) hold the position coefficients; one more
+   step of the recurrence yields the velocity coefficients in
+   W(1:KQMAX1-1).
+   */
+   for ( j = 1;  j < kqmax1;  j++ )
+   {
+      wp[j] = w[j];
+   }
+
+   for ( j = 1;  j <= jx;  j++ )
+   {
+      w[j] = fc[j] * w[j-1]  -  wc[j-1] * w[j];
+   }
+
+   /*
+   Accumulate position and velocity together.
+   */
+   for ( i = 0;  i < 3;  i++ )
+   {
+      kqq  = kq[i];
+      sump = 0.0;
+      sumv = 0.0;
+
+      for ( j = kqq;  j >= 1;  j-- )
+      {
+         sump += dt[i*md + j-1] * wp[j];
+         sumv += dt[i*md + j-1] * w [j-1];
+      }
+
+      state[i]   = ref[2*i]  +  delta * ( ref[2*i+1] + delta * sump );
+      state[i+3] = ref[2*i+1]  +  delta * sumv;
+   }
+
+   return 0;
+}
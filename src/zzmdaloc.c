@@ -0,0 +1,307 @@
+/*
+
+-Procedure zzmdaloc ( Locate difference line record )
+
+-Abstract
+
+   SPICE Private routine intended solely for the support of SPICE
+   routines.  Users should not call this routine directly due
+   to the volatile nature of this routine.
+
+   Find the record of an SPK type 1 or type 21 segment that covers
+   a specified epoch.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   DAF
+   SPK
+
+-Keywords
+
+   EPHEMERIS
+   PRIVATE
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   handle     I   Handle of SPK file.
+   begin      I   Beginning address of segment.
+   nrec       I   Number of records in segment.
+   offe       I   Offset of the first record epoch.
+   et         I   Request epoch.
+   recno      O   Number of the record covering `et'.
+   MAXSEG     P   Number of segments whose epochs are kept.
+
+-Detailed_Input
+
+   handle,
+   begin       are the handle of an SPK file open for read access and
+               the beginning DAF address of a type 1 or type 21
+               segment in it.
+
+   nrec        is the number of records in the segment.
+
+   offe        is the DAF address preceding the first record epoch
+               of the segment.
+
+   et          is an epoch, expressed as seconds past J2000 TDB,
+               within the coverage of the segment.
+
+-Detailed_Output
+
+   recno       is the number of the first record of the segment
+               whose epoch is greater than or equal to `et'.  This is
+               the record SPKR01 or SPKR21 returns for `et'.
+
+-Parameters
+
+   MAXSEG      is the number of segments whose record epochs are
+               kept in memory.
+
+-Exceptions
+
+   1)  Errors reading the segment are signaled by routines in the
+       call tree of this routine.  `recno' is then undefined.
+
+-Files
+
+   See argument `handle'.
+
+-Particulars
+
+   SPKR01 and SPKR21 formerly located the record for an epoch by
+   reading the epoch directory of the segment one entry at a time,
+   then reading and searching the group of 100 epochs the directory
+   entry selected.  For segments of thousands of records, as in
+   small-body ephemerides, this cost up to several dozen DAF reads
+   per state.
+
+   This routine reads the record epochs of a segment once, into
+   memory, and finds the record for each later request by binary
+   search of those epochs.  The epochs of the MAXSEG segments used
+   most recently are kept, in order of last use; reading the epochs
+   of another segment discards those of the segment used least
+   recently.  DAF handles are not reused within a
+   program run, so a handle and segment address identify a segment
+   for as long as the program runs.
+
+   If memory for the epochs cannot be allocated, the epochs are read
+   from the file as the binary search requires them.  The record
+   found is the same in either case.
+
+-Examples
+
+   See SPKR01 and SPKR21.
+
+-Restrictions
+
+   1)  The record epochs of the segment must be strictly increasing,
+       as SPKW01 and SPKW21 require.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 19-OCT-2026 (NZL)
+
+-Index_Entries
+
+   locate type_1 or type_21 spk record
+
+-&
+*/
+
+   #include <stdlib.h>
+   #include <string.h>
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+
+
+   /*
+   Local parameters
+   */
+   #define MAXSEG          16
+
+
+   /*
+   Epoch table entry.
+   */
+   typedef struct
+   {
+      integer          handle;
+      integer          begin;
+      integer          nrec;
+      doublereal     * epochs;
+
+   } EpochTable;
+
+
+   /*
+   Static variables
+
+   The tables are kept in order of last use, the most recent first.
+   */
+   static EpochTable       tables [MAXSEG];
+
+
+   int zzmdaloc_ ( integer      * handle,
+                   integer      * begin,
+                   integer      * nrec,
+                   integer      * offe,
+                   doublereal   * et,
+                   integer      * recno  )
+{
+   /*
+   Local variables
+   */
+   doublereal            * epochs;
+   doublereal              epoch;
+
+   integer                 addr;
+   integer                 first;
+   integer                 hi;
+   integer                 i;
+   integer                 last;
+   integer                 lo;
+   integer                 mid;
+
+   EpochTable              entry;
+
+
+   /*
+   Look for the epochs of the segment.
+   */
+   epochs = NULL;
+
+   for ( i = 0;  ( i < MAXSEG ) && ( epochs == NULL );  i++ )
+   {
+      if (     ( tables[i].epochs != NULL    )
+           && ( tables[i].handle == *handle )
+           && ( tables[i].begin  == *begin  )
+           && ( tables[i].nrec   == *nrec   )  )
+      {
+         epochs = tables[i].epochs;
+
+         /*
+         Move the table to the front.
+         */
+         if ( i > 0 )
+         {
+            entry = tables[i];
+
+            memmove ( tables + 1, tables, (size_t)i * sizeof(EpochTable) );
+
+            tables[0] = entry;
+         }
+      }
+   }
+
+   /*
+   If they are not in memory, discard the epochs of the segment used
+   least recently and read them into the front table.
+   */
+   if ( epochs == NULL )
+   {
+      if ( tables[MAXSEG-1].epochs != NULL )
+      {
+         free ( tables[MAXSEG-1].epochs );
+         tables[MAXSEG-1].epochs = NULL;
+      }
+
+      epochs = (doublereal *) malloc ( (size_t)(*nrec) * sizeof(doublereal) );
+
+      if ( epochs != NULL )
+      {
+         first = *offe + 1;
+         last  = *offe + *nrec;
+
+         dafgda_ ( handle, &first, &last, epochs );
+
+         if ( failed_() )
+         {
+            free ( epochs );
+            return 0;
+         }
+
+         memmove ( tables + 1, tables,
+                   (MAXSEG-1) * sizeof(EpochTable) );
+
+         tables[0].handle = *handle;
+         tables[0].begin  = *begin;
+         tables[0].nrec   = *nrec;
+         tables[0].epochs = epochs;
+      }
+   }
+
+   if ( epochs != NULL )
+   {
+      *recno = lstltd_ ( et, nrec, epochs ) + 1;
+
+      return 0;
+   }
+
+   /*
+   Search the epochs in the file.  Find the number of epochs less
+   than `et': LO epochs are known to be, and HI at most.
+   */
+   lo = 0;
+   hi = *nrec;
+
+   while ( lo < hi )
+   {
+      mid  = ( lo + hi + 1 ) / 2;
+      addr = *offe + mid;
+
+      dafgda_ ( handle, &addr, &addr, &epoch );
+
+      if ( failed_() )
+      {
+         return 0;
+      }
+
+      if ( epoch < *et )
+      {
+         lo = mid;
+      }
+      else
+      {
+         hi = mid - 1;
+      }
+   }
+
+   *recno = lo + 1;
+
+   return 0;
+}
@@ -33,19 +33,14 @@ static integer c_b53 = 100000;
     /* Local variables */
     static integer cvid, npcg;
     static doublereal vmod[3], xmin, ymin, xmax;
-    extern integer zzvox2id_(integer *, integer *);
+    static integer pass;
     static doublereal ymax, zmax, zmin;
-    extern /* Subroutine */ int zzaddlnk_(integer *, integer *, integer *, 
-	    integer *, integer *, integer *, integer *), zzinilnk_(integer *, 
-	    integer *, integer *, integer *, integer *);
     static integer i__, j;
-    extern /* Subroutine */ int zzuntngl_(integer *, integer *, integer *, 
-	    integer *, integer *, integer *, integer *), zzgetvox_(doublereal 
-	    *, doublereal *, integer *, doublereal *, logical *, integer *);
+    extern /* Subroutine */ int zzgetvox_(doublereal *, doublereal *, 
+	    integer *, doublereal *, logical *, integer *);
     static integer q, r__, cgoff[3];
-    extern /* Subroutine */ int zzvoxcvo_(integer *, integer *, integer *, 
-	    integer *, integer *, integer *), chkin_(char *, ftnlen);
-    static integer ncell;
+    extern /* Subroutine */ int chkin_(char *, ftnlen);
+    static integer nfound;
     extern /* Subroutine */ int vpack_(doublereal *, doublereal *, doublereal 
 	    *, doublereal *);
     extern doublereal dpmin_(void), dpmax_(void);
@@ -56,8 +51,7 @@ static integer c_b53 = 100000;
     static logical inbox;
     extern /* Subroutine */ int errdp_(char *, doublereal *, ftnlen);
     static doublereal xvmin, yvmin, xvmax, yvmax, zvmax, zvmin;
-    static integer cgof1d, cgxyz[3], ixptr, vixyz[3];
-    extern logical failed_(void);
+    static integer cgof1d, cgxyz[3], ixptr, ptrdex;
     extern /* Subroutine */ int cleari_(integer *, integer *);
     static integer ncgflg, ix, iy, iz, to, cgrdim[3], nx;
     static doublereal xp[3];
@@ -419,18 +413,18 @@ static integer c_b53 = 100000;
 /*                list of voxel pointers. */
 
 /*     MXCELL     is the number of cells in the input cell array. */
-/*                This is the second dimension of the array. */
+/*                This is the second dimension of the array. MXCELL */
+/*                is no longer used. */
 
 /*     MAXVXL     is the maximum number of elements in the output */
 /*                voxel-plate list. */
 
-/*     CELLS      workspace array used to construct the voxel-plate */
-/*                mapping. */
+/*     CELLS      workspace array formerly used to construct the */
+/*                voxel-plate mapping. CELLS is no longer used. */
 
 /* $ Detailed_Output */
 
-/*     CELLS      workspace array used to construct the voxel-plate */
-/*                mapping. */
+/*     CELLS      is not modified. */
 
 /*     NVOX       Dimensions of the voxel grid in voxel units. */
 
@@ -492,14 +486,13 @@ static integer c_b53 = 100000;
 /*         fine voxel count evenly, the error SPICE(INCOMPATIBLESCALE) */
 /*         will be signaled. */
 
-/*     7)  If the workspace overflows while this routine accumulates */
-/*         voxel-plate associations, the error will be signaled by */
-/*         a routine in the call tree of this routine. */
+/*     7)  If the voxel pointer array overflows while this routine */
+/*         accumulates voxel-plate associations, the error */
+/*         SPICE(AVALOUTOFRANGE) is signaled. */
 
-/*     8)  If the voxel-plate association list array overflows while */
-/*         this routine accumulates voxel-plate associations, the error */
-/*         will be signaled by a routine in the call tree of this */
-/*         routine. */
+/*     8)  If the voxel-plate association list array is too small to */
+/*         hold the voxel-plate associations, the error */
+/*         SPICE(BARRAYTOOSMALL) is signaled. */
 
 /* $ Files */
 
@@ -512,6 +505,14 @@ static integer c_b53 = 100000;
 /*     grid dimensions and parameters. It also builds the voxel-plate */
 /*     association data structures. */
 
+/*     The voxel-plate associations are built in two passes over the */
+/*     plates: the first counts the plates of each voxel, which */
+/*     determines where the plate list of each voxel starts, and the */
+/*     second stores the plate IDs in the lists. The only storage */
+/*     used is that of the outputs. The lists are the same as those */
+/*     formerly built in a linked list in the workspace CELLS: the */
+/*     plate IDs of each list are in decreasing order. */
+
 /* $ Examples */
 
 /*     See usage in DSKMI2. */
@@ -891,9 +892,18 @@ static integer c_b53 = 100000;
 	return 0;
     }
 
-/*     Enumerate all voxels that each plate might intersect. */
+/*     Enumerate all voxels that each plate might intersect. This is */
+/*     done in two passes over the plates. The first pass allocates */
+/*     the pointers of the coarse voxels and counts the plates of each */
+/*     fine voxel, using VXPTR to hold the counts. The counts determine */
+/*     where the plate list of each voxel starts in VXLIST. The second */
+/*     pass stores the plate IDs in those lists. No workspace is */
+/*     needed for the voxel-plate associations. */
 
-    zzinilnk_(maxptr, mxcell, &ncell, vxptr, cells);
+    i__1 = *maxptr;
+    for (i__ = 1; i__ <= i__1; ++i__) {
+	vxptr[i__ - 1] = 0;
+    }
 
 /*     Set the dimensions of the coarse grid. */
 
@@ -905,181 +915,215 @@ static integer c_b53 = 100000;
 /*     TO points to the first free location in the VXPTR array. */
 
     to = 1;
-    i__1 = *np;
-    for (i__ = 1; i__ <= i__1; ++i__) {
-
-/*        Find the extents of the Ith plate, where the extents */
-/*        are expanded by TOL in each direction. We truncate */
-/*        the expanded box at a distance of MDLTOL beyond the */
-/*        extents of the vertex set, if necessary. */
-
-	xp[0] = vrtces[plates[i__ * 3 - 3] * 3 - 3];
-	xp[1] = vrtces[plates[i__ * 3 - 2] * 3 - 3];
-	xp[2] = vrtces[plates[i__ * 3 - 1] * 3 - 3];
-	yp[0] = vrtces[plates[i__ * 3 - 3] * 3 - 2];
-	yp[1] = vrtces[plates[i__ * 3 - 2] * 3 - 2];
-	yp[2] = vrtces[plates[i__ * 3 - 1] * 3 - 2];
-	zp[0] = vrtces[plates[i__ * 3 - 3] * 3 - 1];
-	zp[1] = vrtces[plates[i__ * 3 - 2] * 3 - 1];
-	zp[2] = vrtces[plates[i__ * 3 - 1] * 3 - 1];
+    for (pass = 1; pass <= 2; ++pass) {
+	i__1 = *np;
+	for (i__ = 1; i__ <= i__1; ++i__) {
+
+/*           Find the extents of the Ith plate, where the extents */
+/*           are expanded by TOL in each direction. We truncate */
+/*           the expanded box at a distance of MDLTOL beyond the */
+/*           extents of the vertex set, if necessary. */
+
+	    xp[0] = vrtces[plates[i__ * 3 - 3] * 3 - 3];
+	    xp[1] = vrtces[plates[i__ * 3 - 2] * 3 - 3];
+	    xp[2] = vrtces[plates[i__ * 3 - 1] * 3 - 3];
+	    yp[0] = vrtces[plates[i__ * 3 - 3] * 3 - 2];
+	    yp[1] = vrtces[plates[i__ * 3 - 2] * 3 - 2];
+	    yp[2] = vrtces[plates[i__ * 3 - 1] * 3 - 2];
+	    zp[0] = vrtces[plates[i__ * 3 - 3] * 3 - 1];
+	    zp[1] = vrtces[plates[i__ * 3 - 2] * 3 - 1];
+	    zp[2] = vrtces[plates[i__ * 3 - 1] * 3 - 1];
 /* Computing MIN */
-	d__2 = min(xp[0],xp[1]);
-	d__1 = min(d__2,xp[2]) - mdltol;
-	bxmin = brcktd_(&d__1, xextnt, &xextnt[1]);
+	    d__2 = min(xp[0],xp[1]);
+	    d__1 = min(d__2,xp[2]) - mdltol;
+	    bxmin = brcktd_(&d__1, xextnt, &xextnt[1]);
 /* Computing MAX */
-	d__2 = max(xp[0],xp[1]);
-	d__1 = max(d__2,xp[2]) + mdltol;
-	bxmax = brcktd_(&d__1, xextnt, &xextnt[1]);
+	    d__2 = max(xp[0],xp[1]);
+	    d__1 = max(d__2,xp[2]) + mdltol;
+	    bxmax = brcktd_(&d__1, xextnt, &xextnt[1]);
 /* Computing MIN */
-	d__2 = min(yp[0],yp[1]);
-	d__1 = min(d__2,yp[2]) - mdltol;
-	bymin = brcktd_(&d__1, &xextnt[2], &xextnt[3]);
+	    d__2 = min(yp[0],yp[1]);
+	    d__1 = min(d__2,yp[2]) - mdltol;
+	    bymin = brcktd_(&d__1, &xextnt[2], &xextnt[3]);
 /* Computing MAX */
-	d__2 = max(yp[0],yp[1]);
-	d__1 = max(d__2,yp[2]) + mdltol;
-	bymax = brcktd_(&d__1, &xextnt[2], &xextnt[3]);
+	    d__2 = max(yp[0],yp[1]);
+	    d__1 = max(d__2,yp[2]) + mdltol;
+	    bymax = brcktd_(&d__1, &xextnt[2], &xextnt[3]);
 /* Computing MIN */
-	d__2 = min(zp[0],zp[1]);
-	d__1 = min(d__2,zp[2]) - mdltol;
-	bzmin = brcktd_(&d__1, &xextnt[4], &xextnt[5]);
+	    d__2 = min(zp[0],zp[1]);
+	    d__1 = min(d__2,zp[2]) - mdltol;
+	    bzmin = brcktd_(&d__1, &xextnt[4], &xextnt[5]);
 /* Computing MAX */
-	d__2 = max(zp[0],zp[1]);
-	d__1 = max(d__2,zp[2]) + mdltol;
-	bzmax = brcktd_(&d__1, &xextnt[4], &xextnt[5]);
-
-/*        Find the range of voxel coordinates that contain the bounding */
-/*        box of the plate. All we need look at are the coordinates */
-/*        of the two corners having minimum and maximum coordinates. */
-
-/*        Start with the corner having minimum coordinates: */
-
-	vpack_(&bxmin, &bymin, &bzmin, vmod);
-	zzgetvox_(voxsiz, voxori, nvox, vmod, &inbox, vcoord);
-	if (! inbox) {
-
-/*           A corner of the bounding box lies outside the voxel grid. */
-/*           This should never occur. */
-
-	    setmsg_("BUG: bounding box of plate is outside of voxel grid. In"
-		    "put coordinates were (#, #, #). Plate ID = #.", (ftnlen)
-		    100);
-	    errdp_("#", vmod, (ftnlen)1);
-	    errdp_("#", &vmod[1], (ftnlen)1);
-	    errdp_("#", &vmod[2], (ftnlen)1);
-	    errint_("#", &i__, (ftnlen)1);
-	    sigerr_("SPICE(BUG)", (ftnlen)10);
-	    chkout_("ZZMKSPIN", (ftnlen)8);
-	    return 0;
-	}
-
-/*        Unpack minimum voxel coordinates from VCOORD. */
+	    d__2 = max(zp[0],zp[1]);
+	    d__1 = max(d__2,zp[2]) + mdltol;
+	    bzmax = brcktd_(&d__1, &xextnt[4], &xextnt[5]);
+
+/*           Find the range of voxel coordinates that contain the */
+/*           bounding box of the plate. All we need look at are the */
+/*           coordinates of the two corners having minimum and maximum */
+/*           coordinates. */
+
+/*           Start with the corner having minimum coordinates: */
+
+	    vpack_(&bxmin, &bymin, &bzmin, vmod);
+	    zzgetvox_(voxsiz, voxori, nvox, vmod, &inbox, vcoord);
+	    if (! inbox) {
+
+/*              A corner of the bounding box lies outside the voxel */
+/*              grid. This should never occur. */
+
+		setmsg_("BUG: bounding box of plate is outside of voxel grid"
+			". Input coordinates were (#, #, #). Plate ID = #.", (
+			ftnlen)100);
+		errdp_("#", vmod, (ftnlen)1);
+		errdp_("#", &vmod[1], (ftnlen)1);
+		errdp_("#", &vmod[2], (ftnlen)1);
+		errint_("#", &i__, (ftnlen)1);
+		sigerr_("SPICE(BUG)", (ftnlen)10);
+		chkout_("ZZMKSPIN", (ftnlen)8);
+		return 0;
+	    }
 
-	gxmin = vcoord[0];
-	gymin = vcoord[1];
-	gzmin = vcoord[2];
+/*           Unpack minimum voxel coordinates from VCOORD. */
 
-/*        Now handle the corner having maximum coordinates: */
+	    gxmin = vcoord[0];
+	    gymin = vcoord[1];
+	    gzmin = vcoord[2];
 
-	vpack_(&bxmax, &bymax, &bzmax, vmod);
-	zzgetvox_(voxsiz, voxori, nvox, vmod, &inbox, vcoord);
-	if (! inbox) {
+/*           Now handle the corner having maximum coordinates: */
 
-/*           A corner of the bounding box lies outside the voxel grid. */
-/*           This should never occur. */
+	    vpack_(&bxmax, &bymax, &bzmax, vmod);
+	    zzgetvox_(voxsiz, voxori, nvox, vmod, &inbox, vcoord);
+	    if (! inbox) {
 
-	    setmsg_("BUG: bounding box of plate is outside of voxel grid. In"
-		    "put coordinates were (#, #, #). Plate ID = #.", (ftnlen)
-		    100);
-	    errdp_("#", vmod, (ftnlen)1);
-	    errdp_("#", &vmod[1], (ftnlen)1);
-	    errdp_("#", &vmod[2], (ftnlen)1);
-	    errint_("#", &i__, (ftnlen)1);
-	    sigerr_("SPICE(BUG)", (ftnlen)10);
-	    chkout_("ZZMKSPIN", (ftnlen)8);
-	    return 0;
-	}
+/*              A corner of the bounding box lies outside the voxel */
+/*              grid. This should never occur. */
 
-/*        Unpack maximum voxel coordinates from VCOORD. */
-
-	gxmax = vcoord[0];
-	gymax = vcoord[1];
-	gzmax = vcoord[2];
-
-/*        Determine voxels that the bounding box of the plate */
-/*        intersects. */
-
-	i__2 = gzmax;
-	for (iz = gzmin; iz <= i__2; ++iz) {
-	    i__3 = gymax;
-	    for (iy = gymin; iy <= i__3; ++iy) {
-		i__4 = gxmax;
-		for (ix = gxmin; ix <= i__4; ++ix) {
-		    vixyz[0] = ix;
-		    vixyz[1] = iy;
-		    vixyz[2] = iz;
-
-/*                   Find the coarse voxel containing this voxel, and */
-/*                   compute the offset of this voxel within the coarse */
-/*                   voxel. The output CGXYZ contains the 3-dimensional */
-/*                   coordinates of the coarse voxel within the coarse */
-/*                   grid. The output CGOF1D is the 1-based, */
-/*                   1-dimensional offset of the current voxel (having */
-/*                   coordinates VIXYZ) from the start of the coarse */
-/*                   voxel. */
-
-		    zzvoxcvo_(vixyz, nvox, cgscal, cgxyz, cgoff, &cgof1d);
-		    if (failed_()) {
-			chkout_("ZZMKSPIN", (ftnlen)8);
-			return 0;
-		    }
-		    cvid = zzvox2id_(cgxyz, cgrdim);
-		    if (cgrptr[cvid - 1] == 0) {
-
-/*                      The coarse voxel at index CVID is empty so far. */
-/*                      Allocate CGSCAL pointers for it in the VXPTR */
-/*                      array; make the coarse voxel point to the first */
-/*                      element of this sub-array. */
+		setmsg_("BUG: bounding box of plate is outside of voxel grid"
+			". Input coordinates were (#, #, #). Plate ID = #.", (
+			ftnlen)100);
+		errdp_("#", vmod, (ftnlen)1);
+		errdp_("#", &vmod[1], (ftnlen)1);
+		errdp_("#", &vmod[2], (ftnlen)1);
+		errint_("#", &i__, (ftnlen)1);
+		sigerr_("SPICE(BUG)", (ftnlen)10);
+		chkout_("ZZMKSPIN", (ftnlen)8);
+		return 0;
+	    }
 
-			cgrptr[cvid - 1] = to;
-			to += npcg;
+/*           Unpack maximum voxel coordinates from VCOORD. */
+
+	    gxmax = vcoord[0];
+	    gymax = vcoord[1];
+	    gzmax = vcoord[2];
+
+/*           Determine voxels that the bounding box of the plate */
+/*           intersects. */
+
+	    i__2 = gzmax;
+	    for (iz = gzmin; iz <= i__2; ++iz) {
+		i__3 = gymax;
+		for (iy = gymin; iy <= i__3; ++iy) {
+		    i__4 = gxmax;
+		    for (ix = gxmin; ix <= i__4; ++ix) {
+
+/*                    Find the coarse voxel containing this voxel, and */
+/*                    the 1-based, 1-dimensional offset CGOF1D of this */
+/*                    voxel from the start of the coarse voxel, as */
+/*                    ZZVOXCVO does. Then find the ID of the coarse */
+/*                    voxel, as ZZVOX2ID does. The voxel coordinates */
+/*                    are known to be inside the grid. */
+
+			cgxyz[0] = (ix - 1) / *cgscal + 1;
+			cgxyz[1] = (iy - 1) / *cgscal + 1;
+			cgxyz[2] = (iz - 1) / *cgscal + 1;
+			cgoff[0] = ix - *cgscal * (cgxyz[0] - 1);
+			cgoff[1] = iy - *cgscal * (cgxyz[1] - 1);
+			cgoff[2] = iz - *cgscal * (cgxyz[2] - 1);
+			cgof1d = (cgoff[2] - 1) * *cgscal * *cgscal + (cgoff[
+				1] - 1) * *cgscal + cgoff[0];
+			cvid = cgxyz[0] + cgrdim[0] * (cgxyz[1] - 1 + (cgxyz[
+				2] - 1) * cgrdim[1]);
+			if (pass == 1) {
+			    if (cgrptr[cvid - 1] == 0) {
+
+/*                          The coarse voxel at index CVID is empty so */
+/*                          far. Allocate CGSCAL**3 pointers for it in */
+/*                          the VXPTR array; make the coarse voxel point */
+/*                          to the first element of this sub-array. */
+
+				cgrptr[cvid - 1] = to;
+				to += npcg;
+			    }
+
+/*                       Let IXPTR be the index in the VXPTR array of */
+/*                       the pointer for the current voxel. Count the */
+/*                       plate. */
+
+			    ixptr = cgrptr[cvid - 1] - 1 + cgof1d;
+			    if (ixptr > *maxptr) {
+				setmsg_("Index AVAL is out of range. AVAL = "
+					"#1; valid range is 1:#2.", (ftnlen)
+					59);
+				errint_("#1", &ixptr, (ftnlen)2);
+				errint_("#2", maxptr, (ftnlen)2);
+				sigerr_("SPICE(AVALOUTOFRANGE)", (ftnlen)21);
+				chkout_("ZZMKSPIN", (ftnlen)8);
+				return 0;
+			    }
+			    ++vxptr[ixptr - 1];
+			} else {
+
+/*                       VXPTR(IXPTR) is the index in VXLIST of the */
+/*                       last unfilled element of the voxel's list. */
+/*                       The lists are filled from the end, so that */
+/*                       the plate IDs are in decreasing order. */
+
+			    ixptr = cgrptr[cvid - 1] - 1 + cgof1d;
+			    vxlist[vxptr[ixptr - 1] - 1] = i__;
+			    --vxptr[ixptr - 1];
+			}
 		    }
-
-/*                   Let IXPTR be the index in the VXPTR array of the */
-/*                   pointer for the current voxel. */
-
-		    ixptr = cgrptr[cvid - 1] - 1 + cgof1d;
-		    zzaddlnk_(&ixptr, &i__, maxptr, mxcell, vxptr, &ncell, 
-			    cells);
-		    if (failed_()) {
+		}
+	    }
+	}
+	if (pass == 1) {
+
+/*           Lay out the plate lists in VXLIST. For the Nth voxel, */
+/*           VXLIST(M) will contain the number of plates of the voxel */
+/*           and the IDs of those plates will follow. Empty voxels get */
+/*           the pointer -1. For now, set VXPTR(N) to the index of the */
+/*           last element of the list; when the second pass has filled */
+/*           the list, VXPTR(N) will be M. */
+
+	    *nvxptr = to - 1;
+	    ptrdex = 0;
+	    i__1 = *nvxptr;
+	    for (i__ = 1; i__ <= i__1; ++i__) {
+		nfound = vxptr[i__ - 1];
+		if (nfound > 0) {
+		    if (ptrdex + 1 + nfound > *maxvxl) {
+			setmsg_("Voxel-plate list array size # is too small "
+				"to hold the plate lists of voxels 1:#; # ele"
+				"ments are needed.", (ftnlen)104);
+			errint_("#", maxvxl, (ftnlen)1);
+			errint_("#", &i__, (ftnlen)1);
+			i__2 = ptrdex + 1 + nfound;
+			errint_("#", &i__2, (ftnlen)1);
+			sigerr_("SPICE(BARRAYTOOSMALL)", (ftnlen)21);
 			chkout_("ZZMKSPIN", (ftnlen)8);
 			return 0;
 		    }
+		    vxlist[ptrdex] = nfound;
+		    ptrdex = ptrdex + 1 + nfound;
+		    vxptr[i__ - 1] = ptrdex;
+		} else {
+		    vxptr[i__ - 1] = -1;
 		}
 	    }
+	    *nvxlst = ptrdex;
 	}
     }
-    *nvxptr = to - 1;
-
-/*     Generate two linked lists mapping voxel ID to the plates enclosed */
-/*     within that voxel (if any). */
-
-/*     VXPTR : An array, indexed by voxel ID. For an array element, */
-/*             VXPTR(VOX_ID), greater than zero, the value identifies an */
-/*             index in VXLIST, the value of that VXLIST array element */
-/*             equaling the number of plates contained in the voxel */
-/*             specified by the ID. The condition VXPTR(VOX_ID) = -1 */
-/*             indicates the voxel contains no plates. */
-
-/*     VXLIST: An array, indexed by the positive entries in VXPTR. The */
-/*             element, N, identified by a VXPTR value describes the */
-/*             number of plates contained in the corresponding voxel. */
-
-/*                 N = VXLIST( VXPTR(VOX_ID) ) */
-
-/*             The N elements following VXLIST( VXPTR(VOX_ID) ), */
-/*             contain the IDs of those plates within the voxel. */
-
-    zzuntngl_(nvxptr, mxcell, cells, maxvxl, vxptr, nvxlst, vxlist);
     chkout_("ZZMKSPIN", (ftnlen)8);
     return 0;
 } /* zzmkspin_ */
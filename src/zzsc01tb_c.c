@@ -0,0 +1,1179 @@
+/*
+
+-Procedure zzsc01tb_c ( Cached type 1 SCLK tables, umbrella )
+
+-Abstract
+
+   CSPICE Private routine intended solely for the support of CSPICE
+   routines.  Users should not call this routine directly due
+   to the volatile nature of this routine.
+
+   Maintain parsed copies of the kernel variables of several type 1
+   spacecraft clocks and use them to convert between encoded SCLK,
+   SCLK strings and ET without going through the kernel pool on each
+   call.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   SCLK
+   TIME
+
+-Keywords
+
+   PRIVATE
+   TIME
+
+-Brief_I/O
+
+   See the individual routines.
+
+-Detailed_Input
+
+   See the individual routines.
+
+-Detailed_Output
+
+   See the individual routines.
+
+-Parameters
+
+   MAXCLK      is the number of clocks for which data are buffered.
+               When data for a further clock are needed, the least
+               recently loaded clock is dropped.
+
+-Exceptions
+
+   The routines in this file do not signal errors. If the buffered
+   data cannot be used for a given input, the conversion routines
+   return SPICEFALSE and callers are expected to fall back to the
+   general SPICELIB conversion path, which diagnoses the problem.
+
+-Files
+
+   An SCLK kernel for each clock must be loaded. A leapseconds kernel
+   must be loaded for clocks whose parallel time system is TDT.
+
+-Particulars
+
+   Routines coded in this file:
+
+      zzsc01ld_c     Load the buffered data for a clock.
+      zzsc01ok_c     Select a clock; indicate availability.
+      zzsc01te_c     Convert encoded SCLK to ET.
+      zzsc01ec_c     Convert ET to continuous encoded SCLK.
+      zzsc01et_c     Convert ET to discrete encoded SCLK.
+      zzsc01en_c     Convert an SCLK string to encoded SCLK.
+
+   SPICELIB buffers the type 1 SCLK kernel variables for only the
+   most recently used clock, and refetches them from the kernel pool
+   whenever a different clock is requested. This file keeps the
+   variables of up to MAXCLK clocks, each with its own kernel pool
+   watcher, so applications that alternate between clocks do not pay
+   for a refetch on each call.
+
+   A clock's data are buffered by zzsc01ld_c, which must be called
+   only after a SPICELIB conversion for that clock has succeeded.
+   The kernel variables have then already been validated by SCLU01,
+   SCPART and SCTYPE, so they are not checked again here. The data
+   are discarded as soon as the kernel pool changes, and zzsc01ok_c
+   returns SPICEFALSE until they are loaded again.
+
+   The conversion routines follow the SPICELIB routines SCTE01,
+   SCEC01, SCET01 and SCENCD operation for operation, so results are
+   bit-for-bit identical to those of the SPICELIB conversion path.
+   Searches of the coefficient records start from the record found on
+   the previous call; the bisection used by SC01 is applied only when
+   the hint fails. Any input the SPICELIB routines would reject makes
+   the conversion routines return SPICEFALSE.
+
+-Examples
+
+   See sct2e_c.
+
+-Restrictions
+
+   1) This is a CSPICE private routine. The interface may be changed
+      without notice, so these routines should not be called except
+      by other CSPICE routines.
+
+   2) The conversion routines may be called only after zzsc01ok_c or
+      zzsc01ld_c has returned SPICETRUE. They apply to the clock
+      given in that call.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   buffered type 1 spacecraft clock tables
+
+-&
+*/
+
+   #include <ctype.h>
+   #include <math.h>
+   #include <stdio.h>
+   #include <stdlib.h>
+   #include <string.h>
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZmc.h"
+
+
+   /*
+   Local parameters
+   */
+   #define  MAXCLK         8
+   #define  NVARS          10
+   #define  VARLEN         32
+   #define  MXNFLD         10
+   #define  MAXDIG         15
+   #define  AGTLEN         32
+   #define  NAMLEN         48
+
+   /*
+   Time system codes used in type 1 SCLK kernels.
+   */
+   #define  TDB            1
+   #define  TDT            2
+
+   /*
+   Round to the nearest whole number, as the f2c intrinsic d_nint.
+   */
+   #define  NINT(x)        (  ( (x) >= 0.0 ) ? floor( (x) + 0.5 )       \
+                                             : -floor( 0.5 - (x) )  )
+
+
+   /*
+   Buffered data for one clock.  The coefficient records are stored
+   as in SC01: encoded SCLK, parallel time, rate.  `pstart' and
+   `pstop' are the rounded partition bounds used by SCENCD, and
+   `prend' minus `prstrt' the unrounded partition lengths used by
+   SC01; `ptotls' holds the ticks in each partition and all preceding
+   ones.
+   */
+   typedef struct
+   {
+      SpiceInt         sc;
+      SpiceInt         stamp;
+      SpiceBoolean     stale;
+      SpiceBoolean     usable;
+      SpiceChar        agent  [AGTLEN];
+      integer          usrctr [2];
+
+      SpiceInt         nfield;
+      SpiceInt         timsys;
+      SpiceInt         nrec;
+      SpiceInt         npart;
+
+      SpiceDouble      offset [MXNFLD];
+      SpiceDouble      cmptks [MXNFLD];
+      SpiceDouble      tikmsc;
+      SpiceDouble      mxtick;
+
+      SpiceDouble    * coeffs;
+      SpiceDouble    * pstart;
+      SpiceDouble    * pstop;
+      SpiceDouble    * ptotls;
+
+      SpiceBoolean     tikord;
+      SpiceBoolean     timord;
+      SpiceInt         tikhnt;
+      SpiceInt         timhnt;
+
+   } ClockData;
+
+
+   /*
+   Static variables
+   */
+   static ClockData        clocks [MAXCLK];
+   static ClockData      * cur    = 0;
+   static SpiceInt         nclk   = 0;
+   static SpiceInt         clock  = 0;
+
+
+   static SpiceBoolean  fetch   ( ClockData        * clk );
+
+   static SpiceInt      search  ( ClockData        * clk,
+                                  SpiceInt           col,
+                                  SpiceDouble        x,
+                                  SpiceInt         * hint );
+
+
+
+
+/*
+
+-Procedure zzsc01ok_c ( Select buffered SCLK data )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   sc         I   NAIF ID code of a spacecraft clock.
+
+   The function returns SPICETRUE if buffered data for the clock are
+   available.
+
+-Detailed_Output
+
+   The function returns SPICETRUE if data for the clock `sc' have
+   been loaded by zzsc01ld_c, the kernel pool has not changed since,
+   and, for a clock whose parallel time system is TDT, the buffered
+   leapseconds data are available. The clock becomes the subject of
+   subsequent conversions.
+
+-&
+*/
+
+   SpiceBoolean zzsc01ok_c ( SpiceInt   sc )
+{
+   /*
+   Local variables
+   */
+   SpiceInt                i;
+
+   logical                 update;
+
+
+   if (  ( cur == 0 ) || ( cur->sc != sc )  )
+   {
+      cur = 0;
+
+      for ( i = 0;  i < nclk;  i++ )
+      {
+         if ( clocks[i].sc == sc )
+         {
+            cur = clocks + i;
+            break;
+         }
+      }
+
+      if ( cur == 0 )
+      {
+         return ( SPICEFALSE );
+      }
+   }
+
+   if ( cur->stale )
+   {
+      return ( SPICEFALSE );
+   }
+
+   zzcvpool_ ( ( char    * ) cur->agent,
+               ( integer * ) cur->usrctr,
+               ( logical * ) &update,
+               ( ftnlen    ) strlen(cur->agent) );
+
+   if ( update )
+   {
+      cur->stale = SPICETRUE;
+
+      return ( SPICEFALSE );
+   }
+
+   if ( !cur->usable )
+   {
+      return ( SPICEFALSE );
+   }
+
+   if ( cur->timsys == TDT )
+   {
+      return ( zzlskok_c() );
+   }
+
+   return ( SPICETRUE );
+}
+
+
+
+
+/*
+
+-Procedure zzsc01ld_c ( Load buffered SCLK data )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   sc         I   NAIF ID code of a spacecraft clock.
+
+   The function returns SPICETRUE if buffered data for the clock are
+   available.
+
+-Detailed_Output
+
+   The function returns the value zzsc01ok_c would return after the
+   data for the clock `sc' have been buffered.
+
+-Particulars
+
+   The kernel variables are read only if the clock's data are not
+   already buffered, or if the kernel pool has changed since they
+   were. If no buffer is free, the data of the least recently loaded
+   clock are discarded. A kernel pool watcher is set for the
+   variables of each buffered clock.
+
+   This routine must be called only after a SPICELIB conversion for
+   the clock `sc' has succeeded.
+
+-&
+*/
+
+   SpiceBoolean zzsc01ld_c ( SpiceInt   sc )
+{
+   /*
+   Local variables
+   */
+   static ConstSpiceChar   names [NVARS][VARLEN+1] =
+                           {
+                              "SCLK_KERNEL_ID",
+                              "SCLK_DATA_TYPE",
+                              "SCLK01_COEFFICIENTS",
+                              "SCLK_PARTITION_START",
+                              "SCLK_PARTITION_END",
+                              "SCLK01_N_FIELDS",
+                              "SCLK01_OFFSETS",
+                              "SCLK01_MODULI",
+                              "SCLK01_OUTPUT_DELIM",
+                              "SCLK01_TIME_SYSTEM"
+                           };
+
+   SpiceChar               fvars  [NVARS][VARLEN];
+   SpiceChar               name   [NAMLEN];
+
+   SpiceInt                i;
+   SpiceInt                slot;
+
+   integer                 nvars;
+   logical                 update;
+
+
+   if ( zzsc01ok_c ( sc ) )
+   {
+      return ( SPICETRUE );
+   }
+
+   if (  ( cur != 0 ) && !cur->stale  )
+   {
+      /*
+      The data are current but cannot be used.
+      */
+      return ( SPICEFALSE );
+   }
+
+   if ( cur == 0 )
+   {
+      /*
+      Take a free buffer, or the one loaded least recently.
+      */
+      if ( nclk < MAXCLK )
+      {
+         slot = nclk;
+         nclk++;
+      }
+      else
+      {
+         slot = 0;
+
+         for ( i = 1;  i < MAXCLK;  i++ )
+         {
+            if ( clocks[i].stamp < clocks[slot].stamp )
+            {
+               slot = i;
+            }
+         }
+      }
+
+      cur         = clocks + slot;
+      cur->sc     = sc;
+      cur->usable = SPICEFALSE;
+
+      /*
+      Set the watch on this clock's variables.  All but the first
+      name take the suffix _n, where n is the negative of the clock
+      ID, as in SCLU01.
+      */
+      for ( i = 0;  i < NVARS;  i++ )
+      {
+         if ( i == 0 )
+         {
+            strcpy  ( name, names[i] );
+         }
+         else
+         {
+            sprintf ( name, "%s_%ld", names[i], (long)(-sc) );
+         }
+
+         memset ( fvars[i], ' ', VARLEN );
+         memcpy ( fvars[i], name, MinVal( strlen(name), VARLEN ) );
+      }
+
+      sprintf ( cur->agent, "ZZSC01TB%ld", (long)slot );
+
+      nvars = NVARS;
+
+      swpool_ ( ( char    * ) cur->agent,
+                ( integer * ) &nvars,
+                ( char    * ) fvars,
+                ( ftnlen    ) strlen(cur->agent),
+                ( ftnlen    ) VARLEN          );
+
+      if ( failed_c() )
+      {
+         cur->sc = 0;
+         cur     = 0;
+
+         return ( SPICEFALSE );
+      }
+   }
+
+   /*
+   Synchronize the pool counter before reading the pool, so that any
+   later change is detected.
+   */
+   zzctruin_ ( cur->usrctr );
+
+   zzcvpool_ ( ( char    * ) cur->agent,
+               ( integer * ) cur->usrctr,
+               ( logical * ) &update,
+               ( ftnlen    ) strlen(cur->agent) );
+
+   clock++;
+
+   cur->stamp  = clock;
+   cur->stale  = SPICEFALSE;
+   cur->usable = fetch ( cur );
+
+   return ( zzsc01ok_c ( sc ) );
+}
+
+
+
+
+/*
+
+-Procedure zzsc01te_c ( Buffered encoded SCLK to ET )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   sclkdp     I   Encoded SCLK.
+   et         O   ET, seconds past J2000 TDB.
+
+   The function returns SPICETRUE if the conversion succeeded.
+
+-Particulars
+
+   This routine reproduces the conversion of SCTE01. It returns
+   SPICEFALSE if `sclkdp' is outside the range of the clock.
+
+-&
+*/
+
+   SpiceBoolean zzsc01te_c ( SpiceDouble     sclkdp,
+                             SpiceDouble   * et      )
+{
+   /*
+   Local variables
+   */
+   SpiceDouble             partim;
+   SpiceDouble           * rec;
+
+   SpiceInt                lower;
+
+
+   if (  ( sclkdp < cur->coeffs[0] ) || ( sclkdp > cur->mxtick )  )
+   {
+      return ( SPICEFALSE );
+   }
+
+   lower  = search ( cur, 0, sclkdp, &cur->tikhnt );
+   rec    = cur->coeffs + 3*( lower - 1 );
+
+   partim = rec[1] + ( rec[2] / cur->tikmsc ) * ( sclkdp - rec[0] );
+
+   if ( cur->timsys == TDB )
+   {
+      *et = partim;
+   }
+   else
+   {
+      *et = zztdttdb_c ( partim );
+   }
+
+   return ( SPICETRUE );
+}
+
+
+
+
+/*
+
+-Procedure zzsc01ec_c ( Buffered ET to continuous encoded SCLK )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   et         I   ET, seconds past J2000 TDB.
+   sclkdp     O   Continuous encoded SCLK.
+
+   The function returns SPICETRUE if the conversion succeeded.
+
+-Particulars
+
+   This routine reproduces the conversion of SCEC01. It returns
+   SPICEFALSE if `et' is outside the range of the clock.
+
+-&
+*/
+
+   SpiceBoolean zzsc01ec_c ( SpiceDouble     et,
+                             SpiceDouble   * sclkdp )
+{
+   /*
+   Local variables
+   */
+   SpiceDouble             partim;
+   SpiceDouble             ticks;
+   SpiceDouble           * rec;
+
+   SpiceInt                lower;
+
+
+   if ( cur->timsys == TDB )
+   {
+      partim = et;
+   }
+   else
+   {
+      partim = zztdbtdt_c ( et );
+   }
+
+   if ( partim < cur->coeffs[1] )
+   {
+      return ( SPICEFALSE );
+   }
+
+   lower = search ( cur, 1, partim, &cur->timhnt );
+   rec   = cur->coeffs + 3*( lower - 1 );
+
+   if ( rec[2] <= 0.0 )
+   {
+      return ( SPICEFALSE );
+   }
+
+   ticks = rec[0] + ( 1.0 / ( rec[2] / cur->tikmsc ) ) * ( partim - rec[1] );
+
+   if ( ticks > cur->mxtick )
+   {
+      return ( SPICEFALSE );
+   }
+
+   *sclkdp = ticks;
+
+   return ( SPICETRUE );
+}
+
+
+
+
+/*
+
+-Procedure zzsc01et_c ( Buffered ET to discrete encoded SCLK )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   et         I   ET, seconds past J2000 TDB.
+   sclkdp     O   Discrete encoded SCLK.
+
+   The function returns SPICETRUE if the conversion succeeded.
+
+-Particulars
+
+   This routine reproduces the conversion of SCET01. It returns
+   SPICEFALSE if `et' is outside the range of the clock.
+
+-&
+*/
+
+   SpiceBoolean zzsc01et_c ( SpiceDouble     et,
+                             SpiceDouble   * sclkdp )
+{
+   /*
+   Local variables
+   */
+   SpiceDouble             partim;
+   SpiceDouble             ticks;
+   SpiceDouble           * rec;
+
+   SpiceInt                lower;
+
+
+   if ( cur->timsys == TDB )
+   {
+      partim = et;
+   }
+   else
+   {
+      partim = zztdbtdt_c ( et );
+   }
+
+   /*
+   Times before the first record are extrapolated from it.
+   */
+   if ( partim < cur->coeffs[1] )
+   {
+      lower = 1;
+   }
+   else
+   {
+      lower = search ( cur, 1, partim, &cur->timhnt );
+   }
+
+   rec = cur->coeffs + 3*( lower - 1 );
+
+   if ( rec[2] <= 0.0 )
+   {
+      return ( SPICEFALSE );
+   }
+
+   ticks = rec[0] + ( 1.0 / ( rec[2] / cur->tikmsc ) ) * ( partim - rec[1] );
+   ticks = NINT ( ticks );
+
+   if (  ( ticks < cur->coeffs[0] ) || ( ticks > cur->mxtick )  )
+   {
+      return ( SPICEFALSE );
+   }
+
+   *sclkdp = ticks;
+
+   return ( SPICETRUE );
+}
+
+
+
+
+/*
+
+-Procedure zzsc01en_c ( Buffered SCLK string to encoded SCLK )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   sclkch     I   SCLK string.
+   sclkdp     O   Encoded SCLK.
+
+   The function returns SPICETRUE if the conversion succeeded.
+
+-Particulars
+
+   This routine reproduces the conversion of SCENCD for strings of
+   the plain form
+
+      [pp/]nnn{dnnn}
+
+   where pp and nnn are unsigned decimal integers of at most MAXDIG
+   digits and d is one of the field delimiters ".:-,". The string may
+   have no blanks and no more fields than the clock. It returns
+   SPICEFALSE for any other string, or if the string does not
+   represent a valid clock count.
+
+-&
+*/
+
+   SpiceBoolean zzsc01en_c ( ConstSpiceChar   * sclkch,
+                             SpiceDouble      * sclkdp  )
+{
+   /*
+   Local variables
+   */
+   ConstSpiceChar        * p;
+
+   SpiceDouble             cmpval;
+   SpiceDouble             ticks;
+   SpiceDouble             val;
+
+   SpiceInt                ndig;
+   SpiceInt                nfld;
+   SpiceInt                part;
+
+
+   p    = sclkch;
+   part = 0;
+
+   /*
+   Read the partition number, if present.
+   */
+   if ( strchr ( p, '/' ) != 0 )
+   {
+      ndig = 0;
+
+      while (  isdigit ( (unsigned char) *p )  )
+      {
+         if ( ndig == 9 )
+         {
+            return ( SPICEFALSE );
+         }
+
+         part = 10*part + ( *p - '0' );
+         ndig++;
+         p++;
+      }
+
+      if (  ( ndig == 0 ) || ( *p != '/' )  )
+      {
+         return ( SPICEFALSE );
+      }
+
+      if (  ( part < 1 ) || ( part > cur->npart )  )
+      {
+         return ( SPICEFALSE );
+      }
+
+      p++;
+   }
+
+   /*
+   Convert the fields to ticks, as SCTK01 does.
+   */
+   ticks = 0.0;
+   nfld  = 0;
+
+   for (;;)
+   {
+      val  = 0.0;
+      ndig = 0;
+
+      while (  isdigit ( (unsigned char) *p )  )
+      {
+         if ( ndig == MAXDIG )
+         {
+            return ( SPICEFALSE );
+         }
+
+         val = 10.0*val + (SpiceDouble)( *p - '0' );
+         ndig++;
+         p++;
+      }
+
+      if (  ( ndig == 0 ) || ( nfld == cur->nfield )  )
+      {
+         return ( SPICEFALSE );
+      }
+
+      cmpval = val - cur->offset[nfld];
+
+      if ( NINT ( cmpval ) < 0.0 )
+      {
+         return ( SPICEFALSE );
+      }
+
+      ticks += cmpval * cur->cmptks[nfld];
+      nfld++;
+
+      if ( *p == '\0' )
+      {
+         break;
+      }
+
+      if ( strchr ( ".:-,", *p ) == 0 )
+      {
+         return ( SPICEFALSE );
+      }
+
+      p++;
+   }
+
+   ticks = NINT ( ticks );
+
+   /*
+   Find the partition, as SCENCD does.
+   */
+   if ( part > 0 )
+   {
+      if (  ( ticks < cur->pstart[part-1] )
+         || ( ticks > cur->pstop [part-1] )  )
+      {
+         return ( SPICEFALSE );
+      }
+   }
+   else
+   {
+      part = 1;
+
+      while (     ( part <= cur->npart )
+              && (    ( ticks < cur->pstart[part-1] )
+                   || ( ticks > cur->pstop [part-1] ) )  )
+      {
+         part++;
+      }
+
+      if ( part > cur->npart )
+      {
+         return ( SPICEFALSE );
+      }
+   }
+
+   if ( part > 1 )
+   {
+      *sclkdp = ticks - cur->pstart[part-1] + cur->ptotls[part-2];
+   }
+   else
+   {
+      *sclkdp = ticks - cur->pstart[part-1];
+   }
+
+   return ( SPICETRUE );
+}
+
+
+
+
+/*
+
+   fetch: read the kernel variables of the clock `clk->sc' and derive
+   the quantities SC01 and SCENCD compute from them.  Returns
+   SPICEFALSE if the data cannot be buffered.
+
+*/
+
+   static SpiceBoolean  fetch ( ClockData   * clk )
+{
+   SpiceBoolean            found;
+
+   SpiceChar               name   [NAMLEN];
+   SpiceChar               type   [2];
+
+   SpiceDouble             d;
+   SpiceDouble             moduli [MXNFLD];
+   SpiceDouble           * prend;
+   SpiceDouble           * prstrt;
+
+   SpiceInt                i;
+   SpiceInt                ival;
+   SpiceInt                n;
+   SpiceInt                ncoeff;
+   SpiceInt                nend;
+
+
+   free ( clk->coeffs );
+   free ( clk->pstart );
+
+   clk->coeffs = 0;
+   clk->pstart = 0;
+
+   /*
+   The clock must be of type 1.
+   */
+   sprintf  ( name, "SCLK_DATA_TYPE_%ld", (long)(-clk->sc) );
+   gipool_c ( name, 0, 1, &n, &ival, &found );
+
+   if (  !found  ||  ( ival != 1 )  )
+   {
+      return ( SPICEFALSE );
+   }
+
+   sprintf  ( name, "SCLK01_N_FIELDS_%ld", (long)(-clk->sc) );
+   gipool_c ( name, 0, 1, &n, &clk->nfield, &found );
+
+   if (  !found  ||  ( clk->nfield < 1 )  ||  ( clk->nfield > MXNFLD )  )
+   {
+      return ( SPICEFALSE );
+   }
+
+   sprintf  ( name, "SCLK01_TIME_SYSTEM_%ld", (long)(-clk->sc) );
+   gipool_c ( name, 0, 1, &n, &clk->timsys, &found );
+
+   if ( !found )
+   {
+      clk->timsys = TDB;
+   }
+   else if (  ( clk->timsys != TDB ) && ( clk->timsys != TDT )  )
+   {
+      return ( SPICEFALSE );
+   }
+
+   sprintf  ( name, "SCLK01_MODULI_%ld", (long)(-clk->sc) );
+   gdpool_c ( name, 0, MXNFLD, &n, moduli, &found );
+
+   if (  !found  ||  ( n < clk->nfield )  )
+   {
+      return ( SPICEFALSE );
+   }
+
+   sprintf  ( name, "SCLK01_OFFSETS_%ld", (long)(-clk->sc) );
+   gdpool_c ( name, 0, MXNFLD, &n, clk->offset, &found );
+
+   if (  !found  ||  ( n < clk->nfield )  )
+   {
+      return ( SPICEFALSE );
+   }
+
+   /*
+   Ticks per count of each field, as in SCTK01, and ticks per most
+   significant count, as in SCTE01.
+   */
+   clk->cmptks[clk->nfield-1] = 1.0;
+
+   for ( i = clk->nfield-1;  i >= 1;  i-- )
+   {
+      clk->cmptks[i-1] = clk->cmptks[i] * moduli[i];
+   }
+
+   clk->tikmsc = 1.0;
+
+   for ( i = clk->nfield;  i >= 2;  i-- )
+   {
+      clk->tikmsc *= moduli[i-1];
+   }
+
+   /*
+   Read the coefficient records.
+   */
+   sprintf  ( name, "SCLK01_COEFFICIENTS_%ld", (long)(-clk->sc) );
+   dtpool_c ( name, &found, &ncoeff, type );
+
+   if (  !found  ||  ( type[0] != 'N' )  ||  ( ncoeff < 3 )  )
+   {
+      return ( SPICEFALSE );
+   }
+
+   clk->coeffs = (SpiceDouble *) malloc ( ncoeff * sizeof(SpiceDouble) );
+
+   if ( clk->coeffs == 0 )
+   {
+      return ( SPICEFALSE );
+   }
+
+   gdpool_c ( name, 0, ncoeff, &n, clk->coeffs, &found );
+
+   if (  !found  ||  ( n != ncoeff )  )
+   {
+      return ( SPICEFALSE );
+   }
+
+   clk->nrec = ncoeff / 3;
+
+   /*
+   SCET01 rounds the first encoded SCLK value in place, so the range
+   checks of SCTE01 and SCET01 agree only if it is whole.
+   */
+   if ( clk->coeffs[0] != NINT ( clk->coeffs[0] ) )
+   {
+      return ( SPICEFALSE );
+   }
+
+   /*
+   The record hints may be used only if the columns are strictly
+   increasing; otherwise the records are searched exactly as in SC01.
+   */
+   clk->tikord = SPICETRUE;
+   clk->timord = SPICETRUE;
+   clk->tikhnt = 1;
+   clk->timhnt = 1;
+
+   for ( i = 1;  i < clk->nrec;  i++ )
+   {
+      if ( clk->coeffs[3*i] <= clk->coeffs[3*i-3] )
+      {
+         clk->tikord = SPICEFALSE;
+      }
+
+      if ( clk->coeffs[3*i+1] <= clk->coeffs[3*i-2] )
+      {
+         clk->timord = SPICEFALSE;
+      }
+   }
+
+   /*
+   Read the partitions.  One buffer holds the raw start and end
+   values followed by the rounded bounds and the running totals.
+   */
+   sprintf  ( name, "SCLK_PARTITION_START_%ld", (long)(-clk->sc) );
+   dtpool_c ( name, &found, &n, type );
+
+   if (  !found  ||  ( type[0] != 'N' )  ||  ( n < 1 )  )
+   {
+      return ( SPICEFALSE );
+   }
+
+   clk->npart  = n;
+   clk->pstart = (SpiceDouble *) malloc ( 5 * n * sizeof(SpiceDouble) );
+
+   if ( clk->pstart == 0 )
+   {
+      return ( SPICEFALSE );
+   }
+
+   prstrt      = clk->pstart + 2*n;
+   prend       = clk->pstart + 3*n;
+   clk->pstop  = clk->pstart +   n;
+   clk->ptotls = clk->pstart + 4*n;
+
+   gdpool_c ( name, 0, clk->npart, &n, prstrt, &found );
+
+   sprintf  ( name, "SCLK_PARTITION_END_%ld", (long)(-clk->sc) );
+   dtpool_c ( name, &found, &nend, type );
+
+   if (  !found  ||  ( type[0] != 'N' )  ||  ( nend != clk->npart )  )
+   {
+      return ( SPICEFALSE );
+   }
+
+   gdpool_c ( name, 0, clk->npart, &nend, prend, &found );
+
+   /*
+   The last encoded SCLK value of the clock, as in SCTE01.
+   */
+   clk->mxtick = 0.0;
+
+   for ( i = 0;  i < clk->npart;  i++ )
+   {
+      d           = prend[i] - prstrt[i] + clk->mxtick;
+      clk->mxtick = NINT ( d );
+   }
+
+   /*
+   The rounded partition bounds and running totals, as in SCENCD.
+   */
+   for ( i = 0;  i < clk->npart;  i++ )
+   {
+      clk->pstart[i] = NINT ( prstrt[i] );
+      clk->pstop [i] = NINT ( prend [i] );
+   }
+
+   d              = clk->pstop[0] - clk->pstart[0];
+   clk->ptotls[0] = NINT ( d );
+
+   for ( i = 1;  i < clk->npart;  i++ )
+   {
+      d              = clk->ptotls[i-1] + clk->pstop[i] - clk->pstart[i];
+      clk->ptotls[i] = NINT ( d );
+   }
+
+   return ( !failed_c() );
+}
+
+
+
+
+/*
+
+   search: return the one-based index of the coefficient record SC01
+   would use for the value `x' of column `col' (0 for encoded SCLK,
+   1 for parallel time).  The caller has checked that `x' is not less
+   than the first value of the column.
+
+*/
+
+   static SpiceInt  search ( ClockData     * clk,
+                             SpiceInt        col,
+                             SpiceDouble     x,
+                             SpiceInt      * hint )
+{
+   SpiceDouble           * c;
+
+   SpiceInt                lower;
+   SpiceInt                middle;
+   SpiceInt                nrec;
+   SpiceInt                upper;
+
+
+   c    = clk->coeffs + col;
+   nrec = clk->nrec;
+
+   if (  !( x < c[ 3*(nrec-1) ] )  )
+   {
+      return ( nrec );
+   }
+
+   /*
+   Try the record used last time, then its successor.
+   */
+   if (  ( col == 0 ) ? clk->tikord : clk->timord  )
+   {
+      lower = *hint;
+
+      if (  ( lower < nrec ) && ( c[3*(lower-1)] <= x ) && ( x < c[3*lower] )  )
+      {
+         return ( lower );
+      }
+
+      lower++;
+
+      if (     ( lower < nrec )
+            && ( c[3*(lower-1)] <= x ) && ( x < c[3*lower] )  )
+      {
+         *hint = lower;
+
+         return ( lower );
+      }
+   }
+
+   /*
+   Bisect as SC01 does, keeping
+
+      c( lower )  <=  x  <  c( upper )
+   */
+   lower = 1;
+   upper = nrec;
+
+   while ( lower < upper - 1 )
+   {
+      middle = ( lower + upper ) / 2;
+
+      if ( x < c[ 3*(middle-1) ] )
+      {
+         upper = middle;
+      }
+      else
+      {
+         lower = middle;
+      }
+   }
+
+   *hint = lower;
+
+   return ( lower );
+}
@@ -0,0 +1,747 @@
+/*
+
+-Procedure zzsfxbat ( Batch ray-surface intercept, umbrella )
+
+-Abstract
+
+   SPICE Private routine intended solely for the support of SPICE
+   routines.  Users should not call this routine directly due
+   to the volatile nature of this routine.
+
+   Hold the ray and output arrays of a batch surface intercept
+   computation, and compute the intercepts of all of the rays using
+   observer, target and frame quantities found once for the batch.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   DSK
+
+-Keywords
+
+   GEOMETRY
+   INTERCEPT
+   PRIVATE
+
+-Brief_I/O
+
+   VARIABLE  I/O  ENTRY POINTS
+   --------  ---  --------------------------------------------------
+   n         I-O  zzsfxbst_, zzsfxbnr_
+   dvecs      I   zzsfxbst_
+   spoint,
+   trgepc,
+   srfvec,
+   found      I   zzsfxbst_
+   udnear,
+   udmaxr,
+   udrayx,
+   trgcde,
+   et,
+   abcorr,
+   uselt,
+   usecn,
+   usestl,
+   xmit,
+   fixref,
+   obscde,
+   dfrcde,
+   dclass,
+   dcentr     I   zzsfxbrn_
+
+-Detailed_Input
+
+   See the individual routines.
+
+-Detailed_Output
+
+   See the individual routines.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1) If any ray direction of the batch is the zero vector, the
+      error SPICE(ZEROVECTOR) is signaled by zzsfxbrn_.
+
+   2) If the observer-target distance is zero, the error
+      SPICE(NOSEPARATION) is signaled by zzsfxbrn_.
+
+   3) Errors in ephemeris, frame or surface computations are
+      diagnosed by routines in the call tree of zzsfxbrn_.
+
+-Files
+
+   None.
+
+-Particulars
+
+   ZZSFXCOR computes, for each ray, the observer-target position and
+   light time, the transformation from the ray's frame to J2000, the
+   transformation from J2000 to the target body-fixed frame and the
+   observer's barycentric state, before it computes the intercept.
+   For rays sharing an epoch, observer, target and frames, those
+   quantities are the same for every ray.
+
+   sincpv_c stores its ray and output arrays here with zzsfxbst_,
+   then calls SINCPT.  SINCPT performs its usual name, frame and
+   surface setup once and, finding a batch present, calls zzsfxbrn_
+   in place of ZZSFXCOR.  zzsfxbrn_ finds the shared quantities once
+   and then carries out, for each ray, the computations ZZSFXCOR
+   carries out after finding them.  The results for each ray are
+   those ZZSFXCOR would produce for that ray.
+
+   Light time iterations for the intercept of each ray depend on the
+   ray and are performed per ray.
+
+      zzsfxbst_      Set or clear the batch.
+      zzsfxbnr_      Return the number of rays in the batch.
+      zzsfxbrn_      Compute the intercepts of the rays of the batch.
+
+-Examples
+
+   See sincpv_c.
+
+-Restrictions
+
+   1) The caller of zzsfxbst_ must clear the batch before returning.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   batch ray-surface intercept core algorithm
+
+-&
+*/
+
+   #include <string.h>
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+
+
+   /*
+   Static variables
+   */
+   static integer          svn    = 0;
+
+   static doublereal     * svdvec = 0;
+   static doublereal     * svpnt  = 0;
+   static doublereal     * svepc  = 0;
+   static doublereal     * svsrfv = 0;
+   static logical        * svfnd  = 0;
+
+
+
+/*
+
+-Procedure zzsfxbst_ ( Set ray batch )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   n          I   Number of rays; zero clears the batch.
+   dvecs      I   Ray direction vectors.
+   spoint     I   Array to receive surface intercept points.
+   trgepc     I   Array to receive intercept epochs.
+   srfvec     I   Array to receive observer-to-intercept vectors.
+   found      I   Array to receive found flags.
+
+-Detailed_Input
+
+   n           is the number of rays of the batch.  When `n' is zero
+               the batch is cleared and the array arguments are not
+               referenced.
+
+   dvecs       is an array of `n' ray direction vectors, expressed in
+               the frame DREF passed to SINCPT.
+
+   spoint,
+   trgepc,
+   srfvec,
+   found       are arrays of `n' elements that receive, element by
+               element, the outputs SINCPT would produce for the
+               corresponding ray.
+
+-&
+*/
+
+   int zzsfxbst_ ( integer      * n,
+                   doublereal   * dvecs,
+                   doublereal   * spoint,
+                   doublereal   * trgepc,
+                   doublereal   * srfvec,
+                   logical      * found  )
+{
+   if ( *n > 0 )
+   {
+      svn    = *n;
+      svdvec = dvecs;
+      svpnt  = spoint;
+      svepc  = trgepc;
+      svsrfv = srfvec;
+      svfnd  = found;
+   }
+   else
+   {
+      svn    = 0;
+      svdvec = 0;
+      svpnt  = 0;
+      svepc  = 0;
+      svsrfv = 0;
+      svfnd  = 0;
+   }
+
+   return 0;
+}
+
+
+
+/*
+
+-Procedure zzsfxbnr_ ( Number of rays in batch )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   n          O   Number of rays in the batch, or zero.
+
+-&
+*/
+
+   int zzsfxbnr_ ( integer   * n )
+{
+   *n = svn;
+
+   return 0;
+}
+
+
+
+/*
+
+-Procedure zzsfxbrn_ ( Compute intercepts of ray batch )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   udnear     I   Routine computing ray-surface near point.
+   udmaxr     I   Routine returning maximum surface radius.
+   udrayx     I   Routine computing ray-surface intercept.
+   trgcde     I   Target ID code.
+   et         I   Observation epoch.
+   abcorr     I   Aberration correction flag.
+   uselt      I   Flag indicating light time correction.
+   usecn      I   Flag indicating converged light time correction.
+   usestl     I   Flag indicating stellar aberration correction.
+   xmit       I   Flag indicating transmission correction.
+   fixref     I   Name of target body-fixed frame.
+   obscde     I   Observer ID code.
+   dfrcde     I   ID code of the frame of the ray directions.
+   dclass     I   Class of the frame of the ray directions.
+   dcentr     I   Center of the frame of the ray directions.
+
+-Detailed_Input
+
+   The inputs have the meanings given in the header of ZZSFXCOR.
+   The ray directions are those of the current batch.
+
+-Detailed_Output
+
+   None.  The outputs for each ray are stored in the arrays of the
+   current batch.
+
+-&
+*/
+
+   int zzsfxbrn_ ( S_fp           udnear,
+                   S_fp           udmaxr,
+                   S_fp           udrayx,
+                   integer      * trgcde,
+                   doublereal   * et,
+                   char         * abcorr,
+                   logical      * uselt,
+                   logical      * usecn,
+                   logical      * usestl,
+                   logical      * xmit,
+                   char         * fixref,
+                   integer      * obscde,
+                   integer      * dfrcde,
+                   integer      * dclass,
+                   integer      * dcentr,
+                   ftnlen         abcorr_len,
+                   ftnlen         fixref_len )
+{
+   /*
+   Local parameters
+   */
+   #define MARGIN          1.01
+   #define CNVLIM          1.e-17
+
+   /*
+   Local variables
+   */
+   char                    loccor [5];
+
+   doublereal              d;
+   doublereal              dist;
+   doublereal              epc0;
+   doublereal              etdiff;
+   doublereal              j2dir  [3];
+   doublereal              j2est  [3];
+   doublereal              j2geom [3];
+   doublereal              j2pos  [3];
+   doublereal              j2tmat [3][3];
+   doublereal              lt;
+   doublereal              lt0;
+   doublereal              ltcent;
+   doublereal              ltdiff;
+   doublereal              maxrad;
+   doublereal              neg0   [3];
+   doublereal              obspos [3];
+   doublereal              obs0   [3];
+   doublereal              pnear  [3];
+   doublereal              prevet;
+   doublereal              prevlt;
+   doublereal              r2jmat [3][3];
+   doublereal              range;
+   doublereal              rayalt;
+   doublereal              refepc;
+   doublereal              reject;
+   doublereal              relerr;
+   doublereal              rpos   [3];
+   doublereal              s;
+   doublereal              srflen;
+   doublereal              ssbost [6];
+   doublereal              ssbtst [6];
+   doublereal              stldir [3];
+   doublereal              stlerr [3];
+   doublereal              stltmp [3];
+   doublereal              tol;
+   doublereal              tpos   [3];
+   doublereal              trgdir [3];
+   doublereal              udir   [3];
+   doublereal              xform  [3][3];
+
+   doublereal            * dvec;
+   doublereal            * spoint;
+   doublereal            * srfvec;
+   doublereal            * trgepc;
+
+   integer                 i;
+   integer                 j;
+   integer                 nitr;
+
+   logical               * found;
+   logical                 quick;
+
+   integer                 j2code = 1;
+
+
+   if ( return_c() )
+   {
+      return 0;
+   }
+   chkin_c ( "zzsfxbrn_" );
+
+   for ( i = 0;  i < svn;  i++ )
+   {
+      svfnd[i] = 0;
+
+      if (  vzero_( svdvec + 3*i )  )
+      {
+         setmsg_c ( "Ray direction at index # was the zero vector; "
+                    "this vector must be non-zero."                  );
+         errint_c ( "#",  (SpiceInt)i                                );
+         sigerr_c ( "SPICE(ZEROVECTOR)"                              );
+         chkout_c ( "zzsfxbrn_"                                      );
+         return 0;
+      }
+   }
+
+   /*
+   Get the sign S prefixing LT in the expression for TRGEPC, and the
+   aberration correction without stellar aberration, as ZZSFXCOR
+   does.
+   */
+   if ( *uselt )
+   {
+      s = ( *xmit ) ? 1.0 : -1.0;
+
+      memcpy ( loccor, ( *xmit ) ? "X    " : "     ", 5 );
+      memcpy ( loccor + ( *xmit ? 1 : 0 ), ( *usecn ) ? "CN" : "LT", 2 );
+   }
+   else
+   {
+      s = 0.0;
+
+      memcpy ( loccor, "NONE ", 5 );
+   }
+
+   /*
+   Find the quantities that do not depend on the ray: the observer's
+   position relative to the target in the target body-fixed frame,
+   the corresponding target epoch, the transformations from DREF to
+   J2000 and from J2000 to the body-fixed frame, and the observer's
+   state relative to the solar system barycenter.
+   */
+   spkezp_ ( trgcde, et, fixref, loccor, obscde, tpos, &lt0,
+             fixref_len, (ftnlen)5 );
+
+   if ( failed_c() )
+   {
+      chkout_c ( "zzsfxbrn_" );
+      return 0;
+   }
+
+   vminus_ ( tpos, obs0 );
+
+   epc0 = *et + s * lt0;
+
+   if (  ( *dclass == 1 ) || !( *uselt ) || ( *dcentr == *obscde )  )
+   {
+      refepc = *et;
+   }
+   else
+   {
+      spkezp_ ( dcentr, et, "J2000", abcorr, obscde, rpos, &ltcent,
+                (ftnlen)5, abcorr_len );
+
+      if ( failed_c() )
+      {
+         chkout_c ( "zzsfxbrn_" );
+         return 0;
+      }
+
+      refepc = *et + s * ltcent;
+   }
+
+   refchg_ ( dfrcde, &j2code, &refepc, (doublereal *)r2jmat );
+
+   if ( failed_c() )
+   {
+      chkout_c ( "zzsfxbrn_" );
+      return 0;
+   }
+
+   pxform_ ( "J2000", fixref, &epc0, (doublereal *)j2tmat,
+             (ftnlen)5, fixref_len );
+
+   if ( failed_c() )
+   {
+      chkout_c ( "zzsfxbrn_" );
+      return 0;
+   }
+
+   spkssb_ ( obscde, et, "J2000", ssbost, (ftnlen)5 );
+
+   if ( failed_c() )
+   {
+      chkout_c ( "zzsfxbrn_" );
+      return 0;
+   }
+
+   /*
+   Set up the quick rejection test.
+   */
+   (*udmaxr) ( &maxrad );
+
+   range = vnorm_ ( obs0 );
+
+   if ( range == 0.0 )
+   {
+      setmsg_c ( "Observer-target distance is zero. Observer ID is #; "
+                 "target ID is #."                                     );
+      errint_c ( "#",  (SpiceInt)(*obscde)                             );
+      errint_c ( "#",  (SpiceInt)(*trgcde)                             );
+      sigerr_c ( "SPICE(NOSEPARATION)"                                 );
+      chkout_c ( "zzsfxbrn_"                                           );
+      return 0;
+   }
+
+   quick  = ( range > maxrad * MARGIN );
+   reject = 0.0;
+
+   if ( quick )
+   {
+      d      = maxrad * MARGIN / range;
+      tol    = 1.e-14;
+      reject = dasine_ ( &d, &tol );
+
+      vminus_ ( obs0, neg0 );
+   }
+
+   /*
+   Process the rays.  The code below follows ZZSFXCOR from the point
+   at which the shared quantities have been found.
+   */
+   for ( i = 0;  i < svn;  i++ )
+   {
+      dvec    = svdvec + 3*i;
+      spoint  = svpnt  + 3*i;
+      srfvec  = svsrfv + 3*i;
+      trgepc  = svepc  + i;
+      found   = svfnd  + i;
+
+      *trgepc = epc0;
+      lt      = lt0;
+
+      vequ_ ( obs0, obspos );
+
+      mxv_  ( (doublereal *)r2jmat, dvec, j2dir );
+      vequ_ ( j2dir, j2geom );
+      mxv_  ( (doublereal *)j2tmat, j2dir, trgdir );
+
+      if ( *usestl )
+      {
+         /*
+         Apply the inverse of the stellar aberration correction to
+         the ray.
+         */
+         nitr = 5;
+
+         if ( *xmit )
+         {
+            stelab_ ( j2dir, ssbost+3, stldir );
+         }
+         else
+         {
+            stlabx_ ( j2dir, ssbost+3, stldir );
+         }
+
+         relerr = 1.0;
+         j      = 1;
+
+         while (  ( j <= nitr )  &&  ( relerr > CNVLIM )  )
+         {
+            if ( *xmit )
+            {
+               stlabx_ ( stldir, ssbost+3, j2est );
+            }
+            else
+            {
+               stelab_ ( stldir, ssbost+3, j2est );
+            }
+
+            vsub_ ( j2dir,  j2est,  stlerr );
+            vadd_ ( stlerr, stldir, stltmp );
+            vequ_ ( stltmp, stldir );
+
+            relerr = vnorm_(stlerr) / vnorm_(stldir);
+            ++j;
+         }
+
+         vequ_ ( stldir, j2dir );
+         mxv_  ( (doublereal *)j2tmat, j2dir, trgdir );
+      }
+
+      if ( quick )
+      {
+         if (  vsep_( neg0, trgdir ) > reject  )
+         {
+            continue;
+         }
+      }
+
+      (*udrayx) ( obspos, trgdir, trgepc, spoint, found );
+
+      if ( failed_c() )
+      {
+         chkout_c ( "zzsfxbrn_" );
+         return 0;
+      }
+
+      if (  *found  &&  !( *uselt )  )
+      {
+         vsub_ ( spoint, obspos, srfvec );
+         continue;
+      }
+
+      if ( !( *found ) )
+      {
+         /*
+         Improve the light time estimate using the near point of the
+         ray before giving up.
+         */
+         nitr = ( *usecn ) ? 3 : 1;
+         j    = 1;
+
+         while (  ( j <= nitr )  &&  !( *found )  )
+         {
+            (*udnear) ( obspos, trgdir, et, pnear, &rayalt );
+
+            if ( failed_c() )
+            {
+               chkout_c ( "zzsfxbrn_" );
+               return 0;
+            }
+
+            lt      = vdist_(obspos, pnear) / clight_();
+            *trgepc = *et + s * lt;
+
+            spkssb_ ( trgcde, trgepc, "J2000", ssbtst, (ftnlen)5 );
+
+            if ( failed_c() )
+            {
+               chkout_c ( "zzsfxbrn_" );
+               return 0;
+            }
+
+            vsub_   ( ssbost, ssbtst, j2pos );
+            pxform_ ( "J2000", fixref, trgepc, (doublereal *)xform,
+                      (ftnlen)5, fixref_len );
+
+            if ( failed_c() )
+            {
+               chkout_c ( "zzsfxbrn_" );
+               return 0;
+            }
+
+            mxv_ ( (doublereal *)xform, j2pos, obspos );
+            mxv_ ( (doublereal *)xform, j2dir, trgdir );
+
+            (*udrayx) ( obspos, trgdir, trgepc, spoint, found );
+
+            if ( failed_c() )
+            {
+               chkout_c ( "zzsfxbrn_" );
+               return 0;
+            }
+
+            ++j;
+         }
+
+         if ( !( *found ) )
+         {
+            continue;
+         }
+      }
+
+      /*
+      Iterate the light time to the intercept point.
+      */
+      nitr = ( *usecn ) ? 10 : 1;
+
+      dist    = vdist_ ( obspos, spoint );
+      lt      = dist / clight_();
+      *trgepc = *et + s * lt;
+      prevlt  = 0.0;
+      prevet  = *trgepc;
+      j       = 0;
+      ltdiff  = 1.0;
+      etdiff  = 1.0;
+
+      while (     ( j < nitr )
+              &&  ( ltdiff > ( (lt < 0.0) ? -lt : lt ) * CNVLIM )
+              &&  ( etdiff > 0.0 )                                 )
+      {
+         spkssb_ ( trgcde, trgepc, "J2000", ssbtst, (ftnlen)5 );
+
+         if ( failed_c() )
+         {
+            chkout_c ( "zzsfxbrn_" );
+            return 0;
+         }
+
+         vsub_   ( ssbost, ssbtst, j2pos );
+         pxform_ ( "J2000", fixref, trgepc, (doublereal *)xform,
+                   (ftnlen)5, fixref_len );
+
+         if ( failed_c() )
+         {
+            chkout_c ( "zzsfxbrn_" );
+            return 0;
+         }
+
+         mxv_    ( (doublereal *)xform, j2pos, obspos );
+         mxv_    ( (doublereal *)xform, j2dir, trgdir );
+
+         (*udrayx) ( obspos, trgdir, trgepc, spoint, found );
+
+         if ( failed_c() )
+         {
+            chkout_c ( "zzsfxbrn_" );
+            return 0;
+         }
+
+         if ( !( *found ) )
+         {
+            break;
+         }
+
+         dist    = vdist_ ( obspos, spoint );
+         lt      = dist / clight_();
+         *trgepc = *et + s * lt;
+
+         d      = lt - prevlt;
+         ltdiff = touchd_ ( &d );
+         ltdiff = ( ltdiff < 0.0 ) ? -ltdiff : ltdiff;
+
+         d      = *trgepc - prevet;
+         etdiff = touchd_ ( &d );
+         etdiff = ( etdiff < 0.0 ) ? -etdiff : etdiff;
+
+         prevlt = lt;
+         prevet = *trgepc;
+         ++j;
+      }
+
+      if ( !( *found ) )
+      {
+         continue;
+      }
+
+      /*
+      Derive SRFVEC from the geometric ray direction, as ZZSFXCOR
+      does.
+      */
+      mxv_    ( (doublereal *)xform, j2geom, udir );
+      vhatip_ ( udir );
+
+      srflen = vdist_ ( spoint, obspos );
+
+      vscl_ ( &srflen, udir, srfvec );
+   }
+
+   chkout_c ( "zzsfxbrn_" );
+   return 0;
+}
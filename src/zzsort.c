@@ -0,0 +1,736 @@
+/*
+
+-Procedure zzsort ( Sort arrays and order vectors )
+
+-Abstract
+
+   SPICE Private routine intended solely for the support of SPICE
+   routines.  Users should not call this routine directly due
+   to the volatile nature of this routine.
+
+   Sort double precision, integer and character arrays and arrays of
+   intervals in place, or find the order vectors of arrays, in
+   O(n log n) time.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   None.
+
+-Keywords
+
+   ARRAY
+   PRIVATE
+   SORT
+
+-Brief_I/O
+
+   VARIABLE  I/O  ENTRY POINTS
+   --------  ---  --------------------------------------------------
+   ndim       I   zzsortd, zzsorti, zzsortc, zzordd, zzordi, zzordc
+   npair      I   zzsortp
+   array     I/O  zzsortd, zzsorti, zzsortc
+   pairs     I/O  zzsortp
+   array      I   zzordd, zzordi, zzordc
+   done       O   zzsortc
+   iorder     O   zzordd, zzordi, zzordc
+   RADMIN     P   zzsorti, zzordi
+   INSMAX     P   All
+
+-Detailed_Input
+
+   ndim        is the number of elements of `array'.  If `ndim' is
+               less than 2 the sorting entry points return without
+               changing `array'; if it is less than 1 the order
+               vector entry points return without changing `iorder'.
+
+   array       is a double precision, integer or character array.
+               The sorting entry points sort it in place.
+
+   npair       is the number of intervals in `pairs'.
+
+   pairs       is an array of `npair' intervals, each given by its
+               left and right endpoints.
+
+-Detailed_Output
+
+   array       on output from zzsortd, zzsorti and zzsortc, contains
+               the same elements as on input, in increasing order.
+               Character elements are compared as by the Fortran
+               relational operators, that is, by the ASCII order of
+               their characters.
+
+   pairs       on output from zzsortp, contains the same intervals
+               as on input, in increasing order of their left
+               endpoints.  Intervals with the same left endpoint are
+               in increasing order of their right endpoints.
+
+   done        is returned .TRUE. by zzsortc if `array' was sorted,
+               and .FALSE. if workspace for the sort could not be
+               allocated.  In the latter case `array' is unchanged.
+
+   iorder      on output from zzordd, zzordi and zzordc, is the order
+               vector of `array': iorder(1) is the index of the
+               smallest element of `array', iorder(2) the index of
+               the next smallest, and so on.  The order is stable:
+               the indices of equal elements appear in increasing
+               order.
+
+-Parameters
+
+   RADMIN      is the smallest array for which the integer entry
+               points use a radix sort.
+
+   INSMAX      is the largest partition finished by insertion sort.
+
+-Exceptions
+
+   Error free.
+
+-Files
+
+   None.
+
+-Particulars
+
+   These entry points perform the sorts of SHELLD, SHELLI, SHELLC,
+   ORDERD, ORDERI and ORDERC, and the sort of intervals of WNVALD.
+
+   zzsortd, zzsortp and zzsortc sort by introsort: quicksort with a
+   median-of-three pivot, switching to heapsort if the recursion
+   depth exceeds twice the base 2 logarithm of the array size, and
+   finishing small partitions by insertion sort.  The time is O(n
+   log n) for any input, where the Shell sort the SHELL routines
+   used had O(n**2) worst cases.
+
+   zzsorti and zzordi sort arrays of RADMIN or more elements by a
+   least significant digit radix sort on 8-bit digits, which takes
+   time linear in the array size.  Digits that are the same for all
+   elements, such as the high bytes of small integers, are skipped.
+   The radix sort needs workspace the size of the array (three times
+   the size, for zzordi); when it cannot be allocated, or for
+   smaller arrays, introsort is used.
+
+   The order vector entry points sort the order vector by comparing
+   the elements it indexes, taking the lesser index first when the
+   elements are equal, so that the order vector is stable.  The radix
+   sort of zzordi is itself stable.
+
+   zzsortc sorts an order vector of the character array, then moves
+   the elements into place, so that each element is copied about
+   once rather than once per exchange.
+
+-Examples
+
+   See SHELLD, SHELLI, SHELLC, ORDERD, ORDERI, ORDERC and WNVALD.
+
+-Restrictions
+
+   1)  A double precision array containing NaNs is not sorted in any
+       meaningful order, as with the routines this routine supports.
+
+-Literature_References
+
+   [1]  Musser, D. R. 1997. "Introspective Sorting and Selection
+        Algorithms." Software: Practice and Experience 27(8).
+
+   [2]  Knuth, D. E. 1998. The Art of Computer Programming, Vol. 3,
+        Sorting and Searching, 2nd ed. Addison-Wesley.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 19-OCT-2026 (NZL)
+
+-Index_Entries
+
+   sort arrays and order vectors
+
+-&
+*/
+
+   #include <limits.h>
+   #include <stdlib.h>
+   #include <string.h>
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+
+
+   /*
+   Local parameters
+   */
+   #define INSMAX          16
+   #define NBKT            256
+   #define NBYTE           ( (int) sizeof(integer) )
+   #define RADMIN          4096
+
+
+   /*
+   Comparison of order vector entries: the elements they index, then
+   the indices themselves.
+   */
+   #define ORDLT( x, y, a )                                           \
+                                                                     \
+      (     ( (a)[(x)-1] <  (a)[(y)-1] )                             \
+        || (    ( (a)[(x)-1] == (a)[(y)-1] ) && ( (x) < (y) ) )  )
+
+   #define VALLT( x, y, a )    ( (x) < (y) )
+
+
+   /*
+   Interval, and comparison of intervals: the left endpoints, then
+   the right.
+   */
+   typedef struct
+   {
+      doublereal       ends [2];
+
+   } Interval;
+
+   #define INTLT( x, y, a )                                            \
+                                                                       \
+      (     ( (x).ends[0] <  (y).ends[0] )                             \
+        || (    ( (x).ends[0] == (y).ends[0] )                         \
+             && ( (x).ends[1] <  (y).ends[1] ) )  )
+
+
+   /*
+   INTROSORT defines an introsort of an array of type TYPE, named
+   NAME, with the comparison LT( x, y, key ).  `key' is passed
+   through to the comparison; the order vector sorts use it for the
+   array being ordered.
+   */
+   #define INTROSORT( NAME, TYPE, KTYPE, LT )                          \
+                                                                       \
+   static void NAME##sift ( TYPE * a, integer root, integer n,          \
+                            KTYPE key )                                 \
+   {                                                                   \
+      TYPE       v;                                                    \
+      integer    c;                                                    \
+                                                                       \
+      v = a[root];                                                     \
+                                                                       \
+      while ( ( c = 2*root + 1 ) < n )                                 \
+      {                                                                \
+         if (  ( c+1 < n )  &&  LT( a[c], a[c+1], key )  )             \
+         {                                                             \
+            c++;                                                       \
+         }                                                             \
+                                                                       \
+         if ( !LT( v, a[c], key ) )                                    \
+         {                                                             \
+            break;                                                     \
+         }                                                             \
+                                                                       \
+         a[root] = a[c];                                               \
+         root    = c;                                                  \
+      }                                                                \
+                                                                       \
+      a[root] = v;                                                     \
+   }                                                                   \
+                                                                       \
+   static void NAME ( TYPE * a, integer n, integer depth, KTYPE key )   \
+   {                                                                   \
+      TYPE       p;                                                    \
+      TYPE       v;                                                    \
+      integer    i;                                                    \
+      integer    j;                                                    \
+      integer    m;                                                    \
+                                                                       \
+      while ( n > INSMAX )                                             \
+      {                                                                \
+         if ( depth == 0 )                                             \
+         {                                                             \
+            for ( i = n/2 - 1;  i >= 0;  i-- )                         \
+            {                                                          \
+               NAME##sift ( a, i, n, key );                            \
+            }                                                          \
+                                                                       \
+            for ( i = n-1;  i > 0;  i-- )                              \
+            {                                                          \
+               v = a[0];  a[0] = a[i];  a[i] = v;                      \
+               NAME##sift ( a, 0, i, key );                            \
+            }                                                          \
+                                                                       \
+            return;                                                    \
+         }                                                             \
+                                                                       \
+         depth--;                                                      \
+                                                                       \
+         /*                                                            \
+         Order the first, middle and last elements, and partition     \
+         about the middle one.                                         \
+         */                                                            \
+         m = n / 2;                                                    \
+                                                                       \
+         if ( LT( a[m],   a[0], key ) ) { v=a[0]; a[0]=a[m];   a[m]=v;   } \
+         if ( LT( a[n-1], a[0], key ) ) { v=a[0]; a[0]=a[n-1]; a[n-1]=v; } \
+         if ( LT( a[n-1], a[m], key ) ) { v=a[m]; a[m]=a[n-1]; a[n-1]=v; } \
+                                                                       \
+         p = a[m];                                                     \
+         i = 0;                                                        \
+         j = n - 1;                                                    \
+                                                                       \
+         for (;;)                                                      \
+         {                                                             \
+            do { i++; } while ( ( i < n-1 ) && LT( a[i], p, key ) );    \
+            do { j--; } while ( ( j > 0   ) && LT( p, a[j], key ) );    \
+                                                                       \
+            if ( i >= j )                                              \
+            {                                                          \
+               break;                                                  \
+            }                                                          \
+                                                                       \
+            v = a[i];  a[i] = a[j];  a[j] = v;                         \
+         }                                                             \
+                                                                       \
+         /*                                                            \
+         A(0:J) and A(J+1:N-1) are both nonempty.  Recurse on the     \
+         smaller part, so the stack depth is O(log n), and continue   \
+         with the larger.                                              \
+         */                                                            \
+         if ( j+1 < n-j-1 )                                            \
+         {                                                             \
+            NAME ( a, j+1, depth, key );                               \
+            a += j + 1;                                                \
+            n -= j + 1;                                                \
+         }                                                             \
+         else                                                          \
+         {                                                             \
+            NAME ( a+j+1, n-j-1, depth, key );                         \
+            n  = j + 1;                                                \
+         }                                                             \
+      }                                                                \
+                                                                       \
+      for ( i = 1;  i < n;  i++ )                                      \
+      {                                                                \
+         v = a[i];                                                     \
+                                                                       \
+         for ( j = i;  ( j > 0 ) && LT( v, a[j-1], key );  j-- )       \
+         {                                                             \
+            a[j] = a[j-1];                                             \
+         }                                                             \
+                                                                       \
+         a[j] = v;                                                     \
+      }                                                                \
+   }
+
+
+   /*
+   Comparison of character order vector entries.  The elements all
+   have the same length, so the Fortran comparison is that of
+   memcmp, which compares characters as unsigned.
+   */
+   typedef struct
+   {
+      char           * array;
+      ftnlen           len;
+
+   } CharKey;
+
+   #define CHRLT( x, y, k )                                            \
+                                                                       \
+      ( chrcmp( (x), (y), (k) ) < 0 )
+
+   static int chrcmp ( integer x, integer y, CharKey * k )
+   {
+      int     c;
+
+      c = memcmp ( k->array + (size_t)(x-1) * (size_t)(k->len),
+                   k->array + (size_t)(y-1) * (size_t)(k->len),
+                   (size_t)(k->len)                            );
+
+      if ( c == 0 )
+      {
+         c = ( x < y ) ? -1 : ( x > y );
+      }
+
+      return c;
+   }
+
+
+   INTROSORT ( sortd, doublereal, void *,       VALLT )
+   INTROSORT ( sorti, integer,    void *,       VALLT )
+   INTROSORT ( sortp, Interval,   void *,       INTLT )
+   INTROSORT ( ordd,  integer,    doublereal *, ORDLT )
+   INTROSORT ( ordi,  integer,    integer *,    ORDLT )
+   INTROSORT ( ordc,  integer,    CharKey *,    CHRLT )
+
+
+   /*
+   Return the introsort depth limit for `n' elements.
+   */
+   static integer depthlim ( integer n )
+   {
+      integer    d;
+
+      for ( d = 0;  n > 1;  n /= 2 )
+      {
+         d += 2;
+      }
+
+      return d;
+   }
+
+
+   /*
+   Radix key of an integer: its bits, with the sign bit inverted so
+   that unsigned order is signed order.  Only the low NBYTE bytes of
+   the key are used.
+   */
+   typedef unsigned long   RadKey;
+
+   #define RADKEY( x )                                                 \
+                                                                       \
+      ( (RadKey)(x) ^ ( (RadKey)1 << ( NBYTE*CHAR_BIT - 1 ) ) )
+
+
+   /*
+   Sort the integer array `a' by radix sort, carrying the order
+   vector `idx' along if it is not null.  `ta' and `tidx' are
+   workspace of the same sizes.  Return the array holding the result;
+   the order vector is then in the corresponding index array.
+   */
+   static integer * radixi ( integer   * a,
+                             integer   * idx,
+                             integer     n,
+                             integer   * ta,
+                             integer   * tidx,
+                             integer  ** ridx )
+   {
+      integer         count  [ sizeof(integer) ][ NBKT ];
+      integer       * t;
+      integer         b;
+      integer         i;
+      integer         s;
+      integer         sum;
+      int             shift;
+      RadKey          k0;
+
+      memset ( count, 0, sizeof(count) );
+
+      for ( i = 0;  i < n;  i++ )
+      {
+         k0 = RADKEY( a[i] );
+
+         for ( b = 0;  b < NBYTE;  b++ )
+         {
+            count[b][ ( k0 >> (b*CHAR_BIT) ) & (NBKT-1) ]++;
+         }
+      }
+
+      k0 = RADKEY( a[0] );
+
+      for ( b = 0;  b < NBYTE;  b++ )
+      {
+         shift = b * CHAR_BIT;
+
+         /*
+         Skip a digit common to all elements.
+         */
+         if ( count[b][ ( k0 >> shift ) & (NBKT-1) ] == n )
+         {
+            continue;
+         }
+
+         sum = 0;
+
+         for ( i = 0;  i < NBKT;  i++ )
+         {
+            s            = count[b][i];
+            count[b][i]  = sum;
+            sum         += s;
+         }
+
+         for ( i = 0;  i < n;  i++ )
+         {
+            s = count[b][ ( RADKEY(a[i]) >> shift ) & (NBKT-1) ]++;
+
+            ta[s] = a[i];
+
+            if ( idx != NULL )
+            {
+               tidx[s] = idx[i];
+            }
+         }
+
+         t = a;    a   = ta;    ta   = t;
+         t = idx;  idx = tidx;  tidx = t;
+      }
+
+      *ridx = idx;
+
+      return a;
+   }
+
+
+   int zzsortd_ ( integer      * ndim,
+                  doublereal   * array )
+   {
+      if ( *ndim > 1 )
+      {
+         sortd ( array, *ndim, depthlim(*ndim), NULL );
+      }
+
+      return 0;
+   }
+
+
+   int zzsortp_ ( integer      * npair,
+                  doublereal   * pairs )
+   {
+      if ( *npair > 1 )
+      {
+         sortp ( (Interval *)pairs, *npair, depthlim(*npair), NULL );
+      }
+
+      return 0;
+   }
+
+
+   int zzsorti_ ( integer      * ndim,
+                  integer      * array )
+   {
+      integer       * r;
+      integer       * tmp;
+      integer       * unused;
+
+      if ( *ndim < 2 )
+      {
+         return 0;
+      }
+
+      tmp = NULL;
+
+      if ( *ndim >= RADMIN )
+      {
+         tmp = (integer *) malloc ( (size_t)(*ndim) * sizeof(integer) );
+      }
+
+      if ( tmp != NULL )
+      {
+         r = radixi ( array, NULL, *ndim, tmp, NULL, &unused );
+
+         if ( r != array )
+         {
+            memcpy ( array, r, (size_t)(*ndim) * sizeof(integer) );
+         }
+
+         free ( tmp );
+      }
+      else
+      {
+         sorti ( array, *ndim, depthlim(*ndim), NULL );
+      }
+
+      return 0;
+   }
+
+
+   int zzsortc_ ( integer      * ndim,
+                  char         * array,
+                  logical      * done,
+                  ftnlen         array_len )
+   {
+      CharKey         key;
+      char          * save;
+      char          * dst;
+      integer       * iorder;
+      integer         i;
+      integer         j;
+      integer         k;
+      size_t          len;
+
+      *done = SPICETRUE;
+
+      if ( *ndim < 2 )
+      {
+         return 0;
+      }
+
+      len    = (size_t) array_len;
+      iorder = (integer *) malloc ( (size_t)(*ndim) * sizeof(integer) );
+      save   = (char    *) malloc ( len + 1 );
+
+      if (  ( iorder == NULL )  ||  ( save == NULL )  )
+      {
+         free ( iorder );
+         free ( save   );
+
+         *done = SPICEFALSE;
+         return 0;
+      }
+
+      for ( i = 0;  i < *ndim;  i++ )
+      {
+         iorder[i] = i + 1;
+      }
+
+      key.array = array;
+      key.len   = array_len;
+
+      ordc ( iorder, *ndim, depthlim(*ndim), &key );
+
+      /*
+      Move the elements into place one cycle of the permutation at a
+      time.  Element I of the result is element IORDER(I) of the
+      input; IORDER(I) is set to I+1 once element I is in place.
+      */
+      for ( i = 0;  i < *ndim;  i++ )
+      {
+         if ( iorder[i] == i + 1 )
+         {
+            continue;
+         }
+
+         memcpy ( save, array + (size_t)i * len, len );
+
+         j = i;
+
+         while ( ( k = iorder[j] - 1 ) != i )
+         {
+            dst = array + (size_t)j * len;
+
+            memcpy ( dst, array + (size_t)k * len, len );
+
+            iorder[j] = j + 1;
+            j         = k;
+         }
+
+         memcpy ( array + (size_t)j * len, save, len );
+
+         iorder[j] = j + 1;
+      }
+
+      free ( iorder );
+      free ( save   );
+
+      return 0;
+   }
+
+
+   int zzordd_ ( doublereal   * array,
+                 integer      * ndim,
+                 integer      * iorder )
+   {
+      integer    i;
+
+      for ( i = 0;  i < *ndim;  i++ )
+      {
+         iorder[i] = i + 1;
+      }
+
+      if ( *ndim > 1 )
+      {
+         ordd ( iorder, *ndim, depthlim(*ndim), array );
+      }
+
+      return 0;
+   }
+
+
+   int zzordi_ ( integer      * array,
+                 integer      * ndim,
+                 integer      * iorder )
+   {
+      integer       * ridx;
+      integer       * work;
+      integer         i;
+      integer         n;
+
+      n = *ndim;
+
+      for ( i = 0;  i < n;  i++ )
+      {
+         iorder[i] = i + 1;
+      }
+
+      if ( n < 2 )
+      {
+         return 0;
+      }
+
+      work = NULL;
+
+      if ( n >= RADMIN )
+      {
+         work = (integer *) malloc ( (size_t)n * 3 * sizeof(integer) );
+      }
+
+      if ( work != NULL )
+      {
+         /*
+         Sort a copy of the array, carrying the order vector.  The
+         radix sort is stable, so equal elements keep the order of
+         their indices.
+         */
+         memcpy ( work, array, (size_t)n * sizeof(integer) );
+
+         radixi ( work, iorder, n, work + n, work + 2*n, &ridx );
+
+         if ( ridx != iorder )
+         {
+            memcpy ( iorder, ridx, (size_t)n * sizeof(integer) );
+         }
+
+         free ( work );
+      }
+      else
+      {
+         ordi ( iorder, n, depthlim(n), array );
+      }
+
+      return 0;
+   }
+
+
+   int zzordc_ ( char         * array,
+                 integer      * ndim,
+                 integer      * iorder,
+                 ftnlen         array_len )
+   {
+      CharKey    key;
+      integer    i;
+
+      for ( i = 0;  i < *ndim;  i++ )
+      {
+         iorder[i] = i + 1;
+      }
+
+      if ( *ndim > 1 )
+      {
+         key.array = array;
+         key.len   = array_len;
+
+         ordc ( iorder, *ndim, depthlim(*ndim), &key );
+      }
+
+      return 0;
+   }
@@ -26,7 +26,13 @@ static doublereal c_b9 = 1e-12;
 	    doublereal *), zztanini_(integer *, doublereal *, integer *, 
 	    integer *, integer *, integer *, integer *, doublereal *, 
 	    doublereal *, doublereal *);
-    extern /* Subroutine */ int zztansta_();
+    extern /* Subroutine */ int zztansta_(doublereal *, logical *, 
+	    doublereal *);
+    extern /* Subroutine */ int zztrkwin_(integer *, integer *, doublereal *,
+	     doublereal *, logical *, doublereal *, doublereal *), zztrksav_(
+	    integer *, integer *, doublereal *);
+    logical track, ststat, fnstat, lostat, histat;
+    doublereal lo, hi, pnt[3];
     integer i__;
     extern /* Subroutine */ int zztanslv_(U_fp, U_fp, U_fp, logical *, 
 	    doublereal *, doublereal *, doublereal *, doublereal *, 
@@ -618,6 +624,29 @@ static doublereal c_b9 = 1e-12;
 	}
     }
 
+/*     If tangent point tracking is enabled and the last search for */
+/*     the current cutting half-plane found tangent points, try */
+/*     searching only the angles near those points. The narrowed */
+/*     interval [LO, HI] is accepted only if the occultation states at */
+/*     its endpoints match those at START and FINISH. */
+
+    zztrkwin_(curve, trgcde, &start, &finish, &track, &lo, &hi);
+    if (track) {
+	zztansta_(&start, &ststat, pnt);
+	zztansta_(&finish, &fnstat, pnt);
+	zztansta_(&lo, &lostat, pnt);
+	zztansta_(&hi, &histat, pnt);
+	if (failed_()) {
+	    chkout_("ZZTANGNT", (ftnlen)8);
+	    return 0;
+	}
+	track = lostat == ststat && histat == fnstat;
+    }
+    if (track) {
+	start = lo;
+	finish = hi;
+    }
+
 /*     Search for ray occultations. The endpoints of the occultation */
 /*     intervals are angles at which tangency occurs. */
 
@@ -662,6 +691,10 @@ static doublereal c_b9 = 1e-12;
 	    scardd_(&i__1, result);
 	}
     }
+/*     Record the tangent angles for use by the next search for this */
+/*     cutting half-plane. */
+
+    zztrksav_(curve, trgcde, result);
     chkout_("ZZTANGNT", (ftnlen)8);
     return 0;
 } /* zztangnt_ */
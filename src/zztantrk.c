@@ -0,0 +1,414 @@
+/*
+
+-Procedure zztantrk ( Tangent point tracking, umbrella )
+
+-Abstract
+
+   SPICE Private routine intended solely for the support of SPICE
+   routines.  Users should not call this routine directly due
+   to the volatile nature of this routine.
+
+   Keep, for each cutting half-plane of a limb or terminator
+   computation, the range of tangent ray angles found by the most
+   recent search, and use it to narrow the next search for the same
+   half-plane.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   DSK
+
+-Keywords
+
+   GEOMETRY
+   PRIVATE
+
+-Brief_I/O
+
+   VARIABLE  I/O  ENTRY POINTS
+   --------  ---  --------------------------------------------------
+   enable     I   zztrkset_
+   margin     I   zztrkset_
+   cut        I   zztrkcut_
+   curve      I   zztrkwin_, zztrksav_
+   trgcde     I   zztrkwin_, zztrksav_
+   start      I   zztrkwin_
+   finish     I   zztrkwin_
+   track      O   zztrkwin_
+   lo         O   zztrkwin_
+   hi         O   zztrkwin_
+   result     I   zztrksav_
+
+-Detailed_Input
+
+   See the individual routines.
+
+-Detailed_Output
+
+   See the individual routines.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   None.  If memory for the tracking table cannot be allocated,
+   tracking is disabled and full searches are performed.
+
+-Files
+
+   None.
+
+-Particulars
+
+   ZZTANGNT finds the tangent rays in a cutting half-plane by stepping
+   the angle between a ray and the axis over the interval
+   [start, finish] and refining each change of the ray's occultation
+   state.  The cost of a search is proportional to the length of the
+   interval.  When limb or terminator points are computed at closely
+   spaced epochs, the tangent angles of a half-plane change little
+   from one epoch to the next.
+
+   When tracking is enabled by tngtrk_c, this umbrella records, for
+   each cut index, the smallest and largest tangent angles found by
+   the last search, together with the curve type and target.  The
+   next search for the same cut, curve type and target is confined to
+   that range widened by the tracking margin on each side.
+
+   ZZTANGNT accepts the narrowed interval only if the occultation
+   states at its endpoints equal those at `start' and `finish';
+   otherwise it performs the full search.  Changes of state lying
+   entirely outside of the narrowed interval, such as a distant peak
+   rising above the limb, are not detected; the margin must exceed
+   the angular motion of the tangent rays between epochs.
+
+      zztrkset_      Enable or disable tracking, clearing the table.
+      zztrkcut_      Set the index of the current cutting half-plane.
+      zztrkwin_      Return the search interval for the current cut.
+      zztrksav_      Record the tangent angles found for the current
+                     cut.
+
+-Examples
+
+   See tngtrk_c.
+
+-Restrictions
+
+   1) The table is indexed by cut index only.  The caller must keep
+      the reference vector, roll step and observer of a sequence of
+      tracked computations fixed, or call tngtrk_c to clear the
+      table when they change.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   track limb or terminator tangent points across epochs
+
+-&
+*/
+
+   #include <stdlib.h>
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+
+
+   /*
+   Tracking table entry.
+   */
+   typedef struct
+   {
+      integer          curve;
+      integer          trgcde;
+      logical          valid;
+      doublereal       lo;
+      doublereal       hi;
+
+   } TrackEntry;
+
+
+   /*
+   Static variables
+   */
+   static logical          svon   = 0;
+   static doublereal       svmarg = 0.0;
+   static integer          svcut  = 0;
+
+   static TrackEntry     * table  = 0;
+   static integer          tabsiz = 0;
+
+
+
+/*
+
+-Procedure zztrkset_ ( Enable or disable tangent point tracking )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   enable     I   Flag enabling tracking.
+   margin     I   Angular margin of narrowed search intervals.
+
+-Detailed_Input
+
+   enable      is .TRUE. to enable tracking and .FALSE. to disable
+               it.  The table is cleared in either case.
+
+   margin      is the angle, in radians, added on each side of the
+               range of tangent angles found by the previous search.
+
+-&
+*/
+
+   int zztrkset_ ( logical      * enable,
+                   doublereal   * margin )
+{
+   free ( table );
+
+   table  = 0;
+   tabsiz = 0;
+   svcut  = 0;
+   svon   = *enable;
+   svmarg = *margin;
+
+   return 0;
+}
+
+
+
+/*
+
+-Procedure zztrkcut_ ( Set current cut index )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   cut        I   Zero-based index of the current cutting half-plane.
+
+-&
+*/
+
+   int zztrkcut_ ( integer   * cut )
+{
+   svcut = *cut;
+
+   return 0;
+}
+
+
+
+/*
+
+-Procedure zztrkwin_ ( Return tracked search interval )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   curve      I   Curve type code used by ZZTANGNT.
+   trgcde     I   Target ID code.
+   start,
+   finish     I   Endpoints of the full search interval.
+   track      O   Flag indicating a narrowed interval was found.
+   lo,
+   hi         O   Endpoints of the narrowed interval.
+
+-Detailed_Output
+
+   track       is .TRUE. if tracking is enabled and the last search
+               for the current cut, for the same curve type and
+               target, found tangent angles.
+
+   lo,
+   hi          are the endpoints of the narrowed interval, contained
+               in [start, finish].  They are defined only if `track'
+               is .TRUE.
+
+-&
+*/
+
+   int zztrkwin_ ( integer      * curve,
+                   integer      * trgcde,
+                   doublereal   * start,
+                   doublereal   * finish,
+                   logical      * track,
+                   doublereal   * lo,
+                   doublereal   * hi     )
+{
+   TrackEntry            * ent;
+
+
+   *track = 0;
+
+   if (  !svon  ||  ( svcut < 0 )  ||  ( svcut >= tabsiz )  )
+   {
+      return 0;
+   }
+
+   ent = table + svcut;
+
+   if (     !ent->valid
+         || ( ent->curve  != *curve  )
+         || ( ent->trgcde != *trgcde )  )
+   {
+      return 0;
+   }
+
+   *lo = ent->lo - svmarg;
+   *hi = ent->hi + svmarg;
+
+   if ( *lo < *start )
+   {
+      *lo = *start;
+   }
+
+   if ( *hi > *finish )
+   {
+      *hi = *finish;
+   }
+
+   *track = ( *lo < *hi );
+
+   return 0;
+}
+
+
+
+/*
+
+-Procedure zztrksav_ ( Record tangent angles of current cut )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   curve      I   Curve type code used by ZZTANGNT.
+   trgcde     I   Target ID code.
+   result     I   Cell of tangent angles found by ZZTANGNT.
+
+-&
+*/
+
+   int zztrksav_ ( integer      * curve,
+                   integer      * trgcde,
+                   doublereal   * result )
+{
+   /*
+   Local variables
+   */
+   TrackEntry            * ent;
+   TrackEntry            * tmp;
+
+   integer                 i;
+   integer                 n;
+   integer                 newsiz;
+
+
+   if (  !svon  ||  ( svcut < 0 )  )
+   {
+      return 0;
+   }
+
+   /*
+   Grow the table to hold the current cut.
+   */
+   if ( svcut >= tabsiz )
+   {
+      newsiz = 2 * tabsiz;
+
+      if ( newsiz <= svcut )
+      {
+         newsiz = svcut + 1;
+      }
+
+      tmp = (TrackEntry *) realloc ( table,
+                                     (size_t)newsiz * sizeof(TrackEntry) );
+      if ( tmp == 0 )
+      {
+         free ( table );
+
+         table  = 0;
+         tabsiz = 0;
+         svon   = 0;
+
+         return 0;
+      }
+
+      for ( i = tabsiz;  i < newsiz;  i++ )
+      {
+         tmp[i].valid = 0;
+      }
+
+      table  = tmp;
+      tabsiz = newsiz;
+   }
+
+   ent = table + svcut;
+
+   n = cardd_ ( result );
+
+   ent->curve  = *curve;
+   ent->trgcde = *trgcde;
+   ent->valid  = ( n > 0 );
+
+   if ( n > 0 )
+   {
+      /*
+      The elements of the cell follow its control area.
+      */
+      ent->lo = result[6];
+      ent->hi = result[6];
+
+      for ( i = 1;  i < n;  i++ )
+      {
+         if ( result[6+i] < ent->lo )
+         {
+            ent->lo = result[6+i];
+         }
+
+         if ( result[6+i] > ent->hi )
+         {
+            ent->hi = result[6+i];
+         }
+      }
+   }
+
+   return 0;
+}
@@ -0,0 +1,505 @@
+/*
+
+-Procedure zzutcfst_c ( Fast parse of fixed-format UTC strings )
+
+-Abstract
+
+   CSPICE Private routine intended solely for the support of CSPICE
+   routines.  Users should not call this routine directly due
+   to the volatile nature of this routine.
+
+   Convert fixed-format ISO-8601 calendar and day-of-year UTC
+   strings to ephemeris time without invoking the general time
+   string parser.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   TIME
+
+-Keywords
+
+   PRIVATE
+   TIME
+
+-Brief_I/O
+
+   See the individual routines.
+
+-Detailed_Input
+
+   See the individual routines.
+
+-Detailed_Output
+
+   See the individual routines.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   The routines in this file do not signal errors.  Any string that
+   is not recognized, or any component that is out of the range
+   accepted without qualification by TCHECK, causes zzutcfst_c to
+   return with `found' set to SPICEFALSE.  The caller must then use
+   the general parser, which produces the appropriate diagnostics.
+
+-Files
+
+   A leapseconds kernel must be loaded.
+
+-Particulars
+
+   Routines coded in this file:
+
+      zzutcrdy_c     Indicate whether the fast path may be used.
+      zzutcfst_c     Convert a fixed-format UTC string to ET.
+
+   The strings accepted by zzutcfst_c are
+
+      YYYY-MM-DD
+      YYYY-MM-DDThh
+      YYYY-MM-DDThh:mm
+      YYYY-MM-DDThh:mm:ss
+      YYYY-MM-DDThh:mm:ss.fff...
+      YYYY-DDDThh...
+      YYYY-DDD//hh...
+      YYYY-DDD::hh...
+
+   where the time of day may take any of the forms shown for the
+   calendar case.  In the calendar format, the "T" may also be
+   replaced by one or more blanks.  Leading and trailing blanks are
+   ignored.  Every field has exactly the number of digits shown, and
+   the year must be in the range 1000-9999.
+
+   Such strings are interpreted by STR2ET as UTC calendar or day of
+   year representations on the Gregorian calendar, unless the time
+   system or calendar defaults have been changed via TIMDEF.  When
+   that has happened, zzutcrdy_c returns SPICEFALSE and the general
+   parser must be used.
+
+   The conversion from the parsed time vector to ET uses the
+   buffered tables maintained by zzlsktab_c and produces results
+   identical to those of STR2ET.  The fractional seconds component is
+   parsed with NPARSD, as in the general parser.  Seconds values of
+   60 or greater (leapseconds) are left to the general parser.
+
+-Examples
+
+   See str2et_c.
+
+-Restrictions
+
+   1) This is a CSPICE private routine.  The interface may be changed
+      without notice, so these routines should not be called except
+      by other CSPICE routines.
+
+   2) zzutcfst_c may be called only after zzutcrdy_c has returned
+      SPICETRUE, and no kernel pool or TIMDEF changes have been made
+      since.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   Nabla Zero Labs
+
+-Version
+
+   -CSPICE Version 1.0.0, 18-OCT-2026 (NZL)
+
+-Index_Entries
+
+   fast parse of ISO time strings
+
+-&
+*/
+
+   #include <string.h>
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+
+
+   /*
+   Local parameters
+   */
+   #define  DEFLEN         16
+   #define  ERRLEN         80
+
+   /*
+   Local macros
+   */
+   #define  ISDIG(c)       ( ( (c) >= '0' ) && ( (c) <= '9' ) )
+   #define  DIG(c)         ( (SpiceInt)( (c) - '0' ) )
+
+
+
+
+/*
+
+-Procedure zzutcrdy_c ( Fast UTC path ready? )
+
+-Brief_I/O
+
+   The function returns SPICETRUE if zzutcfst_c may be used.
+
+-Detailed_Output
+
+   The function returns SPICETRUE if the TIMDEF defaults are the
+   standard ones (UTC time system, no time zone, Gregorian calendar)
+   and the buffered leapseconds data are available.
+
+-&
+*/
+
+   SpiceBoolean zzutcrdy_c ( void )
+{
+   /*
+   Local variables
+   */
+   SpiceChar               calndr [DEFLEN];
+   SpiceChar               defsys [DEFLEN];
+   SpiceChar               defzon [DEFLEN];
+
+
+   timdef_ ( "GET", "SYSTEM",   defsys, 3, 6, DEFLEN );
+   timdef_ ( "GET", "ZONE",     defzon, 3, 4, DEFLEN );
+   timdef_ ( "GET", "CALENDAR", calndr, 3, 8, DEFLEN );
+
+   if (    strncmp ( defsys, "UTC ",       4 )
+        || ( defzon[0] != ' ' )
+        || strncmp ( calndr, "GREGORIAN ", 10 )  )
+   {
+      return ( SPICEFALSE );
+   }
+
+   return ( zzlskok_c() );
+}
+
+
+
+
+/*
+
+-Procedure zzutcfst_c ( Fast parse of fixed-format UTC string )
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   str        I   Candidate UTC time string.
+   et         O   Equivalent TDB seconds past J2000.
+   found      O   Flag indicating whether `str' was converted.
+
+-Detailed_Input
+
+   str        is a null-terminated time string.
+
+-Detailed_Output
+
+   et         is the ephemeris time corresponding to `str', if `str'
+              has one of the formats accepted by this routine.
+              Otherwise `et' is not modified.
+
+   found      is SPICETRUE if `str' was converted and SPICEFALSE
+              otherwise.
+
+-&
+*/
+
+   void zzutcfst_c ( ConstSpiceChar  * str,
+                     SpiceDouble     * et,
+                     SpiceBoolean    * found )
+{
+   /*
+   Local variables
+   */
+   static ConstSpiceInt    dpjan0 [12] =
+                           { 0,31,59,90,120,151,181,212,243,273,304,334 };
+
+   static ConstSpiceInt    dpm    [12] =
+                           { 31,28,31,30,31,30,31,31,30,31,30,31 };
+
+   ConstSpiceChar        * beg;
+   ConstSpiceChar        * end;
+   ConstSpiceChar        * p;
+   ConstSpiceChar        * secbeg;
+
+   SpiceBoolean            doy;
+   SpiceBoolean            leap;
+
+   SpiceChar               error  [ERRLEN];
+
+   SpiceDouble             secs;
+   SpiceDouble             sec;
+
+   SpiceInt                day;
+   SpiceInt                daynum;
+   SpiceInt                hour;
+   SpiceInt                minute;
+   SpiceInt                month;
+   SpiceInt                year;
+   SpiceInt                yr1;
+
+   doublereal              dpval;
+
+   integer                 ptr;
+
+
+   *found = SPICEFALSE;
+
+   /*
+   Trim leading and trailing blanks.
+   */
+   beg = str;
+
+   while ( *beg == ' ' )
+   {
+      ++beg;
+   }
+
+   end = beg + strlen(beg);
+
+   while (  ( end > beg ) && ( *(end-1) == ' ' )  )
+   {
+      --end;
+   }
+
+   /*
+   The shortest accepted string is YYYY-MM-DD.
+   */
+   if ( end - beg < 10 )
+   {
+      return;
+   }
+
+   p = beg;
+
+   if (    !ISDIG(p[0]) || !ISDIG(p[1]) || !ISDIG(p[2]) || !ISDIG(p[3])
+        || ( p[0] == '0' ) || ( p[4] != '-' )                         )
+   {
+      return;
+   }
+
+   year  = 1000*DIG(p[0]) + 100*DIG(p[1]) + 10*DIG(p[2]) + DIG(p[3]);
+   p    += 5;
+
+   leap  =    ( ( year % 4 ) == 0 )
+           && (    ( ( year % 100 ) != 0 )
+                || ( ( year % 400 ) == 0 ) );
+
+   if ( !ISDIG(p[0]) || !ISDIG(p[1]) )
+   {
+      return;
+   }
+
+   if ( ISDIG(p[2]) )
+   {
+      /*
+      Day of year format.
+      */
+      doy   = SPICETRUE;
+      month = 1;
+      day   = 100*DIG(p[0]) + 10*DIG(p[1]) + DIG(p[2]);
+      p    += 3;
+
+      if (  ( day < 1 ) || ( day > ( leap ? 366 : 365 ) )  )
+      {
+         return;
+      }
+   }
+   else
+   {
+      /*
+      Calendar format.
+      */
+      doy   = SPICEFALSE;
+      month = 10*DIG(p[0]) + DIG(p[1]);
+
+      if (    ( p[2] != '-' ) || !ISDIG(p[3]) || !ISDIG(p[4])
+           || ( month < 1   ) || ( month > 12 )               )
+      {
+         return;
+      }
+
+      day = 10*DIG(p[3]) + DIG(p[4]);
+      p  += 5;
+
+      if (    ( day < 1 )
+           || ( day > dpm[month-1] + ( (leap && (month == 2)) ? 1 : 0 ) ) )
+      {
+         return;
+      }
+   }
+
+   /*
+   Date/time separator.
+   */
+   hour   = 0;
+   minute = 0;
+   sec    = 0.0;
+
+   if ( p == end )
+   {
+      if ( doy )
+      {
+         return;
+      }
+   }
+   else
+   {
+      if ( *p == 'T' )
+      {
+         ++p;
+      }
+      else if (  doy  &&  ( end - p > 2 )
+                      &&  (    ( ( p[0] == '/' ) && ( p[1] == '/' ) )
+                            || ( ( p[0] == ':' ) && ( p[1] == ':' ) ) )  )
+      {
+         p += 2;
+      }
+      else if (  !doy  &&  ( *p == ' ' )  )
+      {
+         while ( *p == ' ' )
+         {
+            ++p;
+         }
+      }
+      else
+      {
+         return;
+      }
+
+      /*
+      Hours are required; minutes and seconds are optional.
+      */
+      if (  ( end - p < 2 ) || !ISDIG(p[0]) || !ISDIG(p[1])  )
+      {
+         return;
+      }
+
+      hour = 10*DIG(p[0]) + DIG(p[1]);
+      p   += 2;
+
+      if ( p < end )
+      {
+         if (    ( end - p < 3 ) || ( p[0] != ':' )
+              || !ISDIG(p[1])    || !ISDIG(p[2])   )
+         {
+            return;
+         }
+
+         minute = 10*DIG(p[1]) + DIG(p[2]);
+         p     += 3;
+      }
+
+      if ( p < end )
+      {
+         if (    ( end - p < 3 ) || ( p[0] != ':' )
+              || !ISDIG(p[1])    || !ISDIG(p[2])   )
+         {
+            return;
+         }
+
+         secbeg = p + 1;
+         sec    = (SpiceDouble)( 10*DIG(p[1]) + DIG(p[2]) );
+         p     += 3;
+
+         if ( p < end )
+         {
+            /*
+            A fractional part must consist of a decimal point
+            followed by at least one digit and nothing else.
+            */
+            if (  ( *p != '.' ) || ( end - p < 2 )  )
+            {
+               return;
+            }
+
+            ++p;
+
+            while (  ( p < end ) && ISDIG(*p)  )
+            {
+               ++p;
+            }
+
+            if ( p != end )
+            {
+               return;
+            }
+
+            nparsd_ ( ( char       * ) secbeg,
+                      ( doublereal * ) &dpval,
+                      ( char       * ) error,
+                      ( integer    * ) &ptr,
+                      ( ftnlen       ) ( end - secbeg ),
+                      ( ftnlen       ) ERRLEN           );
+
+            if ( ptr != 0 )
+            {
+               return;
+            }
+
+            sec = (SpiceDouble) dpval;
+         }
+      }
+
+      if (  ( hour > 23 ) || ( minute > 59 ) || ( sec >= 60.0 )  )
+      {
+         return;
+      }
+   }
+
+   /*
+   Compute the day number relative to 1 January 1 A.D. and the
+   seconds past the start of the day, as TTRANS does.
+   */
+   yr1    = year - 1;
+
+   daynum =   yr1*365 + yr1/4 - yr1/100 + yr1/400
+            + dpjan0[month-1]
+            + ( ( leap && ( month > 2 ) ) ? 1 : 0 )
+            + day - 1;
+
+   secs   = (SpiceDouble)hour * 3600.0 + (SpiceDouble)minute * 60.0 + sec;
+
+   /*
+   Seconds in the last second of the day are normalized by TTRANS
+   through a round trip to TAI; leave those to the general parser.
+   */
+   if ( secs > 86399.0 )
+   {
+      return;
+   }
+
+   *et    = zztaitdb_c ( zzutctai_c ( daynum, secs ) );
+   *found = SPICETRUE;
+}